@@ -75,6 +75,9 @@ if(CMAKE_SYSTEM_NAME MATCHES "Linux|Darwin")
 if(OQS_DIST_X86_64_BUILD OR OQS_USE_AVX2_INSTRUCTIONS)
     cmake_dependent_option(OQS_ENABLE_SHA3_xkcp_low_avx2 "" ON "NOT OQS_USE_SHA3_OPENSSL" OFF)
 endif()
+if(OQS_DIST_X86_64_BUILD OR (OQS_USE_AVX2_INSTRUCTIONS AND OQS_USE_AVX512_INSTRUCTIONS))
+    cmake_dependent_option(OQS_ENABLE_SHA3_xkcp_low_avx512 "" ON "NOT OQS_USE_SHA3_OPENSSL" OFF)
+endif()
 endif()
 
 # BIKE is not supported on Windows, 32-bit ARM, X86, S390X (big endian) and PPC64 (big endian)
@@ -729,6 +732,10 @@ else()
     set(OQS_ALLOW_LMS_KEY_AND_SIG_GEN OFF)
 endif()
 
+cmake_dependent_option(OQS_XMSS_USE_PTHREADS "Compute XMSS and XMSS^MT key generation leaves on worker threads" OFF "OQS_ALLOW_XMSS_KEY_AND_SIG_GEN;OQS_USE_PTHREADS" OFF)
+cmake_dependent_option(OQS_LMS_USE_PTHREADS "Use the pthread thread pool for LMS key generation and signing" OFF "OQS_ALLOW_LMS_KEY_AND_SIG_GEN;OQS_USE_PTHREADS" OFF)
+cmake_dependent_option(OQS_SPHINCS_USE_PTHREADS "Compute the trees of SPHINCS+ signatures on worker threads" ON "OQS_ENABLE_SIG_SPHINCS;OQS_USE_PTHREADS" OFF)
+
 if(OQS_ALLOW_STFL_KEY_AND_SIG_GEN  STREQUAL "ON")
     message(STATUS "Experimental stateful key and signature generation is enabled. Ensure secret keys are securely stored to prevent multiple simultaneous sign operations.")
 endif()
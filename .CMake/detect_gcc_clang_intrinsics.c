@@ -51,6 +51,12 @@ int main(void) {
 #if defined(__SSE3__)
 	printf("SSE3;");
 #endif
+#if defined(__SHA__) && defined(__SSE4_1__)
+	printf("SHA;");
+#endif
+#if defined(__VAES__)
+	printf("VAES;");
+#endif
 #if defined(__ARM_FEATURE_AES)
 	printf("ARM_AES;");
 #endif
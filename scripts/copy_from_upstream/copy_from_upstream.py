@@ -372,6 +372,19 @@ def load_instructions(file='copy_from_upstream.yml'):
             scheme['pqclean_scheme_c'] = scheme['pqclean_scheme'].replace('-', '')
             scheme['scheme_c'] = scheme['scheme'].replace('-', '')
             scheme['default_implementation'] = family['default_implementation']
+            if (not 'api_extensions' in scheme) and 'api_extensions' in family:
+                scheme['api_extensions'] = family['api_extensions']
+            # Scheme parameters of those entry points, as they would appear in META.yml
+            scheme['metadata'].update(family.get('metadata_extensions', {}))
+            scheme['metadata'].update(scheme.get('metadata_extensions', {}))
+            # Entry points added by our patches to upstreams whose META.yml does not
+            # list them; they are named like the keypair function of each implementation
+            for op in scheme.get('api_extensions', []):
+                for impl in scheme['metadata']['implementations']:
+                    if not 'signature_' + op in impl:
+                        keypair = impl.get('signature_keypair', 'PQCLEAN_{}_{}_crypto_sign_keypair'.format(
+                            scheme['pqclean_scheme_c'].upper(), impl['name'].upper()))
+                        impl['signature_' + op] = keypair[:-len('keypair')] + op
             for impl in scheme['metadata']['implementations']:
                 if 'common_dep' in impl:
                     cdeps_names = impl['common_dep'].split(" ")
@@ -4,17 +4,42 @@
 #define OQS_KEM_{{ family|upper }}_H
 
 #include <oqs/oqs.h>
+{# Optional entry points, see kem_scheme.c #}
+{%- set kem_ops = [
+    {'m': 'encaps_batch', 'k': 'enc_batch', 'fb': 'enc_derand', 'p': 'size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys'},
+    {'m': 'decaps_batch', 'k': 'dec_batch', 'fb': 'dec', 'p': 'size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys'},
+    {'m': 'prepare_public_key', 'k': 'expand_pk', 'p': 'uint8_t *prepared_public_key, const uint8_t *public_key'},
+    {'m': 'encaps_prepared', 'k': 'enc_expanded', 'p': 'uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key'},
+    {'m': 'prepare_secret_key', 'k': 'expand_sk', 'p': 'uint8_t *prepared_secret_key, const uint8_t *secret_key'},
+    {'m': 'decaps_prepared', 'k': 'dec_expanded', 'p': 'uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key'},
+    {'m': 'keypair_derand', 'k': 'keypair_derand', 'p': 'uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed'},
+    {'m': 'encaps_derand', 'k': 'enc_derand', 'p': 'uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed'},
+] -%}
 
+{%- macro offered(scheme, op) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if default_impl['signature_' ~ op['k']] -%}
+default
+{%- elif op['fb'] and (op['fb'] == 'dec' or default_impl['signature_' ~ op['fb']]) and scheme['metadata']['implementations'] | selectattr('signature_' ~ op['k']) | list -%}
+fallback
+{%- endif -%}
+{%- endmacro %}
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_public_key {{ scheme['metadata']['length-public-key'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_secret_key {{ scheme['metadata']['length-secret-key'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_ciphertext {{ scheme['metadata']['length-ciphertext'] }}
 #define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_shared_secret {{ scheme['metadata']['length-shared-secret'] }}
+{%- for length in ['prepared_public_key', 'prepared_secret_key', 'keypair_seed', 'encaps_seed'] if 'length-' ~ length|replace('_', '-') in scheme['metadata'] %}
+#define OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_{{ length }} {{ scheme['metadata']['length-' ~ length|replace('_', '-')] }}
+{%- endfor %}
 OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new(void);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+{%- for op in kem_ops if offered(scheme, op) %}
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ op['m'] }}({{ op['p'] }});
+{%- endfor %}
 {% if 'alias_scheme' in scheme %}
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_public_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_public_key
 #define OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_length_secret_key OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_length_secret_key
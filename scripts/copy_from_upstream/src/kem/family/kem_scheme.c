@@ -3,12 +3,219 @@
 #include <stdlib.h>
 
 #include <oqs/kem_{{ family }}.h>
+{# Optional entry points, in the order of their OQS_KEM members. 'k' names the META
+    implementation key holding the upstream symbol, 'x' its prototype and 'a' the
+    arguments passed to it. 'l' names the length member set just before the entry
+    point, and 'fb' the upstream call that a generic loop over the default
+    implementation uses when only the optimized implementations provide the entry
+    point. keypair, encaps and decaps take the default PQClean symbol names. #}
+{%- set kem_ops = [
+    {'m': 'keypair', 'k': 'keypair', 'd': 'crypto_kem_keypair', 'p': 'uint8_t *public_key, uint8_t *secret_key', 'a': 'public_key, secret_key'},
+    {'m': 'encaps', 'k': 'enc', 'd': 'crypto_kem_enc', 'p': 'uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key', 'a': 'ciphertext, shared_secret, public_key'},
+    {'m': 'decaps', 'k': 'dec', 'd': 'crypto_kem_dec', 'p': 'uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key', 'a': 'shared_secret, ciphertext, secret_key'},
+    {'m': 'encaps_batch', 'k': 'enc_batch', 'fb': 'enc_derand', 'p': 'size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys', 'x': 'uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count', 'a': 'ciphertexts, shared_secrets, public_keys, count'},
+    {'m': 'decaps_batch', 'k': 'dec_batch', 'fb': 'dec', 'p': 'size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys', 'x': 'uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count', 'a': 'shared_secrets, ciphertexts, secret_keys, count'},
+    {'m': 'prepare_public_key', 'k': 'expand_pk', 'l': 'prepared_public_key', 'p': 'uint8_t *prepared_public_key, const uint8_t *public_key', 'x': 'uint8_t *epk, const uint8_t *pk', 'a': 'prepared_public_key, public_key'},
+    {'m': 'encaps_prepared', 'k': 'enc_expanded', 'p': 'uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key', 'x': 'uint8_t *ct, uint8_t *ss, const uint8_t *epk', 'a': 'ciphertext, shared_secret, prepared_public_key'},
+    {'m': 'prepare_secret_key', 'k': 'expand_sk', 'l': 'prepared_secret_key', 'p': 'uint8_t *prepared_secret_key, const uint8_t *secret_key', 'x': 'uint8_t *esk, const uint8_t *sk', 'a': 'prepared_secret_key, secret_key'},
+    {'m': 'decaps_prepared', 'k': 'dec_expanded', 'p': 'uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key', 'x': 'uint8_t *ss, const uint8_t *ct, const uint8_t *esk', 'a': 'shared_secret, ciphertext, prepared_secret_key'},
+    {'m': 'keypair_derand', 'k': 'keypair_derand', 'l': 'keypair_seed', 'p': 'uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed', 'x': 'uint8_t *pk, uint8_t *sk, const uint8_t *coins', 'a': 'public_key, secret_key, seed'},
+    {'m': 'encaps_derand', 'k': 'enc_derand', 'l': 'encaps_seed', 'p': 'uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed', 'x': 'uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins', 'a': 'ciphertext, shared_secret, public_key, seed'},
+] -%}
+
+{%- macro impl_fn(scheme, impl, op) -%}
+{%- if impl['signature_' ~ op['k']] -%}
+{{ impl['signature_' ~ op['k']] }}
+{%- else -%}
+PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_{{ op['d'] }}
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro cpu_check(impl) -%}
+{%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro arg_names(params) -%}
+{%- for param in params.split(', ') -%}{{ param.split(' ')[-1].lstrip('*') }}{%- if not loop.last %}, {% endif -%}{%- endfor -%}
+{%- endmacro -%}
+
+{#- Implementations selected at run time in distributable builds #}
+{%- macro bind_impls(scheme) -%}
+{%- if not (libjade_implementation is defined and scheme['libjade_implementation']) -%}
+{%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] and impl['required_flags'] -%}
+{%- if loop.first %}defined(OQS_DIST_BUILD) && {% if loop.length > 1 %}({% endif %}{% endif -%}
+defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}){%- if not loop.last %} || {% elif loop.length > 1 %}){% endif -%}
+{%- endfor -%}
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro offered(scheme, op) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if op['d'] or default_impl['signature_' ~ op['k']] -%}
+default
+{%- elif op['fb'] and (op['fb'] == 'dec' or default_impl['signature_' ~ op['fb']]) and scheme['metadata']['implementations'] | selectattr('signature_' ~ op['k']) | list -%}
+fallback
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro new_externs(scheme, impl) -%}
+{%- for op in kem_ops if not op['d'] and impl['signature_' ~ op['k']] %}
+extern int {{ impl['signature_' ~ op['k']] }}({{ op['x'] }});
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro new_members(scheme, name) -%}
+{%- for op in kem_ops if not op['d'] %}
+{%- if op['l'] %}
+	kem->length_{{ op['l'] }} = {% if 'length-' ~ op['l']|replace('_', '-') in scheme['metadata'] %}OQS_KEM_{{ family }}_{{ name }}_length_{{ op['l'] }}{% else %}0{% endif %};
+{%- endif %}
+	kem->{{ op['m'] }} = {% if offered(scheme, op) %}OQS_KEM_{{ family }}_{{ name }}_{{ op['m'] }}{% else %}NULL{% endif %};
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro default_call(scheme, op) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if offered(scheme, op) == 'fallback' -%}
+return {{ family }}_{{ scheme['scheme'] }}_{{ scheme['default_implementation'] }}_{{ op['m'] }}({{ arg_names(op['p']) }});
+{%- else -%}
+return (OQS_STATUS) {{ impl_fn(scheme, default_impl, op) }}({{ op['a'] }});
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro dispatcher(scheme, op) %}
+
+OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ op['m'] }}({{ op['p'] }}) {
+    {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] and impl['signature_' ~ op['k']] %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }})
+    {%- if impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({{ cpu_check(impl) }}) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) {{ impl_fn(scheme, impl, op) }}({{ op['a'] }});
+#if defined(OQS_DIST_BUILD)
+	} else {
+		{{ default_call(scheme, op) }}
+	}
+#endif /* OQS_DIST_BUILD */
+    {%- else %}
+	return (OQS_STATUS) {{ impl_fn(scheme, impl, op) }}({{ op['a'] }});
+    {%- endif %}
+    {%- if loop.last %}
+#else
+    {%- endif %}
+    {%- endfor %}
+	{{ default_call(scheme, op) }}
+    {%- if scheme['metadata']['implementations'] | rejectattr('name', 'equalto', scheme['default_implementation']) | selectattr('signature_' ~ op['k']) | list %}
+#endif
+    {%- endif %}
+}
+{%- endmacro -%}
+
+{%- macro trampolines(scheme, impl) -%}
+{%- for op in kem_ops if (op['d'] or impl['signature_' ~ op['k']]) and offered(scheme, op) -%}
+{%- if not loop.first %}
+
+{% endif -%}
+static OQS_STATUS {{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}_{{ op['m'] }}({{ op['p'] }}) {
+	return (OQS_STATUS) {{ impl_fn(scheme, impl, op) }}({{ op['a'] }});
+}
+{%- endfor -%}
+{%- endmacro -%}
+
 
+{%- macro bind_impl(scheme) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- set impls = scheme['metadata']['implementations'] | rejectattr('name', 'equalto', scheme['default_implementation']) | selectattr('required_flags') | list %}
+
+#if {{ bind_impls(scheme) }}
+/* Implementation-specific entry points, bound by OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new once per object. */
+{%- for impl in impls %}
+{%- if impls | length > 1 %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }})
+{%- endif %}
+{{ trampolines(scheme, impl) }}
+{%- endfor %}
+{%- if impls | length > 1 %}
+#endif
+{%- endif %}
+
+{{ trampolines(scheme, default_impl) }}
+
+static void {{ family }}_{{ scheme['scheme'] }}_bind_impl(OQS_KEM *kem) {
+{%- for impl in impls %}
+{%- if impls | length > 1 %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }})
+{%- endif %}
+	if ({{ cpu_check(impl) }}) {
+{%- for op in kem_ops if (op['d'] or impl['signature_' ~ op['k']]) and offered(scheme, op) %}
+		kem->{{ op['m'] }} = {{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}_{{ op['m'] }};
+{%- endfor %}
+		return;
+	}
+{%- endfor %}
+{%- if impls | length > 1 %}
+#endif
+{%- endif %}
+{%- for op in kem_ops if offered(scheme, op) %}
+	kem->{{ op['m'] }} = {{ family }}_{{ scheme['scheme'] }}_{{ scheme['default_implementation'] }}_{{ op['m'] }};
+{%- endfor %}
+}
+#endif
+{%- endmacro -%}
+
+{#- Generic loops over the default implementation for the batch entry points #}
+{%- macro fallbacks(scheme) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- set name = 'OQS_KEM_' ~ family ~ '_' ~ scheme['scheme'] -%}
+{%- for op in kem_ops if offered(scheme, op) == 'fallback' %}
+{%- set impls = scheme['metadata']['implementations'] | rejectattr('name', 'equalto', scheme['default_implementation']) | selectattr('signature_' ~ op['k']) | list %}
+
+#if {% if impls | length > 1 %}!({% else %}!{% endif %}{% for impl in impls %}defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}){% if not loop.last %} || {% endif %}{% endfor %}{% if impls | length > 1 %}){% endif %} || defined(OQS_DIST_BUILD)
+{%- if op['m'] == 'encaps_batch' %}
+#define {{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS 8
+
+/* Draws the encapsulation seeds for up to {{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS entries with one OQS_randombytes call */
+static OQS_STATUS {{ family }}_{{ scheme['scheme'] }}_{{ scheme['default_implementation'] }}_encaps_batch({{ op['p'] }}) {
+	uint8_t seeds[{{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS * {{ name }}_length_encaps_seed];
+	OQS_STATUS rc = OQS_SUCCESS;
+
+	for (size_t i = 0; i < count && rc == OQS_SUCCESS; i++) {
+		size_t j = i % {{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS;
+		if (j == 0) {
+			size_t n = count - i < {{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS ? count - i : {{ family|upper }}_{{ scheme['scheme']|upper }}_BATCH_SEEDS;
+			OQS_randombytes(seeds, n * {{ name }}_length_encaps_seed);
+		}
+		if ({{ default_impl['signature_' ~ op['fb']] }}(ciphertexts + i * {{ name }}_length_ciphertext, shared_secrets + i * {{ name }}_length_shared_secret, public_keys + i * {{ name }}_length_public_key, seeds + j * {{ name }}_length_encaps_seed) != 0) {
+			rc = OQS_ERROR;
+		}
+	}
+	OQS_MEM_cleanse(seeds, sizeof(seeds));
+	return rc;
+}
+{%- elif op['m'] == 'decaps_batch' %}
+static OQS_STATUS {{ family }}_{{ scheme['scheme'] }}_{{ scheme['default_implementation'] }}_decaps_batch({{ op['p'] }}) {
+	for (size_t i = 0; i < count; i++) {
+		if ({{ impl_fn(scheme, default_impl, kem_ops[2]) }}(shared_secrets + i * {{ name }}_length_shared_secret, ciphertexts + i * {{ name }}_length_ciphertext, secret_keys + i * {{ name }}_length_secret_key) != 0) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+{%- endif %}
+#endif
+{%- endfor -%}
+{%- endmacro %}
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 {% if 'alias_scheme' in scheme %}
 #if defined(OQS_ENABLE_KEM_{{ family }}_{{ scheme['scheme'] }})
 {% endif %}
+{% if bind_impls(scheme) -%}
+#if {{ bind_impls(scheme) }}
+static void {{ family }}_{{ scheme['scheme'] }}_bind_impl(OQS_KEM *kem);
+#endif
+
+{% endif -%}
 OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 
 	OQS_KEM *kem = OQS_MEM_malloc(sizeof(OQS_KEM));
@@ -29,6 +236,13 @@ OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 	kem->keypair = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_keypair;
 	kem->encaps = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_encaps;
 	kem->decaps = OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps;
+	{{- new_members(scheme, scheme['scheme']) }}
+{%- if bind_impls(scheme) %}
+
+#if {{ bind_impls(scheme) }}
+	{{ family }}_{{ scheme['scheme'] }}_bind_impl(kem);
+#endif
+{%- endif %}
 
 	return kem;
 }
@@ -60,6 +274,7 @@ OQS_KEM *OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_new(void) {
 	kem->keypair = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_keypair;
 	kem->encaps = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_encaps;
 	kem->decaps = OQS_KEM_{{ family }}_{{ scheme['alias_scheme'] }}_decaps;
+	{{- new_members(scheme, scheme['alias_scheme']) }}
 
 	return kem;
 }
@@ -89,6 +304,7 @@ extern int {{ scheme['metadata']['default_enc_signature'] }}(uint8_t *ct, uint8_
            {%- set cleandec = scheme['metadata'].update({'default_dec_signature': "PQCLEAN_"+scheme['pqclean_scheme_c']|upper+"_"+scheme['default_implementation']|upper+"_crypto_kem_dec"}) -%}
         {%- endif %}
 extern int {{ scheme['metadata']['default_dec_signature']  }}(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+{{- new_externs(scheme, impl) }}
 
     {%- endfor %}
 
@@ -112,6 +328,7 @@ extern int {{ impl['signature_dec'] }}(uint8_t *ss, const uint8_t *ct, const uin
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
         {%- endif %}
+{{- new_externs(scheme, impl) }}
 #endif
     {%- endfor %}
 
@@ -349,6 +566,13 @@ OQS_API OQS_STATUS OQS_KEM_{{ family }}_{{ scheme['scheme'] }}_decaps(uint8_t *s
 #endif /* OQS_LIBJADE_BUILD */
 {%- endif %}
 }
+{{- fallbacks(scheme) }}
+{%- for op in kem_ops if not op['d'] and offered(scheme, op) %}
+{{- dispatcher(scheme, op) }}
+{%- endfor %}
+{%- if bind_impls(scheme) %}
+{{- bind_impl(scheme) }}
+{%- endif %}
 
 #endif
 {% endfor -%}
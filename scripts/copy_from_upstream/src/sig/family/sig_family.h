@@ -4,13 +4,72 @@
 #define OQS_SIG_{{ family|upper }}_H
 
 #include <oqs/oqs.h>
+{#- Optional entry points are declared for the schemes whose default
+    implementation provides them, see sig_scheme.c #}
+{%- macro offered(scheme, op) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if default_impl['signature_' ~ op['k']] -%}
+default
+{%- endif -%}
+{%- endmacro %}
 
 {% for scheme in schemes -%}
 {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{#- Optional entry points, in the order of their OQS_SIG members; the table is
+    filled in per scheme since the upstream calling conventions
+    depend on the scheme metadata:
+    - api-with-context-string: the upstream functions take the context string,
+      otherwise a non-empty context string is rejected;
+    - length-stream-state: the upstream streaming functions keep an opaque state
+      of this size, otherwise the state is an OQS_SHA3_shake256_stack_ctx;
+    - stream-nonce-bytes: the message is hashed together with a nonce of this
+      size, kept next to the SHAKE state until the signature is written; the
+      initialization functions then take neither key;
+    - stream-verify-init-with-signature: the upstream verify_init function
+      takes the signature.
+    'k' names the META implementation key holding the upstream symbol, 'x' its
+    prototype, 'a' the arguments passed to it and 'pre' the statements run
+    before the call. 'l' names the length member set just before the entry
+    point. The entry points with 'd' take the default PQClean symbol names. #}
+{%- set ctx = default_impl['api-with-context-string'] -%}
+{%- set nonce = scheme['metadata']['stream-nonce-bytes'] -%}
+{%- set state_type = 'void' if 'length-stream-state' in scheme['metadata'] else 'OQS_SHA3_shake256_stack_ctx' -%}
+{%- set state = '&s->shake' if nonce else ('state' if 'length-stream-state' in scheme['metadata'] else '(OQS_SHA3_shake256_stack_ctx *) state') -%}
+{%- set check = '' if ctx else '\n\tif (ctx_str != NULL || ctx_str_len != 0) {\n\t\treturn OQS_ERROR;\n\t}' -%}
+{%- set bind_state = '\n\tstruct ' ~ family ~ '_' ~ scheme['scheme'] ~ '_stream_state *s = state;' if nonce else '' -%}
+{%- set sig_ops = [
+    {'m': 'keypair', 'k': 'keypair', 'd': 'crypto_sign_keypair', 'p': 'uint8_t *public_key, uint8_t *secret_key', 'a': 'public_key, secret_key'},
+    {'m': 'keypair_from_fseed', 'k': 'keypair_from_fseed', 'd': 'crypto_sign_keypair_from_fseed', 'p': 'uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed', 'a': 'public_key, secret_key, seed'},
+    {'m': 'pubkey_from_privkey', 'k': 'pubkey_from_privkey', 'd': 'crypto_sign_pubkey_from_privkey', 'p': 'uint8_t *public_key, const uint8_t *secret_key', 'a': 'public_key, secret_key'},
+    {'m': 'sign', 'k': 'signature', 'd': 'crypto_sign_signature', 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key', 'a': 'signature, signature_len, message, message_len, ' ~ ('NULL, 0, ' if ctx else '') ~ 'secret_key'},
+    {'m': 'verify', 'k': 'verify', 'd': 'crypto_sign_verify', 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'a': 'signature, signature_len, message, message_len, ' ~ ('NULL, 0, ' if ctx else '') ~ 'public_key'},
+    {'m': 'sign_with_ctx_str', 'k': 'signature', 'd': 'crypto_sign_signature', 'ctx': true, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'a': 'signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key'},
+    {'m': 'verify_with_ctx_str', 'k': 'verify', 'd': 'crypto_sign_verify', 'ctx': true, 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'a': 'signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key'},
+    {'m': 'prepare_secret_key', 'k': 'expand_privkey', 'l': 'prepared_secret_key', 'p': 'uint8_t *prepared_secret_key, const uint8_t *secret_key', 'x': 'uint8_t *esk, const uint8_t *sk', 'a': 'prepared_secret_key, secret_key'},
+    {'m': 'sign_prepared', 'k': 'signature_expanded', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *esk', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_secret_key'},
+    {'m': 'sign_prepared_threaded', 'k': 'signature_expanded_threaded', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *esk, unsigned int num_threads', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_secret_key, num_threads'},
+    {'m': 'prepare_public_key', 'k': 'expand_pubkey', 'l': 'prepared_public_key', 'p': 'uint8_t *prepared_public_key, const uint8_t *public_key', 'x': 'uint8_t *epk, const uint8_t *pk', 'a': 'prepared_public_key, public_key'},
+    {'m': 'verify_prepared', 'k': 'verify_expanded', 'pre': check, 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *epk', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_public_key'},
+    {'m': 'sign_init', 'k': 'signature_init', 'l': 'stream_state', 'pre': bind_state ~ ('\n\t(void) secret_key;' if nonce else '') ~ check, 'p': 'void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'x': state_type ~ ' *state, ' ~ ('uint8_t *nonce' if nonce else ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *sk'), 'a': state ~ ', ' ~ ('s->nonce' if nonce else ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'secret_key')},
+    {'m': 'sign_final', 'k': 'signature_final', 'pre': bind_state, 'p': 'void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, ' ~ ('const uint8_t *nonce, ' if nonce else '') ~ state_type ~ ' *state, const uint8_t *sk', 'a': 'signature, signature_len, ' ~ ('s->nonce, ' if nonce else '') ~ state ~ ', secret_key'},
+    {'m': 'verify_init', 'k': 'verify_init', 'pre': bind_state ~ ('\n\t(void) public_key;' if nonce else ('' if scheme['metadata']['stream-verify-init-with-signature'] else '\n\t(void) signature;\n\t(void) signature_len;')) ~ check, 'p': 'void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': state_type ~ ' *state, ' ~ ('const uint8_t *sig, size_t siglen' ~ ('' if nonce else ', const uint8_t *pk') if scheme['metadata']['stream-verify-init-with-signature'] else ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk'), 'a': state ~ ', ' ~ ('signature, signature_len' ~ ('' if nonce else ', public_key') if scheme['metadata']['stream-verify-init-with-signature'] else ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key')},
+    {'m': 'verify_final', 'k': 'verify_final', 'pre': bind_state, 'p': 'void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, ' ~ state_type ~ ' *state, const uint8_t *pk', 'a': 'signature, signature_len, ' ~ state ~ ', public_key'},
+    {'m': 'stream_update', 'k': 'verify_update', 'void': true, 'p': 'void *state, const uint8_t *chunk, size_t chunk_len', 'x': 'void *state, const uint8_t *m, size_t mlen', 'a': 'state, chunk, chunk_len'},
+    {'m': 'stream_release', 'k': 'verify_release', 'void': true, 'p': 'void *state', 'x': 'void *state', 'a': 'state'},
+    {'m': 'compute_mu', 'k': 'compute_mu', 'l': 'mu', 'pre': check, 'p': 'uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': 'uint8_t *mu, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk', 'a': 'mu, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key'},
+    {'m': 'sign_mu', 'k': 'signature_extmu', 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *mu, const uint8_t *sk', 'a': 'signature, signature_len, mu, secret_key'},
+    {'m': 'verify_mu', 'k': 'verify_extmu', 'p': 'const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *mu, const uint8_t *pk', 'a': 'signature, signature_len, mu, public_key'},
+    {'m': 'sign_prehash', 'k': 'signature_prehash', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *sk', 'a': 'signature, signature_len, digest, digest_len, digest_oid, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'secret_key'},
+    {'m': 'verify_prehash', 'k': 'verify_prehash', 'pre': check, 'p': 'const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk', 'a': 'signature, signature_len, digest, digest_len, digest_oid, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key'},
+] -%}
+{%- if not ctx %}{% set sig_ops = sig_ops | rejectattr('ctx') | list %}{% endif -%}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key {{ scheme['metadata']['length-public-key'] }}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key {{ scheme['metadata']['length-secret-key'] }}
 #define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_signature {{ scheme['metadata']['length-signature'] }}
+{%- for length in ['prepared_secret_key', 'prepared_public_key', 'stream_state', 'mu'] if 'length-' ~ length|replace('_', '-') in scheme['metadata'] %}
+#define OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_{{ length }} {{ scheme['metadata']['length-' ~ length|replace('_', '-')] }}
+{%- endfor %}
 
 OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new(void);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -20,6 +79,9 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign(uint8_t *sig
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+{%- for op in sig_ops if not op['d'] and offered(scheme, op) %}
+OQS_API {% if op['void'] %}void{% else %}OQS_STATUS{% endif %} OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ op['m'] }}({{ op['p'] }});
+{%- endfor %}
 {% if 'alias_scheme' in scheme %}
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_public_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_public_key
 #define OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_length_secret_key OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_length_secret_key
@@ -3,6 +3,147 @@
 #include <stdlib.h>
 
 #include <oqs/sig_{{ family }}.h>
+{%- for scheme in schemes if 'length-stream-state' not in scheme['metadata'] and (scheme['metadata']['implementations'] | selectattr('name', 'equalto', scheme['default_implementation']) | first) | select('in', ['signature_signature_init', 'signature_verify_init']) | list %}{% if loop.first %}
+#include <oqs/sha3.h>{% endif %}{% endfor %}
+{#- Shared by the entry points of the scheme table filled in below #}
+{%- macro impl_fn(scheme, impl, op) -%}
+{%- if impl['signature_' ~ op['k']] -%}
+{{ impl['signature_' ~ op['k']] }}
+{%- else -%}
+PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_{{ op['d'] }}
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro cpu_check(impl) -%}
+{%- for flag in impl['required_flags'] -%}OQS_CPU_has_extension(OQS_CPU_EXT_{{ flag|upper }}){%- if not loop.last %} && {% endif -%}{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro call(scheme, impl, op) -%}
+{%- if op['void'] -%}
+{{ impl_fn(scheme, impl, op) }}({{ op['a'] }});
+{%- else -%}
+return (OQS_STATUS) {{ impl_fn(scheme, impl, op) }}({{ op['a'] }});
+{%- endif -%}
+{%- endmacro -%}
+
+{#- Implementations selected at run time in distributable builds #}
+{%- macro bind_impls(scheme) -%}
+{%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] and impl['required_flags'] -%}
+{%- if loop.first %}defined(OQS_DIST_BUILD) && {% if loop.length > 1 %}({% endif %}{% endif -%}
+defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}){%- if not loop.last %} || {% elif loop.length > 1 %}){% endif -%}
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro offered(scheme, op) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if op['d'] or default_impl['signature_' ~ op['k']] -%}
+default
+{%- endif -%}
+{%- endmacro -%}
+
+{%- macro streamed(sig_ops, scheme) -%}
+{%- for op in sig_ops if op['m'] in ['sign_init', 'verify_init'] and offered(scheme, op) %}{% if loop.first %}yes{% endif %}{% endfor -%}
+{%- endmacro -%}
+
+{%- macro new_externs(sig_ops, impl) -%}
+{%- for op in sig_ops if not op['d'] and impl['signature_' ~ op['k']] %}
+extern {% if op['void'] %}void{% else %}int{% endif %} {{ impl['signature_' ~ op['k']] }}({{ op['x'] }});
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro new_members(sig_ops, scheme, name) -%}
+{%- for op in sig_ops if not op['d'] %}
+{%- if op['l'] == 'stream_state' and 'length-stream-state' not in scheme['metadata'] and streamed(sig_ops, scheme) %}
+	sig->length_stream_state = sizeof({% if scheme['metadata']['stream-nonce-bytes'] %}struct {{ family }}_{{ scheme['scheme'] }}_stream_state{% else %}OQS_SHA3_shake256_stack_ctx{% endif %});
+{%- elif op['l'] %}
+	sig->length_{{ op['l'] }} = {% if 'length-' ~ op['l']|replace('_', '-') in scheme['metadata'] %}OQS_SIG_{{ family }}_{{ name }}_length_{{ op['l'] }}{% else %}0{% endif %};
+{%- endif %}
+	sig->{{ op['m'] }} = {% if offered(scheme, op) %}OQS_SIG_{{ family }}_{{ name }}_{{ op['m'] }}{% else %}NULL{% endif %};
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro dispatcher(scheme, op) %}
+
+OQS_API {% if op['void'] %}void{% else %}OQS_STATUS{% endif %} OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ op['m'] }}({{ op['p'] }}) {
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- if op['pre'] %}{{ op['pre'] }}{% endif %}
+    {%- for impl in scheme['metadata']['implementations'] if impl['name'] != scheme['default_implementation'] and impl['signature_' ~ op['k']] %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_{{ impl['name'] }}){%- endif %}
+    {%- if impl['required_flags'] %}
+#if defined(OQS_DIST_BUILD)
+	if ({{ cpu_check(impl) }}) {
+#endif /* OQS_DIST_BUILD */
+		{{ call(scheme, impl, op) }}
+#if defined(OQS_DIST_BUILD)
+	} else {
+		{{ call(scheme, default_impl, op) }}
+	}
+#endif /* OQS_DIST_BUILD */
+    {%- else %}
+	{{ call(scheme, impl, op) }}
+    {%- endif %}
+    {%- if loop.last %}
+#else
+    {%- endif %}
+    {%- endfor %}
+	{{ call(scheme, default_impl, op) }}
+    {%- if scheme['metadata']['implementations'] | rejectattr('name', 'equalto', scheme['default_implementation']) | selectattr('signature_' ~ op['k']) | list %}
+#endif
+    {%- endif %}
+}
+{%- endmacro -%}
+
+{%- macro trampolines(sig_ops, scheme, impl) -%}
+{%- for op in sig_ops if (op['d'] or impl['signature_' ~ op['k']]) and offered(scheme, op) -%}
+{%- if not loop.first %}
+
+{% endif -%}
+static {% if op['void'] %}void{% else %}OQS_STATUS{% endif %} {{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}_{{ op['m'] }}({{ op['p'] }}) {
+{%- if op['pre'] %}{{ op['pre'] }}{% endif %}
+	{{ call(scheme, impl, op) }}
+}
+{%- endfor -%}
+{%- endmacro -%}
+
+{%- macro bind_impl(sig_ops, scheme) -%}
+{%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{%- set impls = scheme['metadata']['implementations'] | rejectattr('name', 'equalto', scheme['default_implementation']) | selectattr('required_flags') | list %}
+
+#if {{ bind_impls(scheme) }}
+/* Implementation-specific entry points, bound by OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new once per object. */
+{%- for impl in impls %}
+{%- if impls | length > 1 %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }})
+{%- endif %}
+{{ trampolines(sig_ops, scheme, impl) }}
+{%- endfor %}
+{%- if impls | length > 1 %}
+#endif
+{%- endif %}
+
+{{ trampolines(sig_ops, scheme, default_impl) }}
+
+static void {{ family }}_{{ scheme['scheme'] }}_bind_impl(OQS_SIG *sig) {
+{%- for impl in impls %}
+{%- if impls | length > 1 %}
+#{% if loop.first %}if{% else %}elif{% endif %} defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }})
+{%- endif %}
+	if ({{ cpu_check(impl) }}) {
+{%- for op in sig_ops if (op['d'] or impl['signature_' ~ op['k']]) and offered(scheme, op) %}
+		sig->{{ op['m'] }} = {{ family }}_{{ scheme['scheme'] }}_{{ impl['name'] }}_{{ op['m'] }};
+{%- endfor %}
+		return;
+	}
+{%- endfor %}
+{%- if impls | length > 1 %}
+#endif
+{%- endif %}
+{%- for op in sig_ops if offered(scheme, op) %}
+	sig->{{ op['m'] }} = {{ family }}_{{ scheme['scheme'] }}_{{ scheme['default_implementation'] }}_{{ op['m'] }};
+{%- endfor %}
+}
+#endif
+{%- endmacro %}
 
 {% for scheme in schemes -%}
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }}) {%- if 'alias_scheme' in scheme %} || defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['alias_scheme'] }}){%- endif %}
@@ -10,6 +151,68 @@
 #if defined(OQS_ENABLE_SIG_{{ family }}_{{ scheme['scheme'] }})
 {% endif %}
 {%- set default_impl = scheme['metadata']['implementations'] | selectattr("name", "equalto", scheme['default_implementation']) | first -%}
+{#- Optional entry points, in the order of their OQS_SIG members; the table is
+    filled in per scheme since the upstream calling conventions
+    depend on the scheme metadata:
+    - api-with-context-string: the upstream functions take the context string,
+      otherwise a non-empty context string is rejected;
+    - length-stream-state: the upstream streaming functions keep an opaque state
+      of this size, otherwise the state is an OQS_SHA3_shake256_stack_ctx;
+    - stream-nonce-bytes: the message is hashed together with a nonce of this
+      size, kept next to the SHAKE state until the signature is written; the
+      initialization functions then take neither key;
+    - stream-verify-init-with-signature: the upstream verify_init function
+      takes the signature.
+    'k' names the META implementation key holding the upstream symbol, 'x' its
+    prototype, 'a' the arguments passed to it and 'pre' the statements run
+    before the call. 'l' names the length member set just before the entry
+    point. The entry points with 'd' take the default PQClean symbol names. #}
+{%- set ctx = default_impl['api-with-context-string'] -%}
+{%- set nonce = scheme['metadata']['stream-nonce-bytes'] -%}
+{%- set state_type = 'void' if 'length-stream-state' in scheme['metadata'] else 'OQS_SHA3_shake256_stack_ctx' -%}
+{%- set state = '&s->shake' if nonce else ('state' if 'length-stream-state' in scheme['metadata'] else '(OQS_SHA3_shake256_stack_ctx *) state') -%}
+{%- set check = '' if ctx else '\n\tif (ctx_str != NULL || ctx_str_len != 0) {\n\t\treturn OQS_ERROR;\n\t}' -%}
+{%- set bind_state = '\n\tstruct ' ~ family ~ '_' ~ scheme['scheme'] ~ '_stream_state *s = state;' if nonce else '' -%}
+{%- set sig_ops = [
+    {'m': 'keypair', 'k': 'keypair', 'd': 'crypto_sign_keypair', 'p': 'uint8_t *public_key, uint8_t *secret_key', 'a': 'public_key, secret_key'},
+    {'m': 'keypair_from_fseed', 'k': 'keypair_from_fseed', 'd': 'crypto_sign_keypair_from_fseed', 'p': 'uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed', 'a': 'public_key, secret_key, seed'},
+    {'m': 'pubkey_from_privkey', 'k': 'pubkey_from_privkey', 'd': 'crypto_sign_pubkey_from_privkey', 'p': 'uint8_t *public_key, const uint8_t *secret_key', 'a': 'public_key, secret_key'},
+    {'m': 'sign', 'k': 'signature', 'd': 'crypto_sign_signature', 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key', 'a': 'signature, signature_len, message, message_len, ' ~ ('NULL, 0, ' if ctx else '') ~ 'secret_key'},
+    {'m': 'verify', 'k': 'verify', 'd': 'crypto_sign_verify', 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'a': 'signature, signature_len, message, message_len, ' ~ ('NULL, 0, ' if ctx else '') ~ 'public_key'},
+    {'m': 'sign_with_ctx_str', 'k': 'signature', 'd': 'crypto_sign_signature', 'ctx': true, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'a': 'signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key'},
+    {'m': 'verify_with_ctx_str', 'k': 'verify', 'd': 'crypto_sign_verify', 'ctx': true, 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'a': 'signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key'},
+    {'m': 'prepare_secret_key', 'k': 'expand_privkey', 'l': 'prepared_secret_key', 'p': 'uint8_t *prepared_secret_key, const uint8_t *secret_key', 'x': 'uint8_t *esk, const uint8_t *sk', 'a': 'prepared_secret_key, secret_key'},
+    {'m': 'sign_prepared', 'k': 'signature_expanded', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *esk', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_secret_key'},
+    {'m': 'sign_prepared_threaded', 'k': 'signature_expanded_threaded', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *esk, unsigned int num_threads', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_secret_key, num_threads'},
+    {'m': 'prepare_public_key', 'k': 'expand_pubkey', 'l': 'prepared_public_key', 'p': 'uint8_t *prepared_public_key, const uint8_t *public_key', 'x': 'uint8_t *epk, const uint8_t *pk', 'a': 'prepared_public_key, public_key'},
+    {'m': 'verify_prepared', 'k': 'verify_expanded', 'pre': check, 'p': 'const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *epk', 'a': 'signature, signature_len, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'prepared_public_key'},
+    {'m': 'sign_init', 'k': 'signature_init', 'l': 'stream_state', 'pre': bind_state ~ ('\n\t(void) secret_key;' if nonce else '') ~ check, 'p': 'void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'x': state_type ~ ' *state, ' ~ ('uint8_t *nonce' if nonce else ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *sk'), 'a': state ~ ', ' ~ ('s->nonce' if nonce else ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'secret_key')},
+    {'m': 'sign_final', 'k': 'signature_final', 'pre': bind_state, 'p': 'void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, ' ~ ('const uint8_t *nonce, ' if nonce else '') ~ state_type ~ ' *state, const uint8_t *sk', 'a': 'signature, signature_len, ' ~ ('s->nonce, ' if nonce else '') ~ state ~ ', secret_key'},
+    {'m': 'verify_init', 'k': 'verify_init', 'pre': bind_state ~ ('\n\t(void) public_key;' if nonce else ('' if scheme['metadata']['stream-verify-init-with-signature'] else '\n\t(void) signature;\n\t(void) signature_len;')) ~ check, 'p': 'void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': state_type ~ ' *state, ' ~ ('const uint8_t *sig, size_t siglen' ~ ('' if nonce else ', const uint8_t *pk') if scheme['metadata']['stream-verify-init-with-signature'] else ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk'), 'a': state ~ ', ' ~ ('signature, signature_len' ~ ('' if nonce else ', public_key') if scheme['metadata']['stream-verify-init-with-signature'] else ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key')},
+    {'m': 'verify_final', 'k': 'verify_final', 'pre': bind_state, 'p': 'void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, ' ~ state_type ~ ' *state, const uint8_t *pk', 'a': 'signature, signature_len, ' ~ state ~ ', public_key'},
+    {'m': 'stream_update', 'k': 'verify_update', 'void': true, 'p': 'void *state, const uint8_t *chunk, size_t chunk_len', 'x': 'void *state, const uint8_t *m, size_t mlen', 'a': 'state, chunk, chunk_len'},
+    {'m': 'stream_release', 'k': 'verify_release', 'void': true, 'p': 'void *state', 'x': 'void *state', 'a': 'state'},
+    {'m': 'compute_mu', 'k': 'compute_mu', 'l': 'mu', 'pre': check, 'p': 'uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': 'uint8_t *mu, const uint8_t *m, size_t mlen, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk', 'a': 'mu, message, message_len, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key'},
+    {'m': 'sign_mu', 'k': 'signature_extmu', 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *mu, const uint8_t *sk', 'a': 'signature, signature_len, mu, secret_key'},
+    {'m': 'verify_mu', 'k': 'verify_extmu', 'p': 'const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *mu, const uint8_t *pk', 'a': 'signature, signature_len, mu, public_key'},
+    {'m': 'sign_prehash', 'k': 'signature_prehash', 'pre': check, 'p': 'uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key', 'x': 'uint8_t *sig, size_t *siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *sk', 'a': 'signature, signature_len, digest, digest_len, digest_oid, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'secret_key'},
+    {'m': 'verify_prehash', 'k': 'verify_prehash', 'pre': check, 'p': 'const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key', 'x': 'const uint8_t *sig, size_t siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, ' ~ ('const uint8_t *ctx, size_t ctxlen, ' if ctx else '') ~ 'const uint8_t *pk', 'a': 'signature, signature_len, digest, digest_len, digest_oid, ' ~ ('ctx_str, ctx_str_len, ' if ctx else '') ~ 'public_key'},
+] -%}
+{%- if not ctx %}{% set sig_ops = sig_ops | rejectattr('ctx') | list %}{% endif -%}
+{% if nonce -%}
+/* The message is hashed together with the nonce, which is kept until the signature is written. */
+struct {{ family }}_{{ scheme['scheme'] }}_stream_state {
+	OQS_SHA3_shake256_stack_ctx shake;
+	uint8_t nonce[{{ nonce }}];
+};
+
+{% endif -%}
+{% if bind_impls(scheme) -%}
+#if {{ bind_impls(scheme) }}
+static void {{ family }}_{{ scheme['scheme'] }}_bind_impl(OQS_SIG *sig);
+#endif
+
+{% endif -%}
 OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -38,6 +241,13 @@ OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_new(void) {
 	sig->verify = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify;
 	sig->sign_with_ctx_str = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_str;
+	{{- new_members(sig_ops, scheme, scheme['scheme']) }}
+{%- if bind_impls(scheme) %}
+
+#if {{ bind_impls(scheme) }}
+	{{ family }}_{{ scheme['scheme'] }}_bind_impl(sig);
+#endif
+{%- endif %}
 
 	return sig;
 }
@@ -77,6 +287,7 @@ OQS_SIG *OQS_SIG_{{ family }}_{{ scheme['alias_scheme'] }}_new(void) {
     sig->sign_with_ctx_str = NULL
 	sig->verify_with_ctx_str = NULL;
     {%- endif %}
+	{{- new_members(sig_ops, scheme, scheme['scheme']) }}
 
 	return sig;
 }
@@ -128,6 +339,7 @@ extern int {{ scheme['metadata']['default_verify_signature']  }}(const uint8_t *
 {%- else %}
 extern int {{ scheme['metadata']['default_verify_signature']  }}(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
 {%- endif %}
+{{- new_externs(sig_ops, impl) }}
 
     {%- endfor %}
 
@@ -171,6 +383,7 @@ extern int {{ impl['signature_verify'] }}(const uint8_t *sig, size_t siglen, con
         {%- else %}
 extern int PQCLEAN_{{ scheme['pqclean_scheme_c']|upper }}_{{ impl['name']|upper }}_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
         {%- endif %}
+{{- new_externs(sig_ops, impl) }}
 #endif
     {%- endfor %}
 
@@ -459,5 +672,11 @@ OQS_API OQS_STATUS OQS_SIG_{{ family }}_{{ scheme['scheme'] }}_verify_with_ctx_s
 	}
 }
 {%- endif %}
+{%- for op in sig_ops if not op['d'] and offered(scheme, op) %}
+{{- dispatcher(scheme, op) }}
+{%- endfor %}
+{%- if bind_impls(scheme) %}
+{{- bind_impl(sig_ops, scheme) }}
+{% endif %}
 #endif
 {% endfor -%}
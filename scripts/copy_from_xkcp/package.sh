@@ -92,6 +92,13 @@ unifdef -k -m \
   -DKeccakP1600times4_useAVX2 \
   {} \;
 
+# The AVX-512 implementations are maintained in liboqs, not taken from XKCP
+for D in KeccakP-1600/avx512 KeccakP-1600times8/avx512
+do
+  mkdir -p "${BUILD_XKCP}/${D}"
+  cp -Lp "${BASE}/../../src/common/sha3/xkcp_low/${D}/"* "${BUILD_XKCP}/${D}"
+done
+
 cp "${BASE}/CMakeLists.txt" "${BUILD_XKCP}/CMakeLists.txt"
 
 # Apply liboqs formatting 
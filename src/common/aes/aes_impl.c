@@ -38,6 +38,30 @@
     stmt_c
 #endif
 
+/* Picks the widest VAES kernel for the bulk ECB/CTR functions; only used in
+ * the AES-NI branch of C_OR_NI_OR_ARM, so VAES implies AES-NI here. */
+#if defined(OQS_DIST_X86_64_BUILD)
+#define NI_OR_VAES(stmt_ni, stmt_vaes_avx2, stmt_vaes_avx512) \
+   do { \
+      if (OQS_CPU_has_extension(OQS_CPU_EXT_VAES) && OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) { \
+          stmt_vaes_avx512; \
+      } else if (OQS_CPU_has_extension(OQS_CPU_EXT_VAES) && OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) { \
+          stmt_vaes_avx2; \
+      } else { \
+          stmt_ni; \
+      } \
+   } while(0)
+#elif defined(OQS_USE_VAES_INSTRUCTIONS) && defined(OQS_USE_AVX512_INSTRUCTIONS)
+#define NI_OR_VAES(stmt_ni, stmt_vaes_avx2, stmt_vaes_avx512) \
+    stmt_vaes_avx512
+#elif defined(OQS_USE_VAES_INSTRUCTIONS) && defined(OQS_USE_AVX2_INSTRUCTIONS)
+#define NI_OR_VAES(stmt_ni, stmt_vaes_avx2, stmt_vaes_avx512) \
+    stmt_vaes_avx2
+#else
+#define NI_OR_VAES(stmt_ni, stmt_vaes_avx2, stmt_vaes_avx512) \
+    stmt_ni
+#endif
+
 static void AES128_ECB_load_schedule(const uint8_t *key, void **_schedule) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes128_load_schedule_c(key, _schedule),
@@ -122,7 +146,11 @@ static void AES128_ECB_enc(const uint8_t *plaintext, const size_t plaintext_len,
 static void AES128_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes128_ecb_enc_sch_c(plaintext, plaintext_len, schedule, ciphertext),
-	    oqs_aes128_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	    NI_OR_VAES(
+	        oqs_aes128_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	        oqs_aes128_ecb_enc_sch_vaes_avx2(plaintext, plaintext_len, schedule, ciphertext),
+	        oqs_aes128_ecb_enc_sch_vaes_avx512(plaintext, plaintext_len, schedule, ciphertext)
+	    ),
 	    oqs_aes128_ecb_enc_sch_armv8(plaintext, plaintext_len, schedule, ciphertext)
 	);
 }
@@ -130,7 +158,11 @@ static void AES128_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_
 static void AES128_CTR_inc_stream_iv(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes128_ctr_enc_sch_c(iv, iv_len, schedule, out, out_len),
-	    oqs_aes128_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	    NI_OR_VAES(
+	        oqs_aes128_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	        oqs_aes128_ctr_enc_sch_vaes_avx2(iv, iv_len, schedule, out, out_len),
+	        oqs_aes128_ctr_enc_sch_vaes_avx512(iv, iv_len, schedule, out, out_len)
+	    ),
 	    oqs_aes128_ctr_enc_sch_armv8(iv, iv_len, schedule, out, out_len)
 	);
 }
@@ -147,7 +179,11 @@ static void AES256_ECB_enc(const uint8_t *plaintext, const size_t plaintext_len,
 static void AES256_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes256_ecb_enc_sch_c(plaintext, plaintext_len, schedule, ciphertext),
-	    oqs_aes256_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	    NI_OR_VAES(
+	        oqs_aes256_ecb_enc_sch_ni(plaintext, plaintext_len, schedule, ciphertext),
+	        oqs_aes256_ecb_enc_sch_vaes_avx2(plaintext, plaintext_len, schedule, ciphertext),
+	        oqs_aes256_ecb_enc_sch_vaes_avx512(plaintext, plaintext_len, schedule, ciphertext)
+	    ),
 	    oqs_aes256_ecb_enc_sch_armv8(plaintext, plaintext_len, schedule, ciphertext)
 	);
 }
@@ -155,7 +191,11 @@ static void AES256_ECB_enc_sch(const uint8_t *plaintext, const size_t plaintext_
 static void AES256_CTR_inc_stream_iv(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes256_ctr_enc_sch_c(iv, iv_len, schedule, out, out_len),
-	    oqs_aes256_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	    NI_OR_VAES(
+	        oqs_aes256_ctr_enc_sch_ni(iv, iv_len, schedule, out, out_len),
+	        oqs_aes256_ctr_enc_sch_vaes_avx2(iv, iv_len, schedule, out, out_len),
+	        oqs_aes256_ctr_enc_sch_vaes_avx512(iv, iv_len, schedule, out, out_len)
+	    ),
 	    oqs_aes256_ctr_enc_sch_armv8(iv, iv_len, schedule, out, out_len)
 	);
 }
@@ -163,7 +203,11 @@ static void AES256_CTR_inc_stream_iv(const uint8_t *iv, const size_t iv_len, con
 static void AES256_CTR_inc_stream_blks(void *schedule, uint8_t *out, size_t out_blks) {
 	C_OR_NI_OR_ARM(
 	    oqs_aes256_ctr_enc_sch_upd_blks_c(schedule, out, out_blks),
-	    oqs_aes256_ctr_enc_sch_upd_blks_ni(schedule, out, out_blks),
+	    NI_OR_VAES(
+	        oqs_aes256_ctr_enc_sch_upd_blks_ni(schedule, out, out_blks),
+	        oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx2(schedule, out, out_blks),
+	        oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx512(schedule, out, out_blks)
+	    ),
 	    oqs_aes256_ctr_enc_sch_upd_blks_armv8(schedule, out, out_blks)
 	);
 }
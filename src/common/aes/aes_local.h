@@ -11,6 +11,11 @@ void oqs_aes128_ecb_enc_sch_ni(const uint8_t *plaintext, const size_t plaintext_
 void oqs_aes128_ctr_enc_sch_ni(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
 void oqs_aes128_ctr_enc_sch_upd_blks_ni(void *schedule, uint8_t *out, size_t out_len);
 
+void oqs_aes128_ecb_enc_sch_vaes_avx2(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext);
+void oqs_aes128_ctr_enc_sch_vaes_avx2(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
+void oqs_aes128_ecb_enc_sch_vaes_avx512(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext);
+void oqs_aes128_ctr_enc_sch_vaes_avx512(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
+
 void oqs_aes128_load_schedule_c(const uint8_t *key, void **_schedule);
 void oqs_aes128_load_iv_c(const uint8_t *iv, size_t iv_len, void *_schedule);
 void oqs_aes128_load_iv_u64_c(uint64_t iv, void *_schedule);
@@ -36,6 +41,13 @@ void oqs_aes256_ecb_enc_sch_ni(const uint8_t *plaintext, const size_t plaintext_
 void oqs_aes256_ctr_enc_sch_ni(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
 void oqs_aes256_ctr_enc_sch_upd_blks_ni(void *schedule, uint8_t *out, size_t out_len);
 
+void oqs_aes256_ecb_enc_sch_vaes_avx2(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext);
+void oqs_aes256_ctr_enc_sch_vaes_avx2(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
+void oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx2(void *schedule, uint8_t *out, size_t out_blks);
+void oqs_aes256_ecb_enc_sch_vaes_avx512(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext);
+void oqs_aes256_ctr_enc_sch_vaes_avx512(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len);
+void oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx512(void *schedule, uint8_t *out, size_t out_blks);
+
 void oqs_aes256_load_schedule_c(const uint8_t *key, void **_schedule);
 void oqs_aes256_load_iv_c(const uint8_t *iv, size_t iv_len, void *_schedule);
 void oqs_aes256_load_iv_u64_c(uint64_t iv, void *_schedule);
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+// AES-128/256 ECB and CTR using VAES on 256-bit registers, for CPUs that
+// have VAES but not AVX-512: every aesenc instruction processes two blocks,
+// and four registers are interleaved so that 8 blocks are in flight per
+// round. The key schedules are the ones built by aes128_ni.c and
+// aes256_ni.c; tails shorter than one register are handed back to the
+// AES-NI code.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "aes_local.h"
+
+/* Same layout as the contexts in aes128_ni.c and aes256_ni.c */
+typedef struct {
+	__m128i sk_exp[11];
+	__m128i iv;
+} aes128ctx;
+
+typedef struct {
+	__m128i sk_exp[15];
+	__m128i iv;
+} aes256ctx;
+
+/* Swaps the big-endian 64-bit counter in the upper half of a block into a
+ * native integer, and back. */
+#define CTR_SWAP_MASK _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0)
+
+static inline void vaes256_load_rkeys(const __m128i *sk_exp, unsigned int nr, __m256i *rkeys) {
+	for (unsigned int i = 0; i <= nr; i++) {
+		rkeys[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128(&sk_exp[i]));
+	}
+}
+
+static inline void vaes256_encrypt_x8(const __m256i *rkeys, unsigned int nr, __m256i *b0, __m256i *b1, __m256i *b2, __m256i *b3) {
+	__m256i t0 = _mm256_xor_si256(*b0, rkeys[0]);
+	__m256i t1 = _mm256_xor_si256(*b1, rkeys[0]);
+	__m256i t2 = _mm256_xor_si256(*b2, rkeys[0]);
+	__m256i t3 = _mm256_xor_si256(*b3, rkeys[0]);
+	for (unsigned int r = 1; r < nr; r++) {
+		t0 = _mm256_aesenc_epi128(t0, rkeys[r]);
+		t1 = _mm256_aesenc_epi128(t1, rkeys[r]);
+		t2 = _mm256_aesenc_epi128(t2, rkeys[r]);
+		t3 = _mm256_aesenc_epi128(t3, rkeys[r]);
+	}
+	*b0 = _mm256_aesenclast_epi128(t0, rkeys[nr]);
+	*b1 = _mm256_aesenclast_epi128(t1, rkeys[nr]);
+	*b2 = _mm256_aesenclast_epi128(t2, rkeys[nr]);
+	*b3 = _mm256_aesenclast_epi128(t3, rkeys[nr]);
+}
+
+static inline __m256i vaes256_encrypt_x2(const __m256i *rkeys, unsigned int nr, __m256i b) {
+	b = _mm256_xor_si256(b, rkeys[0]);
+	for (unsigned int r = 1; r < nr; r++) {
+		b = _mm256_aesenc_epi128(b, rkeys[r]);
+	}
+	return _mm256_aesenclast_epi128(b, rkeys[nr]);
+}
+
+/* Encrypts the longest prefix of whole 32-byte chunks, returns its length */
+static inline size_t vaes256_ecb(const uint8_t *in, size_t len, const __m128i *sk_exp, unsigned int nr, uint8_t *out) {
+	__m256i rkeys[15];
+	size_t done = 0;
+
+	vaes256_load_rkeys(sk_exp, nr, rkeys);
+	for (; len - done >= 128; done += 128) {
+		__m256i b0 = _mm256_loadu_si256((const __m256i *)(in + done));
+		__m256i b1 = _mm256_loadu_si256((const __m256i *)(in + done + 32));
+		__m256i b2 = _mm256_loadu_si256((const __m256i *)(in + done + 64));
+		__m256i b3 = _mm256_loadu_si256((const __m256i *)(in + done + 96));
+		vaes256_encrypt_x8(rkeys, nr, &b0, &b1, &b2, &b3);
+		_mm256_storeu_si256((__m256i *)(out + done), b0);
+		_mm256_storeu_si256((__m256i *)(out + done + 32), b1);
+		_mm256_storeu_si256((__m256i *)(out + done + 64), b2);
+		_mm256_storeu_si256((__m256i *)(out + done + 96), b3);
+	}
+	for (; len - done >= 32; done += 32) {
+		__m256i b = _mm256_loadu_si256((const __m256i *)(in + done));
+		_mm256_storeu_si256((__m256i *)(out + done), vaes256_encrypt_x2(rkeys, nr, b));
+	}
+	return done;
+}
+
+/* Writes the keystream for the longest prefix of whole pairs of blocks
+ * and advances *ctr (counter in native order, see CTR_SWAP_MASK) past it.
+ * Returns the number of blocks written. */
+static inline size_t vaes256_ctr(__m128i *ctr, const __m128i *sk_exp, unsigned int nr, uint8_t *out, size_t blks) {
+	const __m256i mask = _mm256_broadcastsi128_si256(CTR_SWAP_MASK);
+	const __m256i step = _mm256_set_epi64x(2, 0, 2, 0);
+	__m256i rkeys[15];
+	__m256i c = _mm256_add_epi64(_mm256_broadcastsi128_si256(*ctr), _mm256_set_epi64x(1, 0, 0, 0));
+	size_t done = 0;
+
+	vaes256_load_rkeys(sk_exp, nr, rkeys);
+	for (; blks - done >= 8; done += 8) {
+		__m256i b0 = _mm256_shuffle_epi8(c, mask);
+		c = _mm256_add_epi64(c, step);
+		__m256i b1 = _mm256_shuffle_epi8(c, mask);
+		c = _mm256_add_epi64(c, step);
+		__m256i b2 = _mm256_shuffle_epi8(c, mask);
+		c = _mm256_add_epi64(c, step);
+		__m256i b3 = _mm256_shuffle_epi8(c, mask);
+		c = _mm256_add_epi64(c, step);
+		vaes256_encrypt_x8(rkeys, nr, &b0, &b1, &b2, &b3);
+		_mm256_storeu_si256((__m256i *)(out + 16 * done), b0);
+		_mm256_storeu_si256((__m256i *)(out + 16 * done + 32), b1);
+		_mm256_storeu_si256((__m256i *)(out + 16 * done + 64), b2);
+		_mm256_storeu_si256((__m256i *)(out + 16 * done + 96), b3);
+	}
+	for (; blks - done >= 2; done += 2) {
+		__m256i b = _mm256_shuffle_epi8(c, mask);
+		c = _mm256_add_epi64(c, step);
+		_mm256_storeu_si256((__m256i *)(out + 16 * done), vaes256_encrypt_x2(rkeys, nr, b));
+	}
+	*ctr = _mm_add_epi64(*ctr, _mm_set_epi64x((long long)done, 0));
+	return done;
+}
+
+static inline __m128i ctr_from_iv(const uint8_t *iv, size_t iv_len) {
+	__m128i block;
+	if (iv_len == 12) {
+		const int32_t *ivi = (const int32_t *) iv;
+		block = _mm_set_epi32(0, ivi[2], ivi[1], ivi[0]);
+	} else if (iv_len == 16) {
+		block = _mm_loadu_si128((const __m128i *)iv);
+	} else {
+		exit(EXIT_FAILURE);
+	}
+	return _mm_shuffle_epi8(block, CTR_SWAP_MASK);
+}
+
+void oqs_aes128_ecb_enc_sch_vaes_avx2(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const aes128ctx *ctx = schedule;
+	size_t done = vaes256_ecb(plaintext, plaintext_len, ctx->sk_exp, 10, ciphertext);
+	oqs_aes128_ecb_enc_sch_ni(plaintext + done, plaintext_len - done, schedule, ciphertext + done);
+}
+
+void oqs_aes128_ctr_enc_sch_vaes_avx2(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	const aes128ctx *ctx = schedule;
+	__m128i ctr = ctr_from_iv(iv, iv_len);
+	uint8_t next_iv[16];
+	size_t done = 16 * vaes256_ctr(&ctr, ctx->sk_exp, 10, out, out_len / 16);
+	if (done < out_len) {
+		_mm_storeu_si128((__m128i *)next_iv, _mm_shuffle_epi8(ctr, CTR_SWAP_MASK));
+		oqs_aes128_ctr_enc_sch_ni(next_iv, 16, schedule, out + done, out_len - done);
+	}
+}
+
+void oqs_aes256_ecb_enc_sch_vaes_avx2(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const aes256ctx *ctx = schedule;
+	size_t done = vaes256_ecb(plaintext, plaintext_len, ctx->sk_exp, 14, ciphertext);
+	oqs_aes256_ecb_enc_sch_ni(plaintext + done, plaintext_len - done, schedule, ciphertext + done);
+}
+
+void oqs_aes256_ctr_enc_sch_vaes_avx2(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	const aes256ctx *ctx = schedule;
+	__m128i ctr = ctr_from_iv(iv, iv_len);
+	uint8_t next_iv[16];
+	size_t done = 16 * vaes256_ctr(&ctr, ctx->sk_exp, 14, out, out_len / 16);
+	if (done < out_len) {
+		_mm_storeu_si128((__m128i *)next_iv, _mm_shuffle_epi8(ctr, CTR_SWAP_MASK));
+		oqs_aes256_ctr_enc_sch_ni(next_iv, 16, schedule, out + done, out_len - done);
+	}
+}
+
+void oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx2(void *schedule, uint8_t *out, size_t out_blks) {
+	aes256ctx *ctx = schedule;
+	size_t done = vaes256_ctr(&ctx->iv, ctx->sk_exp, 14, out, out_blks);
+	oqs_aes256_ctr_enc_sch_upd_blks_ni(schedule, out + 16 * done, out_blks - done);
+}
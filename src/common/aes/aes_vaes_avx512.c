@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+
+// AES-128/256 ECB and CTR using VAES on 512-bit registers: every aesenc
+// instruction processes four blocks, and four registers are interleaved so
+// that 16 blocks are in flight per round. The key schedules are the ones
+// built by aes128_ni.c and aes256_ni.c; tails shorter than one register are
+// handed back to the AES-NI code.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <immintrin.h>
+
+#include "aes_local.h"
+
+/* Same layout as the contexts in aes128_ni.c and aes256_ni.c */
+typedef struct {
+	__m128i sk_exp[11];
+	__m128i iv;
+} aes128ctx;
+
+typedef struct {
+	__m128i sk_exp[15];
+	__m128i iv;
+} aes256ctx;
+
+/* Swaps the big-endian 64-bit counter in the upper half of a block into a
+ * native integer, and back. */
+#define CTR_SWAP_MASK _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 7, 6, 5, 4, 3, 2, 1, 0)
+
+static inline void vaes512_load_rkeys(const __m128i *sk_exp, unsigned int nr, __m512i *rkeys) {
+	for (unsigned int i = 0; i <= nr; i++) {
+		rkeys[i] = _mm512_broadcast_i32x4(_mm_loadu_si128(&sk_exp[i]));
+	}
+}
+
+static inline void vaes512_encrypt_x16(const __m512i *rkeys, unsigned int nr, __m512i *b0, __m512i *b1, __m512i *b2, __m512i *b3) {
+	__m512i t0 = _mm512_xor_si512(*b0, rkeys[0]);
+	__m512i t1 = _mm512_xor_si512(*b1, rkeys[0]);
+	__m512i t2 = _mm512_xor_si512(*b2, rkeys[0]);
+	__m512i t3 = _mm512_xor_si512(*b3, rkeys[0]);
+	for (unsigned int r = 1; r < nr; r++) {
+		t0 = _mm512_aesenc_epi128(t0, rkeys[r]);
+		t1 = _mm512_aesenc_epi128(t1, rkeys[r]);
+		t2 = _mm512_aesenc_epi128(t2, rkeys[r]);
+		t3 = _mm512_aesenc_epi128(t3, rkeys[r]);
+	}
+	*b0 = _mm512_aesenclast_epi128(t0, rkeys[nr]);
+	*b1 = _mm512_aesenclast_epi128(t1, rkeys[nr]);
+	*b2 = _mm512_aesenclast_epi128(t2, rkeys[nr]);
+	*b3 = _mm512_aesenclast_epi128(t3, rkeys[nr]);
+}
+
+static inline __m512i vaes512_encrypt_x4(const __m512i *rkeys, unsigned int nr, __m512i b) {
+	b = _mm512_xor_si512(b, rkeys[0]);
+	for (unsigned int r = 1; r < nr; r++) {
+		b = _mm512_aesenc_epi128(b, rkeys[r]);
+	}
+	return _mm512_aesenclast_epi128(b, rkeys[nr]);
+}
+
+/* Encrypts the longest prefix of whole 64-byte chunks, returns its length */
+static inline size_t vaes512_ecb(const uint8_t *in, size_t len, const __m128i *sk_exp, unsigned int nr, uint8_t *out) {
+	__m512i rkeys[15];
+	size_t done = 0;
+
+	vaes512_load_rkeys(sk_exp, nr, rkeys);
+	for (; len - done >= 256; done += 256) {
+		__m512i b0 = _mm512_loadu_si512((const void *)(in + done));
+		__m512i b1 = _mm512_loadu_si512((const void *)(in + done + 64));
+		__m512i b2 = _mm512_loadu_si512((const void *)(in + done + 128));
+		__m512i b3 = _mm512_loadu_si512((const void *)(in + done + 192));
+		vaes512_encrypt_x16(rkeys, nr, &b0, &b1, &b2, &b3);
+		_mm512_storeu_si512((void *)(out + done), b0);
+		_mm512_storeu_si512((void *)(out + done + 64), b1);
+		_mm512_storeu_si512((void *)(out + done + 128), b2);
+		_mm512_storeu_si512((void *)(out + done + 192), b3);
+	}
+	for (; len - done >= 64; done += 64) {
+		__m512i b = _mm512_loadu_si512((const void *)(in + done));
+		_mm512_storeu_si512((void *)(out + done), vaes512_encrypt_x4(rkeys, nr, b));
+	}
+	return done;
+}
+
+/* Writes the keystream for the longest prefix of whole groups of four blocks
+ * and advances *ctr (counter in native order, see CTR_SWAP_MASK) past it.
+ * Returns the number of blocks written. */
+static inline size_t vaes512_ctr(__m128i *ctr, const __m128i *sk_exp, unsigned int nr, uint8_t *out, size_t blks) {
+	const __m512i mask = _mm512_broadcast_i32x4(CTR_SWAP_MASK);
+	const __m512i step = _mm512_set_epi64(4, 0, 4, 0, 4, 0, 4, 0);
+	__m512i rkeys[15];
+	__m512i c = _mm512_add_epi64(_mm512_broadcast_i32x4(*ctr), _mm512_set_epi64(3, 0, 2, 0, 1, 0, 0, 0));
+	size_t done = 0;
+
+	vaes512_load_rkeys(sk_exp, nr, rkeys);
+	for (; blks - done >= 16; done += 16) {
+		__m512i b0 = _mm512_shuffle_epi8(c, mask);
+		c = _mm512_add_epi64(c, step);
+		__m512i b1 = _mm512_shuffle_epi8(c, mask);
+		c = _mm512_add_epi64(c, step);
+		__m512i b2 = _mm512_shuffle_epi8(c, mask);
+		c = _mm512_add_epi64(c, step);
+		__m512i b3 = _mm512_shuffle_epi8(c, mask);
+		c = _mm512_add_epi64(c, step);
+		vaes512_encrypt_x16(rkeys, nr, &b0, &b1, &b2, &b3);
+		_mm512_storeu_si512((void *)(out + 16 * done), b0);
+		_mm512_storeu_si512((void *)(out + 16 * done + 64), b1);
+		_mm512_storeu_si512((void *)(out + 16 * done + 128), b2);
+		_mm512_storeu_si512((void *)(out + 16 * done + 192), b3);
+	}
+	for (; blks - done >= 4; done += 4) {
+		__m512i b = _mm512_shuffle_epi8(c, mask);
+		c = _mm512_add_epi64(c, step);
+		_mm512_storeu_si512((void *)(out + 16 * done), vaes512_encrypt_x4(rkeys, nr, b));
+	}
+	*ctr = _mm_add_epi64(*ctr, _mm_set_epi64x((long long)done, 0));
+	return done;
+}
+
+static inline __m128i ctr_from_iv(const uint8_t *iv, size_t iv_len) {
+	__m128i block;
+	if (iv_len == 12) {
+		const int32_t *ivi = (const int32_t *) iv;
+		block = _mm_set_epi32(0, ivi[2], ivi[1], ivi[0]);
+	} else if (iv_len == 16) {
+		block = _mm_loadu_si128((const __m128i *)iv);
+	} else {
+		exit(EXIT_FAILURE);
+	}
+	return _mm_shuffle_epi8(block, CTR_SWAP_MASK);
+}
+
+void oqs_aes128_ecb_enc_sch_vaes_avx512(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const aes128ctx *ctx = schedule;
+	size_t done = vaes512_ecb(plaintext, plaintext_len, ctx->sk_exp, 10, ciphertext);
+	oqs_aes128_ecb_enc_sch_ni(plaintext + done, plaintext_len - done, schedule, ciphertext + done);
+}
+
+void oqs_aes128_ctr_enc_sch_vaes_avx512(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	const aes128ctx *ctx = schedule;
+	__m128i ctr = ctr_from_iv(iv, iv_len);
+	uint8_t next_iv[16];
+	size_t done = 16 * vaes512_ctr(&ctr, ctx->sk_exp, 10, out, out_len / 16);
+	if (done < out_len) {
+		_mm_storeu_si128((__m128i *)next_iv, _mm_shuffle_epi8(ctr, CTR_SWAP_MASK));
+		oqs_aes128_ctr_enc_sch_ni(next_iv, 16, schedule, out + done, out_len - done);
+	}
+}
+
+void oqs_aes256_ecb_enc_sch_vaes_avx512(const uint8_t *plaintext, const size_t plaintext_len, const void *schedule, uint8_t *ciphertext) {
+	const aes256ctx *ctx = schedule;
+	size_t done = vaes512_ecb(plaintext, plaintext_len, ctx->sk_exp, 14, ciphertext);
+	oqs_aes256_ecb_enc_sch_ni(plaintext + done, plaintext_len - done, schedule, ciphertext + done);
+}
+
+void oqs_aes256_ctr_enc_sch_vaes_avx512(const uint8_t *iv, const size_t iv_len, const void *schedule, uint8_t *out, size_t out_len) {
+	const aes256ctx *ctx = schedule;
+	__m128i ctr = ctr_from_iv(iv, iv_len);
+	uint8_t next_iv[16];
+	size_t done = 16 * vaes512_ctr(&ctr, ctx->sk_exp, 14, out, out_len / 16);
+	if (done < out_len) {
+		_mm_storeu_si128((__m128i *)next_iv, _mm_shuffle_epi8(ctr, CTR_SWAP_MASK));
+		oqs_aes256_ctr_enc_sch_ni(next_iv, 16, schedule, out + done, out_len - done);
+	}
+}
+
+void oqs_aes256_ctr_enc_sch_upd_blks_vaes_avx512(void *schedule, uint8_t *out, size_t out_blks) {
+	aes256ctx *ctx = schedule;
+	size_t done = vaes512_ctr(&ctx->iv, ctx->sk_exp, 14, out, out_blks);
+	oqs_aes256_ctr_enc_sch_upd_blks_ni(schedule, out + 16 * done, out_blks - done);
+}
@@ -31,6 +31,8 @@
 #include "ossl_helpers.h"
 #endif
 
+#include "rand/rand_internal.h"
+
 /* Identifying the CPU is expensive so we cache the results in cpu_ext_data */
 #if defined(OQS_DIST_BUILD)
 static unsigned int cpu_ext_data[OQS_CPU_EXT_COUNT] = {0};
@@ -65,6 +67,7 @@ static void set_available_cpu_extensions(void) {
 	if (has_mask(xcr0_eax, MASK_XMM | MASK_YMM)) {
 		cpu_ext_data[OQS_CPU_EXT_AVX] = is_bit_set(leaf_1.ecx, 28);
 		cpu_ext_data[OQS_CPU_EXT_AVX2] = is_bit_set(leaf_7.ebx, 5);
+		cpu_ext_data[OQS_CPU_EXT_VAES] = is_bit_set(leaf_7.ecx, 9) && is_bit_set(leaf_1.ecx, 25);
 	}
 	cpu_ext_data[OQS_CPU_EXT_PCLMULQDQ] = is_bit_set(leaf_1.ecx, 1);
 	cpu_ext_data[OQS_CPU_EXT_POPCNT] = is_bit_set(leaf_1.ecx, 23);
@@ -76,6 +79,8 @@ static void set_available_cpu_extensions(void) {
 		cpu_ext_data[OQS_CPU_EXT_SSE] = is_bit_set(leaf_1.edx, 25);
 		cpu_ext_data[OQS_CPU_EXT_SSE2] = is_bit_set(leaf_1.edx, 26);
 		cpu_ext_data[OQS_CPU_EXT_SSE3] = is_bit_set(leaf_1.ecx, 0);
+		/* the SHA-256 code also needs SSSE3 and SSE4.1 shuffles and blends */
+		cpu_ext_data[OQS_CPU_EXT_SHA] = is_bit_set(leaf_7.ebx, 29) && is_bit_set(leaf_1.ecx, 9) && is_bit_set(leaf_1.ecx, 19);
 	}
 
 	if (has_mask(xcr0_eax, MASK_XMM | MASK_YMM | MASK_MASKREG | MASK_ZMM0_15 | MASK_ZMM16_31)) {
@@ -241,6 +246,10 @@ OQS_API void OQS_init(void) {
 }
 
 OQS_API void OQS_thread_stop(void) {
+	oqs_randombytes_thread_release();
+#if defined(OQS_USE_PTHREADS)
+	oqs_randombytes_buffered_release();
+#endif
 #if defined(OQS_USE_OPENSSL)
 	oqs_thread_stop();
 #endif
@@ -251,6 +260,10 @@ OQS_API const char *OQS_version(void) {
 }
 
 OQS_API void OQS_destroy(void) {
+	oqs_randombytes_thread_destroy();
+#if defined(OQS_USE_PTHREADS)
+	oqs_randombytes_buffered_destroy();
+#endif
 #if defined(OQS_USE_OPENSSL)
 	oqs_ossl_destroy();
 #endif
@@ -201,6 +201,8 @@ typedef enum {
 	OQS_CPU_EXT_ARM_SHA2,
 	OQS_CPU_EXT_ARM_SHA3,
 	OQS_CPU_EXT_ARM_NEON,
+	OQS_CPU_EXT_SHA,
+	OQS_CPU_EXT_VAES,
 	/* End extension list */
 	OQS_CPU_EXT_COUNT, /* Must be last */
 } OQS_CPU_EXT;
@@ -220,14 +222,18 @@ OQS_API void OQS_init(void);
 
 /**
  * This function stops OpenSSL threads, which allows resources
- * to be cleaned up in the correct order.
+ * to be cleaned up in the correct order. It also releases the
+ * calling thread's OQS_RAND_alg_buffered generator state and
+ * removes its OQS_randombytes_thread_custom_algorithm binding.
  * @note When liboqs is used in a multithreaded application,
  * each thread should call this function prior to stopping.
  */
 OQS_API void OQS_thread_stop(void);
 
 /**
- * This function frees prefetched OpenSSL objects
+ * This function frees prefetched OpenSSL objects and the state that liboqs
+ * caches per thread, including the state of threads that are still running.
+ * It must not be called while other threads are using liboqs.
  */
 OQS_API void OQS_destroy(void);
 
@@ -42,11 +42,15 @@ FUNC(EVP_CIPHER *, EVP_CIPHER_fetch,
      (OSSL_LIB_CTX *ctx, const char *algorithm, const char *properties),
      (ctx, algorithm, properties))
 VOID_FUNC(void, EVP_CIPHER_free, (EVP_CIPHER *cipher), (cipher))
+FUNC(int, EVP_DigestInit_ex2,
+     (EVP_MD_CTX *ctx, const EVP_MD *type, const OSSL_PARAM params[]),
+     (ctx, type, params))
 FUNC(EVP_MD *, EVP_MD_fetch,
      (OSSL_LIB_CTX *ctx, const char *algorithm, const char *properties),
      (ctx, algorithm, properties))
 VOID_FUNC(void, EVP_MD_free, (EVP_MD *md), (md))
 #else
+FUNC(const EVP_MD *, EVP_MD_CTX_md, (const EVP_MD_CTX *ctx), (ctx))
 FUNC(const EVP_MD *, EVP_sha256, (void), ())
 FUNC(const EVP_MD *, EVP_sha384, (void), ())
 FUNC(const EVP_MD *, EVP_sha3_256, (void), ())
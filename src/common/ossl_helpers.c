@@ -4,14 +4,17 @@
 #define OQS_OSSL_NO_EXTERN 1
 #include "ossl_helpers.h"
 #include <assert.h>
+#include <stdlib.h>
 #if !defined(_WIN32)
 #include <dlfcn.h>
 #endif
 
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
 #if defined(OQS_USE_PTHREADS)
 #include <pthread.h>
+#endif
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#if defined(OQS_USE_PTHREADS)
 static pthread_once_t init_once_control = PTHREAD_ONCE_INIT;
 static pthread_once_t free_once_control = PTHREAD_ONCE_INIT;
 #endif
@@ -83,7 +86,198 @@ static void free_ossl_objects(void) {
 }
 #endif // OPENSSL_VERSION_NUMBER >= 0x30000000L
 
+#if defined(OQS_USE_PTHREADS)
+/* Each thread keeps one EVP_MD_CTX for the one-shot digest calls, so that
+ * short hashes do not pay for a context allocation and provider lookup on
+ * every call. The context is released by OQS_thread_stop, or by the key
+ * destructor when the thread exits.
+ *
+ * The key is created on first use and deleted by OQS_destroy, so that no
+ * destructor can run once the library is unloaded; OQS_init may create it
+ * again. Cached contexts are linked into md_ctx_entries so that OQS_destroy
+ * can also free the contexts of threads that are still running, such as
+ * the LMS, XMSS and SPHINCS+ worker threads. md_ctx_lock guards the list
+ * and the key state; md_ctx_key_ok is read without the lock on the fast
+ * path, which relies on OQS_destroy not running concurrently with other
+ * liboqs calls. */
+typedef struct md_ctx_entry {
+	EVP_MD_CTX *ctx;
+	struct md_ctx_entry *prev;
+	struct md_ctx_entry *next;
+} md_ctx_entry;
+
+static pthread_mutex_t md_ctx_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t md_ctx_key;
+static int md_ctx_key_ok;
+static md_ctx_entry *md_ctx_entries;
+
+/* Must be called with md_ctx_lock held */
+static void unlink_md_ctx_entry(md_ctx_entry *entry) {
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		md_ctx_entries = entry->next;
+	}
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	}
+}
+
+static void free_md_ctx_entry(md_ctx_entry *entry) {
+	OSSL_FUNC(EVP_MD_CTX_free)(entry->ctx);
+	OQS_MEM_insecure_free(entry);
+}
+
+/* Key destructor. The entry may already have been freed by OQS_destroy if
+ * the thread exits while the key is being deleted, so it is only freed if
+ * it is still linked. */
+static void release_md_ctx_entry(void *entry) {
+	md_ctx_entry *e;
+
+	pthread_mutex_lock(&md_ctx_lock);
+	e = md_ctx_entries;
+	while (e != NULL && e != entry) {
+		e = e->next;
+	}
+	if (e != NULL) {
+		unlink_md_ctx_entry(e);
+	}
+	pthread_mutex_unlock(&md_ctx_lock);
+	if (e != NULL) {
+		free_md_ctx_entry(e);
+	}
+}
+
+static int md_ctx_key_created(void) {
+	return __atomic_load_n(&md_ctx_key_ok, __ATOMIC_ACQUIRE);
+}
+
+static int md_ctx_key_ready(void) {
+	int ok;
+
+	if (md_ctx_key_created()) {
+		return 1;
+	}
+	pthread_mutex_lock(&md_ctx_lock);
+	if (!md_ctx_key_ok && pthread_key_create(&md_ctx_key, release_md_ctx_entry) == 0) {
+		__atomic_store_n(&md_ctx_key_ok, 1, __ATOMIC_RELEASE);
+	}
+	ok = md_ctx_key_ok;
+	pthread_mutex_unlock(&md_ctx_lock);
+	return ok;
+}
+
+static md_ctx_entry *new_thread_md_ctx_entry(void) {
+	md_ctx_entry *entry = OQS_MEM_malloc(sizeof(md_ctx_entry));
+	if (entry == NULL) {
+		return NULL;
+	}
+	entry->ctx = OSSL_FUNC(EVP_MD_CTX_new)();
+	if (entry->ctx == NULL) {
+		OQS_MEM_insecure_free(entry);
+		return NULL;
+	}
+	pthread_mutex_lock(&md_ctx_lock);
+	entry->prev = NULL;
+	entry->next = md_ctx_entries;
+	if (md_ctx_entries) {
+		md_ctx_entries->prev = entry;
+	}
+	md_ctx_entries = entry;
+	pthread_mutex_unlock(&md_ctx_lock);
+	if (pthread_setspecific(md_ctx_key, entry)) {
+		release_md_ctx_entry(entry);
+		return NULL;
+	}
+	return entry;
+}
+
+static void release_thread_md_ctx(void) {
+	md_ctx_entry *entry;
+
+	if (!md_ctx_key_created()) {
+		return;
+	}
+	entry = pthread_getspecific(md_ctx_key);
+	if (entry) {
+		pthread_setspecific(md_ctx_key, NULL);
+		release_md_ctx_entry(entry);
+	}
+}
+
+static void destroy_md_ctx_key(void) {
+	md_ctx_entry *entry;
+
+	pthread_mutex_lock(&md_ctx_lock);
+	while ((entry = md_ctx_entries) != NULL) {
+		unlink_md_ctx_entry(entry);
+		free_md_ctx_entry(entry);
+	}
+	if (md_ctx_key_ok) {
+		pthread_key_delete(md_ctx_key);
+		__atomic_store_n(&md_ctx_key_ok, 0, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&md_ctx_lock);
+}
+#endif
+
+EVP_MD_CTX *oqs_md_ctx_get(const EVP_MD *md) {
+	EVP_MD_CTX *ctx = NULL;
+#if defined(OQS_USE_PTHREADS)
+	if (md_ctx_key_ready()) {
+		md_ctx_entry *entry = pthread_getspecific(md_ctx_key);
+		if (!entry) {
+			entry = new_thread_md_ctx_entry();
+		}
+		if (entry) {
+			ctx = entry->ctx;
+		}
+	}
+#endif
+	if (!ctx) {
+		ctx = OSSL_FUNC(EVP_MD_CTX_new)();
+		if (!ctx) {
+			return NULL;
+		}
+	}
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	/* EVP_DigestInit_ex2 keeps the provider context when md is unchanged */
+	if (OSSL_FUNC(EVP_DigestInit_ex2)(ctx, md, NULL) != 1) {
+#else
+	if (OSSL_FUNC(EVP_DigestInit_ex)(ctx, md, NULL) != 1) {
+#endif
+		oqs_md_ctx_put(ctx);
+		return NULL;
+	}
+	return ctx;
+}
+
+void oqs_md_ctx_put(EVP_MD_CTX *ctx) {
+#if defined(OQS_USE_PTHREADS)
+	md_ctx_entry *entry = md_ctx_key_created() ? pthread_getspecific(md_ctx_key) : NULL;
+	if (entry && entry->ctx == ctx) {
+		/* The cached context still holds the digest state of the last
+		 * input, which may be secret: reinitialise it with the same md. */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		if (OSSL_FUNC(EVP_DigestInit_ex2)(ctx, NULL, NULL) == 1) {
+#else
+		if (OSSL_FUNC(EVP_DigestInit_ex)(ctx, OSSL_FUNC(EVP_MD_CTX_md)(ctx), NULL) == 1) {
+#endif
+			return;
+		}
+		pthread_setspecific(md_ctx_key, NULL);
+		release_md_ctx_entry(entry);
+		return;
+	}
+#endif
+	OSSL_FUNC(EVP_MD_CTX_free)(ctx);
+}
+
 void oqs_ossl_destroy(void) {
+#if defined(OQS_USE_PTHREADS)
+	release_thread_md_ctx();
+	destroy_md_ctx_key();
+#endif
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
 #if defined(OQS_USE_PTHREADS)
 	pthread_once(&free_once_control, free_ossl_objects);
@@ -98,6 +292,9 @@ void oqs_ossl_destroy(void) {
 }
 
 void oqs_thread_stop(void) {
+#if defined(OQS_USE_PTHREADS)
+	release_thread_md_ctx();
+#endif
 	OSSL_FUNC(OPENSSL_thread_stop)();
 }
 
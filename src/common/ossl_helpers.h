@@ -15,6 +15,12 @@ void oqs_ossl_destroy(void);
 
 void oqs_thread_stop(void);
 
+/* Returns the calling thread's cached digest context, initialised for md, or
+ * NULL on failure. Every successful call must be paired with oqs_md_ctx_put. */
+EVP_MD_CTX *oqs_md_ctx_get(const EVP_MD *md);
+
+void oqs_md_ctx_put(EVP_MD_CTX *ctx);
+
 const EVP_MD *oqs_sha256(void);
 
 const EVP_MD *oqs_sha384(void);
@@ -35,23 +35,23 @@
 #define sha3_512_inc_ctx_clone OQS_SHA3_sha3_512_inc_ctx_clone
 #define sha3_512_inc_ctx_release OQS_SHA3_sha3_512_inc_ctx_release
 
-#define shake128incctx OQS_SHA3_shake128_inc_ctx
-#define shake128_inc_init OQS_SHA3_shake128_inc_init
-#define shake128_inc_absorb OQS_SHA3_shake128_inc_absorb
-#define shake128_inc_finalize OQS_SHA3_shake128_inc_finalize
-#define shake128_inc_squeeze OQS_SHA3_shake128_inc_squeeze
-#define shake128_inc_ctx_release OQS_SHA3_shake128_inc_ctx_release
-#define shake128_inc_ctx_clone OQS_SHA3_shake128_inc_ctx_clone
-#define shake128_inc_ctx_reset OQS_SHA3_shake128_inc_ctx_reset
+#define shake128incctx OQS_SHA3_shake128_stack_ctx
+#define shake128_inc_init OQS_SHA3_shake128_stack_init
+#define shake128_inc_absorb OQS_SHA3_shake128_stack_absorb
+#define shake128_inc_finalize OQS_SHA3_shake128_stack_finalize
+#define shake128_inc_squeeze OQS_SHA3_shake128_stack_squeeze
+#define shake128_inc_ctx_release OQS_SHA3_shake128_stack_ctx_release
+#define shake128_inc_ctx_clone OQS_SHA3_shake128_stack_ctx_clone
+#define shake128_inc_ctx_reset OQS_SHA3_shake128_stack_ctx_reset
 
-#define shake256incctx OQS_SHA3_shake256_inc_ctx
-#define shake256_inc_init OQS_SHA3_shake256_inc_init
-#define shake256_inc_absorb OQS_SHA3_shake256_inc_absorb
-#define shake256_inc_finalize OQS_SHA3_shake256_inc_finalize
-#define shake256_inc_squeeze OQS_SHA3_shake256_inc_squeeze
-#define shake256_inc_ctx_release OQS_SHA3_shake256_inc_ctx_release
-#define shake256_inc_ctx_clone OQS_SHA3_shake256_inc_ctx_clone
-#define shake256_inc_ctx_reset OQS_SHA3_shake256_inc_ctx_reset
+#define shake256incctx OQS_SHA3_shake256_stack_ctx
+#define shake256_inc_init OQS_SHA3_shake256_stack_init
+#define shake256_inc_absorb OQS_SHA3_shake256_stack_absorb
+#define shake256_inc_finalize OQS_SHA3_shake256_stack_finalize
+#define shake256_inc_squeeze OQS_SHA3_shake256_stack_squeeze
+#define shake256_inc_ctx_release OQS_SHA3_shake256_stack_ctx_release
+#define shake256_inc_ctx_clone OQS_SHA3_shake256_stack_ctx_clone
+#define shake256_inc_ctx_reset OQS_SHA3_shake256_stack_ctx_reset
 
 #define shake128_absorb_once OQS_SHA3_shake128_absorb_once
 void OQS_SHA3_shake128_absorb_once(shake128incctx *state, const uint8_t *in, size_t inlen);
@@ -60,9 +60,9 @@ void OQS_SHA3_shake128_absorb_once(shake128incctx *state, const uint8_t *in, siz
 void OQS_SHA3_shake256_absorb_once(shake256incctx *state, const uint8_t *in, size_t inlen);
 
 #define shake128_squeezeblocks(OUT, NBLOCKS, STATE) \
-        OQS_SHA3_shake128_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
+        OQS_SHA3_shake128_stack_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE128_RATE, STATE)
 
 #define shake256_squeezeblocks(OUT, NBLOCKS, STATE) \
-        OQS_SHA3_shake256_inc_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
+        OQS_SHA3_shake256_stack_squeeze(OUT, (NBLOCKS)*OQS_SHA3_SHAKE256_RATE, STATE)
 
 #endif
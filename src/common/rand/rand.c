@@ -17,7 +17,12 @@
 
 #include <oqs/oqs.h>
 
-void OQS_randombytes_system(uint8_t *random_array, size_t bytes_to_read);
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
+#include "rand_internal.h"
+
 #ifdef OQS_USE_OPENSSL
 void OQS_randombytes_openssl(uint8_t *random_array, size_t bytes_to_read);
 #endif
@@ -39,6 +44,13 @@ OQS_API OQS_STATUS OQS_randombytes_switch_algorithm(const char *algorithm) {
 		return OQS_SUCCESS;
 #else
 		return OQS_ERROR;
+#endif
+	} else if (0 == strcasecmp(OQS_RAND_alg_buffered, algorithm)) {
+#if defined(OQS_USE_PTHREADS)
+		oqs_randombytes_algorithm = &OQS_randombytes_buffered;
+		return OQS_SUCCESS;
+#else
+		return OQS_ERROR;
 #endif
 	} else {
 		return OQS_ERROR;
@@ -49,8 +61,168 @@ OQS_API void OQS_randombytes_custom_algorithm(void (*algorithm_ptr)(uint8_t *, s
 	oqs_randombytes_algorithm = algorithm_ptr;
 }
 
+/* Algorithm bound to the calling thread by OQS_randombytes_thread_custom_algorithm */
+typedef struct thread_algorithm {
+	void (*algorithm_ptr)(void *, uint8_t *, size_t);
+	void *ctx;
+	struct thread_algorithm *prev;
+	struct thread_algorithm *next;
+} thread_algorithm;
+
+#if defined(OQS_USE_PTHREADS)
+/* thread_alg_lock guards thread_algs and the key state. The key is deleted
+ * by OQS_destroy, which also frees the bindings of threads still running. */
+static pthread_mutex_t thread_alg_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t thread_alg_key;
+static int thread_alg_key_ok;
+static thread_algorithm *thread_algs;
+
+/* Must be called with thread_alg_lock held */
+static void unlink_thread_alg(thread_algorithm *alg) {
+	if (alg->prev) {
+		alg->prev->next = alg->next;
+	} else {
+		thread_algs = alg->next;
+	}
+	if (alg->next) {
+		alg->next->prev = alg->prev;
+	}
+}
+
+/* Key destructor; the binding is only freed if OQS_destroy has not already */
+static void free_thread_alg(void *alg) {
+	thread_algorithm *a;
+
+	pthread_mutex_lock(&thread_alg_lock);
+	a = thread_algs;
+	while (a != NULL && a != alg) {
+		a = a->next;
+	}
+	if (a != NULL) {
+		unlink_thread_alg(a);
+	}
+	pthread_mutex_unlock(&thread_alg_lock);
+	OQS_MEM_insecure_free(a);
+}
+
+static int thread_alg_key_created(void) {
+	return __atomic_load_n(&thread_alg_key_ok, __ATOMIC_ACQUIRE);
+}
+
+static int thread_alg_key_ready(void) {
+	int ok;
+
+	if (thread_alg_key_created()) {
+		return 1;
+	}
+	pthread_mutex_lock(&thread_alg_lock);
+	if (!thread_alg_key_ok && pthread_key_create(&thread_alg_key, free_thread_alg) == 0) {
+		__atomic_store_n(&thread_alg_key_ok, 1, __ATOMIC_RELEASE);
+	}
+	ok = thread_alg_key_ok;
+	pthread_mutex_unlock(&thread_alg_lock);
+	return ok;
+}
+
+/* No thread can have a binding before the key exists, so lookups never
+ * create it */
+static thread_algorithm *get_thread_alg(void) {
+	if (!thread_alg_key_created()) {
+		return NULL;
+	}
+	return pthread_getspecific(thread_alg_key);
+}
+
+static thread_algorithm *new_thread_alg(void) {
+	thread_algorithm *alg;
+
+	if (!thread_alg_key_ready()) {
+		exit(EXIT_FAILURE);
+	}
+	alg = OQS_MEM_malloc(sizeof(thread_algorithm));
+	OQS_EXIT_IF_NULLPTR(alg, "randombytes");
+	alg->prev = NULL;
+	pthread_mutex_lock(&thread_alg_lock);
+	alg->next = thread_algs;
+	if (thread_algs) {
+		thread_algs->prev = alg;
+	}
+	thread_algs = alg;
+	pthread_mutex_unlock(&thread_alg_lock);
+	if (pthread_setspecific(thread_alg_key, alg)) {
+		exit(EXIT_FAILURE);
+	}
+	return alg;
+}
+
+void oqs_randombytes_thread_release(void) {
+	thread_algorithm *alg = get_thread_alg();
+	if (alg != NULL) {
+		pthread_setspecific(thread_alg_key, NULL);
+		free_thread_alg(alg);
+	}
+}
+
+void oqs_randombytes_thread_destroy(void) {
+	thread_algorithm *alg;
+
+	pthread_mutex_lock(&thread_alg_lock);
+	while ((alg = thread_algs) != NULL) {
+		unlink_thread_alg(alg);
+		OQS_MEM_insecure_free(alg);
+	}
+	if (thread_alg_key_ok) {
+		pthread_key_delete(thread_alg_key);
+		__atomic_store_n(&thread_alg_key_ok, 0, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&thread_alg_lock);
+}
+#else
+/* Without pthreads there is only one thread to bind to */
+static thread_algorithm *oqs_thread_alg = NULL;
+
+static thread_algorithm *get_thread_alg(void) {
+	return oqs_thread_alg;
+}
+
+static thread_algorithm *new_thread_alg(void) {
+	oqs_thread_alg = OQS_MEM_malloc(sizeof(thread_algorithm));
+	OQS_EXIT_IF_NULLPTR(oqs_thread_alg, "randombytes");
+	return oqs_thread_alg;
+}
+
+void oqs_randombytes_thread_release(void) {
+	OQS_MEM_insecure_free(oqs_thread_alg);
+	oqs_thread_alg = NULL;
+}
+
+void oqs_randombytes_thread_destroy(void) {
+	oqs_randombytes_thread_release();
+}
+#endif
+
+OQS_API void OQS_randombytes_thread_custom_algorithm(void (*algorithm_ptr)(void *, uint8_t *, size_t), void *ctx) {
+	thread_algorithm *alg;
+
+	if (algorithm_ptr == NULL) {
+		oqs_randombytes_thread_release();
+		return;
+	}
+	alg = get_thread_alg();
+	if (alg == NULL) {
+		alg = new_thread_alg();
+	}
+	alg->algorithm_ptr = algorithm_ptr;
+	alg->ctx = ctx;
+}
+
 OQS_API void OQS_randombytes(uint8_t *random_array, size_t bytes_to_read) {
-	oqs_randombytes_algorithm(random_array, bytes_to_read);
+	const thread_algorithm *alg = get_thread_alg();
+	if (alg != NULL) {
+		alg->algorithm_ptr(alg->ctx, random_array, bytes_to_read);
+	} else {
+		oqs_randombytes_algorithm(random_array, bytes_to_read);
+	}
 }
 
 // Select the implementation for OQS_randombytes_system
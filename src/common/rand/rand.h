@@ -23,6 +23,14 @@ extern "C" {
 /** Algorithm identifier for using OpenSSL's PRNG. */
 #define OQS_RAND_alg_openssl "OpenSSL"
 
+/** Algorithm identifier for a per-thread SHAKE256 generator seeded from the system PRNG.
+ *
+ * Output is buffered, so most calls do not enter the kernel. The generator
+ * reseeds from the system PRNG periodically and in the child after fork().
+ * Only available in builds with pthreads; the state of a thread is released
+ * by OQS_thread_stop or when the thread exits. */
+#define OQS_RAND_alg_buffered "buffered"
+
 /**
  * Switches OQS_randombytes to use the specified algorithm.
  *
@@ -45,12 +53,32 @@ OQS_API OQS_STATUS OQS_randombytes_switch_algorithm(const char *algorithm);
  */
 OQS_API void OQS_randombytes_custom_algorithm(void (*algorithm_ptr)(uint8_t *, size_t));
 
+/**
+ * Switches OQS_randombytes to use the given function, for calls made from the calling thread only.
+ *
+ * While a function is bound to a thread, OQS_randombytes called from that thread
+ * invokes `algorithm_ptr(ctx, random_array, bytes_to_read)` and ignores the
+ * algorithm selected by `OQS_randombytes_switch_algorithm` or
+ * `OQS_randombytes_custom_algorithm`; other threads are not affected. This allows
+ * each thread to drive its own deterministic generator, e.g. when producing
+ * known-answer tests in parallel.
+ *
+ * The binding is removed by passing NULL as `algorithm_ptr`, by `OQS_thread_stop`
+ * or by `OQS_destroy`. In builds without pthreads the binding applies to the
+ * whole process.
+ *
+ * @param[in] algorithm_ptr Pointer to the RNG function to use, or NULL to remove the binding.
+ * @param[in] ctx Context passed to `algorithm_ptr` on every call.
+ */
+OQS_API void OQS_randombytes_thread_custom_algorithm(void (*algorithm_ptr)(void *, uint8_t *, size_t), void *ctx);
+
 /**
  * Fills the given memory with the requested number of (pseudo)random bytes.
  *
- * This implementation uses whichever algorithm has been selected by
- * OQS_randombytes_switch_algorithm. The default is OQS_randombytes_system, which
- * reads bytes from a system specific default source.
+ * This implementation uses the function bound to the calling thread by
+ * OQS_randombytes_thread_custom_algorithm if there is one, and otherwise whichever
+ * algorithm has been selected by OQS_randombytes_switch_algorithm. The default is
+ * OQS_randombytes_system, which reads bytes from a system specific default source.
  *
  * The caller is responsible for providing a buffer allocated with sufficient room.
  *
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * Buffered random number generator for OQS_randombytes.
+ *
+ * Each thread owns a SHAKE256-based generator that is seeded from
+ * OQS_randombytes_system. Every refill squeezes a fresh 32-byte key followed
+ * by a block of output from SHAKE256(0x00 || key), so earlier output cannot be
+ * recovered from the current state. Small requests are served from the
+ * buffered block and the bytes handed out are wiped from the buffer.
+ *
+ * The generator mixes in new system entropy after RESEED_INTERVAL bytes of
+ * output, and in a child process after fork(), so parent and child never
+ * share output.
+ *
+ * The thread key is created on first use and deleted by OQS_destroy, so that
+ * free_rng cannot run once the library is unloaded. Generators are linked
+ * into rng_list so that OQS_destroy also frees those of running threads.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <oqs/common.h>
+#include <oqs/rand.h>
+#include <oqs/sha3.h>
+
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+
+#include "rand_internal.h"
+
+#define KEY_BYTES 32
+#define BUF_BYTES 512
+#define RESEED_INTERVAL ((uint64_t)1 << 24)
+
+#define DOMAIN_GENERATE 0x00
+#define DOMAIN_RESEED 0x01
+
+typedef struct buffered_rng {
+	uint8_t key[KEY_BYTES];
+	uint8_t buf[BUF_BYTES];
+	size_t buf_pos;
+	uint64_t output_since_seed;
+	unsigned int fork_generation;
+	int seeded;
+	struct buffered_rng *prev;
+	struct buffered_rng *next;
+} buffered_rng;
+
+/* rng_lock guards rng_list and the key state; rng_key_ok is read without
+ * the lock once set, which relies on OQS_destroy not running concurrently
+ * with other liboqs calls. */
+static pthread_mutex_t rng_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t rng_key;
+static int rng_key_ok;
+static int rng_atfork_ok;
+static buffered_rng *rng_list;
+static volatile unsigned int fork_generation;
+
+/* Must be called with rng_lock held */
+static void unlink_rng(buffered_rng *rng) {
+	if (rng->prev) {
+		rng->prev->next = rng->next;
+	} else {
+		rng_list = rng->next;
+	}
+	if (rng->next) {
+		rng->next->prev = rng->prev;
+	}
+}
+
+/* Key destructor. The generator may already have been freed by OQS_destroy
+ * if the thread exits while the key is being deleted, so it is only freed
+ * if it is still linked. */
+static void free_rng(void *rng) {
+	buffered_rng *r;
+
+	pthread_mutex_lock(&rng_lock);
+	r = rng_list;
+	while (r != NULL && r != rng) {
+		r = r->next;
+	}
+	if (r != NULL) {
+		unlink_rng(r);
+	}
+	pthread_mutex_unlock(&rng_lock);
+	if (r != NULL) {
+		OQS_MEM_secure_free(r, sizeof(buffered_rng));
+	}
+}
+
+static void rng_atfork_child(void) {
+	fork_generation++;
+}
+
+static int rng_key_created(void) {
+	return __atomic_load_n(&rng_key_ok, __ATOMIC_ACQUIRE);
+}
+
+static int rng_key_ready(void) {
+	int ok;
+
+	if (rng_key_created()) {
+		return 1;
+	}
+	pthread_mutex_lock(&rng_lock);
+	/* atfork handlers cannot be removed, so register it only once */
+	if (!rng_atfork_ok) {
+		rng_atfork_ok = (pthread_atfork(NULL, NULL, rng_atfork_child) == 0);
+	}
+	if (!rng_key_ok && rng_atfork_ok && pthread_key_create(&rng_key, free_rng) == 0) {
+		__atomic_store_n(&rng_key_ok, 1, __ATOMIC_RELEASE);
+	}
+	ok = rng_key_ok;
+	pthread_mutex_unlock(&rng_lock);
+	return ok;
+}
+
+/* Replaces the key with SHAKE256(0x00 || key)[0:32] and writes the following
+ * outlen bytes of the same squeeze to out. */
+static void rng_generate(buffered_rng *rng, uint8_t *out, size_t outlen) {
+	OQS_SHA3_shake256_stack_ctx ctx;
+	const uint8_t domain = DOMAIN_GENERATE;
+
+	OQS_SHA3_shake256_stack_init(&ctx);
+	OQS_SHA3_shake256_stack_absorb(&ctx, &domain, 1);
+	OQS_SHA3_shake256_stack_absorb(&ctx, rng->key, KEY_BYTES);
+	OQS_SHA3_shake256_stack_finalize(&ctx);
+	OQS_SHA3_shake256_stack_squeeze(rng->key, KEY_BYTES, &ctx);
+	OQS_SHA3_shake256_stack_squeeze(out, outlen, &ctx);
+	OQS_SHA3_shake256_stack_ctx_release(&ctx);
+}
+
+static void rng_reseed(buffered_rng *rng) {
+	OQS_SHA3_shake256_stack_ctx ctx;
+	const uint8_t domain = DOMAIN_RESEED;
+	uint8_t entropy[KEY_BYTES];
+
+	OQS_randombytes_system(entropy, sizeof(entropy));
+	OQS_SHA3_shake256_stack_init(&ctx);
+	OQS_SHA3_shake256_stack_absorb(&ctx, &domain, 1);
+	OQS_SHA3_shake256_stack_absorb(&ctx, rng->key, KEY_BYTES);
+	OQS_SHA3_shake256_stack_absorb(&ctx, entropy, sizeof(entropy));
+	OQS_SHA3_shake256_stack_finalize(&ctx);
+	OQS_SHA3_shake256_stack_squeeze(rng->key, KEY_BYTES, &ctx);
+	OQS_SHA3_shake256_stack_ctx_release(&ctx);
+	OQS_MEM_cleanse(entropy, sizeof(entropy));
+
+	/* drop output buffered under the previous key */
+	OQS_MEM_cleanse(rng->buf, BUF_BYTES);
+	rng->buf_pos = BUF_BYTES;
+	rng->output_since_seed = 0;
+	rng->fork_generation = fork_generation;
+	rng->seeded = 1;
+}
+
+static buffered_rng *thread_rng(void) {
+	buffered_rng *rng;
+
+	if (!rng_key_ready()) {
+		exit(EXIT_FAILURE);
+	}
+	rng = pthread_getspecific(rng_key);
+	if (rng == NULL) {
+		rng = OQS_MEM_malloc(sizeof(buffered_rng));
+		OQS_EXIT_IF_NULLPTR(rng, "randombytes");
+		memset(rng, 0, sizeof(buffered_rng));
+		pthread_mutex_lock(&rng_lock);
+		rng->next = rng_list;
+		if (rng_list) {
+			rng_list->prev = rng;
+		}
+		rng_list = rng;
+		pthread_mutex_unlock(&rng_lock);
+		if (pthread_setspecific(rng_key, rng)) {
+			exit(EXIT_FAILURE);
+		}
+	}
+	return rng;
+}
+
+void OQS_randombytes_buffered(uint8_t *random_array, size_t bytes_to_read) {
+	buffered_rng *rng = thread_rng();
+
+	if (!rng->seeded || rng->fork_generation != fork_generation ||
+	        rng->output_since_seed >= RESEED_INTERVAL) {
+		rng_reseed(rng);
+	}
+	rng->output_since_seed += bytes_to_read;
+
+	if (bytes_to_read >= BUF_BYTES) {
+		rng_generate(rng, random_array, bytes_to_read);
+		return;
+	}
+	while (bytes_to_read > 0) {
+		size_t n;
+		if (rng->buf_pos == BUF_BYTES) {
+			rng_generate(rng, rng->buf, BUF_BYTES);
+			rng->buf_pos = 0;
+		}
+		n = BUF_BYTES - rng->buf_pos;
+		if (n > bytes_to_read) {
+			n = bytes_to_read;
+		}
+		memcpy(random_array, rng->buf + rng->buf_pos, n);
+		OQS_MEM_cleanse(rng->buf + rng->buf_pos, n);
+		rng->buf_pos += n;
+		random_array += n;
+		bytes_to_read -= n;
+	}
+}
+
+void oqs_randombytes_buffered_release(void) {
+	buffered_rng *rng;
+
+	if (!rng_key_created()) {
+		return;
+	}
+	rng = pthread_getspecific(rng_key);
+	if (rng != NULL) {
+		pthread_setspecific(rng_key, NULL);
+		free_rng(rng);
+	}
+}
+
+void oqs_randombytes_buffered_destroy(void) {
+	buffered_rng *rng;
+
+	pthread_mutex_lock(&rng_lock);
+	while ((rng = rng_list) != NULL) {
+		unlink_rng(rng);
+		OQS_MEM_secure_free(rng, sizeof(buffered_rng));
+	}
+	if (rng_key_ok) {
+		pthread_key_delete(rng_key);
+		__atomic_store_n(&rng_key_ok, 0, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&rng_lock);
+}
+
+#endif
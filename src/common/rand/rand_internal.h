@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: MIT
+#ifndef OQS_RAND_INTERNAL_H
+#define OQS_RAND_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <oqs/common.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void OQS_randombytes_system(uint8_t *random_array, size_t bytes_to_read);
+
+/* Removes the calling thread's OQS_randombytes_thread_custom_algorithm binding */
+void oqs_randombytes_thread_release(void);
+
+/* Removes the bindings of all threads and deletes their thread key */
+void oqs_randombytes_thread_destroy(void);
+
+#if defined(OQS_USE_PTHREADS)
+void OQS_randombytes_buffered(uint8_t *random_array, size_t bytes_to_read);
+
+/* Frees the calling thread's OQS_RAND_alg_buffered generator */
+void oqs_randombytes_buffered_release(void);
+
+/* Frees the generators of all threads and deletes their thread key */
+void oqs_randombytes_buffered_destroy(void);
+#endif
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // OQS_RAND_INTERNAL_H
@@ -59,7 +59,7 @@ static void AES256_ECB(unsigned char *key, unsigned char *ctr, unsigned char *bu
 #endif
 }
 
-void OQS_randombytes_nist_kat_init_256bit(const uint8_t *entropy_input, const uint8_t *personalization_string) {
+void OQS_randombytes_nist_kat_ctx_init_256bit(OQS_NIST_DRBG_struct *ctx, const uint8_t *entropy_input, const uint8_t *personalization_string) {
 	unsigned char seed_material[48];
 
 	memcpy(seed_material, entropy_input, 48);
@@ -67,27 +67,27 @@ void OQS_randombytes_nist_kat_init_256bit(const uint8_t *entropy_input, const ui
 		for (int i = 0; i < 48; i++) {
 			seed_material[i] ^= personalization_string[i];
 		}
-	memset(DRBG_ctx.Key, 0x00, 32);
-	memset(DRBG_ctx.V, 0x00, 16);
-	AES256_CTR_DRBG_Update(seed_material, DRBG_ctx.Key, DRBG_ctx.V);
-	DRBG_ctx.reseed_counter = 1;
+	memset(ctx->Key, 0x00, 32);
+	memset(ctx->V, 0x00, 16);
+	AES256_CTR_DRBG_Update(seed_material, ctx->Key, ctx->V);
+	ctx->reseed_counter = 1;
 }
 
-void OQS_randombytes_nist_kat(unsigned char *x, size_t xlen) {
+void OQS_randombytes_nist_kat_ctx(OQS_NIST_DRBG_struct *ctx, uint8_t *x, size_t xlen) {
 	unsigned char block[16];
 	int i = 0;
 
 	while (xlen > 0) {
 		//increment V
 		for (int j = 15; j >= 0; j--) {
-			if (DRBG_ctx.V[j] == 0xff) {
-				DRBG_ctx.V[j] = 0x00;
+			if (ctx->V[j] == 0xff) {
+				ctx->V[j] = 0x00;
 			} else {
-				DRBG_ctx.V[j]++;
+				ctx->V[j]++;
 				break;
 			}
 		}
-		AES256_ECB(DRBG_ctx.Key, DRBG_ctx.V, block);
+		AES256_ECB(ctx->Key, ctx->V, block);
 		if (xlen > 15) {
 			memcpy(x + i, block, 16);
 			i += 16;
@@ -97,8 +97,16 @@ void OQS_randombytes_nist_kat(unsigned char *x, size_t xlen) {
 			xlen = 0;
 		}
 	}
-	AES256_CTR_DRBG_Update(NULL, DRBG_ctx.Key, DRBG_ctx.V);
-	DRBG_ctx.reseed_counter++;
+	AES256_CTR_DRBG_Update(NULL, ctx->Key, ctx->V);
+	ctx->reseed_counter++;
+}
+
+void OQS_randombytes_nist_kat_init_256bit(const uint8_t *entropy_input, const uint8_t *personalization_string) {
+	OQS_randombytes_nist_kat_ctx_init_256bit(&DRBG_ctx, entropy_input, personalization_string);
+}
+
+void OQS_randombytes_nist_kat(unsigned char *x, size_t xlen) {
+	OQS_randombytes_nist_kat_ctx(&DRBG_ctx, x, xlen);
 }
 
 void OQS_randombytes_nist_kat_get_state(void *out) {
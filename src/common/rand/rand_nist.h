@@ -11,12 +11,35 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/** State of one instance of the NIST AES-256 CTR-DRBG. */
 typedef struct {
 	unsigned char Key[32];
 	unsigned char V[16];
 	int reseed_counter;
 } OQS_NIST_DRBG_struct;
 
+/**
+ * Initializes the NIST DRBG instance ctx with a given seed and with 256-bit security.
+ *
+ * Instances are independent of each other and of the DRBG used by
+ * OQS_randombytes_nist_kat, so different threads can each use their own.
+ *
+ * @param[out] ctx The DRBG instance to initialize
+ * @param[in] entropy_input The seed; must be exactly 48 bytes
+ * @param[in] personalization_string An optional personalization string;
+ * may be NULL; if not NULL, must be at least 48 bytes long
+ */
+void OQS_randombytes_nist_kat_ctx_init_256bit(OQS_NIST_DRBG_struct *ctx, const uint8_t *entropy_input, const uint8_t *personalization_string);
+
+/**
+ * Fills the given memory with the requested number of pseudorandom bytes using the NIST DRBG instance ctx.
+ *
+ * @param[in,out] ctx The DRBG instance, initialized by OQS_randombytes_nist_kat_ctx_init_256bit
+ * @param[out] random_array Pointer to the memory to fill with (pseudo)random bytes
+ * @param[in] bytes_to_read The number of random bytes to read into memory
+ */
+void OQS_randombytes_nist_kat_ctx(OQS_NIST_DRBG_struct *ctx, uint8_t *random_array, size_t bytes_to_read);
+
 /**
  * Initializes the NIST DRBG with a given seed and with 256-bit security.
  *
@@ -78,6 +78,28 @@ void OQS_SHA2_sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
 	callbacks->SHA2_sha256(out, in, inlen);
 }
 
+void OQS_SHA2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                        size_t inlen) {
+	/* The eight-way path is not part of the callback table, so only take it
+	 * when the caller has not replaced the SHA-2 implementation. */
+	if (callbacks == &sha2_default_callbacks) {
+		oqs_sha2_sha256_x8(out0, out1, out2, out3, out4, out5, out6, out7,
+		                   in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA2_sha256(out0, in0, inlen);
+	callbacks->SHA2_sha256(out1, in1, inlen);
+	callbacks->SHA2_sha256(out2, in2, inlen);
+	callbacks->SHA2_sha256(out3, in3, inlen);
+	callbacks->SHA2_sha256(out4, in4, inlen);
+	callbacks->SHA2_sha256(out5, in5, inlen);
+	callbacks->SHA2_sha256(out6, in6, inlen);
+	callbacks->SHA2_sha256(out7, in7, inlen);
+}
+
 void OQS_SHA2_sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
 	callbacks->SHA2_sha384(out, in, inlen);
 }
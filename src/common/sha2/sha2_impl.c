@@ -6,8 +6,17 @@
 #include "sha2.h"
 #include "sha2_local.h"
 
-#if defined(OQS_DIST_ARM64_V8_BUILD)
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#if defined(OQS_DIST_X86_64_BUILD)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    do { \
+        if (OQS_CPU_has_extension(OQS_CPU_EXT_SHA)) {  \
+            stmt_ni; \
+        } else { \
+            stmt_c; \
+        } \
+    } while(0)
+#elif defined(OQS_DIST_ARM64_V8_BUILD)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     do { \
         if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_SHA2)) {  \
             stmt_arm; \
@@ -15,11 +24,31 @@
             stmt_c; \
         } \
     } while(0)
+#elif defined(OQS_USE_SHA_INSTRUCTIONS)
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    stmt_ni
 #elif defined(OQS_USE_ARM_SHA2_INSTRUCTIONS)
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
     stmt_arm
 #else
-#define C_OR_ARM(stmt_c, stmt_arm) \
+#define C_OR_NI_OR_ARM(stmt_c, stmt_ni, stmt_arm) \
+    stmt_c
+#endif
+
+#if defined(OQS_DIST_X86_64_BUILD)
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
+    do { \
+        if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {  \
+            stmt_avx2; \
+        } else { \
+            stmt_c; \
+        } \
+    } while(0)
+#elif defined(OQS_USE_AVX2_INSTRUCTIONS)
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
+    stmt_avx2
+#else
+#define C_OR_AVX2(stmt_c, stmt_avx2) \
     stmt_c
 #endif
 
@@ -32,21 +61,27 @@ static void SHA2_sha256_inc_ctx_clone(OQS_SHA2_sha256_ctx *dest, const OQS_SHA2_
 }
 
 static void SHA2_sha256_inc(OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t len) {
-	C_OR_ARM(
+	C_OR_NI_OR_ARM(
 	    oqs_sha2_sha256_inc_c((sha256ctx *) state, in, len),
+	    oqs_sha2_sha256_inc_ni((sha256ctx *) state, in, len),
 	    oqs_sha2_sha256_inc_armv8((sha256ctx *) state, in, len)
 	);
 }
 
 static void SHA2_sha256_inc_blocks(OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t inblocks) {
-	C_OR_ARM(
+	C_OR_NI_OR_ARM(
 	    oqs_sha2_sha256_inc_blocks_c((sha256ctx *) state, in, inblocks),
+	    oqs_sha2_sha256_inc_blocks_ni((sha256ctx *) state, in, inblocks),
 	    oqs_sha2_sha256_inc_blocks_armv8((sha256ctx *) state, in, inblocks)
 	);
 }
 
 static void SHA2_sha256_inc_finalize(uint8_t *out, OQS_SHA2_sha256_ctx *state, const uint8_t *in, size_t inlen) {
-	oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen);
+	C_OR_NI_OR_ARM(
+	    oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen),
+	    oqs_sha2_sha256_inc_finalize_ni(out, (sha256ctx *) state, in, inlen),
+	    oqs_sha2_sha256_inc_finalize_c(out, (sha256ctx *) state, in, inlen)
+	);
 }
 
 static void SHA2_sha256_inc_ctx_release(OQS_SHA2_sha256_ctx *state) {
@@ -94,12 +129,41 @@ static void SHA2_sha512_inc_ctx_release(OQS_SHA2_sha512_ctx *state) {
 }
 
 static void SHA2_sha256(uint8_t *out, const uint8_t *in, size_t inlen) {
-	C_OR_ARM (
+	C_OR_NI_OR_ARM(
 	    oqs_sha2_sha256_c(out, in, inlen),
+	    oqs_sha2_sha256_ni(out, in, inlen),
 	    oqs_sha2_sha256_armv8(out, in, inlen)
 	);
 }
 
+static void SHA2_sha256_x8_serial(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                                  uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                                  const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                                  const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                                  size_t inlen) {
+	SHA2_sha256(out0, in0, inlen);
+	SHA2_sha256(out1, in1, inlen);
+	SHA2_sha256(out2, in2, inlen);
+	SHA2_sha256(out3, in3, inlen);
+	SHA2_sha256(out4, in4, inlen);
+	SHA2_sha256(out5, in5, inlen);
+	SHA2_sha256(out6, in6, inlen);
+	SHA2_sha256(out7, in7, inlen);
+}
+
+void oqs_sha2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                        size_t inlen) {
+	C_OR_AVX2(
+	    SHA2_sha256_x8_serial(out0, out1, out2, out3, out4, out5, out6, out7,
+	                          in0, in1, in2, in3, in4, in5, in6, in7, inlen),
+	    oqs_sha2_sha256_x8_avx2(out0, out1, out2, out3, out4, out5, out6, out7,
+	                            in0, in1, in2, in3, in4, in5, in6, in7, inlen)
+	);
+}
+
 static void SHA2_sha384(uint8_t *out, const uint8_t *in, size_t inlen) {
 	oqs_sha2_sha384_c(out, in, inlen);
 }
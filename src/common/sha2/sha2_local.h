@@ -84,11 +84,31 @@ void oqs_sha2_sha384_inc_blocks_armv8(sha384ctx *state, const uint8_t *in, size_
 void oqs_sha2_sha384_inc_finalize_armv8(uint8_t *out, sha384ctx *state, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha384_inc_ctx_release_armv8(sha384ctx *state);
 
+// x86 SHA extensions functions
+void oqs_sha2_sha256_inc_blocks_ni(sha256ctx *state, const uint8_t *in, size_t inblocks);
+void oqs_sha2_sha256_inc_ni(sha256ctx *state, const uint8_t *in, size_t len);
+void oqs_sha2_sha256_inc_finalize_ni(uint8_t *out, sha256ctx *state, const uint8_t *in, size_t inlen);
+void oqs_sha2_sha256_ni(uint8_t *out, const uint8_t *in, size_t inlen);
+
 void oqs_sha2_sha224_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha256_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha384_c(uint8_t *out, const uint8_t *in, size_t inlen);
 void oqs_sha2_sha512_c(uint8_t *out, const uint8_t *in, size_t inlen);
 
+// Eight-way SHA-256 backing OQS_SHA2_sha256_x8 when the default callbacks are in use
+void oqs_sha2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                        size_t inlen);
+
+// AVX2 functions
+void oqs_sha2_sha256_x8_avx2(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                             uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                             const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                             const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                             size_t inlen);
+
 extern struct OQS_SHA2_callbacks sha2_default_callbacks;
 
 #if defined(__cplusplus)
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+
+/*
+ * SHA-256 using the x86 SHA extensions (SHA-NI).
+ *
+ * The state layout is the one of sha2_c.c (32 bytes of big-endian state words
+ * followed by a 64-bit big-endian byte count), so contexts can be freely mixed
+ * with the C implementation. The compression function follows the public
+ * domain SHA-NI code by Jeffrey Walton and Sean Gulley (Intel).
+ */
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <oqs/common.h>
+
+#include "sha2_local.h"
+
+static const uint32_t K256[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint8_t iv_256[32] = {
+	0x6a, 0x09, 0xe6, 0x67, 0xbb, 0x67, 0xae, 0x85,
+	0x3c, 0x6e, 0xf3, 0x72, 0xa5, 0x4f, 0xf5, 0x3a,
+	0x51, 0x0e, 0x52, 0x7f, 0x9b, 0x05, 0x68, 0x8c,
+	0x1f, 0x83, 0xd9, 0xab, 0x5b, 0xe0, 0xcd, 0x19
+};
+
+static uint64_t load_bigendian_64(const uint8_t *x) {
+	return (uint64_t)(x[7]) | (((uint64_t)(x[6])) << 8) |
+	       (((uint64_t)(x[5])) << 16) | (((uint64_t)(x[4])) << 24) |
+	       (((uint64_t)(x[3])) << 32) | (((uint64_t)(x[2])) << 40) |
+	       (((uint64_t)(x[1])) << 48) | (((uint64_t)(x[0])) << 56);
+}
+
+static void store_bigendian_64(uint8_t *x, uint64_t u) {
+	x[7] = (uint8_t)u;
+	u >>= 8;
+	x[6] = (uint8_t)u;
+	u >>= 8;
+	x[5] = (uint8_t)u;
+	u >>= 8;
+	x[4] = (uint8_t)u;
+	u >>= 8;
+	x[3] = (uint8_t)u;
+	u >>= 8;
+	x[2] = (uint8_t)u;
+	u >>= 8;
+	x[1] = (uint8_t)u;
+	u >>= 8;
+	x[0] = (uint8_t)u;
+}
+
+/* Four rounds on the message words in msg */
+#define ROUNDS4(msg, k) \
+	MSG = _mm_add_epi32(msg, _mm_loadu_si128((const __m128i *)(k))); \
+	STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG); \
+	MSG = _mm_shuffle_epi32(MSG, 0x0E); \
+	STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG)
+
+/* Finish the next four message words from the current and previous ones */
+#define EXPAND4(next, cur, prev) \
+	next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(cur, prev, 4)), cur)
+
+/* Four rounds that also advance the message schedule */
+#define STEP4(cur, prev, next, k) \
+	ROUNDS4(cur, k); \
+	EXPAND4(next, cur, prev); \
+	prev = _mm_sha256msg1_epu32(prev, cur)
+
+/*
+ * Hashes the whole 64-byte blocks of data into statebytes and returns the
+ * number of trailing bytes that were left over.
+ */
+static size_t crypto_hashblocks_sha256_ni(uint8_t *statebytes,
+        const uint8_t *data, size_t length) {
+	const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i STATE0, STATE1, MSG, TMP;
+	__m128i MSG0, MSG1, MSG2, MSG3;
+	__m128i ABEF_SAVE, CDGH_SAVE;
+
+	/* load state and rearrange it into the ABEF/CDGH order used by the instructions */
+	TMP = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(statebytes + 0)), MASK);
+	STATE1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(statebytes + 16)), MASK);
+	TMP = _mm_shuffle_epi32(TMP, 0xB1);
+	STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);
+	STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);
+	STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);
+
+	while (length >= 64) {
+		ABEF_SAVE = STATE0;
+		CDGH_SAVE = STATE1;
+
+		MSG0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), MASK);
+		MSG1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), MASK);
+		MSG2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), MASK);
+		MSG3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), MASK);
+
+		ROUNDS4(MSG0, K256 + 0);
+		ROUNDS4(MSG1, K256 + 4);
+		MSG0 = _mm_sha256msg1_epu32(MSG0, MSG1);
+		ROUNDS4(MSG2, K256 + 8);
+		MSG1 = _mm_sha256msg1_epu32(MSG1, MSG2);
+		STEP4(MSG3, MSG2, MSG0, K256 + 12);
+		STEP4(MSG0, MSG3, MSG1, K256 + 16);
+		STEP4(MSG1, MSG0, MSG2, K256 + 20);
+		STEP4(MSG2, MSG1, MSG3, K256 + 24);
+		STEP4(MSG3, MSG2, MSG0, K256 + 28);
+		STEP4(MSG0, MSG3, MSG1, K256 + 32);
+		STEP4(MSG1, MSG0, MSG2, K256 + 36);
+		STEP4(MSG2, MSG1, MSG3, K256 + 40);
+		STEP4(MSG3, MSG2, MSG0, K256 + 44);
+		STEP4(MSG0, MSG3, MSG1, K256 + 48);
+		ROUNDS4(MSG1, K256 + 52);
+		EXPAND4(MSG2, MSG1, MSG0);
+		ROUNDS4(MSG2, K256 + 56);
+		EXPAND4(MSG3, MSG2, MSG1);
+		ROUNDS4(MSG3, K256 + 60);
+
+		STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+		STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+
+		data += 64;
+		length -= 64;
+	}
+
+	/* back to ABCD/EFGH, stored big-endian */
+	TMP = _mm_shuffle_epi32(STATE0, 0x1B);
+	STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);
+	STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);
+	STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);
+	_mm_storeu_si128((__m128i *)(statebytes + 0), _mm_shuffle_epi8(STATE0, MASK));
+	_mm_storeu_si128((__m128i *)(statebytes + 16), _mm_shuffle_epi8(STATE1, MASK));
+
+	return length;
+}
+
+/*
+ * Hashes the remaining input, pads the last (less than 64) bytes of a message
+ * that is bytes long in total, and writes the digest to out.
+ */
+static void sha256_ni_final(uint8_t *out, uint8_t *statebytes,
+                            const uint8_t *in, size_t inlen, uint64_t bytes) {
+	uint8_t padded[128];
+	size_t tail = crypto_hashblocks_sha256_ni(statebytes, in, inlen);
+	size_t padded_len = tail < 56 ? 64 : 128;
+
+	if (tail) {
+		memcpy(padded, in + inlen - tail, tail);
+	}
+	padded[tail] = 0x80;
+	memset(padded + tail + 1, 0, padded_len - 8 - tail - 1);
+	store_bigendian_64(padded + padded_len - 8, bytes << 3);
+	crypto_hashblocks_sha256_ni(statebytes, padded, padded_len);
+	memcpy(out, statebytes, 32);
+
+	OQS_MEM_cleanse(padded, sizeof(padded));
+}
+
+void oqs_sha2_sha256_inc_ni(sha256ctx *state, const uint8_t *in, size_t len) {
+	uint64_t bytes;
+	size_t blocks_len;
+
+	if (len == 0) {
+		return;
+	}
+	bytes = load_bigendian_64(state->ctx + 32);
+
+	/* Top up a partially filled block first */
+	if (state->data_len) {
+		size_t incr = 64 - state->data_len;
+		if (incr > len) {
+			incr = len;
+		}
+		memcpy(state->data + state->data_len, in, incr);
+		state->data_len += incr;
+		in += incr;
+		len -= incr;
+		if (state->data_len < 64) {
+			return;
+		}
+		crypto_hashblocks_sha256_ni(state->ctx, state->data, 64);
+		bytes += 64;
+		state->data_len = 0;
+	}
+
+	/* Then hash whole blocks straight from the input */
+	blocks_len = len & ~(size_t)63;
+	crypto_hashblocks_sha256_ni(state->ctx, in, blocks_len);
+	bytes += blocks_len;
+	store_bigendian_64(state->ctx + 32, bytes);
+
+	if (len > blocks_len) {
+		memcpy(state->data, in + blocks_len, len - blocks_len);
+		state->data_len = len - blocks_len;
+	}
+}
+
+void oqs_sha2_sha256_inc_blocks_ni(sha256ctx *state, const uint8_t *in, size_t inblocks) {
+	uint64_t bytes;
+
+	/* Buffered data shifts the block boundaries; the remainder stays buffered */
+	if (state->data_len) {
+		oqs_sha2_sha256_inc_ni(state, in, 64 * inblocks);
+		return;
+	}
+
+	bytes = load_bigendian_64(state->ctx + 32);
+	crypto_hashblocks_sha256_ni(state->ctx, in, 64 * inblocks);
+	bytes += 64 * inblocks;
+	store_bigendian_64(state->ctx + 32, bytes);
+}
+
+void oqs_sha2_sha256_inc_finalize_ni(uint8_t *out, sha256ctx *state, const uint8_t *in, size_t inlen) {
+	/* Merge the final input with any buffered data */
+	if (state->data_len) {
+		if (in && inlen) {
+			oqs_sha2_sha256_inc_ni(state, in, inlen);
+		}
+		in = state->data;
+		inlen = state->data_len;
+	}
+
+	sha256_ni_final(out, state->ctx, in, inlen, load_bigendian_64(state->ctx + 32) + inlen);
+
+	oqs_sha2_sha256_inc_ctx_release_c(state);
+}
+
+void oqs_sha2_sha256_ni(uint8_t *out, const uint8_t *in, size_t inlen) {
+	uint8_t statebytes[32];
+
+	memcpy(statebytes, iv_256, sizeof(statebytes));
+	sha256_ni_final(out, statebytes, in, inlen, inlen);
+
+	OQS_MEM_cleanse(statebytes, sizeof(statebytes));
+}
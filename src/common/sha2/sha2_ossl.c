@@ -16,12 +16,11 @@
 static void do_hash(uint8_t *output, const uint8_t *input, size_t inplen, const EVP_MD *md) {
 	EVP_MD_CTX *mdctx;
 	unsigned int outlen;
-	mdctx = OSSL_FUNC(EVP_MD_CTX_new)();
+	mdctx = oqs_md_ctx_get(md);
 	OQS_EXIT_IF_NULLPTR(mdctx, "OpenSSL");
-	OQS_OPENSSL_GUARD(OSSL_FUNC(EVP_DigestInit_ex)(mdctx, md, NULL));
 	OQS_OPENSSL_GUARD(OSSL_FUNC(EVP_DigestUpdate)(mdctx, input, inplen));
 	OQS_OPENSSL_GUARD(OSSL_FUNC(EVP_DigestFinal_ex)(mdctx, output, &outlen));
-	OSSL_FUNC(EVP_MD_CTX_free)(mdctx);
+	oqs_md_ctx_put(mdctx);
 }
 
 static void SHA2_sha256(uint8_t *output, const uint8_t *input, size_t inplen) {
@@ -153,6 +152,21 @@ static void SHA2_sha512_inc_ctx_clone(OQS_SHA2_sha512_ctx *dest, const OQS_SHA2_
 	OQS_OPENSSL_GUARD(OSSL_FUNC(EVP_MD_CTX_copy_ex)((EVP_MD_CTX *) dest->ctx, (EVP_MD_CTX *) src->ctx));
 }
 
+void oqs_sha2_sha256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                        uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7,
+                        const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3,
+                        const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7,
+                        size_t inlen) {
+	SHA2_sha256(out0, in0, inlen);
+	SHA2_sha256(out1, in1, inlen);
+	SHA2_sha256(out2, in2, inlen);
+	SHA2_sha256(out3, in3, inlen);
+	SHA2_sha256(out4, in4, inlen);
+	SHA2_sha256(out5, in5, inlen);
+	SHA2_sha256(out6, in6, inlen);
+	SHA2_sha256(out7, in7, inlen);
+}
+
 struct OQS_SHA2_callbacks sha2_default_callbacks = {
 	SHA2_sha256,
 	SHA2_sha256_inc_init,
@@ -16,20 +16,20 @@
 
 static void do_hash(uint8_t *output, const uint8_t *input, size_t inplen, const EVP_MD *md) {
 	EVP_MD_CTX *mdctx;
-	mdctx = OSSL_FUNC(EVP_MD_CTX_new)();
-	OSSL_FUNC(EVP_DigestInit_ex)(mdctx, md, NULL);
+	mdctx = oqs_md_ctx_get(md);
+	OQS_EXIT_IF_NULLPTR(mdctx, "OpenSSL");
 	OSSL_FUNC(EVP_DigestUpdate)(mdctx, input, inplen);
 	OSSL_FUNC(EVP_DigestFinal_ex)(mdctx, output, NULL);
-	OSSL_FUNC(EVP_MD_CTX_free)(mdctx);
+	oqs_md_ctx_put(mdctx);
 }
 
 static void do_xof(uint8_t *output, size_t outlen, const uint8_t *input, size_t inplen, const EVP_MD *md) {
 	EVP_MD_CTX *mdctx;
-	mdctx = OSSL_FUNC(EVP_MD_CTX_new)();
-	OSSL_FUNC(EVP_DigestInit_ex)(mdctx, md, NULL);
+	mdctx = oqs_md_ctx_get(md);
+	OQS_EXIT_IF_NULLPTR(mdctx, "OpenSSL");
 	OSSL_FUNC(EVP_DigestUpdate)(mdctx, input, inplen);
 	OSSL_FUNC(EVP_DigestFinalXOF)(mdctx, output, outlen);
-	OSSL_FUNC(EVP_MD_CTX_free)(mdctx);
+	oqs_md_ctx_put(mdctx);
 }
 
 /* SHA3-256 */
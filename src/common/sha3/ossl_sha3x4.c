@@ -256,6 +256,18 @@ static void SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state)
 	s->n_out = 0;
 }
 
+/* Eight-way SHAKE */
+
+void oqs_sha3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+	SHA3_shake128_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+}
+
+void oqs_sha3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+	SHA3_shake256_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+}
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
 struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
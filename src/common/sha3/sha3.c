@@ -4,8 +4,18 @@
 
 #include "sha3.h"
 
+#include <string.h>
+
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
 
+#if !defined(OQS_USE_SHA3_OPENSSL)
+/* Implemented next to sha3_default_callbacks; s holds 25 lanes and the byte position */
+void oqs_sha3_keccak_inc_reset(uint64_t *s);
+void oqs_sha3_keccak_inc_absorb(uint64_t *s, uint32_t r, const uint8_t *m, size_t mlen);
+void oqs_sha3_keccak_inc_finalize(uint64_t *s, uint32_t r, uint8_t p);
+void oqs_sha3_keccak_inc_squeeze(uint8_t *h, size_t outlen, uint64_t *s, uint32_t r);
+#endif
+
 static struct OQS_SHA3_callbacks *callbacks = &sha3_default_callbacks;
 
 OQS_API void OQS_SHA3_set_callbacks(struct OQS_SHA3_callbacks *new_callbacks) {
@@ -159,3 +169,144 @@ void OQS_SHA3_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_
 void OQS_SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state) {
 	callbacks->SHA3_shake256_inc_ctx_reset(state);
 }
+
+void OQS_SHA3_shake128_stack_init(OQS_SHA3_shake128_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	/* OpenSSL and replaced callbacks keep their state behind the wrapped incremental context */
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_init(&state->inc);
+}
+
+void OQS_SHA3_shake128_stack_absorb(OQS_SHA3_shake128_stack_ctx *state, const uint8_t *input, size_t inlen) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_absorb(state->s, OQS_SHA3_SHAKE128_RATE, input, inlen);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_absorb(&state->inc, input, inlen);
+}
+
+void OQS_SHA3_shake128_stack_finalize(OQS_SHA3_shake128_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_finalize(state->s, OQS_SHA3_SHAKE128_RATE, 0x1F);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_finalize(&state->inc);
+}
+
+void OQS_SHA3_shake128_stack_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake128_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_squeeze(output, outlen, state->s, OQS_SHA3_SHAKE128_RATE);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_squeeze(output, outlen, &state->inc);
+}
+
+void OQS_SHA3_shake128_stack_ctx_release(OQS_SHA3_shake128_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		OQS_MEM_cleanse(state->s, sizeof(state->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_ctx_release(&state->inc);
+}
+
+void OQS_SHA3_shake128_stack_ctx_clone(OQS_SHA3_shake128_stack_ctx *dest, const OQS_SHA3_shake128_stack_ctx *src) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		memcpy(dest->s, src->s, sizeof(src->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_ctx_clone(&dest->inc, &src->inc);
+}
+
+void OQS_SHA3_shake128_stack_ctx_reset(OQS_SHA3_shake128_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_inc_ctx_reset(&state->inc);
+}
+
+void OQS_SHA3_shake256_stack_init(OQS_SHA3_shake256_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_init(&state->inc);
+}
+
+void OQS_SHA3_shake256_stack_absorb(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *input, size_t inlen) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_absorb(state->s, OQS_SHA3_SHAKE256_RATE, input, inlen);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_absorb(&state->inc, input, inlen);
+}
+
+void OQS_SHA3_shake256_stack_finalize(OQS_SHA3_shake256_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_finalize(state->s, OQS_SHA3_SHAKE256_RATE, 0x1F);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_finalize(&state->inc);
+}
+
+void OQS_SHA3_shake256_stack_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake256_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_squeeze(output, outlen, state->s, OQS_SHA3_SHAKE256_RATE);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_squeeze(output, outlen, &state->inc);
+}
+
+void OQS_SHA3_shake256_stack_ctx_release(OQS_SHA3_shake256_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		OQS_MEM_cleanse(state->s, sizeof(state->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_ctx_release(&state->inc);
+}
+
+void OQS_SHA3_shake256_stack_ctx_clone(OQS_SHA3_shake256_stack_ctx *dest, const OQS_SHA3_shake256_stack_ctx *src) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		memcpy(dest->s, src->s, sizeof(src->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_ctx_clone(&dest->inc, &src->inc);
+}
+
+void OQS_SHA3_shake256_stack_ctx_reset(OQS_SHA3_shake256_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_default_callbacks) {
+		oqs_sha3_keccak_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_inc_ctx_reset(&state->inc);
+}
@@ -393,6 +393,163 @@ void OQS_SHA3_shake256_inc_ctx_clone(OQS_SHA3_shake256_inc_ctx *dest, const OQS_
  */
 void OQS_SHA3_shake256_inc_ctx_reset(OQS_SHA3_shake256_inc_ctx *state);
 
+/* SHAKE with caller-allocated state */
+
+/** Alignment of the Keccak state stored inside the stack context types */
+#define OQS_SHA3_STACK_CTX_ALIGNMENT 32
+
+/** \cond */
+#if defined(__cplusplus)
+#define OQS_SHA3_STACK_CTX_ALIGNAS alignas(OQS_SHA3_STACK_CTX_ALIGNMENT)
+#elif defined(_MSC_VER)
+#define OQS_SHA3_STACK_CTX_ALIGNAS __declspec(align(32))
+#else
+#define OQS_SHA3_STACK_CTX_ALIGNAS _Alignas(OQS_SHA3_STACK_CTX_ALIGNMENT)
+#endif
+/** \endcond */
+
+/**
+ * Data structure for the state of the SHAKE-128 API with caller-allocated state.
+ *
+ * Unlike OQS_SHA3_shake128_inc_ctx, the Keccak state is stored in the structure
+ * itself, so it can live on the stack or inside another structure and none of
+ * the OQS_SHA3_shake128_stack functions allocate memory. When the SHA3 callbacks
+ * have been replaced, or when SHA3 is provided by OpenSSL, the structure wraps an
+ * incremental context instead and the functions forward to the incremental API.
+ */
+typedef union {
+	/** Keccak state: 25 lanes followed by the byte position within the current block. */
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	/** Incremental context, used when the built-in Keccak implementation is not. */
+	OQS_SHA3_shake128_inc_ctx inc;
+} OQS_SHA3_shake128_stack_ctx;
+
+/**
+ * \brief Initialize a caller-allocated SHAKE-128 state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake128_stack_ctx_release.
+ *
+ * \param state The function state to be initialized
+ */
+void OQS_SHA3_shake128_stack_init(OQS_SHA3_shake128_stack_ctx *state);
+
+/**
+ * \brief Absorb an input into a caller-allocated SHAKE-128 state.
+ *
+ * \param state The function state; must be initialized
+ * \param input input buffer
+ * \param inlen length of input buffer
+ */
+void OQS_SHA3_shake128_stack_absorb(OQS_SHA3_shake128_stack_ctx *state, const uint8_t *input, size_t inlen);
+
+/**
+ * \brief Prepare a caller-allocated SHAKE-128 state for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_stack_finalize(OQS_SHA3_shake128_stack_ctx *state);
+
+/**
+ * \brief Squeeze output from a caller-allocated SHAKE-128 state.
+ *
+ * \param output output buffer
+ * \param outlen bytes of output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake128_stack_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake128_stack_ctx *state);
+
+/**
+ * \brief Release a caller-allocated SHAKE-128 state; the Keccak state is zeroized.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_stack_ctx_release(OQS_SHA3_shake128_stack_ctx *state);
+
+/**
+ * \brief Copy a caller-allocated SHAKE-128 state.
+ *
+ * \param dest The function state to copy into; must be initialized
+ * \param src The function state to copy; must be initialized
+ */
+void OQS_SHA3_shake128_stack_ctx_clone(OQS_SHA3_shake128_stack_ctx *dest, const OQS_SHA3_shake128_stack_ctx *src);
+
+/**
+ * \brief Reset a caller-allocated SHAKE-128 state so that it can be reused.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_stack_ctx_reset(OQS_SHA3_shake128_stack_ctx *state);
+
+/**
+ * Data structure for the state of the SHAKE-256 API with caller-allocated state.
+ *
+ * See OQS_SHA3_shake128_stack_ctx.
+ */
+typedef union {
+	/** Keccak state: 25 lanes followed by the byte position within the current block. */
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	/** Incremental context, used when the built-in Keccak implementation is not. */
+	OQS_SHA3_shake256_inc_ctx inc;
+} OQS_SHA3_shake256_stack_ctx;
+
+/**
+ * \brief Initialize a caller-allocated SHAKE-256 state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake256_stack_ctx_release.
+ *
+ * \param state The function state to be initialized
+ */
+void OQS_SHA3_shake256_stack_init(OQS_SHA3_shake256_stack_ctx *state);
+
+/**
+ * \brief Absorb an input into a caller-allocated SHAKE-256 state.
+ *
+ * \param state The function state; must be initialized
+ * \param input input buffer
+ * \param inlen length of input buffer
+ */
+void OQS_SHA3_shake256_stack_absorb(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *input, size_t inlen);
+
+/**
+ * \brief Prepare a caller-allocated SHAKE-256 state for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_stack_finalize(OQS_SHA3_shake256_stack_ctx *state);
+
+/**
+ * \brief Squeeze output from a caller-allocated SHAKE-256 state.
+ *
+ * \param output output buffer
+ * \param outlen bytes of output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake256_stack_squeeze(uint8_t *output, size_t outlen, OQS_SHA3_shake256_stack_ctx *state);
+
+/**
+ * \brief Release a caller-allocated SHAKE-256 state; the Keccak state is zeroized.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_stack_ctx_release(OQS_SHA3_shake256_stack_ctx *state);
+
+/**
+ * \brief Copy a caller-allocated SHAKE-256 state.
+ *
+ * \param dest The function state to copy into; must be initialized
+ * \param src The function state to copy; must be initialized
+ */
+void OQS_SHA3_shake256_stack_ctx_clone(OQS_SHA3_shake256_stack_ctx *dest, const OQS_SHA3_shake256_stack_ctx *src);
+
+/**
+ * \brief Reset a caller-allocated SHAKE-256 state so that it can be reused.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_stack_ctx_reset(OQS_SHA3_shake256_stack_ctx *state);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
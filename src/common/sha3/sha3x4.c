@@ -4,8 +4,22 @@
 
 #include "sha3x4.h"
 
+#include <string.h>
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
+/* Implemented by the backend next to sha3_x4_default_callbacks */
+void oqs_sha3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+void oqs_sha3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen);
+
+#if !defined(OQS_USE_SHA3_OPENSSL)
+/* s holds four interleaved Keccak states and the byte position */
+void oqs_sha3_keccak_x4_inc_reset(uint64_t *s);
+void oqs_sha3_keccak_x4_inc_absorb(uint64_t *s, uint32_t r, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen);
+void oqs_sha3_keccak_x4_inc_finalize(uint64_t *s, uint32_t r, uint8_t p);
+void oqs_sha3_keccak_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, uint64_t *s, uint32_t r);
+#endif
+
 static struct OQS_SHA3_x4_callbacks *callbacks = &sha3_x4_default_callbacks;
 
 OQS_API void OQS_SHA3_x4_set_callbacks(struct OQS_SHA3_x4_callbacks *new_callbacks) {
@@ -16,6 +30,17 @@ void OQS_SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *
 	callbacks->SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
 }
 
+void OQS_SHA3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	/* There is no x8 callback; replaced x4 callbacks must still see every call */
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_shake128_x8(out0, out1, out2, out3, out4, out5, out6, out7, outlen,
+		                     in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+	callbacks->SHA3_shake128_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+}
+
 void OQS_SHA3_shake128_x4_inc_init(OQS_SHA3_shake128_x4_inc_ctx *state) {
 	callbacks->SHA3_shake128_x4_inc_init(state);
 }
@@ -48,6 +73,16 @@ void OQS_SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *
 	callbacks->SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
 }
 
+void OQS_SHA3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_shake256_x8(out0, out1, out2, out3, out4, out5, out6, out7, outlen,
+		                     in0, in1, in2, in3, in4, in5, in6, in7, inlen);
+		return;
+	}
+	callbacks->SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+	callbacks->SHA3_shake256_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+}
+
 void OQS_SHA3_shake256_x4_inc_init(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	callbacks->SHA3_shake256_x4_inc_init(state);
 }
@@ -75,3 +110,143 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(OQS_SHA3_shake256_x4_inc_ctx *dest, cons
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state) {
 	callbacks->SHA3_shake256_x4_inc_ctx_reset(state);
 }
+
+void OQS_SHA3_shake128_x4_stack_init(OQS_SHA3_shake128_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_init(&state->inc);
+}
+
+void OQS_SHA3_shake128_x4_stack_absorb(OQS_SHA3_shake128_x4_stack_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_absorb(state->s, OQS_SHA3_SHAKE128_RATE, in0, in1, in2, in3, inlen);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_absorb(&state->inc, in0, in1, in2, in3, inlen);
+}
+
+void OQS_SHA3_shake128_x4_stack_finalize(OQS_SHA3_shake128_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_finalize(state->s, OQS_SHA3_SHAKE128_RATE, 0x1F);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_finalize(&state->inc);
+}
+
+void OQS_SHA3_shake128_x4_stack_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, OQS_SHA3_shake128_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, state->s, OQS_SHA3_SHAKE128_RATE);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, &state->inc);
+}
+
+void OQS_SHA3_shake128_x4_stack_ctx_release(OQS_SHA3_shake128_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		OQS_MEM_cleanse(state->s, sizeof(state->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_ctx_release(&state->inc);
+}
+
+void OQS_SHA3_shake128_x4_stack_ctx_clone(OQS_SHA3_shake128_x4_stack_ctx *dest, const OQS_SHA3_shake128_x4_stack_ctx *src) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		memcpy(dest->s, src->s, sizeof(src->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_ctx_clone(&dest->inc, &src->inc);
+}
+
+void OQS_SHA3_shake128_x4_stack_ctx_reset(OQS_SHA3_shake128_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake128_x4_inc_ctx_reset(&state->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_init(OQS_SHA3_shake256_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_init(&state->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_absorb(OQS_SHA3_shake256_x4_stack_ctx *state, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_absorb(state->s, OQS_SHA3_SHAKE256_RATE, in0, in1, in2, in3, inlen);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_absorb(&state->inc, in0, in1, in2, in3, inlen);
+}
+
+void OQS_SHA3_shake256_x4_stack_finalize(OQS_SHA3_shake256_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_finalize(state->s, OQS_SHA3_SHAKE256_RATE, 0x1F);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_finalize(&state->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, OQS_SHA3_shake256_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, state->s, OQS_SHA3_SHAKE256_RATE);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, &state->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_ctx_release(OQS_SHA3_shake256_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		OQS_MEM_cleanse(state->s, sizeof(state->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_ctx_release(&state->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_ctx_clone(OQS_SHA3_shake256_x4_stack_ctx *dest, const OQS_SHA3_shake256_x4_stack_ctx *src) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		memcpy(dest->s, src->s, sizeof(src->s));
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_ctx_clone(&dest->inc, &src->inc);
+}
+
+void OQS_SHA3_shake256_x4_stack_ctx_reset(OQS_SHA3_shake256_x4_stack_ctx *state) {
+#if !defined(OQS_USE_SHA3_OPENSSL)
+	if (callbacks == &sha3_x4_default_callbacks) {
+		oqs_sha3_keccak_x4_inc_reset(state->s);
+		return;
+	}
+#endif
+	callbacks->SHA3_shake256_x4_inc_ctx_reset(&state->inc);
+}
@@ -18,6 +18,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <oqs/sha3.h>
 #include <oqs/sha3x4_ops.h>
 
 #if defined(__cplusplus)
@@ -52,6 +53,54 @@ void OQS_SHA3_shake128_x4(
     const uint8_t *in3,
     size_t inlen);
 
+/**
+ * \brief Seed 8 parallel SHAKE-128 instances, and generate 8 arrays of pseudo-random bytes.
+ *
+ * Uses a vectorized (AVX-512) implementation of SHAKE-128 if available, and
+ * two four-way calls otherwise. Replacement callbacks installed with
+ * OQS_SHA3_x4_set_callbacks are always used through the four-way functions.
+ *
+ * \warning The output array length must not be zero.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param out4 The fifth output byte array
+ * \param out5 The sixth output byte array
+ * \param out6 The seventh output byte array
+ * \param out7 The eighth output byte array
+ * \param outlen The number of output bytes to generate in every output array
+ * \param in0 The first input seed byte array
+ * \param in1 The second input seed byte array
+ * \param in2 The third input seed byte array
+ * \param in3 The fourth input seed byte array
+ * \param in4 The fifth input seed byte array
+ * \param in5 The sixth input seed byte array
+ * \param in6 The seventh input seed byte array
+ * \param in7 The eighth input seed byte array
+ * \param inlen The number of seed bytes to process from every input array
+ */
+void OQS_SHA3_shake128_x8(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
 /**
  * \brief Initialize the state for four-way parallel incremental SHAKE-128 API.
  *
@@ -163,6 +212,54 @@ void OQS_SHA3_shake256_x4(
     const uint8_t *in3,
     size_t inlen);
 
+/**
+ * \brief Seed 8 parallel SHAKE-256 instances, and generate 8 arrays of pseudo-random bytes.
+ *
+ * Uses a vectorized (AVX-512) implementation of SHAKE-256 if available, and
+ * two four-way calls otherwise. Replacement callbacks installed with
+ * OQS_SHA3_x4_set_callbacks are always used through the four-way functions.
+ *
+ * \warning The output array length must not be zero.
+ *
+ * \param out0 The first output byte array
+ * \param out1 The second output byte array
+ * \param out2 The third output byte array
+ * \param out3 The fourth output byte array
+ * \param out4 The fifth output byte array
+ * \param out5 The sixth output byte array
+ * \param out6 The seventh output byte array
+ * \param out7 The eighth output byte array
+ * \param outlen The number of output bytes to generate in every output array
+ * \param in0 The first input seed byte array
+ * \param in1 The second input seed byte array
+ * \param in2 The third input seed byte array
+ * \param in3 The fourth input seed byte array
+ * \param in4 The fifth input seed byte array
+ * \param in5 The sixth input seed byte array
+ * \param in6 The seventh input seed byte array
+ * \param in7 The eighth input seed byte array
+ * \param inlen The number of seed bytes to process from every input array
+ */
+void OQS_SHA3_shake256_x8(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    uint8_t *out4,
+    uint8_t *out5,
+    uint8_t *out6,
+    uint8_t *out7,
+    size_t outlen,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    const uint8_t *in4,
+    const uint8_t *in5,
+    const uint8_t *in6,
+    const uint8_t *in7,
+    size_t inlen);
+
 /**
  * \brief Initialize the state for four-way parallel incremental SHAKE-256 API.
  *
@@ -245,6 +342,196 @@ void OQS_SHA3_shake256_x4_inc_ctx_clone(
  */
 void OQS_SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state);
 
+/**
+ * Data structure for the state of the four-way parallel SHAKE-128 API with
+ * caller-allocated state.
+ *
+ * The four interleaved Keccak states are stored in the structure itself, so none
+ * of the OQS_SHA3_shake128_x4_stack functions allocate memory. When the SHA3x4
+ * callbacks have been replaced, or when SHA3 is provided by OpenSSL, the structure
+ * wraps an incremental context instead.
+ */
+typedef union {
+	/** Keccak states: 4 x 25 interleaved lanes followed by the byte position within the current block. */
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[101];
+	/** Incremental context, used when the built-in Keccak implementation is not. */
+	OQS_SHA3_shake128_x4_inc_ctx inc;
+} OQS_SHA3_shake128_x4_stack_ctx;
+
+/**
+ * \brief Initialize a caller-allocated four-way parallel SHAKE-128 state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake128_x4_stack_ctx_release.
+ *
+ * \param state The function state to be initialized
+ */
+void OQS_SHA3_shake128_x4_stack_init(OQS_SHA3_shake128_x4_stack_ctx *state);
+
+/**
+ * \brief Absorb inputs into a caller-allocated four-way parallel SHAKE-128 state.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 The input to be absorbed into first instance
+ * \param in1 The input to be absorbed into second instance
+ * \param in2 The input to be absorbed into third instance
+ * \param in3 The input to be absorbed into fourth instance
+ * \param inlen The number of bytes to process from each input array
+ */
+void OQS_SHA3_shake128_x4_stack_absorb(
+    OQS_SHA3_shake128_x4_stack_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    size_t inlen);
+
+/**
+ * \brief Prepare a caller-allocated four-way parallel SHAKE-128 state for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_x4_stack_finalize(OQS_SHA3_shake128_x4_stack_ctx *state);
+
+/**
+ * \brief Squeeze output from a caller-allocated four-way parallel SHAKE-128 state.
+ *
+ * \param out0 output buffer for the first instance
+ * \param out1 output buffer for the second instance
+ * \param out2 output buffer for the third instance
+ * \param out3 output buffer for the fourth instance
+ * \param outlen bytes of each output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake128_x4_stack_squeeze(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    size_t outlen,
+    OQS_SHA3_shake128_x4_stack_ctx *state);
+
+/**
+ * \brief Release a caller-allocated four-way parallel SHAKE-128 state; the Keccak
+ * states are zeroized.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_x4_stack_ctx_release(OQS_SHA3_shake128_x4_stack_ctx *state);
+
+/**
+ * \brief Copy a caller-allocated four-way parallel SHAKE-128 state.
+ *
+ * \param dest The function state to copy into; must be initialized
+ * \param src The function state to copy; must be initialized
+ */
+void OQS_SHA3_shake128_x4_stack_ctx_clone(
+    OQS_SHA3_shake128_x4_stack_ctx *dest,
+    const OQS_SHA3_shake128_x4_stack_ctx *src);
+
+/**
+ * \brief Reset a caller-allocated four-way parallel SHAKE-128 state so that it can
+ * be reused.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake128_x4_stack_ctx_reset(OQS_SHA3_shake128_x4_stack_ctx *state);
+
+/**
+ * Data structure for the state of the four-way parallel SHAKE-256 API with
+ * caller-allocated state.
+ *
+ * The four interleaved Keccak states are stored in the structure itself, so none
+ * of the OQS_SHA3_shake256_x4_stack functions allocate memory. When the SHA3x4
+ * callbacks have been replaced, or when SHA3 is provided by OpenSSL, the structure
+ * wraps an incremental context instead.
+ */
+typedef union {
+	/** Keccak states: 4 x 25 interleaved lanes followed by the byte position within the current block. */
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[101];
+	/** Incremental context, used when the built-in Keccak implementation is not. */
+	OQS_SHA3_shake256_x4_inc_ctx inc;
+} OQS_SHA3_shake256_x4_stack_ctx;
+
+/**
+ * \brief Initialize a caller-allocated four-way parallel SHAKE-256 state.
+ *
+ * \warning Caller is responsible for releasing state by calling
+ * OQS_SHA3_shake256_x4_stack_ctx_release.
+ *
+ * \param state The function state to be initialized
+ */
+void OQS_SHA3_shake256_x4_stack_init(OQS_SHA3_shake256_x4_stack_ctx *state);
+
+/**
+ * \brief Absorb inputs into a caller-allocated four-way parallel SHAKE-256 state.
+ *
+ * \param state The function state; must be initialized
+ * \param in0 The input to be absorbed into first instance
+ * \param in1 The input to be absorbed into second instance
+ * \param in2 The input to be absorbed into third instance
+ * \param in3 The input to be absorbed into fourth instance
+ * \param inlen The number of bytes to process from each input array
+ */
+void OQS_SHA3_shake256_x4_stack_absorb(
+    OQS_SHA3_shake256_x4_stack_ctx *state,
+    const uint8_t *in0,
+    const uint8_t *in1,
+    const uint8_t *in2,
+    const uint8_t *in3,
+    size_t inlen);
+
+/**
+ * \brief Prepare a caller-allocated four-way parallel SHAKE-256 state for squeezing.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_x4_stack_finalize(OQS_SHA3_shake256_x4_stack_ctx *state);
+
+/**
+ * \brief Squeeze output from a caller-allocated four-way parallel SHAKE-256 state.
+ *
+ * \param out0 output buffer for the first instance
+ * \param out1 output buffer for the second instance
+ * \param out2 output buffer for the third instance
+ * \param out3 output buffer for the fourth instance
+ * \param outlen bytes of each output buffer
+ * \param state The function state; must be initialized and finalized
+ */
+void OQS_SHA3_shake256_x4_stack_squeeze(
+    uint8_t *out0,
+    uint8_t *out1,
+    uint8_t *out2,
+    uint8_t *out3,
+    size_t outlen,
+    OQS_SHA3_shake256_x4_stack_ctx *state);
+
+/**
+ * \brief Release a caller-allocated four-way parallel SHAKE-256 state; the Keccak
+ * states are zeroized.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_x4_stack_ctx_release(OQS_SHA3_shake256_x4_stack_ctx *state);
+
+/**
+ * \brief Copy a caller-allocated four-way parallel SHAKE-256 state.
+ *
+ * \param dest The function state to copy into; must be initialized
+ * \param src The function state to copy; must be initialized
+ */
+void OQS_SHA3_shake256_x4_stack_ctx_clone(
+    OQS_SHA3_shake256_x4_stack_ctx *dest,
+    const OQS_SHA3_shake256_x4_stack_ctx *src);
+
+/**
+ * \brief Reset a caller-allocated four-way parallel SHAKE-256 state so that it can
+ * be reused.
+ *
+ * \param state The function state; must be initialized
+ */
+void OQS_SHA3_shake256_x4_stack_ctx_reset(OQS_SHA3_shake256_x4_stack_ctx *state);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -17,37 +17,43 @@ typedef void KeccakInitFn(void *);
 extern KeccakInitFn \
 KeccakP1600_Initialize, \
 KeccakP1600_Initialize_plain64, \
-KeccakP1600_Initialize_avx2;
+KeccakP1600_Initialize_avx2, \
+KeccakP1600_Initialize_avx512;
 
 typedef void KeccakAddByteFn(void *, const uint8_t, unsigned int);
 extern KeccakAddByteFn \
 KeccakP1600_AddByte, \
 KeccakP1600_AddByte_plain64, \
-KeccakP1600_AddByte_avx2;
+KeccakP1600_AddByte_avx2, \
+KeccakP1600_AddByte_avx512;
 
 typedef void KeccakAddBytesFn(void *, const uint8_t *, unsigned int, unsigned int);
 extern KeccakAddBytesFn \
 KeccakP1600_AddBytes, \
 KeccakP1600_AddBytes_plain64, \
-KeccakP1600_AddBytes_avx2;
+KeccakP1600_AddBytes_avx2, \
+KeccakP1600_AddBytes_avx512;
 
 typedef void KeccakPermuteFn(void *);
 extern KeccakPermuteFn \
 KeccakP1600_Permute_24rounds, \
 KeccakP1600_Permute_24rounds_plain64, \
-KeccakP1600_Permute_24rounds_avx2;
+KeccakP1600_Permute_24rounds_avx2, \
+KeccakP1600_Permute_24rounds_avx512;
 
 typedef void KeccakExtractBytesFn(const void *, uint8_t *, unsigned int, unsigned int);
 extern KeccakExtractBytesFn \
 KeccakP1600_ExtractBytes, \
 KeccakP1600_ExtractBytes_plain64, \
-KeccakP1600_ExtractBytes_avx2;
+KeccakP1600_ExtractBytes_avx2, \
+KeccakP1600_ExtractBytes_avx512;
 
 typedef size_t KeccakFastLoopAbsorbFn(void *, unsigned int, const uint8_t *, size_t);
 extern KeccakFastLoopAbsorbFn \
 KeccakF1600_FastLoop_Absorb, \
 KeccakF1600_FastLoop_Absorb_plain64, \
-KeccakF1600_FastLoop_Absorb_avx2;
+KeccakF1600_FastLoop_Absorb_avx2, \
+KeccakF1600_FastLoop_Absorb_avx512;
 
 typedef void KeccakX4InitFn(void *);
 extern KeccakX4InitFn \
@@ -79,4 +85,29 @@ KeccakP1600times4_ExtractBytes, \
 KeccakP1600times4_ExtractBytes_serial, \
 KeccakP1600times4_ExtractBytes_avx2;
 
+typedef void KeccakX8InitFn(void *);
+extern KeccakX8InitFn \
+KeccakP1600times8_InitializeAll, \
+KeccakP1600times8_InitializeAll_avx512;
+
+typedef void KeccakX8AddByteFn(void *, unsigned int, unsigned char, unsigned int);
+extern KeccakX8AddByteFn \
+KeccakP1600times8_AddByte, \
+KeccakP1600times8_AddByte_avx512;
+
+typedef void KeccakX8AddBytesFn(void *, unsigned int, const unsigned char *, unsigned int, unsigned int);
+extern KeccakX8AddBytesFn \
+KeccakP1600times8_AddBytes, \
+KeccakP1600times8_AddBytes_avx512;
+
+typedef void KeccakX8PermuteFn(void *);
+extern KeccakX8PermuteFn \
+KeccakP1600times8_PermuteAll_24rounds, \
+KeccakP1600times8_PermuteAll_24rounds_avx512;
+
+typedef void KeccakX8ExtractBytesFn(const void *, unsigned int, unsigned char *, unsigned int, unsigned int);
+extern KeccakX8ExtractBytesFn \
+KeccakP1600times8_ExtractBytes, \
+KeccakP1600times8_ExtractBytes_avx512;
+
 #endif // OQS_SHA3_XKCP_DISPATCH_H
@@ -0,0 +1,209 @@
+/*
+The Keccak-p permutations, designed by Guido Bertoni, Joan Daemen, Michaël Peeters and Gilles Van Assche.
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file implements Keccak-p[1600] in a SnP-compatible way using AVX-512F.
+Please refer to SnP-documentation.h for more details.
+
+The state is kept as the usual 25 little-endian lanes, so it can be read and
+written byte-wise like the generic 64-bit implementation. During the
+permutation each plane (five lanes with the same y coordinate) lives in the
+low five 64-bit elements of one zmm register:
+- theta, rho and chi are computed with ternary logic and variable rotations;
+- pi is split into a per-register lane shuffle before chi and a 5x5 transpose
+  after it, so that chi works across registers without any shuffles.
+
+This implementation comes with KeccakP-1600-SnP.h in the same folder.
+*/
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "KeccakP-1600-SnP.h"
+
+typedef __m512i V512;
+
+#define PLANE_MASK 0x1F
+
+/* (a ^ b ^ c) and (a ^ (~b & c)) */
+#define XOR3(a, b, c)   _mm512_ternarylogic_epi64(a, b, c, 0x96)
+#define CHI(a, b, c)    _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+
+static const uint64_t KeccakF1600RoundConstants[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600_Initialize(void *state) {
+	memset(state, 0, 200);
+}
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600_AddByte(void *state, unsigned char byte, unsigned int offset) {
+	((unsigned char *)state)[offset] ^= byte;
+}
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600_AddBytes(void *state, const unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned char *stateAsBytes = (unsigned char *)state + offset;
+	unsigned int i;
+
+	for (i = 0; i < length; i++) {
+		stateAsBytes[i] ^= data[i];
+	}
+}
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600_ExtractBytes(const void *state, unsigned char *data, unsigned int offset, unsigned int length) {
+	memcpy(data, (const unsigned char *)state + offset, length);
+}
+
+/* ---------------------------------------------------------------- */
+
+#define declarePlanes \
+	V512 Ba, Be, Bi, Bo, Bu; \
+	const V512 moveThetaPrev = _mm512_setr_epi64(4, 0, 1, 2, 3, 5, 6, 7); \
+	const V512 moveThetaNext = _mm512_setr_epi64(1, 2, 3, 4, 0, 5, 6, 7); \
+	const V512 rhoBa = _mm512_setr_epi64(0, 1, 62, 28, 27, 0, 0, 0); \
+	const V512 rhoBe = _mm512_setr_epi64(36, 44, 6, 55, 20, 0, 0, 0); \
+	const V512 rhoBi = _mm512_setr_epi64(3, 10, 43, 25, 39, 0, 0, 0); \
+	const V512 rhoBo = _mm512_setr_epi64(41, 45, 15, 21, 8, 0, 0, 0); \
+	const V512 rhoBu = _mm512_setr_epi64(18, 2, 61, 56, 14, 0, 0, 0); \
+	const V512 pi1Ba = _mm512_setr_epi64(0, 3, 1, 4, 2, 5, 6, 7); \
+	const V512 pi1Be = _mm512_setr_epi64(1, 4, 2, 0, 3, 5, 6, 7); \
+	const V512 pi1Bi = _mm512_setr_epi64(2, 0, 3, 1, 4, 5, 6, 7); \
+	const V512 pi1Bo = _mm512_setr_epi64(3, 1, 4, 2, 0, 5, 6, 7); \
+	const V512 pi1Bu = _mm512_setr_epi64(4, 2, 0, 3, 1, 5, 6, 7); \
+	const V512 pi2Lo = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11); \
+	const V512 pi2Hi = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15); \
+	const V512 pi2Y0 = _mm512_setr_epi64(0, 1, 2, 3, 8, 5, 6, 7); \
+	const V512 pi2Y1 = _mm512_setr_epi64(0, 1, 2, 3, 9, 5, 6, 7); \
+	const V512 pi2Y2 = _mm512_setr_epi64(4, 5, 6, 7, 10, 5, 6, 7); \
+	const V512 pi2Y3 = _mm512_setr_epi64(4, 5, 6, 7, 11, 5, 6, 7); \
+	const V512 pi2Y4 = _mm512_setr_epi64(0, 1, 2, 3, 12, 5, 6, 7);
+
+#define copyFromState(stateAsLanes) \
+	Ba = _mm512_maskz_loadu_epi64(PLANE_MASK, (stateAsLanes) +  0); \
+	Be = _mm512_maskz_loadu_epi64(PLANE_MASK, (stateAsLanes) +  5); \
+	Bi = _mm512_maskz_loadu_epi64(PLANE_MASK, (stateAsLanes) + 10); \
+	Bo = _mm512_maskz_loadu_epi64(PLANE_MASK, (stateAsLanes) + 15); \
+	Bu = _mm512_maskz_loadu_epi64(PLANE_MASK, (stateAsLanes) + 20);
+
+#define copyToState(stateAsLanes) \
+	_mm512_mask_storeu_epi64((stateAsLanes) +  0, PLANE_MASK, Ba); \
+	_mm512_mask_storeu_epi64((stateAsLanes) +  5, PLANE_MASK, Be); \
+	_mm512_mask_storeu_epi64((stateAsLanes) + 10, PLANE_MASK, Bi); \
+	_mm512_mask_storeu_epi64((stateAsLanes) + 15, PLANE_MASK, Bo); \
+	_mm512_mask_storeu_epi64((stateAsLanes) + 20, PLANE_MASK, Bu);
+
+/*
+ * One round. Planes enter and leave with lane x of plane y in element x of
+ * register B[y]; in between, chi sees register x holding lane (x, y) of the
+ * output in element y.
+ */
+#define KeccakP_Round(rc) { \
+	V512 C, D, T0, T1, T2, T3; \
+	/* theta */ \
+	C = XOR3(XOR3(Ba, Be, Bi), Bo, Bu); \
+	T0 = _mm512_permutexvar_epi64(moveThetaPrev, C); \
+	T1 = _mm512_rol_epi64(_mm512_permutexvar_epi64(moveThetaNext, C), 1); \
+	D = _mm512_xor_si512(T0, T1); \
+	/* theta, rho and the first half of pi */ \
+	Ba = _mm512_permutexvar_epi64(pi1Ba, _mm512_rolv_epi64(_mm512_xor_si512(Ba, D), rhoBa)); \
+	Be = _mm512_permutexvar_epi64(pi1Be, _mm512_rolv_epi64(_mm512_xor_si512(Be, D), rhoBe)); \
+	Bi = _mm512_permutexvar_epi64(pi1Bi, _mm512_rolv_epi64(_mm512_xor_si512(Bi, D), rhoBi)); \
+	Bo = _mm512_permutexvar_epi64(pi1Bo, _mm512_rolv_epi64(_mm512_xor_si512(Bo, D), rhoBo)); \
+	Bu = _mm512_permutexvar_epi64(pi1Bu, _mm512_rolv_epi64(_mm512_xor_si512(Bu, D), rhoBu)); \
+	/* chi and iota */ \
+	T0 = CHI(Ba, Be, Bi); \
+	T1 = CHI(Be, Bi, Bo); \
+	T2 = CHI(Bi, Bo, Bu); \
+	T3 = CHI(Bo, Bu, Ba); \
+	Bu = CHI(Bu, Ba, Be); \
+	T0 = _mm512_xor_si512(T0, _mm512_maskz_set1_epi64(1, (long long)(rc))); \
+	/* second half of pi: transpose back to planes */ \
+	Ba = _mm512_unpacklo_epi64(T0, T1); \
+	Be = _mm512_unpackhi_epi64(T0, T1); \
+	Bi = _mm512_unpacklo_epi64(T2, T3); \
+	Bo = _mm512_unpackhi_epi64(T2, T3); \
+	T0 = _mm512_permutex2var_epi64(Ba, pi2Lo, Bi); \
+	T1 = _mm512_permutex2var_epi64(Be, pi2Lo, Bo); \
+	T2 = _mm512_permutex2var_epi64(Ba, pi2Hi, Bi); \
+	Ba = _mm512_permutex2var_epi64(T0, pi2Y0, Bu); \
+	Be = _mm512_permutex2var_epi64(T1, pi2Y1, Bu); \
+	Bi = _mm512_permutex2var_epi64(T0, pi2Y2, Bu); \
+	Bo = _mm512_permutex2var_epi64(T1, pi2Y3, Bu); \
+	Bu = _mm512_permutex2var_epi64(T2, pi2Y4, Bu); \
+}
+
+#define rounds24 { \
+	unsigned int round; \
+	for (round = 0; round < 24; round++) { \
+		KeccakP_Round(KeccakF1600RoundConstants[round]) \
+	} \
+}
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600_Permute_24rounds(void *state) {
+	uint64_t *stateAsLanes = (uint64_t *)state;
+	declarePlanes
+
+	copyFromState(stateAsLanes)
+	rounds24
+	copyToState(stateAsLanes)
+}
+
+/* ---------------------------------------------------------------- */
+
+static __mmask8 laneMask(unsigned int laneCount, unsigned int firstLane) {
+	if (laneCount >= firstLane + 5) {
+		return PLANE_MASK;
+	}
+	if (laneCount <= firstLane) {
+		return 0;
+	}
+	return (__mmask8)((1U << (laneCount - firstLane)) - 1);
+}
+
+size_t KeccakF1600_FastLoop_Absorb(void *state, unsigned int laneCount, const unsigned char *data, size_t dataByteLen) {
+	size_t originalDataByteLen = dataByteLen;
+	uint64_t *stateAsLanes = (uint64_t *)state;
+	const __mmask8 ma = laneMask(laneCount, 0);
+	const __mmask8 me = laneMask(laneCount, 5);
+	const __mmask8 mi = laneMask(laneCount, 10);
+	const __mmask8 mo = laneMask(laneCount, 15);
+	const __mmask8 mu = laneMask(laneCount, 20);
+	declarePlanes
+
+	copyFromState(stateAsLanes)
+	while (dataByteLen >= laneCount * 8) {
+		Ba = _mm512_xor_si512(Ba, _mm512_maskz_loadu_epi64(ma, data +   0));
+		Be = _mm512_xor_si512(Be, _mm512_maskz_loadu_epi64(me, data +  40));
+		Bi = _mm512_xor_si512(Bi, _mm512_maskz_loadu_epi64(mi, data +  80));
+		Bo = _mm512_xor_si512(Bo, _mm512_maskz_loadu_epi64(mo, data + 120));
+		Bu = _mm512_xor_si512(Bu, _mm512_maskz_loadu_epi64(mu, data + 160));
+		rounds24
+		data += laneCount * 8;
+		dataByteLen -= laneCount * 8;
+	}
+	copyToState(stateAsLanes)
+	return originalDataByteLen - dataByteLen;
+}
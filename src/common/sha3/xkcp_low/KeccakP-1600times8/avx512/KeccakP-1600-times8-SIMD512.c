@@ -0,0 +1,212 @@
+/*
+The Keccak-p permutations, designed by Guido Bertoni, Joan Daemen, Michaël Peeters and Gilles Van Assche.
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+This file implements Keccak-p[1600]×8 in a PlSnP-compatible way using AVX-512F.
+Please refer to PlSnP-documentation.h for more details.
+
+The eight states are interleaved lane by lane, as in the 256-bit times4
+implementation: lane i of instance j is the 64-bit word at index 8*i+j, so
+each zmm register holds the same lane of all eight instances.
+
+This implementation comes with KeccakP-1600-times8-SnP.h in the same folder.
+*/
+
+#include <immintrin.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "KeccakP-1600-times8-SnP.h"
+
+typedef __m512i V512;
+
+#define laneIndex(instanceIndex, lanePosition) ((lanePosition)*8 + instanceIndex)
+
+#define SnP_laneLengthInBytes 8
+
+#define LOAD512u(a)             _mm512_loadu_si512((const V512 *)&(a))
+#define STORE512u(a, b)         _mm512_storeu_si512((V512 *)&(a), b)
+#define XOR512(a, b)            _mm512_xor_si512(a, b)
+#define ROL512(a, o)            _mm512_rol_epi64(a, o)
+#define XOR3_512(a, b, c)       _mm512_ternarylogic_epi64(a, b, c, 0x96)
+#define CHI512(a, b, c)         _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+
+static const uint64_t KeccakF1600RoundConstants[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* ---------------------------------------------------------------- */
+
+void KeccakP1600times8_InitializeAll(void *states) {
+	memset(states, 0, KeccakP1600times8_statesSizeInBytes_avx512);
+}
+
+void KeccakP1600times8_AddByte(void *states, unsigned int instanceIndex, unsigned char byte, unsigned int offset) {
+	((unsigned char *)states)[instanceIndex * 8 + (offset / 8) * 8 * 8 + offset % 8] ^= byte;
+}
+
+void KeccakP1600times8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int sizeLeft = length;
+	unsigned int lanePosition = offset / SnP_laneLengthInBytes;
+	unsigned int offsetInLane = offset % SnP_laneLengthInBytes;
+	unsigned int bytesInLane;
+	const unsigned char *curData = data;
+	uint64_t *statesAsLanes = (uint64_t *)states;
+	uint64_t lane;
+
+	if ((sizeLeft > 0) && (offsetInLane != 0)) {
+		bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+		if (bytesInLane > sizeLeft) {
+			bytesInLane = sizeLeft;
+		}
+		lane = 0;
+		memcpy((unsigned char *)&lane + offsetInLane, curData, bytesInLane);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+		sizeLeft -= bytesInLane;
+		lanePosition++;
+		curData += bytesInLane;
+	}
+
+	while (sizeLeft >= SnP_laneLengthInBytes) {
+		memcpy(&lane, curData, SnP_laneLengthInBytes);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+		sizeLeft -= SnP_laneLengthInBytes;
+		lanePosition++;
+		curData += SnP_laneLengthInBytes;
+	}
+
+	if (sizeLeft > 0) {
+		lane = 0;
+		memcpy(&lane, curData, sizeLeft);
+		statesAsLanes[laneIndex(instanceIndex, lanePosition)] ^= lane;
+	}
+}
+
+void KeccakP1600times8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length) {
+	unsigned int sizeLeft = length;
+	unsigned int lanePosition = offset / SnP_laneLengthInBytes;
+	unsigned int offsetInLane = offset % SnP_laneLengthInBytes;
+	unsigned char *curData = data;
+	const uint64_t *statesAsLanes = (const uint64_t *)states;
+
+	if ((sizeLeft > 0) && (offsetInLane != 0)) {
+		unsigned int bytesInLane = SnP_laneLengthInBytes - offsetInLane;
+		if (bytesInLane > sizeLeft) {
+			bytesInLane = sizeLeft;
+		}
+		memcpy(curData, ((const unsigned char *)&statesAsLanes[laneIndex(instanceIndex, lanePosition)]) + offsetInLane, bytesInLane);
+		sizeLeft -= bytesInLane;
+		lanePosition++;
+		curData += bytesInLane;
+	}
+
+	while (sizeLeft >= SnP_laneLengthInBytes) {
+		memcpy(curData, &statesAsLanes[laneIndex(instanceIndex, lanePosition)], SnP_laneLengthInBytes);
+		sizeLeft -= SnP_laneLengthInBytes;
+		lanePosition++;
+		curData += SnP_laneLengthInBytes;
+	}
+
+	if (sizeLeft > 0) {
+		memcpy(curData, &statesAsLanes[laneIndex(instanceIndex, lanePosition)], sizeLeft);
+	}
+}
+
+/* ---------------------------------------------------------------- */
+
+/*
+ * One round on the 25 lanes in A; theta, rho and pi write into B and chi and
+ * iota write back into A. B[x+5y] receives lane (x', y') with x = y' and
+ * y = 2x' + 3y' mod 5.
+ */
+#define KeccakP_Round(A, B, rc) { \
+	V512 C0, C1, C2, C3, C4, D[5]; \
+	C0 = XOR3_512(XOR3_512(A[ 0], A[ 5], A[10]), A[15], A[20]); \
+	C1 = XOR3_512(XOR3_512(A[ 1], A[ 6], A[11]), A[16], A[21]); \
+	C2 = XOR3_512(XOR3_512(A[ 2], A[ 7], A[12]), A[17], A[22]); \
+	C3 = XOR3_512(XOR3_512(A[ 3], A[ 8], A[13]), A[18], A[23]); \
+	C4 = XOR3_512(XOR3_512(A[ 4], A[ 9], A[14]), A[19], A[24]); \
+	D[0] = XOR512(C4, ROL512(C1, 1)); \
+	D[1] = XOR512(C0, ROL512(C2, 1)); \
+	D[2] = XOR512(C1, ROL512(C3, 1)); \
+	D[3] = XOR512(C2, ROL512(C4, 1)); \
+	D[4] = XOR512(C3, ROL512(C0, 1)); \
+	B[ 0] = XOR512(A[ 0], D[0]); \
+	B[10] = ROL512(XOR512(A[ 1], D[1]), 1); \
+	B[20] = ROL512(XOR512(A[ 2], D[2]), 62); \
+	B[ 5] = ROL512(XOR512(A[ 3], D[3]), 28); \
+	B[15] = ROL512(XOR512(A[ 4], D[4]), 27); \
+	B[16] = ROL512(XOR512(A[ 5], D[0]), 36); \
+	B[ 1] = ROL512(XOR512(A[ 6], D[1]), 44); \
+	B[11] = ROL512(XOR512(A[ 7], D[2]), 6); \
+	B[21] = ROL512(XOR512(A[ 8], D[3]), 55); \
+	B[ 6] = ROL512(XOR512(A[ 9], D[4]), 20); \
+	B[ 7] = ROL512(XOR512(A[10], D[0]), 3); \
+	B[17] = ROL512(XOR512(A[11], D[1]), 10); \
+	B[ 2] = ROL512(XOR512(A[12], D[2]), 43); \
+	B[12] = ROL512(XOR512(A[13], D[3]), 25); \
+	B[22] = ROL512(XOR512(A[14], D[4]), 39); \
+	B[23] = ROL512(XOR512(A[15], D[0]), 41); \
+	B[ 8] = ROL512(XOR512(A[16], D[1]), 45); \
+	B[18] = ROL512(XOR512(A[17], D[2]), 15); \
+	B[ 3] = ROL512(XOR512(A[18], D[3]), 21); \
+	B[13] = ROL512(XOR512(A[19], D[4]), 8); \
+	B[14] = ROL512(XOR512(A[20], D[0]), 18); \
+	B[24] = ROL512(XOR512(A[21], D[1]), 2); \
+	B[ 9] = ROL512(XOR512(A[22], D[2]), 61); \
+	B[19] = ROL512(XOR512(A[23], D[3]), 56); \
+	B[ 4] = ROL512(XOR512(A[24], D[4]), 14); \
+	A[ 0] = XOR512(CHI512(B[ 0], B[ 1], B[ 2]), _mm512_set1_epi64((long long)(rc))); \
+	A[ 1] = CHI512(B[ 1], B[ 2], B[ 3]); \
+	A[ 2] = CHI512(B[ 2], B[ 3], B[ 4]); \
+	A[ 3] = CHI512(B[ 3], B[ 4], B[ 0]); \
+	A[ 4] = CHI512(B[ 4], B[ 0], B[ 1]); \
+	A[ 5] = CHI512(B[ 5], B[ 6], B[ 7]); \
+	A[ 6] = CHI512(B[ 6], B[ 7], B[ 8]); \
+	A[ 7] = CHI512(B[ 7], B[ 8], B[ 9]); \
+	A[ 8] = CHI512(B[ 8], B[ 9], B[ 5]); \
+	A[ 9] = CHI512(B[ 9], B[ 5], B[ 6]); \
+	A[10] = CHI512(B[10], B[11], B[12]); \
+	A[11] = CHI512(B[11], B[12], B[13]); \
+	A[12] = CHI512(B[12], B[13], B[14]); \
+	A[13] = CHI512(B[13], B[14], B[10]); \
+	A[14] = CHI512(B[14], B[10], B[11]); \
+	A[15] = CHI512(B[15], B[16], B[17]); \
+	A[16] = CHI512(B[16], B[17], B[18]); \
+	A[17] = CHI512(B[17], B[18], B[19]); \
+	A[18] = CHI512(B[18], B[19], B[15]); \
+	A[19] = CHI512(B[19], B[15], B[16]); \
+	A[20] = CHI512(B[20], B[21], B[22]); \
+	A[21] = CHI512(B[21], B[22], B[23]); \
+	A[22] = CHI512(B[22], B[23], B[24]); \
+	A[23] = CHI512(B[23], B[24], B[20]); \
+	A[24] = CHI512(B[24], B[20], B[21]); \
+}
+
+void KeccakP1600times8_PermuteAll_24rounds(void *states) {
+	V512 *statesAsLanes = (V512 *)states;
+	V512 A[25], B[25];
+	unsigned int i;
+
+	for (i = 0; i < 25; i++) {
+		A[i] = LOAD512u(statesAsLanes[i]);
+	}
+	for (i = 0; i < 24; i++) {
+		KeccakP_Round(A, B, KeccakF1600RoundConstants[i])
+	}
+	for (i = 0; i < 25; i++) {
+		STORE512u(statesAsLanes[i], A[i]);
+	}
+}
@@ -0,0 +1,48 @@
+/*
+The Keccak-p permutations, designed by Guido Bertoni, Joan Daemen, Michaël Peeters and Gilles Van Assche.
+
+To the extent possible under law, the implementer has waived all copyright
+and related or neighboring rights to the source code in this file.
+http://creativecommons.org/publicdomain/zero/1.0/
+
+---
+
+Please refer to PlSnP-documentation.h for more details.
+*/
+
+#ifndef _KeccakP_1600_times8_SnP_h_
+#define _KeccakP_1600_times8_SnP_h_
+
+#include <stddef.h>
+
+#define KeccakP1600times8_implementation_avx512        "512-bit SIMD implementation (AVX-512F)"
+#define KeccakP1600times8_statesSizeInBytes_avx512     1600
+#define KeccakP1600times8_statesAlignment_avx512       8
+
+#if defined(ADD_SYMBOL_SUFFIX)
+#define KECCAKTIMES8_IMPL_NAMESPACE(x) x##_avx512
+#else
+#define KECCAKTIMES8_IMPL_NAMESPACE(x) x
+#define KeccakP1600times8_implementation KeccakP1600times8_implementation_avx512
+#define KeccakP1600times8_statesSizeInBytes KeccakP1600times8_statesSizeInBytes_avx512
+#define KeccakP1600times8_statesAlignment KeccakP1600times8_statesAlignment_avx512
+#endif
+
+#define KeccakP1600times8_StaticInitialize()
+
+#define KeccakP1600times8_InitializeAll KECCAKTIMES8_IMPL_NAMESPACE(KeccakP1600times8_InitializeAll)
+void KeccakP1600times8_InitializeAll(void *states);
+
+#define KeccakP1600times8_AddByte KECCAKTIMES8_IMPL_NAMESPACE(KeccakP1600times8_AddByte)
+void KeccakP1600times8_AddByte(void *states, unsigned int instanceIndex, unsigned char byte, unsigned int offset);
+
+#define KeccakP1600times8_AddBytes KECCAKTIMES8_IMPL_NAMESPACE(KeccakP1600times8_AddBytes)
+void KeccakP1600times8_AddBytes(void *states, unsigned int instanceIndex, const unsigned char *data, unsigned int offset, unsigned int length);
+
+#define KeccakP1600times8_PermuteAll_24rounds KECCAKTIMES8_IMPL_NAMESPACE(KeccakP1600times8_PermuteAll_24rounds)
+void KeccakP1600times8_PermuteAll_24rounds(void *states);
+
+#define KeccakP1600times8_ExtractBytes KECCAKTIMES8_IMPL_NAMESPACE(KeccakP1600times8_ExtractBytes)
+void KeccakP1600times8_ExtractBytes(const void *states, unsigned int instanceIndex, unsigned char *data, unsigned int offset, unsigned int length);
+
+#endif
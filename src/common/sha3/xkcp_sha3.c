@@ -41,6 +41,17 @@ static void Keccak_Dispatch(void) {
 // TODO: Simplify this when we have a Windows-compatible AVX2 implementation of SHA3
 #if defined(OQS_DIST_X86_64_BUILD)
 #if defined(OQS_ENABLE_SHA3_xkcp_low_avx2)
+#if defined(OQS_ENABLE_SHA3_xkcp_low_avx512)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) {
+		Keccak_Initialize_ptr = &KeccakP1600_Initialize_avx512;
+		Keccak_AddByte_ptr = &KeccakP1600_AddByte_avx512;
+		Keccak_AddBytes_ptr = &KeccakP1600_AddBytes_avx512;
+		Keccak_Permute_ptr = &KeccakP1600_Permute_24rounds_avx512;
+		Keccak_ExtractBytes_ptr = &KeccakP1600_ExtractBytes_avx512;
+		Keccak_FastLoopAbsorb_ptr = &KeccakF1600_FastLoop_Absorb_avx512;
+		return;
+	}
+#endif
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
 		Keccak_Initialize_ptr = &KeccakP1600_Initialize_avx2;
 		Keccak_AddByte_ptr = &KeccakP1600_AddByte_avx2;
@@ -188,14 +199,33 @@ static void keccak_inc_squeeze(uint8_t *h, size_t outlen,
 	s[25] -= outlen;
 }
 
+/* Caller-allocated states, used by the OQS_SHA3_*_stack functions in sha3.c */
+
+void oqs_sha3_keccak_inc_reset(uint64_t *s) {
+	keccak_inc_reset(s);
+}
+
+void oqs_sha3_keccak_inc_absorb(uint64_t *s, uint32_t r, const uint8_t *m, size_t mlen) {
+	keccak_inc_absorb(s, r, m, mlen);
+}
+
+void oqs_sha3_keccak_inc_finalize(uint64_t *s, uint32_t r, uint8_t p) {
+	keccak_inc_finalize(s, r, p);
+}
+
+void oqs_sha3_keccak_inc_squeeze(uint8_t *h, size_t outlen, uint64_t *s, uint32_t r) {
+	keccak_inc_squeeze(h, outlen, s, r);
+}
+
 /* SHA3-256 */
 
 static void SHA3_sha3_256(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_256_inc_ctx s;
-	OQS_SHA3_sha3_256_inc_init(&s);
-	OQS_SHA3_sha3_256_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_256_inc_finalize(output, &s);
-	OQS_SHA3_sha3_256_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	keccak_inc_reset(s);
+	keccak_inc_absorb(s, OQS_SHA3_SHA3_256_RATE, input, inlen);
+	keccak_inc_finalize(s, OQS_SHA3_SHA3_256_RATE, 0x06);
+	keccak_inc_squeeze(output, 32, s, OQS_SHA3_SHA3_256_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 static void SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
@@ -229,11 +259,12 @@ static void SHA3_sha3_256_inc_ctx_reset(OQS_SHA3_sha3_256_inc_ctx *state) {
 /* SHA3-384 */
 
 static void SHA3_sha3_384(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_384_inc_ctx s;
-	OQS_SHA3_sha3_384_inc_init(&s);
-	OQS_SHA3_sha3_384_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_384_inc_finalize(output, &s);
-	OQS_SHA3_sha3_384_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	keccak_inc_reset(s);
+	keccak_inc_absorb(s, OQS_SHA3_SHA3_384_RATE, input, inlen);
+	keccak_inc_finalize(s, OQS_SHA3_SHA3_384_RATE, 0x06);
+	keccak_inc_squeeze(output, 48, s, OQS_SHA3_SHA3_384_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 static void SHA3_sha3_384_inc_init(OQS_SHA3_sha3_384_inc_ctx *state) {
@@ -265,11 +296,12 @@ static void SHA3_sha3_384_inc_ctx_reset(OQS_SHA3_sha3_384_inc_ctx *state) {
 /* SHA3-512 */
 
 static void SHA3_sha3_512(uint8_t *output, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_sha3_512_inc_ctx s;
-	OQS_SHA3_sha3_512_inc_init(&s);
-	OQS_SHA3_sha3_512_inc_absorb(&s, input, inlen);
-	OQS_SHA3_sha3_512_inc_finalize(output, &s);
-	OQS_SHA3_sha3_512_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	keccak_inc_reset(s);
+	keccak_inc_absorb(s, OQS_SHA3_SHA3_512_RATE, input, inlen);
+	keccak_inc_finalize(s, OQS_SHA3_SHA3_512_RATE, 0x06);
+	keccak_inc_squeeze(output, 64, s, OQS_SHA3_SHA3_512_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 static void SHA3_sha3_512_inc_init(OQS_SHA3_sha3_512_inc_ctx *state) {
@@ -302,12 +334,12 @@ static void SHA3_sha3_512_inc_ctx_reset(OQS_SHA3_sha3_512_inc_ctx *state) {
 /* SHAKE128 */
 
 static void SHA3_shake128(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_shake128_inc_ctx s;
-	OQS_SHA3_shake128_inc_init(&s);
-	OQS_SHA3_shake128_inc_absorb(&s, input, inlen);
-	OQS_SHA3_shake128_inc_finalize(&s);
-	OQS_SHA3_shake128_inc_squeeze(output, outlen, &s);
-	OQS_SHA3_shake128_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	keccak_inc_reset(s);
+	keccak_inc_absorb(s, OQS_SHA3_SHAKE128_RATE, input, inlen);
+	keccak_inc_finalize(s, OQS_SHA3_SHAKE128_RATE, 0x1F);
+	keccak_inc_squeeze(output, outlen, s, OQS_SHA3_SHAKE128_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 /* SHAKE128 incremental */
@@ -345,12 +377,12 @@ static void SHA3_shake128_inc_ctx_reset(OQS_SHA3_shake128_inc_ctx *state) {
 /* SHAKE256 */
 
 static void SHA3_shake256(uint8_t *output, size_t outlen, const uint8_t *input, size_t inlen) {
-	OQS_SHA3_shake256_inc_ctx s;
-	OQS_SHA3_shake256_inc_init(&s);
-	OQS_SHA3_shake256_inc_absorb(&s, input, inlen);
-	OQS_SHA3_shake256_inc_finalize(&s);
-	OQS_SHA3_shake256_inc_squeeze(output, outlen, &s);
-	OQS_SHA3_shake256_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[26];
+	keccak_inc_reset(s);
+	keccak_inc_absorb(s, OQS_SHA3_SHAKE256_RATE, input, inlen);
+	keccak_inc_finalize(s, OQS_SHA3_SHAKE256_RATE, 0x1F);
+	keccak_inc_squeeze(output, outlen, s, OQS_SHA3_SHAKE256_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 /* SHAKE256 incremental */
@@ -31,6 +31,13 @@ static KeccakX4AddBytesFn *Keccak_X4_AddBytes_ptr = NULL;
 static KeccakX4PermuteFn *Keccak_X4_Permute_ptr = NULL;
 static KeccakX4ExtractBytesFn *Keccak_X4_ExtractBytes_ptr = NULL;
 
+/* Left NULL when there is no eight-way backend for this CPU */
+static KeccakX8InitFn *Keccak_X8_Initialize_ptr = NULL;
+static KeccakX8AddByteFn *Keccak_X8_AddByte_ptr = NULL;
+static KeccakX8AddBytesFn *Keccak_X8_AddBytes_ptr = NULL;
+static KeccakX8PermuteFn *Keccak_X8_Permute_ptr = NULL;
+static KeccakX8ExtractBytesFn *Keccak_X8_ExtractBytes_ptr = NULL;
+
 static void Keccak_X4_Dispatch(void) {
 // TODO: Simplify this when we have a Windows-compatible AVX2 implementation of SHA3
 #if defined(OQS_DIST_X86_64_BUILD)
@@ -62,9 +69,27 @@ static void Keccak_X4_Dispatch(void) {
 	Keccak_X4_Permute_ptr = &KeccakP1600times4_PermuteAll_24rounds;
 	Keccak_X4_ExtractBytes_ptr = &KeccakP1600times4_ExtractBytes;
 #endif
+
+#if defined(OQS_DIST_X86_64_BUILD)
+#if defined(OQS_ENABLE_SHA3_xkcp_low_avx512)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX512)) {
+		Keccak_X8_Initialize_ptr = &KeccakP1600times8_InitializeAll_avx512;
+		Keccak_X8_AddByte_ptr = &KeccakP1600times8_AddByte_avx512;
+		Keccak_X8_AddBytes_ptr = &KeccakP1600times8_AddBytes_avx512;
+		Keccak_X8_Permute_ptr = &KeccakP1600times8_PermuteAll_24rounds_avx512;
+		Keccak_X8_ExtractBytes_ptr = &KeccakP1600times8_ExtractBytes_avx512;
+	}
+#endif
+#elif defined(OQS_ENABLE_SHA3_xkcp_low_avx512)
+	Keccak_X8_Initialize_ptr = &KeccakP1600times8_InitializeAll;
+	Keccak_X8_AddByte_ptr = &KeccakP1600times8_AddByte;
+	Keccak_X8_AddBytes_ptr = &KeccakP1600times8_AddBytes;
+	Keccak_X8_Permute_ptr = &KeccakP1600times8_PermuteAll_24rounds;
+	Keccak_X8_ExtractBytes_ptr = &KeccakP1600times8_ExtractBytes;
+#endif
 }
 
-static void keccak_x4_inc_reset(uint64_t *s) {
+static void keccak_x4_dispatch_once(void) {
 #if OQS_USE_PTHREADS
 	pthread_once(&dispatch_once_control, Keccak_X4_Dispatch);
 #else
@@ -72,6 +97,10 @@ static void keccak_x4_inc_reset(uint64_t *s) {
 		Keccak_X4_Dispatch();
 	}
 #endif
+}
+
+static void keccak_x4_inc_reset(uint64_t *s) {
+	keccak_x4_dispatch_once();
 	(*Keccak_X4_Initialize_ptr)(s);
 	s[100] = 0;
 }
@@ -153,15 +182,33 @@ static void keccak_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, u
 	s[100] -= outlen;
 }
 
+/* Caller-allocated states, used by the OQS_SHA3_*_x4_stack functions in sha3x4.c */
+
+void oqs_sha3_keccak_x4_inc_reset(uint64_t *s) {
+	keccak_x4_inc_reset(s);
+}
+
+void oqs_sha3_keccak_x4_inc_absorb(uint64_t *s, uint32_t r, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
+	keccak_x4_inc_absorb(s, r, in0, in1, in2, in3, inlen);
+}
+
+void oqs_sha3_keccak_x4_inc_finalize(uint64_t *s, uint32_t r, uint8_t p) {
+	keccak_x4_inc_finalize(s, r, p);
+}
+
+void oqs_sha3_keccak_x4_inc_squeeze(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, uint64_t *s, uint32_t r) {
+	keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, s, r);
+}
+
 /********** SHAKE128 ***********/
 
 static void SHA3_shake128_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
-	OQS_SHA3_shake128_x4_inc_ctx s;
-	OQS_SHA3_shake128_x4_inc_init(&s);
-	OQS_SHA3_shake128_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
-	OQS_SHA3_shake128_x4_inc_finalize(&s);
-	OQS_SHA3_shake128_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
-	OQS_SHA3_shake128_x4_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[101];
+	keccak_x4_inc_reset(s);
+	keccak_x4_inc_absorb(s, OQS_SHA3_SHAKE128_RATE, in0, in1, in2, in3, inlen);
+	keccak_x4_inc_finalize(s, OQS_SHA3_SHAKE128_RATE, 0x1F);
+	keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, s, OQS_SHA3_SHAKE128_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 /* SHAKE128 incremental */
@@ -198,12 +245,12 @@ static void SHA3_shake128_x4_inc_ctx_reset(OQS_SHA3_shake128_x4_inc_ctx *state)
 /********** SHAKE256 ***********/
 
 static void SHA3_shake256_x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, size_t inlen) {
-	OQS_SHA3_shake256_x4_inc_ctx s;
-	OQS_SHA3_shake256_x4_inc_init(&s);
-	OQS_SHA3_shake256_x4_inc_absorb(&s, in0, in1, in2, in3, inlen);
-	OQS_SHA3_shake256_x4_inc_finalize(&s);
-	OQS_SHA3_shake256_x4_inc_squeeze(out0, out1, out2, out3, outlen, &s);
-	OQS_SHA3_shake256_x4_inc_ctx_release(&s);
+	OQS_SHA3_STACK_CTX_ALIGNAS uint64_t s[101];
+	keccak_x4_inc_reset(s);
+	keccak_x4_inc_absorb(s, OQS_SHA3_SHAKE256_RATE, in0, in1, in2, in3, inlen);
+	keccak_x4_inc_finalize(s, OQS_SHA3_SHAKE256_RATE, 0x1F);
+	keccak_x4_inc_squeeze(out0, out1, out2, out3, outlen, s, OQS_SHA3_SHAKE256_RATE);
+	OQS_MEM_cleanse(s, sizeof(s));
 }
 
 /* SHAKE256 incremental */
@@ -238,6 +285,73 @@ static void SHA3_shake256_x4_inc_ctx_reset(OQS_SHA3_shake256_x4_inc_ctx *state)
 	keccak_x4_inc_reset((uint64_t *)state->ctx);
 }
 
+/********** Eight-way SHAKE ***********/
+
+static void keccak_x8(uint8_t *const out[8], size_t outlen, const uint8_t *const in[8], size_t inlen, uint32_t r) {
+	uint64_t s[200];
+	size_t offset = 0;
+	unsigned int i;
+
+	(*Keccak_X8_Initialize_ptr)(s);
+
+	while (inlen >= r) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_AddBytes_ptr)(s, i, in[i] + offset, 0, r);
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		offset += r;
+		inlen -= r;
+	}
+
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_AddBytes_ptr)(s, i, in[i] + offset, 0, (unsigned int)inlen);
+		(*Keccak_X8_AddByte_ptr)(s, i, 0x1F, (unsigned int)inlen);
+		(*Keccak_X8_AddByte_ptr)(s, i, 0x80, r - 1);
+	}
+	(*Keccak_X8_Permute_ptr)(s);
+
+	offset = 0;
+	while (outlen > r) {
+		for (i = 0; i < 8; i++) {
+			(*Keccak_X8_ExtractBytes_ptr)(s, i, out[i] + offset, 0, r);
+		}
+		(*Keccak_X8_Permute_ptr)(s);
+		offset += r;
+		outlen -= r;
+	}
+	for (i = 0; i < 8; i++) {
+		(*Keccak_X8_ExtractBytes_ptr)(s, i, out[i] + offset, 0, (unsigned int)outlen);
+	}
+
+	OQS_MEM_cleanse(s, sizeof(s));
+}
+
+void oqs_sha3_shake128_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	keccak_x4_dispatch_once();
+	if (Keccak_X8_Permute_ptr == NULL) {
+		SHA3_shake128_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		SHA3_shake128_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+
+	uint8_t *const out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+	const uint8_t *const in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	keccak_x8(out, outlen, in, inlen, OQS_SHA3_SHAKE128_RATE);
+}
+
+void oqs_sha3_shake256_x8(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3, uint8_t *out4, uint8_t *out5, uint8_t *out6, uint8_t *out7, size_t outlen, const uint8_t *in0, const uint8_t *in1, const uint8_t *in2, const uint8_t *in3, const uint8_t *in4, const uint8_t *in5, const uint8_t *in6, const uint8_t *in7, size_t inlen) {
+	keccak_x4_dispatch_once();
+	if (Keccak_X8_Permute_ptr == NULL) {
+		SHA3_shake256_x4(out0, out1, out2, out3, outlen, in0, in1, in2, in3, inlen);
+		SHA3_shake256_x4(out4, out5, out6, out7, outlen, in4, in5, in6, in7, inlen);
+		return;
+	}
+
+	uint8_t *const out[8] = {out0, out1, out2, out3, out4, out5, out6, out7};
+	const uint8_t *const in[8] = {in0, in1, in2, in3, in4, in5, in6, in7};
+	keccak_x8(out, outlen, in, inlen, OQS_SHA3_SHAKE256_RATE);
+}
+
 extern struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks;
 
 struct OQS_SHA3_x4_callbacks sha3_x4_default_callbacks = {
@@ -24,6 +24,18 @@ OQS_KEM *OQS_KEM_bike_l1_new(void) {
 	kem->keypair = OQS_KEM_bike_l1_keypair;
 	kem->encaps = OQS_KEM_bike_l1_encaps;
 	kem->decaps = OQS_KEM_bike_l1_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
 
 	return kem;
 }
@@ -49,6 +61,18 @@ OQS_KEM *OQS_KEM_bike_l3_new(void) {
 	kem->keypair = OQS_KEM_bike_l3_keypair;
 	kem->encaps = OQS_KEM_bike_l3_encaps;
 	kem->decaps = OQS_KEM_bike_l3_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
 
 	return kem;
 }
@@ -74,6 +98,18 @@ OQS_KEM *OQS_KEM_bike_l5_new(void) {
 	kem->keypair = OQS_KEM_bike_l5_keypair;
 	kem->encaps = OQS_KEM_bike_l5_encaps;
 	kem->decaps = OQS_KEM_bike_l5_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
 
 	return kem;
 }
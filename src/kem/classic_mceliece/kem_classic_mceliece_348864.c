@@ -6,6 +6,10 @@
 
 #if defined(OQS_ENABLE_KEM_classic_mceliece_348864)
 
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
+static void classic_mceliece_348864_bind_impl(OQS_KEM *kem);
+#endif
+
 OQS_KEM *OQS_KEM_classic_mceliece_348864_new(void) {
 
 	OQS_KEM *kem = OQS_MEM_malloc(sizeof(OQS_KEM));
@@ -26,6 +30,22 @@ OQS_KEM *OQS_KEM_classic_mceliece_348864_new(void) {
 	kem->keypair = OQS_KEM_classic_mceliece_348864_keypair;
 	kem->encaps = OQS_KEM_classic_mceliece_348864_encaps;
 	kem->decaps = OQS_KEM_classic_mceliece_348864_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
+	classic_mceliece_348864_bind_impl(kem);
+#endif
 
 	return kem;
 }
@@ -88,4 +108,43 @@ OQS_API OQS_STATUS OQS_KEM_classic_mceliece_348864_decaps(uint8_t *shared_secret
 #endif
 }
 
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_classic_mceliece_348864_avx2)
+/* Implementation-specific entry points, bound by OQS_KEM_classic_mceliece_348864_new once per object. */
+static OQS_STATUS classic_mceliece_348864_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_AVX2_crypto_kem_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS classic_mceliece_348864_avx2_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_AVX2_crypto_kem_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS classic_mceliece_348864_avx2_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_AVX2_crypto_kem_dec(shared_secret, ciphertext, secret_key);
+}
+
+static OQS_STATUS classic_mceliece_348864_clean_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS classic_mceliece_348864_clean_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS classic_mceliece_348864_clean_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MCELIECE348864_CLEAN_crypto_kem_dec(shared_secret, ciphertext, secret_key);
+}
+
+static void classic_mceliece_348864_bind_impl(OQS_KEM *kem) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+		kem->keypair = classic_mceliece_348864_avx2_keypair;
+		kem->encaps = classic_mceliece_348864_avx2_encaps;
+		kem->decaps = classic_mceliece_348864_avx2_decaps;
+		return;
+	}
+	kem->keypair = classic_mceliece_348864_clean_keypair;
+	kem->encaps = classic_mceliece_348864_clean_encaps;
+	kem->decaps = classic_mceliece_348864_clean_decaps;
+}
+#endif
+
 #endif
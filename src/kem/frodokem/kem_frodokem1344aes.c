@@ -26,6 +26,18 @@ OQS_KEM *OQS_KEM_frodokem_1344_aes_new(void) {
 	kem->keypair = OQS_KEM_frodokem_1344_aes_keypair;
 	kem->encaps = OQS_KEM_frodokem_1344_aes_encaps;
 	kem->decaps = OQS_KEM_frodokem_1344_aes_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
 
 	return kem;
 }
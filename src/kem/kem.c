@@ -2,8 +2,8 @@
 
 #include <assert.h>
 #include <stdlib.h>
-#if defined(_WIN32)
 #include <string.h>
+#if defined(_WIN32)
 #define strcasecmp _stricmp
 #else
 #include <strings.h>
@@ -11,6 +11,10 @@
 
 #include <oqs/oqs.h>
 
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
 OQS_API const char *OQS_KEM_alg_identifier(size_t i) {
 	// EDIT-WHEN-ADDING-KEM
 	const char *a[OQS_KEM_algs_length] = {
@@ -57,437 +61,424 @@ OQS_API int OQS_KEM_alg_count(void) {
 	return OQS_KEM_algs_length;
 }
 
-OQS_API int OQS_KEM_alg_is_enabled(const char *method_name) {
-	if (method_name == NULL) {
-		return 0;
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l1)) {
+/* Registry of all KEMs; new_kem is NULL for the ones not enabled at compile time */
+typedef struct {
+	const char *method_name;
+	OQS_KEM *(*new_kem)(void);
+} kem_registry_entry;
+
+static const kem_registry_entry kem_registry[OQS_KEM_algs_length] = {
 #ifdef OQS_ENABLE_KEM_bike_l1
-		return 1;
+	{OQS_KEM_alg_bike_l1, OQS_KEM_bike_l1_new},
 #else
-		return 0;
+	{OQS_KEM_alg_bike_l1, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l3)) {
 #ifdef OQS_ENABLE_KEM_bike_l3
-		return 1;
+	{OQS_KEM_alg_bike_l3, OQS_KEM_bike_l3_new},
 #else
-		return 0;
+	{OQS_KEM_alg_bike_l3, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l5)) {
 #ifdef OQS_ENABLE_KEM_bike_l5
-		return 1;
+	{OQS_KEM_alg_bike_l5, OQS_KEM_bike_l5_new},
 #else
-		return 0;
+	{OQS_KEM_alg_bike_l5, NULL},
 #endif
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_ENABLED_CASE_START
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_348864)) {
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_REGISTRY_ENTRY_START
 #ifdef OQS_ENABLE_KEM_classic_mceliece_348864
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_348864, OQS_KEM_classic_mceliece_348864_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_348864, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_348864f)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_348864f
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_348864f, OQS_KEM_classic_mceliece_348864f_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_348864f, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_460896)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_460896
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_460896, OQS_KEM_classic_mceliece_460896_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_460896, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_460896f)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_460896f
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_460896f, OQS_KEM_classic_mceliece_460896f_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_460896f, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6688128)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_6688128
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_6688128, OQS_KEM_classic_mceliece_6688128_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_6688128, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6688128f)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_6688128f
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_6688128f, OQS_KEM_classic_mceliece_6688128f_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_6688128f, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6960119)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_6960119
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_6960119, OQS_KEM_classic_mceliece_6960119_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_6960119, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6960119f)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_6960119f
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_6960119f, OQS_KEM_classic_mceliece_6960119f_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_6960119f, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_8192128)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_8192128
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_8192128, OQS_KEM_classic_mceliece_8192128_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_8192128, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_8192128f)) {
 #ifdef OQS_ENABLE_KEM_classic_mceliece_8192128f
-		return 1;
+	{OQS_KEM_alg_classic_mceliece_8192128f, OQS_KEM_classic_mceliece_8192128f_new},
 #else
-		return 0;
+	{OQS_KEM_alg_classic_mceliece_8192128f, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_128)) {
 #ifdef OQS_ENABLE_KEM_hqc_128
-		return 1;
+	{OQS_KEM_alg_hqc_128, OQS_KEM_hqc_128_new},
 #else
-		return 0;
+	{OQS_KEM_alg_hqc_128, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_192)) {
 #ifdef OQS_ENABLE_KEM_hqc_192
-		return 1;
+	{OQS_KEM_alg_hqc_192, OQS_KEM_hqc_192_new},
 #else
-		return 0;
+	{OQS_KEM_alg_hqc_192, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_256)) {
 #ifdef OQS_ENABLE_KEM_hqc_256
-		return 1;
+	{OQS_KEM_alg_hqc_256, OQS_KEM_hqc_256_new},
 #else
-		return 0;
+	{OQS_KEM_alg_hqc_256, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_512)) {
 #ifdef OQS_ENABLE_KEM_kyber_512
-		return 1;
+	{OQS_KEM_alg_kyber_512, OQS_KEM_kyber_512_new},
 #else
-		return 0;
+	{OQS_KEM_alg_kyber_512, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_768)) {
 #ifdef OQS_ENABLE_KEM_kyber_768
-		return 1;
+	{OQS_KEM_alg_kyber_768, OQS_KEM_kyber_768_new},
 #else
-		return 0;
+	{OQS_KEM_alg_kyber_768, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_1024)) {
 #ifdef OQS_ENABLE_KEM_kyber_1024
-		return 1;
+	{OQS_KEM_alg_kyber_1024, OQS_KEM_kyber_1024_new},
 #else
-		return 0;
+	{OQS_KEM_alg_kyber_1024, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_512)) {
 #ifdef OQS_ENABLE_KEM_ml_kem_512
-		return 1;
+	{OQS_KEM_alg_ml_kem_512, OQS_KEM_ml_kem_512_new},
 #else
-		return 0;
+	{OQS_KEM_alg_ml_kem_512, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_768)) {
 #ifdef OQS_ENABLE_KEM_ml_kem_768
-		return 1;
+	{OQS_KEM_alg_ml_kem_768, OQS_KEM_ml_kem_768_new},
 #else
-		return 0;
+	{OQS_KEM_alg_ml_kem_768, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_1024)) {
 #ifdef OQS_ENABLE_KEM_ml_kem_1024
-		return 1;
+	{OQS_KEM_alg_ml_kem_1024, OQS_KEM_ml_kem_1024_new},
 #else
-		return 0;
+	{OQS_KEM_alg_ml_kem_1024, NULL},
 #endif
-
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_ENABLED_CASE_END
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ntruprime_sntrup761)) {
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_REGISTRY_ENTRY_END
 #ifdef OQS_ENABLE_KEM_ntruprime_sntrup761
-		return 1;
+	{OQS_KEM_alg_ntruprime_sntrup761, OQS_KEM_ntruprime_sntrup761_new},
 #else
-		return 0;
+	{OQS_KEM_alg_ntruprime_sntrup761, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_640_aes)) {
 #ifdef OQS_ENABLE_KEM_frodokem_640_aes
-		return 1;
+	{OQS_KEM_alg_frodokem_640_aes, OQS_KEM_frodokem_640_aes_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_640_aes, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_640_shake)) {
 #ifdef OQS_ENABLE_KEM_frodokem_640_shake
-		return 1;
+	{OQS_KEM_alg_frodokem_640_shake, OQS_KEM_frodokem_640_shake_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_640_shake, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_976_aes)) {
 #ifdef OQS_ENABLE_KEM_frodokem_976_aes
-		return 1;
+	{OQS_KEM_alg_frodokem_976_aes, OQS_KEM_frodokem_976_aes_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_976_aes, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_976_shake)) {
 #ifdef OQS_ENABLE_KEM_frodokem_976_shake
-		return 1;
+	{OQS_KEM_alg_frodokem_976_shake, OQS_KEM_frodokem_976_shake_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_976_shake, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_1344_aes)) {
 #ifdef OQS_ENABLE_KEM_frodokem_1344_aes
-		return 1;
+	{OQS_KEM_alg_frodokem_1344_aes, OQS_KEM_frodokem_1344_aes_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_1344_aes, NULL},
 #endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_1344_shake)) {
 #ifdef OQS_ENABLE_KEM_frodokem_1344_shake
-		return 1;
+	{OQS_KEM_alg_frodokem_1344_shake, OQS_KEM_frodokem_1344_shake_new},
 #else
-		return 0;
+	{OQS_KEM_alg_frodokem_1344_shake, NULL},
 #endif
-		// EDIT-WHEN-ADDING-KEM
-	} else {
-		return 0;
+	// EDIT-WHEN-ADDING-KEM
+};
+
+/* Built on first use: registry indices in strcasecmp order of the names, and
+ * one shared descriptor per enabled algorithm for OQS_KEM_get */
+static size_t kem_sorted[OQS_KEM_algs_length];
+static OQS_KEM kem_descriptors[OQS_KEM_algs_length];
+static bool kem_descriptor_ok[OQS_KEM_algs_length];
+#if defined(OQS_USE_PTHREADS)
+static pthread_once_t kem_registry_once_control = PTHREAD_ONCE_INIT;
+#else
+static bool kem_registry_init_done = false;
+#endif
+
+static void init_kem_registry(void) {
+	for (size_t i = 0; i < OQS_KEM_algs_length; i++) {
+		size_t j = i;
+		while (j > 0 && strcasecmp(kem_registry[kem_sorted[j - 1]].method_name, kem_registry[i].method_name) > 0) {
+			kem_sorted[j] = kem_sorted[j - 1];
+			j--;
+		}
+		kem_sorted[j] = i;
+
+		if (kem_registry[i].new_kem != NULL) {
+			OQS_KEM *kem = kem_registry[i].new_kem();
+			if (kem != NULL) {
+				kem_descriptors[i] = *kem;
+				kem_descriptor_ok[i] = true;
+				OQS_KEM_free(kem);
+			}
+		}
 	}
+#if !defined(OQS_USE_PTHREADS)
+	kem_registry_init_done = true;
+#endif
 }
 
-OQS_API OQS_KEM *OQS_KEM_new(const char *method_name) {
+/* Returns the registry index of method_name, or -1 if it is not a known algorithm */
+static int find_kem(const char *method_name) {
+	size_t lo = 0, hi = OQS_KEM_algs_length;
+
 	if (method_name == NULL) {
-		return NULL;
+		return -1;
 	}
-	if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l1)) {
-#ifdef OQS_ENABLE_KEM_bike_l1
-		return OQS_KEM_bike_l1_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l3)) {
-#ifdef OQS_ENABLE_KEM_bike_l3
-		return OQS_KEM_bike_l3_new();
+#if defined(OQS_USE_PTHREADS)
+	pthread_once(&kem_registry_once_control, &init_kem_registry);
 #else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_bike_l5)) {
-#ifdef OQS_ENABLE_KEM_bike_l5
-		return OQS_KEM_bike_l5_new();
-#else
-		return NULL;
-#endif
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_NEW_CASE_START
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_348864)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_348864
-		return OQS_KEM_classic_mceliece_348864_new();
-#else
-		return NULL;
+	if (!kem_registry_init_done) {
+		init_kem_registry();
+	}
 #endif
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		int c = strcasecmp(method_name, kem_registry[kem_sorted[mid]].method_name);
+		if (c == 0) {
+			return (int)kem_sorted[mid];
+		} else if (c < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return -1;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_348864f)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_348864f
-		return OQS_KEM_classic_mceliece_348864f_new();
-#else
-		return NULL;
-#endif
+OQS_API int OQS_KEM_alg_is_enabled(const char *method_name) {
+	int i = find_kem(method_name);
+	return (i >= 0 && kem_registry[i].new_kem != NULL) ? 1 : 0;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_460896)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_460896
-		return OQS_KEM_classic_mceliece_460896_new();
-#else
+OQS_API OQS_KEM *OQS_KEM_new(const char *method_name) {
+	int i = find_kem(method_name);
+	if (i < 0 || kem_registry[i].new_kem == NULL) {
 		return NULL;
-#endif
+	}
+	return kem_registry[i].new_kem();
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_460896f)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_460896f
-		return OQS_KEM_classic_mceliece_460896f_new();
-#else
+OQS_API const OQS_KEM *OQS_KEM_get(const char *method_name) {
+	int i = find_kem(method_name);
+	if (i < 0 || !kem_descriptor_ok[i]) {
 		return NULL;
-#endif
+	}
+	return &kem_descriptors[i];
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6688128)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_6688128
-		return OQS_KEM_classic_mceliece_6688128_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_keypair(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else {
+		return kem->keypair(public_key, secret_key);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6688128f)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_6688128f
-		return OQS_KEM_classic_mceliece_6688128f_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else {
+		return kem->encaps(ciphertext, shared_secret, public_key);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6960119)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_6960119
-		return OQS_KEM_classic_mceliece_6960119_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else {
+		return kem->decaps(shared_secret, ciphertext, secret_key);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_6960119f)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_6960119f
-		return OQS_KEM_classic_mceliece_6960119f_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_keypair_derand(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	if (kem == NULL || kem->keypair_derand == NULL) {
+		return OQS_ERROR;
+	} else {
+		return kem->keypair_derand(public_key, secret_key, seed);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_8192128)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_8192128
-		return OQS_KEM_classic_mceliece_8192128_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_encaps_derand(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed) {
+	if (kem == NULL || kem->encaps_derand == NULL) {
+		return OQS_ERROR;
+	} else {
+		return kem->encaps_derand(ciphertext, shared_secret, public_key, seed);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_classic_mceliece_8192128f)) {
-#ifdef OQS_ENABLE_KEM_classic_mceliece_8192128f
-		return OQS_KEM_classic_mceliece_8192128f_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_encaps_batch(const OQS_KEM *kem, size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->encaps_batch != NULL) {
+		return kem->encaps_batch(count, ciphertexts, shared_secrets, public_keys);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (kem->encaps(ciphertexts + i * kem->length_ciphertext, shared_secrets + i * kem->length_shared_secret, public_keys + i * kem->length_public_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_128)) {
-#ifdef OQS_ENABLE_KEM_hqc_128
-		return OQS_KEM_hqc_128_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_decaps_batch(const OQS_KEM *kem, size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys) {
+	if (kem == NULL) {
+		return OQS_ERROR;
+	} else if (kem->decaps_batch != NULL) {
+		return kem->decaps_batch(count, shared_secrets, ciphertexts, secret_keys);
+	}
+	for (size_t i = 0; i < count; i++) {
+		if (kem->decaps(shared_secrets + i * kem->length_shared_secret, ciphertexts + i * kem->length_ciphertext, secret_keys + i * kem->length_secret_key) != OQS_SUCCESS) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_192)) {
-#ifdef OQS_ENABLE_KEM_hqc_192
-		return OQS_KEM_hqc_192_new();
-#else
-		return NULL;
-#endif
+struct OQS_KEM_PUBLIC_KEY {
+	/* The method_name of the OQS_KEM object the key was constructed for. */
+	const char *method_name;
+	/* The length, in bytes, of key_data. */
+	size_t length_key_data;
+	/* The prepared public key, or a copy of the encoded public key if the KEM does not support prepared keys. */
+	uint8_t *key_data;
+	/* Whether key_data holds a prepared public key. */
+	bool prepared;
+};
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_hqc_256)) {
-#ifdef OQS_ENABLE_KEM_hqc_256
-		return OQS_KEM_hqc_256_new();
-#else
+OQS_API OQS_KEM_PUBLIC_KEY *OQS_KEM_PUBLIC_KEY_new(const OQS_KEM *kem, const uint8_t *public_key) {
+	if (kem == NULL || public_key == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_512)) {
-#ifdef OQS_ENABLE_KEM_kyber_512
-		return OQS_KEM_kyber_512_new();
-#else
+	}
+	OQS_KEM_PUBLIC_KEY *pk = OQS_MEM_malloc(sizeof(OQS_KEM_PUBLIC_KEY));
+	if (pk == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_768)) {
-#ifdef OQS_ENABLE_KEM_kyber_768
-		return OQS_KEM_kyber_768_new();
-#else
+	}
+	pk->method_name = kem->method_name;
+	pk->prepared = kem->prepare_public_key != NULL && kem->encaps_prepared != NULL;
+	pk->length_key_data = pk->prepared ? kem->length_prepared_public_key : kem->length_public_key;
+	/* OQS_MEM_aligned_alloc requires the size to be a multiple of the alignment */
+	pk->key_data = OQS_MEM_aligned_alloc(32, (pk->length_key_data + 31) & ~(size_t)31);
+	if (pk->key_data == NULL) {
+		OQS_MEM_insecure_free(pk);
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_kyber_1024)) {
-#ifdef OQS_ENABLE_KEM_kyber_1024
-		return OQS_KEM_kyber_1024_new();
-#else
+	}
+	if (!pk->prepared) {
+		memcpy(pk->key_data, public_key, kem->length_public_key);
+	} else if (kem->prepare_public_key(pk->key_data, public_key) != OQS_SUCCESS) {
+		OQS_KEM_PUBLIC_KEY_free(pk);
 		return NULL;
-#endif
+	}
+	return pk;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_512)) {
-#ifdef OQS_ENABLE_KEM_ml_kem_512
-		return OQS_KEM_ml_kem_512_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_KEM_encaps_prepared(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_PUBLIC_KEY *public_key) {
+	if (kem == NULL || public_key == NULL || strcmp(kem->method_name, public_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (public_key->prepared) {
+		return kem->encaps_prepared(ciphertext, shared_secret, public_key->key_data);
+	} else {
+		return kem->encaps(ciphertext, shared_secret, public_key->key_data);
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_768)) {
-#ifdef OQS_ENABLE_KEM_ml_kem_768
-		return OQS_KEM_ml_kem_768_new();
-#else
-		return NULL;
-#endif
+OQS_API void OQS_KEM_PUBLIC_KEY_free(OQS_KEM_PUBLIC_KEY *public_key) {
+	if (public_key == NULL) {
+		return;
+	}
+	OQS_MEM_aligned_free(public_key->key_data);
+	OQS_MEM_insecure_free(public_key);
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ml_kem_1024)) {
-#ifdef OQS_ENABLE_KEM_ml_kem_1024
-		return OQS_KEM_ml_kem_1024_new();
-#else
-		return NULL;
-#endif
+struct OQS_KEM_SECRET_KEY {
+	/* The method_name of the OQS_KEM object the key was constructed for. */
+	const char *method_name;
+	/* The length, in bytes, of key_data. */
+	size_t length_key_data;
+	/* The prepared secret key, or a copy of the encoded secret key if the KEM does not support prepared keys. */
+	uint8_t *key_data;
+	/* Whether key_data holds a prepared secret key. */
+	bool prepared;
+};
 
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_NEW_CASE_END
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_ntruprime_sntrup761)) {
-#ifdef OQS_ENABLE_KEM_ntruprime_sntrup761
-		return OQS_KEM_ntruprime_sntrup761_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_640_aes)) {
-#ifdef OQS_ENABLE_KEM_frodokem_640_aes
-		return OQS_KEM_frodokem_640_aes_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_640_shake)) {
-#ifdef OQS_ENABLE_KEM_frodokem_640_shake
-		return OQS_KEM_frodokem_640_shake_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_976_aes)) {
-#ifdef OQS_ENABLE_KEM_frodokem_976_aes
-		return OQS_KEM_frodokem_976_aes_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_976_shake)) {
-#ifdef OQS_ENABLE_KEM_frodokem_976_shake
-		return OQS_KEM_frodokem_976_shake_new();
-#else
+OQS_API OQS_KEM_SECRET_KEY *OQS_KEM_SECRET_KEY_new(const OQS_KEM *kem, const uint8_t *secret_key) {
+	if (kem == NULL || secret_key == NULL) {
 		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_1344_aes)) {
-#ifdef OQS_ENABLE_KEM_frodokem_1344_aes
-		return OQS_KEM_frodokem_1344_aes_new();
-#else
-		return NULL;
-#endif
-	} else if (0 == strcasecmp(method_name, OQS_KEM_alg_frodokem_1344_shake)) {
-#ifdef OQS_ENABLE_KEM_frodokem_1344_shake
-		return OQS_KEM_frodokem_1344_shake_new();
-#else
+	}
+	OQS_KEM_SECRET_KEY *sk = OQS_MEM_malloc(sizeof(OQS_KEM_SECRET_KEY));
+	if (sk == NULL) {
 		return NULL;
-#endif
-		// EDIT-WHEN-ADDING-KEM
-	} else {
+	}
+	sk->method_name = kem->method_name;
+	sk->prepared = kem->prepare_secret_key != NULL && kem->decaps_prepared != NULL;
+	sk->length_key_data = (sk->prepared ? kem->length_prepared_secret_key : kem->length_secret_key);
+	/* Rounded up, so that OQS_KEM_SECRET_KEY_free can cleanse the whole allocation */
+	sk->length_key_data = (sk->length_key_data + 31) & ~(size_t)31;
+	sk->key_data = OQS_MEM_aligned_alloc(32, sk->length_key_data);
+	if (sk->key_data == NULL) {
+		OQS_MEM_insecure_free(sk);
 		return NULL;
 	}
-}
-
-OQS_API OQS_STATUS OQS_KEM_keypair(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key) {
-	if (kem == NULL) {
-		return OQS_ERROR;
-	} else {
-		return kem->keypair(public_key, secret_key);
+	if (!sk->prepared) {
+		memcpy(sk->key_data, secret_key, kem->length_secret_key);
+	} else if (kem->prepare_secret_key(sk->key_data, secret_key) != OQS_SUCCESS) {
+		OQS_KEM_SECRET_KEY_free(sk);
+		return NULL;
 	}
+	return sk;
 }
 
-OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
-	if (kem == NULL) {
+OQS_API OQS_STATUS OQS_KEM_decaps_prepared(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_SECRET_KEY *secret_key) {
+	if (kem == NULL || secret_key == NULL || strcmp(kem->method_name, secret_key->method_name) != 0) {
 		return OQS_ERROR;
+	} else if (secret_key->prepared) {
+		return kem->decaps_prepared(shared_secret, ciphertext, secret_key->key_data);
 	} else {
-		return kem->encaps(ciphertext, shared_secret, public_key);
+		return kem->decaps(shared_secret, ciphertext, secret_key->key_data);
 	}
 }
 
-OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
-	if (kem == NULL) {
-		return OQS_ERROR;
-	} else {
-		return kem->decaps(shared_secret, ciphertext, secret_key);
+OQS_API void OQS_KEM_SECRET_KEY_free(OQS_KEM_SECRET_KEY *secret_key) {
+	if (secret_key == NULL) {
+		return;
 	}
+	OQS_MEM_cleanse(secret_key->key_data, secret_key->length_key_data);
+	OQS_MEM_aligned_free(secret_key->key_data);
+	OQS_MEM_insecure_free(secret_key);
 }
 
 OQS_API void OQS_KEM_free(OQS_KEM *kem) {
@@ -199,8 +199,169 @@ typedef struct OQS_KEM {
 	 */
 	OQS_STATUS (*decaps)(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
 
+	/**
+	 * Batch encapsulation algorithm.
+	 *
+	 * Encapsulates to `count` independent public keys in a single call. The i-th
+	 * public key is read from `public_keys + i * length_public_key`, and the i-th
+	 * ciphertext and shared secret are written to `ciphertexts + i * length_ciphertext`
+	 * and `shared_secrets + i * length_shared_secret`.
+	 *
+	 * May be `NULL` if the scheme has no dedicated batch implementation, in which
+	 * case OQS_KEM_encaps_batch falls back to calling `encaps` for each entry.
+	 *
+	 * @param[in] count The number of encapsulations to perform.
+	 * @param[out] ciphertexts The ciphertexts, stored back to back.
+	 * @param[out] shared_secrets The shared secrets, stored back to back.
+	 * @param[in] public_keys The public keys, stored back to back.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_batch)(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys);
+
+	/**
+	 * Batch decapsulation algorithm.
+	 *
+	 * Decapsulates `count` independent ciphertexts in a single call, using the same
+	 * back-to-back buffer layout as `encaps_batch`.
+	 *
+	 * May be `NULL` if the scheme has no dedicated batch implementation, in which
+	 * case OQS_KEM_decaps_batch falls back to calling `decaps` for each entry.
+	 *
+	 * @param[in] count The number of decapsulations to perform.
+	 * @param[out] shared_secrets The shared secrets, stored back to back.
+	 * @param[in] ciphertexts The ciphertexts, stored back to back.
+	 * @param[in] secret_keys The secret keys, stored back to back.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*decaps_batch)(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys);
+
+	/** The length, in bytes, of prepared public keys for this KEM, or 0 if prepared public keys are not supported. */
+	size_t length_prepared_public_key;
+
+	/**
+	 * Public key preparation algorithm.
+	 *
+	 * Expands `public_key` into a scheme-specific representation that `encaps_prepared`
+	 * can reuse across any number of encapsulations, so that work depending only on the
+	 * public key is done once. Caller is responsible for providing `length_prepared_public_key`
+	 * bytes of 32-byte aligned memory for `prepared_public_key`; OQS_KEM_PUBLIC_KEY_new
+	 * takes care of this.
+	 *
+	 * May be `NULL` if the scheme does not support prepared public keys.
+	 *
+	 * @param[out] prepared_public_key The prepared public key.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*prepare_public_key)(uint8_t *prepared_public_key, const uint8_t *public_key);
+
+	/**
+	 * Encapsulation algorithm using a prepared public key.
+	 *
+	 * Produces the same kind of output as `encaps` for the public key that
+	 * `prepared_public_key` was prepared from.
+	 *
+	 * May be `NULL` if the scheme does not support prepared public keys.
+	 *
+	 * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] prepared_public_key The public key as output by `prepare_public_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_prepared)(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key);
+
+	/** The length, in bytes, of prepared secret keys for this KEM, or 0 if prepared secret keys are not supported. */
+	size_t length_prepared_secret_key;
+
+	/**
+	 * Secret key preparation algorithm.
+	 *
+	 * Expands `secret_key` into a scheme-specific representation that `decaps_prepared`
+	 * can reuse across any number of decapsulations. Caller is responsible for providing
+	 * `length_prepared_secret_key` bytes of 32-byte aligned memory for `prepared_secret_key`;
+	 * OQS_KEM_SECRET_KEY_new takes care of this.
+	 *
+	 * May be `NULL` if the scheme does not support prepared secret keys.
+	 *
+	 * @param[out] prepared_secret_key The prepared secret key.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*prepare_secret_key)(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+
+	/**
+	 * Decapsulation algorithm using a prepared secret key.
+	 *
+	 * Produces the same output as `decaps` for the secret key that
+	 * `prepared_secret_key` was prepared from.
+	 *
+	 * May be `NULL` if the scheme does not support prepared secret keys.
+	 *
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[in] prepared_secret_key The secret key as output by `prepare_secret_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*decaps_prepared)(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key);
+
+	/** The length, in bytes, of seeds for `keypair_derand`, or 0 if deterministic keypair generation is not supported. */
+	size_t length_keypair_seed;
+
+	/**
+	 * Deterministic keypair generation algorithm.
+	 *
+	 * Like `keypair`, but takes all of its randomness from the `length_keypair_seed`
+	 * bytes at `seed` instead of calling OQS_randombytes. The same seed always yields
+	 * the same key pair, so the seed must be secret and uniformly random.
+	 *
+	 * May be `NULL` if the scheme does not support deterministic keypair generation.
+	 *
+	 * @param[out] public_key The public key represented as a byte string.
+	 * @param[out] secret_key The secret key represented as a byte string.
+	 * @param[in] seed The seed, `length_keypair_seed` bytes long.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*keypair_derand)(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+
+	/** The length, in bytes, of seeds for `encaps_derand`, or 0 if deterministic encapsulation is not supported. */
+	size_t length_encaps_seed;
+
+	/**
+	 * Deterministic encapsulation algorithm.
+	 *
+	 * Like `encaps`, but takes all of its randomness from the `length_encaps_seed`
+	 * bytes at `seed` instead of calling OQS_randombytes. A seed must never be used
+	 * for more than one encapsulation.
+	 *
+	 * May be `NULL` if the scheme does not support deterministic encapsulation.
+	 *
+	 * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+	 * @param[out] shared_secret The shared secret represented as a byte string.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @param[in] seed The seed, `length_encaps_seed` bytes long.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*encaps_derand)(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed);
+
 } OQS_KEM;
 
+/**
+ * Opaque public key object for repeated encapsulation to the same public key.
+ *
+ * Constructed from an encoded public key by OQS_KEM_PUBLIC_KEY_new and used with
+ * OQS_KEM_encaps_prepared.
+ */
+typedef struct OQS_KEM_PUBLIC_KEY OQS_KEM_PUBLIC_KEY;
+
+/**
+ * Opaque secret key object for repeated decapsulation with the same secret key.
+ *
+ * Constructed from an encoded secret key by OQS_KEM_SECRET_KEY_new and used with
+ * OQS_KEM_decaps_prepared. The object holds secret data and is cleansed when freed
+ * with OQS_KEM_SECRET_KEY_free.
+ */
+typedef struct OQS_KEM_SECRET_KEY OQS_KEM_SECRET_KEY;
+
 /**
  * Constructs an OQS_KEM object for a particular algorithm.
  *
@@ -212,6 +373,18 @@ typedef struct OQS_KEM {
  */
 OQS_API OQS_KEM *OQS_KEM_new(const char *method_name);
 
+/**
+ * Returns the shared descriptor of a particular algorithm, without allocating memory.
+ *
+ * The names are matched case-insensitively, as in OQS_KEM_new. Every call for the same
+ * algorithm returns the same immutable object, which remains valid for the lifetime of
+ * the program and can be used from any thread. It must not be passed to OQS_KEM_free.
+ *
+ * @param[in] method_name Name of the desired algorithm; one of the names in `OQS_KEM_algs`.
+ * @return The descriptor of the algorithm, or `NULL` if the name is invalid or the algorithm has been disabled at compile-time.
+ */
+OQS_API const OQS_KEM *OQS_KEM_get(const char *method_name);
+
 /**
  * Keypair generation algorithm.
  *
@@ -256,6 +429,143 @@ OQS_API OQS_STATUS OQS_KEM_encaps(const OQS_KEM *kem, uint8_t *ciphertext, uint8
  */
 OQS_API OQS_STATUS OQS_KEM_decaps(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
 
+/**
+ * Deterministic keypair generation algorithm.
+ *
+ * Caller is responsible for allocating sufficient memory for `public_key` and
+ * `secret_key`, based on the `length_*` members in this object or the per-scheme
+ * compile-time macros `OQS_KEM_*_length_*`.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] public_key The public key represented as a byte string.
+ * @param[out] secret_key The secret key represented as a byte string.
+ * @param[in] seed The seed, `kem->length_keypair_seed` bytes long.
+ * @return OQS_SUCCESS or OQS_ERROR; OQS_ERROR if `kem` does not support deterministic keypair generation.
+ */
+OQS_API OQS_STATUS OQS_KEM_keypair_derand(const OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+
+/**
+ * Deterministic encapsulation algorithm.
+ *
+ * Caller is responsible for allocating sufficient memory for `ciphertext` and
+ * `shared_secret`, based on the `length_*` members in this object or the per-scheme
+ * compile-time macros `OQS_KEM_*_length_*`.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] public_key The public key represented as a byte string.
+ * @param[in] seed The seed, `kem->length_encaps_seed` bytes long.
+ * @return OQS_SUCCESS or OQS_ERROR; OQS_ERROR if `kem` does not support deterministic encapsulation.
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_derand(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed);
+
+/**
+ * Batch encapsulation algorithm.
+ *
+ * Performs `count` independent encapsulations. Buffers hold `count` entries stored
+ * back to back, each of the size given by the corresponding `length_*` member of
+ * `kem`. Schemes with a dedicated batch implementation (currently ML-KEM on AVX2)
+ * share SHAKE invocations across entries; all other schemes call `encaps` once per entry.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] count The number of encapsulations to perform.
+ * @param[out] ciphertexts The ciphertexts, stored back to back.
+ * @param[out] shared_secrets The shared secrets, stored back to back.
+ * @param[in] public_keys The public keys, stored back to back.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_batch(const OQS_KEM *kem, size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys);
+
+/**
+ * Batch decapsulation algorithm.
+ *
+ * Performs `count` independent decapsulations, using the same buffer layout as
+ * OQS_KEM_encaps_batch.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] count The number of decapsulations to perform.
+ * @param[out] shared_secrets The shared secrets, stored back to back.
+ * @param[in] ciphertexts The ciphertexts, stored back to back.
+ * @param[in] secret_keys The secret keys, stored back to back.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_decaps_batch(const OQS_KEM *kem, size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys);
+
+/**
+ * Constructs an OQS_KEM_PUBLIC_KEY object from an encoded public key.
+ *
+ * For schemes that support prepared public keys (currently ML-KEM), the object stores the
+ * expanded key, so that OQS_KEM_encaps_prepared skips unpacking the key and regenerating
+ * public matrices. For all other schemes, the object stores a copy of `public_key` and
+ * OQS_KEM_encaps_prepared behaves like OQS_KEM_encaps.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return An OQS_KEM_PUBLIC_KEY for use with `kem`, or `NULL` on error.
+ */
+OQS_API OQS_KEM_PUBLIC_KEY *OQS_KEM_PUBLIC_KEY_new(const OQS_KEM *kem, const uint8_t *public_key);
+
+/**
+ * Encapsulation algorithm using a public key object.
+ *
+ * Caller is responsible for allocating sufficient memory for `ciphertext` and
+ * `shared_secret`, based on the `length_*` members in this object or the per-scheme
+ * compile-time macros `OQS_KEM_*_length_*`.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] public_key The public key object, constructed by OQS_KEM_PUBLIC_KEY_new for the same KEM.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_encaps_prepared(const OQS_KEM *kem, uint8_t *ciphertext, uint8_t *shared_secret, const OQS_KEM_PUBLIC_KEY *public_key);
+
+/**
+ * Frees an OQS_KEM_PUBLIC_KEY object that was constructed by OQS_KEM_PUBLIC_KEY_new.
+ *
+ * @param[in] public_key The OQS_KEM_PUBLIC_KEY object to free.
+ */
+OQS_API void OQS_KEM_PUBLIC_KEY_free(OQS_KEM_PUBLIC_KEY *public_key);
+
+/**
+ * Constructs an OQS_KEM_SECRET_KEY object from an encoded secret key.
+ *
+ * For schemes that support prepared secret keys (currently ML-KEM), the object stores the
+ * unpacked secret key together with the expanded public key used for re-encryption, so that
+ * OQS_KEM_decaps_prepared skips unpacking and regenerating public matrices. For all other
+ * schemes, the object stores a copy of `secret_key` and OQS_KEM_decaps_prepared behaves
+ * like OQS_KEM_decaps.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return An OQS_KEM_SECRET_KEY for use with `kem`, or `NULL` on error.
+ */
+OQS_API OQS_KEM_SECRET_KEY *OQS_KEM_SECRET_KEY_new(const OQS_KEM *kem, const uint8_t *secret_key);
+
+/**
+ * Decapsulation algorithm using a secret key object.
+ *
+ * Caller is responsible for allocating sufficient memory for `shared_secret`, based
+ * on the `length_*` members in this object or the per-scheme compile-time macros
+ * `OQS_KEM_*_length_*`.
+ *
+ * @param[in] kem The OQS_KEM object representing the KEM.
+ * @param[out] shared_secret The shared secret represented as a byte string.
+ * @param[in] ciphertext The ciphertext (encapsulation) represented as a byte string.
+ * @param[in] secret_key The secret key object, constructed by OQS_KEM_SECRET_KEY_new for the same KEM.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_KEM_decaps_prepared(const OQS_KEM *kem, uint8_t *shared_secret, const uint8_t *ciphertext, const OQS_KEM_SECRET_KEY *secret_key);
+
+/**
+ * Frees an OQS_KEM_SECRET_KEY object that was constructed by OQS_KEM_SECRET_KEY_new,
+ * zeroising the key material first.
+ *
+ * @param[in] secret_key The OQS_KEM_SECRET_KEY object to free.
+ */
+OQS_API void OQS_KEM_SECRET_KEY_free(OQS_KEM_SECRET_KEY *secret_key);
+
 /**
  * Frees an OQS_KEM object that was constructed by OQS_KEM_new.
  *
@@ -6,6 +6,10 @@
 
 #if defined(OQS_ENABLE_KEM_kyber_1024)
 
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_KEM_kyber_1024_avx2) || defined(OQS_ENABLE_KEM_kyber_1024_aarch64))
+static void kyber_1024_bind_impl(OQS_KEM *kem);
+#endif
+
 OQS_KEM *OQS_KEM_kyber_1024_new(void) {
 
 	OQS_KEM *kem = OQS_MEM_malloc(sizeof(OQS_KEM));
@@ -26,6 +30,22 @@ OQS_KEM *OQS_KEM_kyber_1024_new(void) {
 	kem->keypair = OQS_KEM_kyber_1024_keypair;
 	kem->encaps = OQS_KEM_kyber_1024_encaps;
 	kem->decaps = OQS_KEM_kyber_1024_decaps;
+	kem->encaps_batch = NULL;
+	kem->decaps_batch = NULL;
+	kem->length_prepared_public_key = 0;
+	kem->prepare_public_key = NULL;
+	kem->encaps_prepared = NULL;
+	kem->length_prepared_secret_key = 0;
+	kem->prepare_secret_key = NULL;
+	kem->decaps_prepared = NULL;
+	kem->length_keypair_seed = 0;
+	kem->keypair_derand = NULL;
+	kem->length_encaps_seed = 0;
+	kem->encaps_derand = NULL;
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_KEM_kyber_1024_avx2) || defined(OQS_ENABLE_KEM_kyber_1024_aarch64))
+	kyber_1024_bind_impl(kem);
+#endif
 
 	return kem;
 }
@@ -124,4 +144,66 @@ OQS_API OQS_STATUS OQS_KEM_kyber_1024_decaps(uint8_t *shared_secret, const uint8
 #endif
 }
 
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_KEM_kyber_1024_avx2) || defined(OQS_ENABLE_KEM_kyber_1024_aarch64))
+/* Implementation-specific entry points, bound by OQS_KEM_kyber_1024_new once per object. */
+#if defined(OQS_ENABLE_KEM_kyber_1024_avx2)
+static OQS_STATUS kyber_1024_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_avx2_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS kyber_1024_avx2_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_avx2_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS kyber_1024_avx2_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_avx2_dec(shared_secret, ciphertext, secret_key);
+}
+#elif defined(OQS_ENABLE_KEM_kyber_1024_aarch64)
+static OQS_STATUS kyber_1024_aarch64_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_KYBER1024_AARCH64_crypto_kem_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS kyber_1024_aarch64_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_KYBER1024_AARCH64_crypto_kem_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS kyber_1024_aarch64_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_KYBER1024_AARCH64_crypto_kem_dec(shared_secret, ciphertext, secret_key);
+}
+#endif
+
+static OQS_STATUS kyber_1024_ref_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_ref_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS kyber_1024_ref_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_ref_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS kyber_1024_ref_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_kyber1024_ref_dec(shared_secret, ciphertext, secret_key);
+}
+
+static void kyber_1024_bind_impl(OQS_KEM *kem) {
+#if defined(OQS_ENABLE_KEM_kyber_1024_avx2)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+		kem->keypair = kyber_1024_avx2_keypair;
+		kem->encaps = kyber_1024_avx2_encaps;
+		kem->decaps = kyber_1024_avx2_decaps;
+		return;
+	}
+#elif defined(OQS_ENABLE_KEM_kyber_1024_aarch64)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+		kem->keypair = kyber_1024_aarch64_keypair;
+		kem->encaps = kyber_1024_aarch64_encaps;
+		kem->decaps = kyber_1024_aarch64_decaps;
+		return;
+	}
+#endif
+	kem->keypair = kyber_1024_ref_keypair;
+	kem->encaps = kyber_1024_ref_encaps;
+	kem->decaps = kyber_1024_ref_decaps;
+}
+#endif
+
 #endif
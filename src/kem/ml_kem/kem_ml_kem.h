@@ -10,10 +10,22 @@
 #define OQS_KEM_ml_kem_512_length_secret_key 1632
 #define OQS_KEM_ml_kem_512_length_ciphertext 768
 #define OQS_KEM_ml_kem_512_length_shared_secret 32
+#define OQS_KEM_ml_kem_512_length_prepared_public_key 3104
+#define OQS_KEM_ml_kem_512_length_prepared_secret_key 4160
+#define OQS_KEM_ml_kem_512_length_keypair_seed 64
+#define OQS_KEM_ml_kem_512_length_encaps_seed 32
 OQS_KEM *OQS_KEM_ml_kem_512_new(void);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed);
 #endif
 
 #if defined(OQS_ENABLE_KEM_ml_kem_768)
@@ -21,10 +33,22 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps(uint8_t *shared_secret, const uint8
 #define OQS_KEM_ml_kem_768_length_secret_key 2400
 #define OQS_KEM_ml_kem_768_length_ciphertext 1088
 #define OQS_KEM_ml_kem_768_length_shared_secret 32
+#define OQS_KEM_ml_kem_768_length_prepared_public_key 6176
+#define OQS_KEM_ml_kem_768_length_prepared_secret_key 7744
+#define OQS_KEM_ml_kem_768_length_keypair_seed 64
+#define OQS_KEM_ml_kem_768_length_encaps_seed 32
 OQS_KEM *OQS_KEM_ml_kem_768_new(void);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_768_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_768_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_768_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_768_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed);
 #endif
 
 #if defined(OQS_ENABLE_KEM_ml_kem_1024)
@@ -32,10 +56,22 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_768_decaps(uint8_t *shared_secret, const uint8
 #define OQS_KEM_ml_kem_1024_length_secret_key 3168
 #define OQS_KEM_ml_kem_1024_length_ciphertext 1568
 #define OQS_KEM_ml_kem_1024_length_shared_secret 32
+#define OQS_KEM_ml_kem_1024_length_prepared_public_key 10272
+#define OQS_KEM_ml_kem_1024_length_prepared_secret_key 12352
+#define OQS_KEM_ml_kem_1024_length_keypair_seed 64
+#define OQS_KEM_ml_kem_1024_length_encaps_seed 32
 OQS_KEM *OQS_KEM_ml_kem_1024_new(void);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed);
+OQS_API OQS_STATUS OQS_KEM_ml_kem_1024_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed);
 #endif
 
 #endif
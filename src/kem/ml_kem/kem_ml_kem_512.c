@@ -6,6 +6,10 @@
 
 #if defined(OQS_ENABLE_KEM_ml_kem_512)
 
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+static void ml_kem_512_bind_impl(OQS_KEM *kem);
+#endif
+
 OQS_KEM *OQS_KEM_ml_kem_512_new(void) {
 
 	OQS_KEM *kem = OQS_MEM_malloc(sizeof(OQS_KEM));
@@ -26,6 +30,22 @@ OQS_KEM *OQS_KEM_ml_kem_512_new(void) {
 	kem->keypair = OQS_KEM_ml_kem_512_keypair;
 	kem->encaps = OQS_KEM_ml_kem_512_encaps;
 	kem->decaps = OQS_KEM_ml_kem_512_decaps;
+	kem->encaps_batch = OQS_KEM_ml_kem_512_encaps_batch;
+	kem->decaps_batch = OQS_KEM_ml_kem_512_decaps_batch;
+	kem->length_prepared_public_key = OQS_KEM_ml_kem_512_length_prepared_public_key;
+	kem->prepare_public_key = OQS_KEM_ml_kem_512_prepare_public_key;
+	kem->encaps_prepared = OQS_KEM_ml_kem_512_encaps_prepared;
+	kem->length_prepared_secret_key = OQS_KEM_ml_kem_512_length_prepared_secret_key;
+	kem->prepare_secret_key = OQS_KEM_ml_kem_512_prepare_secret_key;
+	kem->decaps_prepared = OQS_KEM_ml_kem_512_decaps_prepared;
+	kem->length_keypair_seed = OQS_KEM_ml_kem_512_length_keypair_seed;
+	kem->keypair_derand = OQS_KEM_ml_kem_512_keypair_derand;
+	kem->length_encaps_seed = OQS_KEM_ml_kem_512_length_encaps_seed;
+	kem->encaps_derand = OQS_KEM_ml_kem_512_encaps_derand;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+	ml_kem_512_bind_impl(kem);
+#endif
 
 	return kem;
 }
@@ -33,11 +53,25 @@ OQS_KEM *OQS_KEM_ml_kem_512_new(void) {
 extern int pqcrystals_ml_kem_512_ref_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_ml_kem_512_ref_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int pqcrystals_ml_kem_512_ref_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int pqcrystals_ml_kem_512_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_kem_512_ref_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+extern int pqcrystals_ml_kem_512_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_kem_512_ref_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
+extern int pqcrystals_ml_kem_512_ref_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+extern int pqcrystals_ml_kem_512_ref_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
 
 #if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
 extern int pqcrystals_ml_kem_512_avx2_keypair(uint8_t *pk, uint8_t *sk);
 extern int pqcrystals_ml_kem_512_avx2_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 extern int pqcrystals_ml_kem_512_avx2_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
+extern int pqcrystals_ml_kem_512_avx2_enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+extern int pqcrystals_ml_kem_512_avx2_dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+extern int pqcrystals_ml_kem_512_avx2_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_kem_512_avx2_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+extern int pqcrystals_ml_kem_512_avx2_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_kem_512_avx2_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
+extern int pqcrystals_ml_kem_512_avx2_keypair_derand(uint8_t *pk, uint8_t *sk, const uint8_t *coins);
+extern int pqcrystals_ml_kem_512_avx2_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uint8_t *coins);
 #endif
 
 OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -88,4 +122,277 @@ OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps(uint8_t *shared_secret, const uint8
 #endif
 }
 
+#if !defined(OQS_ENABLE_KEM_ml_kem_512_avx2) || defined(OQS_DIST_BUILD)
+#define ML_KEM_512_BATCH_SEEDS 8
+
+/* Draws the encapsulation seeds for up to ML_KEM_512_BATCH_SEEDS entries with one OQS_randombytes call */
+static OQS_STATUS ml_kem_512_ref_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys) {
+	uint8_t seeds[ML_KEM_512_BATCH_SEEDS * OQS_KEM_ml_kem_512_length_encaps_seed];
+	OQS_STATUS rc = OQS_SUCCESS;
+
+	for (size_t i = 0; i < count && rc == OQS_SUCCESS; i++) {
+		size_t j = i % ML_KEM_512_BATCH_SEEDS;
+		if (j == 0) {
+			size_t n = count - i < ML_KEM_512_BATCH_SEEDS ? count - i : ML_KEM_512_BATCH_SEEDS;
+			OQS_randombytes(seeds, n * OQS_KEM_ml_kem_512_length_encaps_seed);
+		}
+		if (pqcrystals_ml_kem_512_ref_enc_derand(ciphertexts + i * OQS_KEM_ml_kem_512_length_ciphertext, shared_secrets + i * OQS_KEM_ml_kem_512_length_shared_secret, public_keys + i * OQS_KEM_ml_kem_512_length_public_key, seeds + j * OQS_KEM_ml_kem_512_length_encaps_seed) != 0) {
+			rc = OQS_ERROR;
+		}
+	}
+	OQS_MEM_cleanse(seeds, sizeof(seeds));
+	return rc;
+}
+#endif
+
+#if !defined(OQS_ENABLE_KEM_ml_kem_512_avx2) || defined(OQS_DIST_BUILD)
+static OQS_STATUS ml_kem_512_ref_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys) {
+	for (size_t i = 0; i < count; i++) {
+		if (pqcrystals_ml_kem_512_ref_dec(shared_secrets + i * OQS_KEM_ml_kem_512_length_shared_secret, ciphertexts + i * OQS_KEM_ml_kem_512_length_ciphertext, secret_keys + i * OQS_KEM_ml_kem_512_length_secret_key) != 0) {
+			return OQS_ERROR;
+		}
+	}
+	return OQS_SUCCESS;
+}
+#endif
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_batch(ciphertexts, shared_secrets, public_keys, count);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return ml_kem_512_ref_encaps_batch(count, ciphertexts, shared_secrets, public_keys);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return ml_kem_512_ref_encaps_batch(count, ciphertexts, shared_secrets, public_keys);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_dec_batch(shared_secrets, ciphertexts, secret_keys, count);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return ml_kem_512_ref_decaps_batch(count, shared_secrets, ciphertexts, secret_keys);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return ml_kem_512_ref_decaps_batch(count, shared_secrets, ciphertexts, secret_keys);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_expand_pk(prepared_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_pk(prepared_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_pk(prepared_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_expanded(ciphertext, shared_secret, prepared_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_expanded(ciphertext, shared_secret, prepared_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_expanded(ciphertext, shared_secret, prepared_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_expand_sk(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_sk(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_sk(prepared_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_dec_expanded(shared_secret, ciphertext, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_dec_expanded(shared_secret, ciphertext, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_dec_expanded(shared_secret, ciphertext, prepared_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_keypair_derand(public_key, secret_key, seed);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_keypair_derand(public_key, secret_key, seed);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_keypair_derand(public_key, secret_key, seed);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_KEM_ml_kem_512_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed) {
+#if defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_derand(ciphertext, shared_secret, public_key, seed);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_derand(ciphertext, shared_secret, public_key, seed);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_derand(ciphertext, shared_secret, public_key, seed);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_KEM_ml_kem_512_avx2)
+/* Implementation-specific entry points, bound by OQS_KEM_ml_kem_512_new once per object. */
+static OQS_STATUS ml_kem_512_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_dec(shared_secret, ciphertext, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_encaps_batch(size_t count, uint8_t *ciphertexts, uint8_t *shared_secrets, const uint8_t *public_keys) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_batch(ciphertexts, shared_secrets, public_keys, count);
+}
+
+static OQS_STATUS ml_kem_512_avx2_decaps_batch(size_t count, uint8_t *shared_secrets, const uint8_t *ciphertexts, const uint8_t *secret_keys) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_dec_batch(shared_secrets, ciphertexts, secret_keys, count);
+}
+
+static OQS_STATUS ml_kem_512_avx2_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_expand_pk(prepared_public_key, public_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_expanded(ciphertext, shared_secret, prepared_public_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_expand_sk(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_dec_expanded(shared_secret, ciphertext, prepared_secret_key);
+}
+
+static OQS_STATUS ml_kem_512_avx2_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_keypair_derand(public_key, secret_key, seed);
+}
+
+static OQS_STATUS ml_kem_512_avx2_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_avx2_enc_derand(ciphertext, shared_secret, public_key, seed);
+}
+
+static OQS_STATUS ml_kem_512_ref_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_encaps(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc(ciphertext, shared_secret, public_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_decaps(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_dec(shared_secret, ciphertext, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_pk(prepared_public_key, public_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_encaps_prepared(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *prepared_public_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_expanded(ciphertext, shared_secret, prepared_public_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_expand_sk(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_decaps_prepared(uint8_t *shared_secret, const uint8_t *ciphertext, const uint8_t *prepared_secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_dec_expanded(shared_secret, ciphertext, prepared_secret_key);
+}
+
+static OQS_STATUS ml_kem_512_ref_keypair_derand(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_keypair_derand(public_key, secret_key, seed);
+}
+
+static OQS_STATUS ml_kem_512_ref_encaps_derand(uint8_t *ciphertext, uint8_t *shared_secret, const uint8_t *public_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_ml_kem_512_ref_enc_derand(ciphertext, shared_secret, public_key, seed);
+}
+
+static void ml_kem_512_bind_impl(OQS_KEM *kem) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+		kem->keypair = ml_kem_512_avx2_keypair;
+		kem->encaps = ml_kem_512_avx2_encaps;
+		kem->decaps = ml_kem_512_avx2_decaps;
+		kem->encaps_batch = ml_kem_512_avx2_encaps_batch;
+		kem->decaps_batch = ml_kem_512_avx2_decaps_batch;
+		kem->prepare_public_key = ml_kem_512_avx2_prepare_public_key;
+		kem->encaps_prepared = ml_kem_512_avx2_encaps_prepared;
+		kem->prepare_secret_key = ml_kem_512_avx2_prepare_secret_key;
+		kem->decaps_prepared = ml_kem_512_avx2_decaps_prepared;
+		kem->keypair_derand = ml_kem_512_avx2_keypair_derand;
+		kem->encaps_derand = ml_kem_512_avx2_encaps_derand;
+		return;
+	}
+	kem->keypair = ml_kem_512_ref_keypair;
+	kem->encaps = ml_kem_512_ref_encaps;
+	kem->decaps = ml_kem_512_ref_decaps;
+	kem->encaps_batch = ml_kem_512_ref_encaps_batch;
+	kem->decaps_batch = ml_kem_512_ref_decaps_batch;
+	kem->prepare_public_key = ml_kem_512_ref_prepare_public_key;
+	kem->encaps_prepared = ml_kem_512_ref_encaps_prepared;
+	kem->prepare_secret_key = ml_kem_512_ref_prepare_secret_key;
+	kem->decaps_prepared = ml_kem_512_ref_decaps_prepared;
+	kem->keypair_derand = ml_kem_512_ref_keypair_derand;
+	kem->encaps_derand = ml_kem_512_ref_encaps_derand;
+}
+#endif
+
 #endif
@@ -5,20 +5,53 @@
 #include "params.h"
 #include "polyvec.h"
 
+typedef struct {
+  polyvec at[KYBER_K];
+  polyvec pkpv;
+} indcpa_expanded_pk;
+
 #define gen_matrix KYBER_NAMESPACE(gen_matrix)
 void gen_matrix(polyvec *a, const uint8_t seed[KYBER_SYMBYTES], int transposed);
 
+#define gen_matrix_x4 KYBER_NAMESPACE(gen_matrix_x4)
+void gen_matrix_x4(polyvec a[4][KYBER_K], const uint8_t *seed[4], int transposed);
+
 #define indcpa_keypair_derand KYBER_NAMESPACE(indcpa_keypair_derand)
 void indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                            uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES],
                            const uint8_t coins[KYBER_SYMBYTES]);
 
+#define indcpa_expand_pk KYBER_NAMESPACE(indcpa_expand_pk)
+void indcpa_expand_pk(indcpa_expanded_pk *epk,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]);
+
+#define indcpa_enc_expanded KYBER_NAMESPACE(indcpa_enc_expanded)
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[KYBER_SYMBYTES]);
+
 #define indcpa_enc KYBER_NAMESPACE(indcpa_enc)
 void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                 const uint8_t coins[KYBER_SYMBYTES]);
 
+#define indcpa_enc_x4 KYBER_NAMESPACE(indcpa_enc_x4)
+void indcpa_enc_x4(uint8_t *c[4],
+                   const uint8_t *m[4],
+                   const uint8_t *pk[4],
+                   const uint8_t *coins[4]);
+
+#define indcpa_expand_sk KYBER_NAMESPACE(indcpa_expand_sk)
+void indcpa_expand_sk(polyvec *skpv,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
+
+#define indcpa_dec_expanded KYBER_NAMESPACE(indcpa_dec_expanded)
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv);
+
 #define indcpa_dec KYBER_NAMESPACE(indcpa_dec)
 void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t c[KYBER_INDCPA_BYTES],
@@ -1,6 +1,7 @@
 #ifndef KEM_H
 #define KEM_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "params.h"
 
@@ -29,7 +30,28 @@ int crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, const uint8_t *pk, const uin
 #define crypto_kem_enc KYBER_NAMESPACE(enc)
 int crypto_kem_enc(uint8_t *ct, uint8_t *ss, const uint8_t *pk);
 
+#define crypto_kem_expand_pk KYBER_NAMESPACE(expand_pk)
+int crypto_kem_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+#define crypto_kem_enc_expanded_derand KYBER_NAMESPACE(enc_expanded_derand)
+int crypto_kem_enc_expanded_derand(uint8_t *ct, uint8_t *ss, const uint8_t *epk, const uint8_t *coins);
+
+#define crypto_kem_enc_expanded KYBER_NAMESPACE(enc_expanded)
+int crypto_kem_enc_expanded(uint8_t *ct, uint8_t *ss, const uint8_t *epk);
+
 #define crypto_kem_dec KYBER_NAMESPACE(dec)
 int crypto_kem_dec(uint8_t *ss, const uint8_t *ct, const uint8_t *sk);
 
+#define crypto_kem_expand_sk KYBER_NAMESPACE(expand_sk)
+int crypto_kem_expand_sk(uint8_t *esk, const uint8_t *sk);
+
+#define crypto_kem_dec_expanded KYBER_NAMESPACE(dec_expanded)
+int crypto_kem_dec_expanded(uint8_t *ss, const uint8_t *ct, const uint8_t *esk);
+
+#define crypto_kem_enc_batch KYBER_NAMESPACE(enc_batch)
+int crypto_kem_enc_batch(uint8_t *ct, uint8_t *ss, const uint8_t *pk, size_t count);
+
+#define crypto_kem_dec_batch KYBER_NAMESPACE(dec_batch)
+int crypto_kem_dec_batch(uint8_t *ss, const uint8_t *ct, const uint8_t *sk, size_t count);
+
 #endif
@@ -7,6 +7,18 @@
 #include "verify.h"
 #include "symmetric.h"
 #include "randombytes.h"
+
+typedef struct {
+  indcpa_expanded_pk indcpa;
+  uint8_t hpk[KYBER_SYMBYTES];
+} kem_expanded_pk;
+
+typedef struct {
+  polyvec skpv;
+  kem_expanded_pk pk;
+  uint8_t z[KYBER_SYMBYTES];
+} kem_expanded_sk;
+
 /*************************************************
 * Name:        crypto_kem_keypair_derand
 *
@@ -120,6 +132,96 @@ int crypto_kem_enc(uint8_t *ct,
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_kem_expand_pk
+*
+* Description: Expands a public key into the form consumed by
+*              crypto_kem_enc_expanded: unpacked NTT-domain vector,
+*              matrix A^T and H(pk)
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*                (an already allocated, 32-byte aligned array of
+*                KYBER_EXPANDEDPKBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                (an already allocated array of KYBER_PUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_expand_pk(uint8_t *epk,
+                         const uint8_t *pk)
+{
+  kem_expanded_pk *e = (kem_expanded_pk *)epk;
+
+  indcpa_expand_pk(&e->indcpa, pk);
+  hash_h(e->hpk, pk, KYBER_PUBLICKEYBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_enc_expanded_derand
+*
+* Description: Generates cipher text and shared
+*              secret for given expanded public key
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *epk: pointer to input expanded public key
+*                (as output by crypto_kem_expand_pk)
+*              - const uint8_t *coins: pointer to input randomness
+*                (an already allocated array filled with KYBER_SYMBYTES random bytes)
+**
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_expanded_derand(uint8_t *ct,
+                                   uint8_t *ss,
+                                   const uint8_t *epk,
+                                   const uint8_t *coins)
+{
+  const kem_expanded_pk *e = (const kem_expanded_pk *)epk;
+  uint8_t buf[2*KYBER_SYMBYTES];
+  /* Will contain key, coins */
+  uint8_t kr[2*KYBER_SYMBYTES];
+
+  memcpy(buf, coins, KYBER_SYMBYTES);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf+KYBER_SYMBYTES, e->hpk, KYBER_SYMBYTES);
+  hash_g(kr, buf, 2*KYBER_SYMBYTES);
+
+  /* coins are in kr+KYBER_SYMBYTES */
+  indcpa_enc_expanded(ct, buf, &e->indcpa, kr+KYBER_SYMBYTES);
+
+  memcpy(ss,kr,KYBER_SYMBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_enc_expanded
+*
+* Description: Generates cipher text and shared
+*              secret for given expanded public key
+*
+* Arguments:   - uint8_t *ct: pointer to output cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *epk: pointer to input expanded public key
+*                (as output by crypto_kem_expand_pk)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_expanded(uint8_t *ct,
+                            uint8_t *ss,
+                            const uint8_t *epk)
+{
+  uint8_t coins[KYBER_SYMBYTES];
+  randombytes(coins, KYBER_SYMBYTES);
+  crypto_kem_enc_expanded_derand(ct, ss, epk, coins);
+  return 0;
+}
+
 /*************************************************
 * Name:        crypto_kem_dec
 *
@@ -167,3 +269,78 @@ int crypto_kem_dec(uint8_t *ss,
 
   return 0;
 }
+
+/*************************************************
+* Name:        crypto_kem_expand_sk
+*
+* Description: Expands a secret key into the form consumed by
+*              crypto_kem_dec_expanded: unpacked NTT-domain secret
+*              vector, expanded embedded public key and value z
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                (an already allocated, 32-byte aligned array of
+*                KYBER_EXPANDEDSKBYTES bytes)
+*              - const uint8_t *sk: pointer to input private key
+*                (an already allocated array of KYBER_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_expand_sk(uint8_t *esk,
+                         const uint8_t *sk)
+{
+  kem_expanded_sk *e = (kem_expanded_sk *)esk;
+
+  indcpa_expand_sk(&e->skpv, sk);
+  indcpa_expand_pk(&e->pk.indcpa, sk+KYBER_INDCPA_SECRETKEYBYTES);
+  memcpy(e->pk.hpk, sk+KYBER_SECRETKEYBYTES-2*KYBER_SYMBYTES, KYBER_SYMBYTES);
+  memcpy(e->z, sk+KYBER_SECRETKEYBYTES-KYBER_SYMBYTES, KYBER_SYMBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_dec_expanded
+*
+* Description: Generates shared secret for given
+*              cipher text and expanded private key
+*
+* Arguments:   - uint8_t *ss: pointer to output shared secret
+*                (an already allocated array of KYBER_SSBYTES bytes)
+*              - const uint8_t *ct: pointer to input cipher text
+*                (an already allocated array of KYBER_CIPHERTEXTBYTES bytes)
+*              - const uint8_t *esk: pointer to input expanded private key
+*                (as output by crypto_kem_expand_sk)
+*
+* Returns 0.
+*
+* On failure, ss will contain a pseudo-random value.
+**************************************************/
+int crypto_kem_dec_expanded(uint8_t *ss,
+                            const uint8_t *ct,
+                            const uint8_t *esk)
+{
+  const kem_expanded_sk *e = (const kem_expanded_sk *)esk;
+  int fail;
+  uint8_t buf[2*KYBER_SYMBYTES];
+  /* Will contain key, coins */
+  uint8_t kr[2*KYBER_SYMBYTES];
+  uint8_t cmp[KYBER_CIPHERTEXTBYTES+KYBER_SYMBYTES];
+
+  indcpa_dec_expanded(buf, ct, &e->skpv);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  memcpy(buf+KYBER_SYMBYTES, e->pk.hpk, KYBER_SYMBYTES);
+  hash_g(kr, buf, 2*KYBER_SYMBYTES);
+
+  /* coins are in kr+KYBER_SYMBYTES */
+  indcpa_enc_expanded(cmp, buf, &e->pk.indcpa, kr+KYBER_SYMBYTES);
+
+  fail = verify(ct, cmp, KYBER_CIPHERTEXTBYTES);
+
+  /* Compute rejection key */
+  rkprf(ss,e->z,ct);
+
+  /* Copy true key to return buffer if fail is false */
+  cmov(ss,kr,KYBER_SYMBYTES,!fail);
+
+  return 0;
+}
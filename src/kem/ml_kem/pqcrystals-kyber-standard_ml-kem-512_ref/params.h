@@ -52,4 +52,11 @@
 #define KYBER_SECRETKEYBYTES  (KYBER_INDCPA_SECRETKEYBYTES + KYBER_INDCPA_PUBLICKEYBYTES + 2*KYBER_SYMBYTES)
 #define KYBER_CIPHERTEXTBYTES (KYBER_INDCPA_BYTES)
 
+/* Unpacked polynomial vector: KYBER_K polynomials of KYBER_N int16_t coefficients */
+#define KYBER_POLYVECUNPACKEDBYTES (KYBER_K * KYBER_N * 2)
+/* Matrix A^T and vector t in NTT domain, followed by H(pk) */
+#define KYBER_EXPANDEDPKBYTES ((KYBER_K + 1) * KYBER_POLYVECUNPACKEDBYTES + KYBER_SYMBYTES)
+/* Vector s in NTT domain, expanded public key and rejection value z */
+#define KYBER_EXPANDEDSKBYTES (KYBER_POLYVECUNPACKEDBYTES + KYBER_EXPANDEDPKBYTES + KYBER_SYMBYTES)
+
 #endif
@@ -417,6 +417,130 @@ void gen_matrix(polyvec *a, const uint8_t seed[32], int transposed)
 }
 #endif
 
+/*************************************************
+* Name:        gen_matrix_entries_x4
+*
+* Description: Samples four independent matrix entries in one pass over
+*              the 4-way SHAKE128 state. Entry j is generated from
+*              seed[j] extended by the two bytes in nonce[j].
+*
+* Arguments:   - poly *r[4]: pointers to output polynomials
+*              - const uint8_t *seed[4]: pointers to input seeds
+*              - uint8_t nonce[4][2]: matrix indices per entry
+*              - shake128x4incctx *state: pointer to initialized 4-way state
+**************************************************/
+static void gen_matrix_entries_x4(poly *r[4],
+                                  const uint8_t *seed[4],
+                                  uint8_t nonce[4][2],
+                                  shake128x4incctx *state)
+{
+  unsigned int j, ctr[4];
+  ALIGNED_UINT8(REJ_UNIFORM_AVX_NBLOCKS*SHAKE128_RATE) buf[4];
+
+  for(j=0;j<4;j++) {
+    memcpy(buf[j].coeffs, seed[j], KYBER_SYMBYTES);
+    buf[j].coeffs[32] = nonce[j][0];
+    buf[j].coeffs[33] = nonce[j][1];
+  }
+
+  shake128x4_absorb_once(state, buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 34);
+  shake128x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, REJ_UNIFORM_AVX_NBLOCKS, state);
+
+  for(j=0;j<4;j++)
+    ctr[j] = rej_uniform_avx(r[j]->coeffs, buf[j].coeffs);
+
+  while(ctr[0] < KYBER_N || ctr[1] < KYBER_N || ctr[2] < KYBER_N || ctr[3] < KYBER_N) {
+    shake128x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 1, state);
+
+    for(j=0;j<4;j++)
+      ctr[j] += rej_uniform(r[j]->coeffs + ctr[j], KYBER_N - ctr[j], buf[j].coeffs, SHAKE128_RATE);
+  }
+
+  for(j=0;j<4;j++)
+    poly_nttunpack(r[j]);
+}
+
+/*************************************************
+* Name:        gen_matrix_x4
+*
+* Description: Deterministically generate four matrices A (or the transposes
+*              of A) from four independent seeds. All 4*KYBER_K*KYBER_K
+*              entries are fed through the 4-way SHAKE128 in groups of four,
+*              so no lane is left idle as in the single-seed gen_matrix.
+*              Output is identical to four calls to gen_matrix.
+*
+* Arguments:   - polyvec a[4][KYBER_K]: output matrices
+*              - const uint8_t *seed[4]: pointers to input seeds
+*              - int transposed: boolean deciding whether A or A^T is generated
+**************************************************/
+void gen_matrix_x4(polyvec a[4][KYBER_K], const uint8_t *seed[4], int transposed)
+{
+  unsigned int i, j, k, n;
+  poly *r[4];
+  const uint8_t *s[4];
+  uint8_t nonce[4][2];
+  shake128x4incctx state;
+
+  shake128x4_inc_init(&state);
+  n = 0;
+  for(k=0;k<4;k++) {
+    for(i=0;i<KYBER_K;i++) {
+      for(j=0;j<KYBER_K;j++) {
+        r[n] = &a[k][i].vec[j];
+        s[n] = seed[k];
+        nonce[n][0] = transposed ? i : j;
+        nonce[n][1] = transposed ? j : i;
+        if(++n == 4) {
+          gen_matrix_entries_x4(r, s, nonce, &state);
+          n = 0;
+        }
+      }
+    }
+  }
+  shake128x4_inc_ctx_release(&state);
+}
+
+#define NOISE_NBLOCKS ((KYBER_ETA1*KYBER_N/4+SHAKE256_RATE-1)/SHAKE256_RATE)
+
+/*************************************************
+* Name:        getnoise_entries_x4
+*
+* Description: Samples four noise polynomials with independent seeds and
+*              nonces in one pass over the 4-way SHAKE256 state.
+*              Entry j uses the centered binomial distribution with
+*              parameter KYBER_ETA1 if eta1[j] is set, KYBER_ETA2 otherwise.
+*
+* Arguments:   - poly *r[4]: pointers to output polynomials
+*              - const uint8_t *seed[4]: pointers to input seeds
+*              - const uint8_t nonce[4]: one-byte nonces
+*              - const int eta1[4]: distribution selector per entry
+*              - shake256x4incctx *state: pointer to initialized 4-way state
+**************************************************/
+static void getnoise_entries_x4(poly *r[4],
+                                const uint8_t *seed[4],
+                                const uint8_t nonce[4],
+                                const int eta1[4],
+                                shake256x4incctx *state)
+{
+  unsigned int j;
+  ALIGNED_UINT8(NOISE_NBLOCKS*SHAKE256_RATE) buf[4];
+
+  for(j=0;j<4;j++) {
+    memcpy(buf[j].coeffs, seed[j], KYBER_SYMBYTES);
+    buf[j].coeffs[32] = nonce[j];
+  }
+
+  shake256x4_absorb_once(state, buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, 33);
+  shake256x4_squeezeblocks(buf[0].coeffs, buf[1].coeffs, buf[2].coeffs, buf[3].coeffs, NOISE_NBLOCKS, state);
+
+  for(j=0;j<4;j++) {
+    if(eta1[j])
+      poly_cbd_eta1(r[j], buf[j].vec);
+    else
+      poly_cbd_eta2(r[j], buf[j].vec);
+  }
+}
+
 /*************************************************
 * Name:        indcpa_keypair_derand
 *
@@ -474,34 +598,51 @@ void indcpa_keypair_derand(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
 }
 
 /*************************************************
-* Name:        indcpa_enc
+* Name:        indcpa_expand_pk
+*
+* Description: Unpacks a public key and expands the matrix A^T
+*              from its seed, so that the result can be reused
+*              by indcpa_enc_expanded for any number of encryptions.
+*
+* Arguments:   - indcpa_expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void indcpa_expand_pk(indcpa_expanded_pk *epk,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES])
+{
+  uint8_t seed[KYBER_SYMBYTES];
+
+  unpack_pk(&epk->pkpv, seed, pk);
+  gen_at(epk->at, seed);
+}
+
+/*************************************************
+* Name:        indcpa_enc_expanded
 *
 * Description: Encryption function of the CPA-secure
-*              public-key encryption scheme underlying Kyber.
+*              public-key encryption scheme underlying Kyber,
+*              operating on a public key expanded by indcpa_expand_pk.
 *
 * Arguments:   - uint8_t *c: pointer to output ciphertext
 *                            (of length KYBER_INDCPA_BYTES bytes)
 *              - const uint8_t *m: pointer to input message
 *                                  (of length KYBER_INDCPA_MSGBYTES bytes)
-*              - const uint8_t *pk: pointer to input public key
-*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const indcpa_expanded_pk *epk: pointer to input expanded public key
 *              - const uint8_t *coins: pointer to input random coins used as seed
 *                                      (of length KYBER_SYMBYTES) to deterministically
 *                                      generate all randomness
 **************************************************/
-void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
-                const uint8_t m[KYBER_INDCPA_MSGBYTES],
-                const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
-                const uint8_t coins[KYBER_SYMBYTES])
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[KYBER_SYMBYTES])
 {
   unsigned int i;
-  uint8_t seed[KYBER_SYMBYTES];
-  polyvec sp, pkpv, ep, at[KYBER_K], b;
+  polyvec sp, ep, b;
   poly v, k, epp;
 
-  unpack_pk(&pkpv, seed, pk);
   poly_frommsg(&k, m);
-  gen_at(at, seed);
 
 #if KYBER_K == 2
   poly_getnoise_eta1122_4x(sp.vec+0, sp.vec+1, ep.vec+0, ep.vec+1, coins, 0, 1, 2, 3);
@@ -519,8 +660,8 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 
   // matrix-vector multiplication
   for(i=0;i<KYBER_K;i++)
-    polyvec_basemul_acc_montgomery(&b.vec[i], &at[i], &sp);
-  polyvec_basemul_acc_montgomery(&v, &pkpv, &sp);
+    polyvec_basemul_acc_montgomery(&b.vec[i], &epk->at[i], &sp);
+  polyvec_basemul_acc_montgomery(&v, &epk->pkpv, &sp);
 
   polyvec_invntt_tomont(&b);
   poly_invntt_tomont(&v);
@@ -535,30 +676,72 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
 }
 
 /*************************************************
-* Name:        indcpa_dec
+* Name:        indcpa_enc
 *
-* Description: Decryption function of the CPA-secure
+* Description: Encryption function of the CPA-secure
 *              public-key encryption scheme underlying Kyber.
 *
+* Arguments:   - uint8_t *c: pointer to output ciphertext
+*                            (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m: pointer to input message
+*                                  (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk: pointer to input public key
+*                                   (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins: pointer to input random coins used as seed
+*                                      (of length KYBER_SYMBYTES) to deterministically
+*                                      generate all randomness
+**************************************************/
+void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
+                const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
+                const uint8_t coins[KYBER_SYMBYTES])
+{
+  indcpa_expanded_pk epk;
+
+  indcpa_expand_pk(&epk, pk);
+  indcpa_enc_expanded(c, m, &epk, coins);
+}
+
+/*************************************************
+* Name:        indcpa_expand_sk
+*
+* Description: Unpacks a secret key into the NTT-domain vector
+*              consumed by indcpa_dec_expanded.
+*
+* Arguments:   - polyvec *skpv: pointer to output secret-key polynomial vector
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void indcpa_expand_sk(polyvec *skpv,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+{
+  unpack_sk(skpv, sk);
+}
+
+/*************************************************
+* Name:        indcpa_dec_expanded
+*
+* Description: Decryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber,
+*              operating on a secret key expanded by indcpa_expand_sk.
+*
 * Arguments:   - uint8_t *m: pointer to output decrypted message
 *                            (of length KYBER_INDCPA_MSGBYTES)
 *              - const uint8_t *c: pointer to input ciphertext
 *                                  (of length KYBER_INDCPA_BYTES)
-*              - const uint8_t *sk: pointer to input secret key
-*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+*              - const polyvec *skpv: pointer to input secret-key polynomial vector
 **************************************************/
-void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
-                const uint8_t c[KYBER_INDCPA_BYTES],
-                const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const polyvec *skpv)
 {
-  polyvec b, skpv;
+  polyvec b;
   poly v, mp;
 
   unpack_ciphertext(&b, &v, c);
-  unpack_sk(&skpv, sk);
 
   polyvec_ntt(&b);
-  polyvec_basemul_acc_montgomery(&mp, &skpv, &b);
+  polyvec_basemul_acc_montgomery(&mp, skpv, &b);
   poly_invntt_tomont(&mp);
 
   poly_sub(&mp, &v, &mp);
@@ -566,3 +749,109 @@ void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
 
   poly_tomsg(m, &mp);
 }
+
+/*************************************************
+* Name:        indcpa_dec
+*
+* Description: Decryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber.
+*
+* Arguments:   - uint8_t *m: pointer to output decrypted message
+*                            (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c: pointer to input ciphertext
+*                                  (of length KYBER_INDCPA_BYTES)
+*              - const uint8_t *sk: pointer to input secret key
+*                                   (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                const uint8_t c[KYBER_INDCPA_BYTES],
+                const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+{
+  polyvec skpv;
+
+  indcpa_expand_sk(&skpv, sk);
+  indcpa_dec_expanded(m, c, &skpv);
+}
+
+/*************************************************
+* Name:        indcpa_enc_x4
+*
+* Description: Four independent encryptions of the CPA-secure
+*              public-key encryption scheme underlying Kyber.
+*              Matrix expansion and noise sampling for all four
+*              inputs share the 4-way SHAKE states; the output is
+*              identical to four calls to indcpa_enc.
+*
+* Arguments:   - uint8_t *c[4]: pointers to output ciphertexts
+*                               (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m[4]: pointers to input messages
+*                                     (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const uint8_t *pk[4]: pointers to input public keys
+*                                      (of length KYBER_INDCPA_PUBLICKEYBYTES)
+*              - const uint8_t *coins[4]: pointers to input random coins
+*                                         (of length KYBER_SYMBYTES)
+**************************************************/
+void indcpa_enc_x4(uint8_t *c[4],
+                   const uint8_t *m[4],
+                   const uint8_t *pk[4],
+                   const uint8_t *coins[4])
+{
+  unsigned int i, k, n;
+  uint8_t seed[4][KYBER_SYMBYTES];
+  const uint8_t *s[4];
+  uint8_t nonce[4];
+  int eta1[4];
+  poly *r[4];
+  polyvec sp[4], pkpv[4], ep[4], at[4][KYBER_K], b;
+  poly v, kp, epp[4];
+  shake256x4incctx state;
+
+  for(k=0;k<4;k++) {
+    unpack_pk(&pkpv[k], seed[k], pk[k]);
+    s[k] = seed[k];
+  }
+  gen_matrix_x4(at, s, 1);
+
+  /* sp with eta1, ep and epp with eta2, nonces 0..2*KYBER_K as in indcpa_enc */
+  shake256x4_inc_init(&state);
+  n = 0;
+  for(k=0;k<4;k++) {
+    for(i=0;i<2*KYBER_K+1;i++) {
+      if(i < KYBER_K)
+        r[n] = &sp[k].vec[i];
+      else if(i < 2*KYBER_K)
+        r[n] = &ep[k].vec[i-KYBER_K];
+      else
+        r[n] = &epp[k];
+      s[n] = coins[k];
+      nonce[n] = i;
+      eta1[n] = i < KYBER_K;
+      if(++n == 4) {
+        getnoise_entries_x4(r, s, nonce, eta1, &state);
+        n = 0;
+      }
+    }
+  }
+  shake256x4_inc_ctx_release(&state);
+
+  for(k=0;k<4;k++) {
+    poly_frommsg(&kp, m[k]);
+    polyvec_ntt(&sp[k]);
+
+    // matrix-vector multiplication
+    for(i=0;i<KYBER_K;i++)
+      polyvec_basemul_acc_montgomery(&b.vec[i], &at[k][i], &sp[k]);
+    polyvec_basemul_acc_montgomery(&v, &pkpv[k], &sp[k]);
+
+    polyvec_invntt_tomont(&b);
+    poly_invntt_tomont(&v);
+
+    polyvec_add(&b, &b, &ep[k]);
+    poly_add(&v, &v, &epp[k]);
+    poly_add(&v, &v, &kp);
+    polyvec_reduce(&b);
+    poly_reduce(&v);
+
+    pack_ciphertext(c[k], &b, &v);
+  }
+}
@@ -57,6 +57,8 @@
 #cmakedefine OQS_USE_SSE_INSTRUCTIONS 1
 #cmakedefine OQS_USE_SSE2_INSTRUCTIONS 1
 #cmakedefine OQS_USE_SSE3_INSTRUCTIONS 1
+#cmakedefine OQS_USE_SHA_INSTRUCTIONS 1
+#cmakedefine OQS_USE_VAES_INSTRUCTIONS 1
 
 #cmakedefine OQS_USE_ARM_AES_INSTRUCTIONS 1
 #cmakedefine OQS_USE_ARM_SHA2_INSTRUCTIONS 1
@@ -68,6 +70,7 @@
 #cmakedefine OQS_ENABLE_TEST_CONSTANT_TIME 1
 
 #cmakedefine OQS_ENABLE_SHA3_xkcp_low_avx2 1
+#cmakedefine OQS_ENABLE_SHA3_xkcp_low_avx512 1
 
 #cmakedefine OQS_ENABLE_KEM_BIKE 1
 #cmakedefine OQS_ENABLE_KEM_bike_l1 1
@@ -313,3 +316,6 @@
 #cmakedefine OQS_ALLOW_STFL_KEY_AND_SIG_GEN 1
 #cmakedefine OQS_ALLOW_XMSS_KEY_AND_SIG_GEN 1
 #cmakedefine OQS_ALLOW_LMS_KEY_AND_SIG_GEN 1
+#cmakedefine OQS_LMS_USE_PTHREADS 1
+#cmakedefine OQS_XMSS_USE_PTHREADS 1
+#cmakedefine OQS_SPHINCS_USE_PTHREADS 1
@@ -5,6 +5,10 @@
 #include <oqs/sig_cross.h>
 
 #if defined(OQS_ENABLE_SIG_cross_rsdp_192_fast)
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+static void cross_rsdp_192_fast_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_cross_rsdp_192_fast_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +33,30 @@ OQS_SIG *OQS_SIG_cross_rsdp_192_fast_new(void) {
 	sig->verify = OQS_SIG_cross_rsdp_192_fast_verify;
 	sig->sign_with_ctx_str = OQS_SIG_cross_rsdp_192_fast_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_cross_rsdp_192_fast_verify_with_ctx_str;
+	sig->length_prepared_secret_key = 0;
+	sig->prepare_secret_key = NULL;
+	sig->sign_prepared = NULL;
+	sig->sign_prepared_threaded = NULL;
+	sig->length_prepared_public_key = 0;
+	sig->prepare_public_key = NULL;
+	sig->verify_prepared = NULL;
+	sig->length_stream_state = 0;
+	sig->sign_init = NULL;
+	sig->sign_final = NULL;
+	sig->verify_init = NULL;
+	sig->verify_final = NULL;
+	sig->stream_update = NULL;
+	sig->stream_release = NULL;
+	sig->length_mu = 0;
+	sig->compute_mu = NULL;
+	sig->sign_mu = NULL;
+	sig->verify_mu = NULL;
+	sig->sign_prehash = NULL;
+	sig->verify_prehash = NULL;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+	cross_rsdp_192_fast_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -142,4 +170,64 @@ OQS_API OQS_STATUS OQS_SIG_cross_rsdp_192_fast_verify_with_ctx_str(const uint8_t
 		return OQS_ERROR;
 	}
 }
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_cross_rsdp_192_fast_avx2)
+/* Implementation-specific entry points, bound by OQS_SIG_cross_rsdp_192_fast_new once per object. */
+static OQS_STATUS cross_rsdp_192_fast_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_AVX2_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_clean_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_clean_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_clean_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_clean_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS cross_rsdp_192_fast_clean_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_CROSSRSDP192FAST_CLEAN_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static void cross_rsdp_192_fast_bind_impl(OQS_SIG *sig) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+		sig->keypair = cross_rsdp_192_fast_avx2_keypair;
+		sig->keypair_from_fseed = cross_rsdp_192_fast_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = cross_rsdp_192_fast_avx2_pubkey_from_privkey;
+		sig->sign = cross_rsdp_192_fast_avx2_sign;
+		sig->verify = cross_rsdp_192_fast_avx2_verify;
+		return;
+	}
+	sig->keypair = cross_rsdp_192_fast_clean_keypair;
+	sig->keypair_from_fseed = cross_rsdp_192_fast_clean_keypair_from_fseed;
+	sig->pubkey_from_privkey = cross_rsdp_192_fast_clean_pubkey_from_privkey;
+	sig->sign = cross_rsdp_192_fast_clean_sign;
+	sig->verify = cross_rsdp_192_fast_clean_verify;
+}
+#endif
+
 #endif
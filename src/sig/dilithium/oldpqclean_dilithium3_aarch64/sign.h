@@ -10,6 +10,7 @@
 #include "params.h"
 #include "poly.h"
 #include "polyvec.h"
+#include "fips202.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -42,6 +43,24 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *m, size_t mlen,
                        const uint8_t *pk);
 
+#define crypto_sign_signature_init DILITHIUM_NAMESPACE(crypto_sign_signature_init)
+int crypto_sign_signature_init(shake256incctx *state,
+                               const uint8_t *sk);
+
+#define crypto_sign_signature_final DILITHIUM_NAMESPACE(crypto_sign_signature_final)
+int crypto_sign_signature_final(uint8_t *sig, size_t *siglen,
+                                shake256incctx *state,
+                                const uint8_t *sk);
+
+#define crypto_sign_verify_init DILITHIUM_NAMESPACE(crypto_sign_verify_init)
+int crypto_sign_verify_init(shake256incctx *state,
+                            const uint8_t *pk);
+
+#define crypto_sign_verify_final DILITHIUM_NAMESPACE(crypto_sign_verify_final)
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+                             shake256incctx *state,
+                             const uint8_t *pk);
+
 #define crypto_sign_open DILITHIUM_NAMESPACE(crypto_sign_open)
 int crypto_sign_open(uint8_t *m, size_t *mlen,
                      const uint8_t *sm, size_t smlen,
@@ -375,19 +375,38 @@ int crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature
+* Name:        crypto_sign_signature_init
 *
-* Description: Computes signature.
+* Description: Starts incremental signing. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature computed with crypto_sign_signature_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_init(shake256incctx *state, const uint8_t *sk) {
+  /* Absorb tr for CRH(tr, msg) */
+  shake256_inc_init(state);
+  shake256_inc_absorb(state, sk + 2*SEEDBYTES, SEEDBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_final
+*
+* Description: Computes signature of the message absorbed into
+*              state and releases state.
 *
 * Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m: pointer to message to be signed
-*              - size_t mlen: length of message
+*              - shake256incctx *state: pointer to hash state
 *              - uint8_t *sk: pointer to bit-packed secret key
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
+int crypto_sign_signature_final(uint8_t *sig, size_t *siglen, shake256incctx *state, const uint8_t *sk) {
   unsigned int i, n, pos;
   uint8_t seedbuf[3*SEEDBYTES + 2*CRHBYTES];
   uint8_t *rho, *tr, *key, *mu, *rhoprime;
@@ -401,7 +420,6 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t
     polyvecl y;
     polyveck w0;
   } tmpv;
-  shake256incctx state;
 
   rho = seedbuf;
   tr = rho + SEEDBYTES;
@@ -411,11 +429,8 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t
   unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
 
   /* Compute CRH(tr, msg) */
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, SEEDBYTES);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
 
 #ifdef DILITHIUM_RANDOMIZED_SIGNING
   randombytes(rhoprime, CRHBYTES);
@@ -472,11 +487,11 @@ rej:
   polyveck_decompose(&w1, &tmpv.w0, &w1);
   polyveck_pack_w1(sig, &w1);
 
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
-  shake256_inc_absorb(&state, sig, K*POLYW1_PACKEDBYTES);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(sig, SEEDBYTES, &state);
+  shake256_inc_ctx_reset(state);
+  shake256_inc_absorb(state, mu, CRHBYTES);
+  shake256_inc_absorb(state, sig, K*POLYW1_PACKEDBYTES);
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(sig, SEEDBYTES, state);
   poly_challenge(&c, sig);
   poly_ntt(&c);
 
@@ -525,7 +540,7 @@ rej:
   aes256_ctx_release(&aesctx);
 #endif
 
-  shake256_inc_ctx_release(&state);
+  shake256_inc_ctx_release(state);
   /* Pack z into signature */
   for(i = 0; i < L; i++)
     polyz_pack(sig + SEEDBYTES + i*POLYZ_PACKEDBYTES, &z.vec[i]);
@@ -534,6 +549,27 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_signature
+*
+* Description: Computes signature.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk) {
+  shake256incctx state;
+
+  crypto_sign_signature_init(&state, sk);
+  shake256_inc_absorb(&state, m, mlen);
+  return crypto_sign_signature_final(sig, siglen, &state, sk);
+}
+
 /*************************************************
 * Name:        crypto_sign
 *
@@ -561,19 +597,41 @@ int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen, const
 }
 
 /*************************************************
-* Name:        crypto_sign_verify
+* Name:        crypto_sign_verify_init
 *
-* Description: Verifies signature.
+* Description: Starts incremental verification. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature checked with crypto_sign_verify_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_verify_init(shake256incctx *state, const uint8_t *pk) {
+  uint8_t tr[SEEDBYTES];
+
+  /* Absorb H(rho, t1) for CRH(H(rho, t1), msg) */
+  shake256(tr, SEEDBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  shake256_inc_init(state);
+  shake256_inc_absorb(state, tr, SEEDBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_final
+*
+* Description: Verifies signature of the message absorbed into
+*              state and releases state.
 *
 * Arguments:   - uint8_t *m: pointer to input signature
 *              - size_t siglen: length of signature
-*              - const uint8_t *m: pointer to message
-*              - size_t mlen: length of message
+*              - shake256incctx *state: pointer to hash state
 *              - const uint8_t *pk: pointer to bit-packed public key
 *
 * Returns 0 if signature could be verified correctly and -1 otherwise
 **************************************************/
-int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk) {
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen, shake256incctx *state, const uint8_t *pk) {
   unsigned int i, j, pos = 0;
   /* polyw1_pack writes additional 14 bytes */
   ALIGNED_UINT8(K*POLYW1_PACKEDBYTES+14) buf;
@@ -589,20 +647,15 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size
   polyvecl *row = rowbuf;
   polyvecl z;
   poly c, w1, h;
-  shake256incctx state;
+
+  /* Compute CRH(H(rho, t1), msg) */
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
+  shake256_inc_ctx_release(state);
 
   if(siglen != CRYPTO_BYTES)
     return -1;
 
-  /* Compute CRH(H(rho, t1), msg) */
-  shake256(mu, SEEDBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, mu, SEEDBYTES);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-  shake256_inc_ctx_release(&state);
-
   /* Expand challenge */
   poly_challenge(&c, sig);
   poly_ntt(&c);
@@ -677,12 +730,12 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size
     if(hint[j]) return -1;
 
   /* Call random oracle and verify challenge */
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
-  shake256_inc_absorb(&state, buf.coeffs, K*POLYW1_PACKEDBYTES);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(buf.coeffs, SEEDBYTES, &state);
-  shake256_inc_ctx_release(&state);
+  shake256_inc_init(state);
+  shake256_inc_absorb(state, mu, CRHBYTES);
+  shake256_inc_absorb(state, buf.coeffs, K*POLYW1_PACKEDBYTES);
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(buf.coeffs, SEEDBYTES, state);
+  shake256_inc_ctx_release(state);
   for(i = 0; i < SEEDBYTES; ++i)
     if(buf.coeffs[i] != sig[i])
       return -1;
@@ -690,6 +743,27 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_verify
+*
+* Description: Verifies signature.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk) {
+  shake256incctx state;
+
+  crypto_sign_verify_init(&state, pk);
+  shake256_inc_absorb(&state, m, mlen);
+  return crypto_sign_verify_final(sig, siglen, &state, pk);
+}
+
 /*************************************************
 * Name:        crypto_sign_open
 *
@@ -18,6 +18,10 @@ OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign(uint8_t *signature, size_t *signatur
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_2_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_dilithium_3)
@@ -33,6 +37,10 @@ OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign(uint8_t *signature, size_t *signatur
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_3_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_dilithium_5)
@@ -48,6 +56,10 @@ OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign(uint8_t *signature, size_t *signatur
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #endif
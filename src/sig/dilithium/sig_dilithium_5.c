@@ -3,8 +3,13 @@
 #include <stdlib.h>
 
 #include <oqs/sig_dilithium.h>
+#include <oqs/sha3.h>
 
 #if defined(OQS_ENABLE_SIG_dilithium_5)
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_dilithium_5_avx2) || defined(OQS_ENABLE_SIG_dilithium_5_aarch64))
+static void dilithium_5_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_dilithium_5_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +34,30 @@ OQS_SIG *OQS_SIG_dilithium_5_new(void) {
 	sig->verify = OQS_SIG_dilithium_5_verify;
 	sig->sign_with_ctx_str = OQS_SIG_dilithium_5_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_dilithium_5_verify_with_ctx_str;
+	sig->length_prepared_secret_key = 0;
+	sig->prepare_secret_key = NULL;
+	sig->sign_prepared = NULL;
+	sig->sign_prepared_threaded = NULL;
+	sig->length_prepared_public_key = 0;
+	sig->prepare_public_key = NULL;
+	sig->verify_prepared = NULL;
+	sig->length_stream_state = sizeof(OQS_SHA3_shake256_stack_ctx);
+	sig->sign_init = OQS_SIG_dilithium_5_sign_init;
+	sig->sign_final = OQS_SIG_dilithium_5_sign_final;
+	sig->verify_init = OQS_SIG_dilithium_5_verify_init;
+	sig->verify_final = OQS_SIG_dilithium_5_verify_final;
+	sig->stream_update = NULL;
+	sig->stream_release = NULL;
+	sig->length_mu = 0;
+	sig->compute_mu = NULL;
+	sig->sign_mu = NULL;
+	sig->verify_mu = NULL;
+	sig->sign_prehash = NULL;
+	sig->verify_prehash = NULL;
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_dilithium_5_avx2) || defined(OQS_ENABLE_SIG_dilithium_5_aarch64))
+	dilithium_5_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -38,6 +67,10 @@ extern int pqcrystals_dilithium5_ref_keypair_from_fseed(uint8_t *pk, uint8_t *sk
 extern int pqcrystals_dilithium5_ref_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqcrystals_dilithium5_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqcrystals_dilithium5_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqcrystals_dilithium5_ref_signature_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_dilithium5_ref_signature_final(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_dilithium5_ref_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
+extern int pqcrystals_dilithium5_ref_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
 extern int pqcrystals_dilithium5_avx2_keypair(uint8_t *pk, uint8_t *sk);
@@ -45,6 +78,10 @@ extern int pqcrystals_dilithium5_avx2_keypair_from_fseed(uint8_t *pk, uint8_t *s
 extern int pqcrystals_dilithium5_avx2_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqcrystals_dilithium5_avx2_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqcrystals_dilithium5_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqcrystals_dilithium5_avx2_signature_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_dilithium5_avx2_signature_final(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_dilithium5_avx2_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
+extern int pqcrystals_dilithium5_avx2_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 #endif
 
 #if defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
@@ -53,6 +90,10 @@ extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_keypair_from_fseed(uint8_t *pk
 extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_final(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
+extern int PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_dilithium_5_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -200,4 +241,293 @@ OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_with_ctx_str(const uint8_t *messag
 		return OQS_ERROR;
 	}
 }
+
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_dilithium5_avx2_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_dilithium5_avx2_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_dilithium5_avx2_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_dilithium_5_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_dilithium5_avx2_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_dilithium_5_avx2) || defined(OQS_ENABLE_SIG_dilithium_5_aarch64))
+/* Implementation-specific entry points, bound by OQS_SIG_dilithium_5_new once per object. */
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+static OQS_STATUS dilithium_5_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS dilithium_5_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static OQS_STATUS dilithium_5_avx2_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_avx2_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+static OQS_STATUS dilithium_5_aarch64_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS dilithium_5_aarch64_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static OQS_STATUS dilithium_5_aarch64_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_DILITHIUM5_AARCH64_crypto_sign_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+#endif
+
+static OQS_STATUS dilithium_5_ref_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_ref_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS dilithium_5_ref_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS dilithium_5_ref_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS dilithium_5_ref_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS dilithium_5_ref_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_ref_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS dilithium_5_ref_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static OQS_STATUS dilithium_5_ref_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_dilithium5_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static void dilithium_5_bind_impl(OQS_SIG *sig) {
+#if defined(OQS_ENABLE_SIG_dilithium_5_avx2)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+		sig->keypair = dilithium_5_avx2_keypair;
+		sig->keypair_from_fseed = dilithium_5_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = dilithium_5_avx2_pubkey_from_privkey;
+		sig->sign = dilithium_5_avx2_sign;
+		sig->verify = dilithium_5_avx2_verify;
+		sig->sign_init = dilithium_5_avx2_sign_init;
+		sig->sign_final = dilithium_5_avx2_sign_final;
+		sig->verify_init = dilithium_5_avx2_verify_init;
+		sig->verify_final = dilithium_5_avx2_verify_final;
+		return;
+	}
+#elif defined(OQS_ENABLE_SIG_dilithium_5_aarch64)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+		sig->keypair = dilithium_5_aarch64_keypair;
+		sig->keypair_from_fseed = dilithium_5_aarch64_keypair_from_fseed;
+		sig->pubkey_from_privkey = dilithium_5_aarch64_pubkey_from_privkey;
+		sig->sign = dilithium_5_aarch64_sign;
+		sig->verify = dilithium_5_aarch64_verify;
+		sig->sign_init = dilithium_5_aarch64_sign_init;
+		sig->sign_final = dilithium_5_aarch64_sign_final;
+		sig->verify_init = dilithium_5_aarch64_verify_init;
+		sig->verify_final = dilithium_5_aarch64_verify_final;
+		return;
+	}
+#endif
+	sig->keypair = dilithium_5_ref_keypair;
+	sig->keypair_from_fseed = dilithium_5_ref_keypair_from_fseed;
+	sig->pubkey_from_privkey = dilithium_5_ref_pubkey_from_privkey;
+	sig->sign = dilithium_5_ref_sign;
+	sig->verify = dilithium_5_ref_verify;
+	sig->sign_init = dilithium_5_ref_sign_init;
+	sig->sign_final = dilithium_5_ref_sign_final;
+	sig->verify_init = dilithium_5_ref_verify_init;
+	sig->verify_final = dilithium_5_ref_verify_final;
+}
+#endif
+
 #endif
@@ -491,6 +491,158 @@ mq_div_12289(uint32_t x, uint32_t y) {
     return mq_montymul(y18, x);
 }
 
+/*
+ * AVX2 counterparts of the functions above, on 16 values at once (one
+ * per 16-bit lane). Operands are in the 0..q-1 range and so are the
+ * results, which are therefore the same as with the scalar functions.
+ */
+
+/*
+ * Montgomery multiplication modulo q (computes x * y / R mod q). The
+ * low 16 bits of x*y are cancelled with k*q, where k = x*y/q mod 2^16
+ * (1/q = -Q0I mod 2^16); the difference of the high halves is then
+ * between -q and q-1, and a conditional addition normalizes it.
+ */
+static inline __m256i
+mq_montymul_x16(__m256i x, __m256i y) {
+    __m256i z, k;
+
+    k = _mm256_mullo_epi16(_mm256_mullo_epi16(x, y),
+                           _mm256_set1_epi16(-(int16_t)Q0I));
+    z = _mm256_sub_epi16(_mm256_mulhi_epi16(x, y),
+                         _mm256_mulhi_epi16(k, _mm256_set1_epi16(Q)));
+    return _mm256_add_epi16(z,
+                            _mm256_and_si256(_mm256_srai_epi16(z, 15), _mm256_set1_epi16(Q)));
+}
+
+/*
+ * Addition modulo q. If x + y < q, then x + y - q wraps around to a
+ * larger unsigned value, so the unsigned minimum picks the right one.
+ */
+static inline __m256i
+mq_add_x16(__m256i x, __m256i y) {
+    __m256i d;
+
+    d = _mm256_add_epi16(x, y);
+    return _mm256_min_epu16(d, _mm256_sub_epi16(d, _mm256_set1_epi16(Q)));
+}
+
+/*
+ * Subtraction modulo q, with the same trick as mq_add_x16().
+ */
+static inline __m256i
+mq_sub_x16(__m256i x, __m256i y) {
+    __m256i d;
+
+    d = _mm256_sub_epi16(x, y);
+    return _mm256_min_epu16(d, _mm256_add_epi16(d, _mm256_set1_epi16(Q)));
+}
+
+/*
+ * NTT butterfly: (u, v) -> (u + s*v, u - s*v).
+ */
+static inline void
+mq_NTT_bfly_x16(__m256i *u, __m256i *v, __m256i s) {
+    __m256i t;
+
+    t = mq_montymul_x16(*v, s);
+    *v = mq_sub_x16(*u, t);
+    *u = mq_add_x16(*u, t);
+}
+
+/*
+ * Inverse NTT butterfly: (u, v) -> (u + v, s*(u - v)).
+ */
+static inline void
+mq_iNTT_bfly_x16(__m256i *u, __m256i *v, __m256i s) {
+    __m256i t;
+
+    t = mq_sub_x16(*u, *v);
+    *u = mq_add_x16(*u, *v);
+    *v = mq_montymul_x16(t, s);
+}
+
+/*
+ * Butterflies between values at distance ht < 16 are computed on 32
+ * consecutive values (x, y) at a time, which hold 32/(2*ht) groups of
+ * ht butterflies each. mq_split_x16() moves the first operands of the
+ * 16 butterflies into u and the second operands into v, and
+ * mq_merge_x16() undoes it. Numbering the butterflies 0 to 15 in
+ * memory order, the lanes hold them in the order 0..3 8..11 4..7 12..15,
+ * except for ht = 8 where the order is natural; mq_twiddles_x16()
+ * follows the same layout.
+ */
+static inline void
+mq_split_x16(__m256i *u, __m256i *v, __m256i x, __m256i y, unsigned ht) {
+    if (ht == 8) {
+        *u = _mm256_permute2x128_si256(x, y, 0x20);
+        *v = _mm256_permute2x128_si256(x, y, 0x31);
+        return;
+    }
+    if (ht == 2) {
+        x = _mm256_shuffle_epi32(x, 0xD8);
+        y = _mm256_shuffle_epi32(y, 0xD8);
+    } else if (ht == 1) {
+        const __m256i even_odd = _mm256_setr_epi8(
+                                     0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                     0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+
+        x = _mm256_shuffle_epi8(x, even_odd);
+        y = _mm256_shuffle_epi8(y, even_odd);
+    }
+    *u = _mm256_unpacklo_epi64(x, y);
+    *v = _mm256_unpackhi_epi64(x, y);
+}
+
+static inline void
+mq_merge_x16(__m256i *x, __m256i *y, __m256i u, __m256i v, unsigned ht) {
+    if (ht == 8) {
+        *x = _mm256_permute2x128_si256(u, v, 0x20);
+        *y = _mm256_permute2x128_si256(u, v, 0x31);
+        return;
+    }
+    *x = _mm256_unpacklo_epi64(u, v);
+    *y = _mm256_unpackhi_epi64(u, v);
+    if (ht == 2) {
+        *x = _mm256_shuffle_epi32(*x, 0xD8);
+        *y = _mm256_shuffle_epi32(*y, 0xD8);
+    } else if (ht == 1) {
+        const __m256i interleave = _mm256_setr_epi8(
+                                       0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+                                       0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+
+        *x = _mm256_shuffle_epi8(*x, interleave);
+        *y = _mm256_shuffle_epi8(*y, interleave);
+    }
+}
+
+/*
+ * Load the twiddle factors s[0..32/(2*ht)-1] of the groups of
+ * butterflies processed by mq_split_x16(), one per lane.
+ */
+static inline __m256i
+mq_twiddles_x16(const uint16_t *s, unsigned ht) {
+    __m128i t;
+
+    switch (ht) {
+    case 1:
+        return _mm256_permute4x64_epi64(
+                   _mm256_loadu_si256((const __m256i *)s), 0xD8);
+    case 2:
+        t = _mm_loadu_si128((const __m128i *)s);
+        return _mm256_permute4x64_epi64(_mm256_set_m128i(
+                                            _mm_unpackhi_epi16(t, t), _mm_unpacklo_epi16(t, t)), 0xD8);
+    case 4:
+        t = _mm_loadl_epi64((const __m128i *)s);
+        t = _mm_unpacklo_epi16(t, t);
+        return _mm256_permute4x64_epi64(_mm256_set_m128i(
+                                            _mm_unpackhi_epi32(t, t), _mm_unpacklo_epi32(t, t)), 0xD8);
+    default:
+        return _mm256_set_m128i(_mm_set1_epi16((int16_t)s[1]),
+                                _mm_set1_epi16((int16_t)s[0]));
+    }
+}
+
 /*
  * Compute NTT on a ring element.
  */
@@ -504,19 +656,50 @@ mq_NTT(uint16_t *a, unsigned logn) {
         size_t ht, i, j1;
 
         ht = t >> 1;
-        for (i = 0, j1 = 0; i < m; i ++, j1 += t) {
-            size_t j, j2;
-            uint32_t s;
-
-            s = GMb[m + i];
-            j2 = j1 + ht;
-            for (j = j1; j < j2; j ++) {
-                uint32_t u, v;
-
-                u = a[j];
-                v = mq_montymul(a[j + ht], s);
-                a[j] = (uint16_t)mq_add(u, v);
-                a[j + ht] = (uint16_t)mq_sub(u, v);
+        if (ht >= 16) {
+            for (i = 0, j1 = 0; i < m; i ++, j1 += t) {
+                size_t j, j2;
+                __m256i s;
+
+                s = _mm256_set1_epi16((int16_t)GMb[m + i]);
+                j2 = j1 + ht;
+                for (j = j1; j < j2; j += 16) {
+                    __m256i u, v;
+
+                    u = _mm256_loadu_si256((const __m256i *)(a + j));
+                    v = _mm256_loadu_si256((const __m256i *)(a + j + ht));
+                    mq_NTT_bfly_x16(&u, &v, s);
+                    _mm256_storeu_si256((__m256i *)(a + j), u);
+                    _mm256_storeu_si256((__m256i *)(a + j + ht), v);
+                }
+            }
+        } else if (n >= 32) {
+            for (i = 0, j1 = 0; i < m; i += 32 / t, j1 += 32) {
+                __m256i x, y, u, v;
+
+                x = _mm256_loadu_si256((const __m256i *)(a + j1));
+                y = _mm256_loadu_si256((const __m256i *)(a + j1 + 16));
+                mq_split_x16(&u, &v, x, y, (unsigned)ht);
+                mq_NTT_bfly_x16(&u, &v, mq_twiddles_x16(&GMb[m + i], (unsigned)ht));
+                mq_merge_x16(&x, &y, u, v, (unsigned)ht);
+                _mm256_storeu_si256((__m256i *)(a + j1), x);
+                _mm256_storeu_si256((__m256i *)(a + j1 + 16), y);
+            }
+        } else {
+            for (i = 0, j1 = 0; i < m; i ++, j1 += t) {
+                size_t j, j2;
+                uint32_t s;
+
+                s = GMb[m + i];
+                j2 = j1 + ht;
+                for (j = j1; j < j2; j ++) {
+                    uint32_t u, v;
+
+                    u = a[j];
+                    v = mq_montymul(a[j + ht], s);
+                    a[j] = (uint16_t)mq_add(u, v);
+                    a[j + ht] = (uint16_t)mq_sub(u, v);
+                }
             }
         }
         t = ht;
@@ -528,7 +711,7 @@ mq_NTT(uint16_t *a, unsigned logn) {
  */
 static void
 mq_iNTT(uint16_t *a, unsigned logn) {
-    size_t n, t, m;
+    size_t n, t, m, u;
     uint32_t ni;
 
     n = (size_t)1 << logn;
@@ -539,21 +722,52 @@ mq_iNTT(uint16_t *a, unsigned logn) {
 
         hm = m >> 1;
         dt = t << 1;
-        for (i = 0, j1 = 0; i < hm; i ++, j1 += dt) {
-            size_t j, j2;
-            uint32_t s;
-
-            j2 = j1 + t;
-            s = iGMb[hm + i];
-            for (j = j1; j < j2; j ++) {
-                uint32_t u, v, w;
-
-                u = a[j];
-                v = a[j + t];
-                a[j] = (uint16_t)mq_add(u, v);
-                w = mq_sub(u, v);
-                a[j + t] = (uint16_t)
-                           mq_montymul(w, s);
+        if (t >= 16) {
+            for (i = 0, j1 = 0; i < hm; i ++, j1 += dt) {
+                size_t j, j2;
+                __m256i s;
+
+                s = _mm256_set1_epi16((int16_t)iGMb[hm + i]);
+                j2 = j1 + t;
+                for (j = j1; j < j2; j += 16) {
+                    __m256i x, y;
+
+                    x = _mm256_loadu_si256((const __m256i *)(a + j));
+                    y = _mm256_loadu_si256((const __m256i *)(a + j + t));
+                    mq_iNTT_bfly_x16(&x, &y, s);
+                    _mm256_storeu_si256((__m256i *)(a + j), x);
+                    _mm256_storeu_si256((__m256i *)(a + j + t), y);
+                }
+            }
+        } else if (n >= 32) {
+            for (i = 0, j1 = 0; i < hm; i += 32 / dt, j1 += 32) {
+                __m256i x, y, v, w;
+
+                x = _mm256_loadu_si256((const __m256i *)(a + j1));
+                y = _mm256_loadu_si256((const __m256i *)(a + j1 + 16));
+                mq_split_x16(&v, &w, x, y, (unsigned)t);
+                mq_iNTT_bfly_x16(&v, &w, mq_twiddles_x16(&iGMb[hm + i], (unsigned)t));
+                mq_merge_x16(&x, &y, v, w, (unsigned)t);
+                _mm256_storeu_si256((__m256i *)(a + j1), x);
+                _mm256_storeu_si256((__m256i *)(a + j1 + 16), y);
+            }
+        } else {
+            for (i = 0, j1 = 0; i < hm; i ++, j1 += dt) {
+                size_t j, j2;
+                uint32_t s;
+
+                j2 = j1 + t;
+                s = iGMb[hm + i];
+                for (j = j1; j < j2; j ++) {
+                    uint32_t x, y, w;
+
+                    x = a[j];
+                    y = a[j + t];
+                    a[j] = (uint16_t)mq_add(x, y);
+                    w = mq_sub(x, y);
+                    a[j + t] = (uint16_t)
+                               mq_montymul(w, s);
+                }
             }
         }
         t = dt;
@@ -573,8 +787,15 @@ mq_iNTT(uint16_t *a, unsigned logn) {
     for (m = n; m > 1; m >>= 1) {
         ni = mq_rshift1(ni);
     }
-    for (m = 0; m < n; m ++) {
-        a[m] = (uint16_t)mq_montymul(a[m], ni);
+    for (u = 0; u + 16 <= n; u += 16) {
+        __m256i x;
+
+        x = _mm256_loadu_si256((const __m256i *)(a + u));
+        x = mq_montymul_x16(x, _mm256_set1_epi16((int16_t)ni));
+        _mm256_storeu_si256((__m256i *)(a + u), x);
+    }
+    for (; u < n; u ++) {
+        a[u] = (uint16_t)mq_montymul(a[u], ni);
     }
 }
 
@@ -586,7 +807,14 @@ mq_poly_tomonty(uint16_t *f, unsigned logn) {
     size_t u, n;
 
     n = (size_t)1 << logn;
-    for (u = 0; u < n; u ++) {
+    for (u = 0; u + 16 <= n; u += 16) {
+        __m256i x;
+
+        x = _mm256_loadu_si256((const __m256i *)(f + u));
+        x = mq_montymul_x16(x, _mm256_set1_epi16(R2));
+        _mm256_storeu_si256((__m256i *)(f + u), x);
+    }
+    for (; u < n; u ++) {
         f[u] = (uint16_t)mq_montymul(f[u], R2);
     }
 }
@@ -600,7 +828,14 @@ mq_poly_montymul_ntt(uint16_t *f, const uint16_t *g, unsigned logn) {
     size_t u, n;
 
     n = (size_t)1 << logn;
-    for (u = 0; u < n; u ++) {
+    for (u = 0; u + 16 <= n; u += 16) {
+        __m256i x, y;
+
+        x = _mm256_loadu_si256((const __m256i *)(f + u));
+        y = _mm256_loadu_si256((const __m256i *)(g + u));
+        _mm256_storeu_si256((__m256i *)(f + u), mq_montymul_x16(x, y));
+    }
+    for (; u < n; u ++) {
         f[u] = (uint16_t)mq_montymul(f[u], g[u]);
     }
 }
@@ -613,7 +848,14 @@ mq_poly_sub(uint16_t *f, const uint16_t *g, unsigned logn) {
     size_t u, n;
 
     n = (size_t)1 << logn;
-    for (u = 0; u < n; u ++) {
+    for (u = 0; u + 16 <= n; u += 16) {
+        __m256i x, y;
+
+        x = _mm256_loadu_si256((const __m256i *)(f + u));
+        y = _mm256_loadu_si256((const __m256i *)(g + u));
+        _mm256_storeu_si256((__m256i *)(f + u), mq_sub_x16(x, y));
+    }
+    for (; u < n; u ++) {
         f[u] = (uint16_t)mq_sub(f[u], g[u]);
     }
 }
@@ -249,19 +249,15 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_pubkey_from_privkey(
 }
 
 /*
- * Compute the signature. nonce[] receives the nonce and must have length
- * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
- * or header byte), with *sigbuflen providing the maximum value length and
- * receiving the actual value length.
- *
- * If a signature could be computed but not encoded because it would
- * exceed the output buffer size, then an error is returned.
+ * Compute the signature for the nonce and message that have been
+ * injected into hsc (which must not be flipped yet); hsc is released.
+ * sigbuf[] and sigbuflen are as for do_sign().
  *
  * Return value: 0 on success, -1 on error.
  */
 static int
-do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
-        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+do_sign_hashed(uint8_t *sigbuf, size_t *sigbuflen,
+               inner_shake256_context *hsc, const uint8_t *sk) {
     union {
         uint8_t b[72 * 1024];
         uint64_t dummy_u64;
@@ -276,6 +272,13 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     inner_shake256_context sc;
     size_t u, v;
 
+    /*
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(hsc, r.hm, 10, tmp.b);
+    inner_shake256_ctx_release(hsc);
+
     /*
      * Decode the private key.
      */
@@ -311,21 +314,6 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
         return -1;
     }
 
-    /*
-     * Create a random nonce (40 bytes).
-     */
-    randombytes(nonce, NONCELEN);
-
-    /*
-     * Hash message nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(&sc, r.hm, 10, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Initialize a RNG.
      */
@@ -348,27 +336,95 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
 }
 
 /*
- * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
- * (of size sigbuflen) contains the signature value, not including the
- * header byte or nonce. Return value is 0 on success, -1 on error.
+ * Compute the signature. nonce[] receives the nonce and must have length
+ * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
+ * or header byte), with *sigbuflen providing the maximum value length and
+ * receiving the actual value length.
+ *
+ * If a signature could be computed but not encoded because it would
+ * exceed the output buffer size, then an error is returned.
+ *
+ * Return value: 0 on success, -1 on error.
  */
 static int
-do_verify(
-    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
-    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    inner_shake256_context sc;
+
+    /*
+     * Create a random nonce (40 bytes).
+     */
+    randombytes(nonce, NONCELEN);
+
+    /*
+     * Hash message nonce + message into a vector.
+     */
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_sign_hashed(sigbuf, sigbuflen, &sc, sk);
+}
+
+/*
+ * Compute the signature for the nonce and message that have been
+ * injected into hsc (which must not be flipped yet), with an expanded
+ * private key as output by crypto_sign_expand_privkey(); hsc is
+ * released. sigbuf[] and sigbuflen are as for do_sign_hashed().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_sign_hashed_expanded(uint8_t *sigbuf, size_t *sigbuflen,
+                        inner_shake256_context *hsc, const fpr *esk) {
     union {
-        uint8_t b[2 * 1024];
+        uint8_t b[48 * 1024];
         uint64_t dummy_u64;
         fpr dummy_fpr;
     } tmp;
-    uint16_t h[1024], hm[1024];
-    int16_t sig[1024];
+    struct {
+        int16_t sig[1024];
+        uint16_t hm[1024];
+    } r;
+    unsigned char seed[48];
     inner_shake256_context sc;
     size_t v;
 
     /*
-     * Decode public key.
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(hsc, r.hm, 10, tmp.b);
+    inner_shake256_ctx_release(hsc);
+
+    /*
+     * Initialize a RNG.
+     */
+    randombytes(seed, sizeof seed);
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, seed, sizeof seed);
+    inner_shake256_flip(&sc);
+
+    /*
+     * Compute and return the signature.
      */
+    PQCLEAN_FALCON1024_CLEAN_sign_tree(r.sig, &sc, esk, r.hm, 10, tmp.b);
+    v = PQCLEAN_FALCON1024_CLEAN_comp_encode(sigbuf, *sigbuflen, r.sig, 10);
+    inner_shake256_ctx_release(&sc);
+    if (v == 0) {
+        return -1;
+    }
+    *sigbuflen = v;
+    return 0;
+}
+
+/*
+ * Decode a public key into h[], in the NTT representation expected by
+ * verify_raw().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+decode_pubkey(uint16_t *h, const uint8_t *pk) {
     if (pk[0] != 0x00 + 10) {
         return -1;
     }
@@ -378,6 +434,34 @@ do_verify(
         return -1;
     }
     PQCLEAN_FALCON1024_CLEAN_to_ntt_monty(h, 10);
+    return 0;
+}
+
+/*
+ * Same as do_verify_hashed(), with a public key already decoded by
+ * decode_pubkey(). hsc is released.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_verify_hashed_ntt(
+    const uint8_t *sigbuf, size_t sigbuflen,
+    inner_shake256_context *hsc, const uint16_t *h) {
+    union {
+        uint8_t b[2 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    uint16_t hm[1024];
+    int16_t sig[1024];
+    size_t v;
+
+    /*
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(hsc, hm, 10, tmp.b);
+    inner_shake256_ctx_release(hsc);
 
     /*
      * Decode signature.
@@ -402,16 +486,6 @@ do_verify(
         }
     }
 
-    /*
-     * Hash nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON1024_CLEAN_hash_to_point_ct(&sc, hm, 10, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Verify signature.
      */
@@ -421,6 +495,43 @@ do_verify(
     return 0;
 }
 
+/*
+ * Verify a signature for the nonce and message that have been injected
+ * into hsc (which must not be flipped yet); hsc is released. sigbuf[]
+ * and sigbuflen are as for do_verify().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_verify_hashed(
+    const uint8_t *sigbuf, size_t sigbuflen,
+    inner_shake256_context *hsc, const uint8_t *pk) {
+    uint16_t h[1024];
+
+    if (decode_pubkey(h, pk) < 0) {
+        inner_shake256_ctx_release(hsc);
+        return -1;
+    }
+    return do_verify_hashed_ntt(sigbuf, sigbuflen, hsc, h);
+}
+
+/*
+ * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
+ * (of size sigbuflen) contains the signature value, not including the
+ * header byte or nonce. Return value is 0 on success, -1 on error.
+ */
+static int
+do_verify(
+    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    inner_shake256_context sc;
+
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed(sigbuf, sigbuflen, &sc, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(
@@ -437,6 +548,74 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(
     return 0;
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(
+    uint8_t *esk, const uint8_t *sk) {
+    union {
+        uint8_t b[48 * 1024];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[1024], g[1024], F[1024], G[1024];
+    size_t u, v;
+
+    if (sk[0] != 0x50 + 10) {
+        return -1;
+    }
+    u = 1;
+    v = PQCLEAN_FALCON1024_CLEAN_trim_i8_decode(
+            f, 10, PQCLEAN_FALCON1024_CLEAN_max_fg_bits[10],
+            sk + u, PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    v = PQCLEAN_FALCON1024_CLEAN_trim_i8_decode(
+            g, 10, PQCLEAN_FALCON1024_CLEAN_max_fg_bits[10],
+            sk + u, PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    v = PQCLEAN_FALCON1024_CLEAN_trim_i8_decode(
+            F, 10, PQCLEAN_FALCON1024_CLEAN_max_FG_bits[10],
+            sk + u, PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    if (u != PQCLEAN_FALCON1024_CLEAN_CRYPTO_SECRETKEYBYTES) {
+        return -1;
+    }
+    if (!PQCLEAN_FALCON1024_CLEAN_complete_private(G, f, g, F, 10, tmp.b)) {
+        return -1;
+    }
+    PQCLEAN_FALCON1024_CLEAN_expand_privkey((fpr *)esk, f, g, F, G, 10, tmp.b);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    inner_shake256_context sc;
+    size_t vlen;
+
+    vlen = PQCLEAN_FALCON1024_CLEAN_CRYPTO_BYTES - NONCELEN - 1;
+    randombytes(sig + 1, NONCELEN);
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, sig + 1, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    if (do_sign_hashed_expanded(sig + 1 + NONCELEN, &vlen, &sc, (const fpr *)esk) < 0) {
+        return -1;
+    }
+    sig[0] = 0x30 + 10;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify(
@@ -452,6 +631,33 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify(
                      sig + 1 + NONCELEN, siglen - 1 - NONCELEN, m, mlen, pk);
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(
+    uint8_t *epk, const uint8_t *pk) {
+    return decode_pubkey((uint16_t *)epk, pk);
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk) {
+    inner_shake256_context sc;
+
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + 10) {
+        return -1;
+    }
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, sig + 1, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed_ntt(sig + 1 + NONCELEN, siglen - 1 - NONCELEN,
+                                &sc, (const uint16_t *)epk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON1024_CLEAN_crypto_sign(
@@ -521,3 +727,53 @@ PQCLEAN_FALCON1024_CLEAN_crypto_sign_open(
     *mlen = pmlen;
     return 0;
 }
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(
+    shake256incctx *state, uint8_t *nonce) {
+    randombytes(nonce, NONCELEN);
+    inner_shake256_init(state);
+    inner_shake256_inject(state, nonce, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *nonce, shake256incctx *state, const uint8_t *sk) {
+    size_t vlen;
+
+    vlen = PQCLEAN_FALCON1024_CLEAN_CRYPTO_BYTES - NONCELEN - 1;
+    if (do_sign_hashed(sig + 1 + NONCELEN, &vlen, state, sk) < 0) {
+        return -1;
+    }
+    memmove(sig + 1, nonce, NONCELEN);
+    sig[0] = 0x30 + 10;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(
+    shake256incctx *state, const uint8_t *sig, size_t siglen) {
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + 10) {
+        return -1;
+    }
+    inner_shake256_init(state);
+    inner_shake256_inject(state, sig + 1, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(
+    const uint8_t *sig, size_t siglen,
+    shake256incctx *state, const uint8_t *pk) {
+    return do_verify_hashed(sig + 1 + NONCELEN, siglen - 1 - NONCELEN, state, pk);
+}
@@ -250,7 +250,7 @@ void PQCLEAN_FALCON512_AARCH64_to_ntt_monty(int16_t *h);
  * Internal signature verification code:
  *   c0[]      contains the hashed nonce+message
  *   s2[]      is the decoded signature
- *   h[]       contains the public key, in NTT + Montgomery format
+ *   h[]       contains the public key, in NTT format (see to_ntt())
  *   logn      is the degree log
  *   tmp[]     temporary, must have at least 2*2^logn bytes
  * Returned value is 1 on success, 0 on error.
@@ -258,7 +258,7 @@ void PQCLEAN_FALCON512_AARCH64_to_ntt_monty(int16_t *h);
  * tmp[] must have 16-bit alignment.
  */
 int PQCLEAN_FALCON512_AARCH64_verify_raw(const int16_t *c0, const int16_t *s2,
-        int16_t *h, int16_t *tmp);
+        const int16_t *h, int16_t *tmp);
 
 /*
  * Compute the public key h[], given the private key elements f[] and
@@ -249,19 +249,15 @@ PQCLEAN_FALCON512_AARCH64_crypto_sign_pubkey_from_privkey(
 }
 
 /*
- * Compute the signature. nonce[] receives the nonce and must have length
- * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
- * or header byte), with *sigbuflen providing the maximum value length and
- * receiving the actual value length.
- *
- * If a signature could be computed but not encoded because it would
- * exceed the output buffer size, then an error is returned.
+ * Compute the signature for the nonce and message that have been
+ * injected into hsc (which must not be flipped yet); hsc is released.
+ * sigbuf[] and sigbuflen are as for do_sign().
  *
  * Return value: 0 on success, -1 on error.
  */
 static int
-do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
-        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+do_sign_hashed(uint8_t *sigbuf, size_t *sigbuflen,
+               inner_shake256_context *hsc, const uint8_t *sk) {
     union {
         uint8_t b[72 * FALCON_N];
         uint64_t dummy_u64;
@@ -276,6 +272,13 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
     inner_shake256_context sc;
     size_t u, v;
 
+    /*
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(hsc, r.hm, FALCON_LOGN, tmp.b);
+    inner_shake256_ctx_release(hsc);
+
     /*
      * Decode the private key.
      */
@@ -311,21 +314,6 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
         return -1;
     }
 
-    /*
-     * Create a random nonce (40 bytes).
-     */
-    randombytes(nonce, NONCELEN);
-
-    /*
-     * Hash message nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(&sc, r.hm, FALCON_LOGN, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Initialize a RNG.
      */
@@ -348,28 +336,95 @@ do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
 }
 
 /*
- * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
- * (of size sigbuflen) contains the signature value, not including the
- * header byte or nonce. Return value is 0 on success, -1 on error.
+ * Compute the signature. nonce[] receives the nonce and must have length
+ * NONCELEN bytes. sigbuf[] receives the signature value (without nonce
+ * or header byte), with *sigbuflen providing the maximum value length and
+ * receiving the actual value length.
+ *
+ * If a signature could be computed but not encoded because it would
+ * exceed the output buffer size, then an error is returned.
+ *
+ * Return value: 0 on success, -1 on error.
  */
 static int
-do_verify(
-    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
-    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+do_sign(uint8_t *nonce, uint8_t *sigbuf, size_t *sigbuflen,
+        const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    inner_shake256_context sc;
+
+    /*
+     * Create a random nonce (40 bytes).
+     */
+    randombytes(nonce, NONCELEN);
+
+    /*
+     * Hash message nonce + message into a vector.
+     */
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_sign_hashed(sigbuf, sigbuflen, &sc, sk);
+}
+
+/*
+ * Compute the signature for the nonce and message that have been
+ * injected into hsc (which must not be flipped yet), with an expanded
+ * private key as output by crypto_sign_expand_privkey(); hsc is
+ * released. sigbuf[] and sigbuflen are as for do_sign_hashed().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_sign_hashed_expanded(uint8_t *sigbuf, size_t *sigbuflen,
+                        inner_shake256_context *hsc, const fpr *esk) {
     union {
-        uint8_t b[2 * FALCON_N];
+        uint8_t b[48 * FALCON_N];
         uint64_t dummy_u64;
         fpr dummy_fpr;
     } tmp;
-    int16_t h[FALCON_N];
-    int16_t hm[FALCON_N];
-    int16_t sig[FALCON_N];
+    struct {
+        int16_t sig[FALCON_N];
+        uint16_t hm[FALCON_N];
+    } r;
+    unsigned char seed[48];
     inner_shake256_context sc;
     size_t v;
 
     /*
-     * Decode public key.
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(hsc, r.hm, FALCON_LOGN, tmp.b);
+    inner_shake256_ctx_release(hsc);
+
+    /*
+     * Initialize a RNG.
+     */
+    randombytes(seed, sizeof seed);
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, seed, sizeof seed);
+    inner_shake256_flip(&sc);
+
+    /*
+     * Compute and return the signature.
      */
+    PQCLEAN_FALCON512_AARCH64_sign_tree(r.sig, &sc, esk, r.hm, tmp.b);
+    v = PQCLEAN_FALCON512_AARCH64_comp_encode(sigbuf, *sigbuflen, r.sig);
+    inner_shake256_ctx_release(&sc);
+    if (v == 0) {
+        return -1;
+    }
+    *sigbuflen = v;
+    return 0;
+}
+
+/*
+ * Decode a public key into h[], in the NTT representation expected by
+ * verify_raw().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+decode_pubkey(int16_t *h, const uint8_t *pk) {
     if (pk[0] != 0x00 + FALCON_LOGN) {
         return -1;
     }
@@ -378,7 +433,35 @@ do_verify(
             != PQCLEAN_FALCON512_AARCH64_CRYPTO_PUBLICKEYBYTES - 1) {
         return -1;
     }
-    // We move the conversion to NTT domain of `h` inside verify_raw()
+    PQCLEAN_FALCON512_AARCH64_to_ntt(h);
+    return 0;
+}
+
+/*
+ * Same as do_verify_hashed(), with a public key already decoded by
+ * decode_pubkey(). hsc is released.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_verify_hashed_ntt(
+    const uint8_t *sigbuf, size_t sigbuflen,
+    inner_shake256_context *hsc, const int16_t *h) {
+    union {
+        uint8_t b[2 * FALCON_N];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int16_t hm[FALCON_N];
+    int16_t sig[FALCON_N];
+    size_t v;
+
+    /*
+     * Hash nonce + message into a vector.
+     */
+    inner_shake256_flip(hsc);
+    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(hsc, (uint16_t *) hm, FALCON_LOGN, tmp.b);
+    inner_shake256_ctx_release(hsc);
 
     /*
      * Decode signature.
@@ -403,16 +486,6 @@ do_verify(
         }
     }
 
-    /*
-     * Hash nonce + message into a vector.
-     */
-    inner_shake256_init(&sc);
-    inner_shake256_inject(&sc, nonce, NONCELEN);
-    inner_shake256_inject(&sc, m, mlen);
-    inner_shake256_flip(&sc);
-    PQCLEAN_FALCON512_AARCH64_hash_to_point_ct(&sc, (uint16_t *) hm, FALCON_LOGN, tmp.b);
-    inner_shake256_ctx_release(&sc);
-
     /*
      * Verify signature.
      */
@@ -422,6 +495,43 @@ do_verify(
     return 0;
 }
 
+/*
+ * Verify a signature for the nonce and message that have been injected
+ * into hsc (which must not be flipped yet); hsc is released. sigbuf[]
+ * and sigbuflen are as for do_verify().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+static int
+do_verify_hashed(
+    const uint8_t *sigbuf, size_t sigbuflen,
+    inner_shake256_context *hsc, const uint8_t *pk) {
+    int16_t h[FALCON_N];
+
+    if (decode_pubkey(h, pk) < 0) {
+        inner_shake256_ctx_release(hsc);
+        return -1;
+    }
+    return do_verify_hashed_ntt(sigbuf, sigbuflen, hsc, h);
+}
+
+/*
+ * Verify a sigature. The nonce has size NONCELEN bytes. sigbuf[]
+ * (of size sigbuflen) contains the signature value, not including the
+ * header byte or nonce. Return value is 0 on success, -1 on error.
+ */
+static int
+do_verify(
+    const uint8_t *nonce, const uint8_t *sigbuf, size_t sigbuflen,
+    const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    inner_shake256_context sc;
+
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, nonce, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed(sigbuf, sigbuflen, &sc, pk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AARCH64_crypto_sign_signature(
@@ -438,6 +548,74 @@ PQCLEAN_FALCON512_AARCH64_crypto_sign_signature(
     return 0;
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_expand_privkey(
+    uint8_t *esk, const uint8_t *sk) {
+    union {
+        uint8_t b[48 * FALCON_N];
+        uint64_t dummy_u64;
+        fpr dummy_fpr;
+    } tmp;
+    int8_t f[FALCON_N], g[FALCON_N], F[FALCON_N], G[FALCON_N];
+    size_t u, v;
+
+    if (sk[0] != 0x50 + FALCON_LOGN) {
+        return -1;
+    }
+    u = 1;
+    v = PQCLEAN_FALCON512_AARCH64_trim_i8_decode(
+            f, PQCLEAN_FALCON512_AARCH64_max_fg_bits[FALCON_LOGN],
+            sk + u, PQCLEAN_FALCON512_AARCH64_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    v = PQCLEAN_FALCON512_AARCH64_trim_i8_decode(
+            g, PQCLEAN_FALCON512_AARCH64_max_fg_bits[FALCON_LOGN],
+            sk + u, PQCLEAN_FALCON512_AARCH64_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    v = PQCLEAN_FALCON512_AARCH64_trim_i8_decode(
+            F, PQCLEAN_FALCON512_AARCH64_max_FG_bits[FALCON_LOGN],
+            sk + u, PQCLEAN_FALCON512_AARCH64_CRYPTO_SECRETKEYBYTES - u);
+    if (v == 0) {
+        return -1;
+    }
+    u += v;
+    if (u != PQCLEAN_FALCON512_AARCH64_CRYPTO_SECRETKEYBYTES) {
+        return -1;
+    }
+    if (!PQCLEAN_FALCON512_AARCH64_complete_private(G, f, g, F, tmp.b)) {
+        return -1;
+    }
+    PQCLEAN_FALCON512_AARCH64_expand_privkey((fpr *)esk, f, g, F, G, tmp.b);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk) {
+    inner_shake256_context sc;
+    size_t vlen;
+
+    vlen = PQCLEAN_FALCON512_AARCH64_CRYPTO_BYTES - NONCELEN - 1;
+    randombytes(sig + 1, NONCELEN);
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, sig + 1, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    if (do_sign_hashed_expanded(sig + 1 + NONCELEN, &vlen, &sc, (const fpr *)esk) < 0) {
+        return -1;
+    }
+    sig[0] = 0x30 + FALCON_LOGN;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AARCH64_crypto_sign_verify(
@@ -453,6 +631,33 @@ PQCLEAN_FALCON512_AARCH64_crypto_sign_verify(
                      sig + 1 + NONCELEN, siglen - 1 - NONCELEN, m, mlen, pk);
 }
 
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_expand_pubkey(
+    uint8_t *epk, const uint8_t *pk) {
+    return decode_pubkey((int16_t *)epk, pk);
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk) {
+    inner_shake256_context sc;
+
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + FALCON_LOGN) {
+        return -1;
+    }
+    inner_shake256_init(&sc);
+    inner_shake256_inject(&sc, sig + 1, NONCELEN);
+    inner_shake256_inject(&sc, m, mlen);
+    return do_verify_hashed_ntt(sig + 1 + NONCELEN, siglen - 1 - NONCELEN,
+                                &sc, (const int16_t *)epk);
+}
+
 /* see api.h */
 int
 PQCLEAN_FALCON512_AARCH64_crypto_sign(
@@ -522,3 +727,53 @@ PQCLEAN_FALCON512_AARCH64_crypto_sign_open(
     *mlen = pmlen;
     return 0;
 }
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_signature_init(
+    shake256incctx *state, uint8_t *nonce) {
+    randombytes(nonce, NONCELEN);
+    inner_shake256_init(state);
+    inner_shake256_inject(state, nonce, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_signature_final(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *nonce, shake256incctx *state, const uint8_t *sk) {
+    size_t vlen;
+
+    vlen = PQCLEAN_FALCON512_AARCH64_CRYPTO_BYTES - NONCELEN - 1;
+    if (do_sign_hashed(sig + 1 + NONCELEN, &vlen, state, sk) < 0) {
+        return -1;
+    }
+    memmove(sig + 1, nonce, NONCELEN);
+    sig[0] = 0x30 + FALCON_LOGN;
+    *siglen = 1 + NONCELEN + vlen;
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_init(
+    shake256incctx *state, const uint8_t *sig, size_t siglen) {
+    if (siglen < 1 + NONCELEN) {
+        return -1;
+    }
+    if (sig[0] != 0x30 + FALCON_LOGN) {
+        return -1;
+    }
+    inner_shake256_init(state);
+    inner_shake256_inject(state, sig + 1, NONCELEN);
+    return 0;
+}
+
+/* see api.h */
+int
+PQCLEAN_FALCON512_AARCH64_crypto_sign_verify_final(
+    const uint8_t *sig, size_t siglen,
+    shake256incctx *state, const uint8_t *pk) {
+    return do_verify_hashed(sig + 1 + NONCELEN, siglen - 1 - NONCELEN, state, pk);
+}
@@ -4,8 +4,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
+
 #define PQCLEAN_FALCON512_AVX2_CRYPTO_SECRETKEYBYTES   1281
 #define PQCLEAN_FALCON512_AVX2_CRYPTO_PUBLICKEYBYTES   897
+#define PQCLEAN_FALCON512_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 57344
+#define PQCLEAN_FALCON512_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES 1024
 #define PQCLEAN_FALCON512_AVX2_CRYPTO_BYTES            752
 
 #define PQCLEAN_FALCON512_AVX2_CRYPTO_ALGNAME          "Falcon-512"
@@ -60,6 +64,29 @@ int PQCLEAN_FALCON512_AVX2_crypto_sign_signature(
     uint8_t *sig, size_t *siglen,
     const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+/*
+ * Expand a private key (sk) into the form used by
+ * crypto_sign_signature_expanded(), written into esk[] (exactly
+ * PQCLEAN_FALCON512_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES bytes). The expanded key holds
+ * the B0 matrix and LDL tree in FFT representation, so that signing
+ * does not recompute them. esk[] must have 64-bit alignment.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_expand_privkey(
+    uint8_t *esk, const uint8_t *sk);
+
+/*
+ * Same as crypto_sign_signature(), with a private key that was expanded
+ * with crypto_sign_expand_privkey(). For the same random bytes, both
+ * functions output the same signature.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_signature_expanded(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *esk);
+
 /*
  * Verify a signature (sig, siglen) on a message (m, mlen) with a given
  * public key (pk).
@@ -72,6 +99,62 @@ int PQCLEAN_FALCON512_AVX2_crypto_sign_verify(
     const uint8_t *sig, size_t siglen,
     const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+/*
+ * Decode a public key (pk) into the form used by
+ * crypto_sign_verify_expanded(), written into epk[] (exactly
+ * PQCLEAN_FALCON512_AVX2_CRYPTO_EXPANDEDPUBLICKEYBYTES bytes). The expanded key holds h
+ * in NTT representation, so that verification does not decode and
+ * transform it again. epk[] must have 16-bit alignment.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_expand_pubkey(
+    uint8_t *epk, const uint8_t *pk);
+
+/*
+ * Same as crypto_sign_verify(), with a public key that was expanded
+ * with crypto_sign_expand_pubkey().
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_verify_expanded(
+    const uint8_t *sig, size_t siglen,
+    const uint8_t *m, size_t mlen, const uint8_t *epk);
+
+/*
+ * Incremental variant of crypto_sign_signature(), for messages that are
+ * not available in a single buffer. The _init() call draws the nonce
+ * (40 bytes) into nonce[] and starts hashing; the message is then fed
+ * to state in chunks with shake256_inc_absorb(), and the _final() call
+ * computes the signature with the private key (sk). The caller keeps
+ * nonce[] until _final(), which also releases state.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_signature_init(
+    shake256incctx *state, uint8_t *nonce);
+
+int PQCLEAN_FALCON512_AVX2_crypto_sign_signature_final(
+    uint8_t *sig, size_t *siglen,
+    const uint8_t *nonce, shake256incctx *state, const uint8_t *sk);
+
+/*
+ * Incremental variant of crypto_sign_verify(). The _init() call checks
+ * the signature header and starts hashing; the message is then fed to
+ * state in chunks with shake256_inc_absorb(), and the _final() call
+ * verifies the signature against the public key (pk). The same (sig,
+ * siglen) must be given to both calls. state is released by _final();
+ * it is left untouched if _init() fails.
+ *
+ * Return value: 0 on success, -1 on error.
+ */
+int PQCLEAN_FALCON512_AVX2_crypto_sign_verify_init(
+    shake256incctx *state, const uint8_t *sig, size_t siglen);
+
+int PQCLEAN_FALCON512_AVX2_crypto_sign_verify_final(
+    const uint8_t *sig, size_t siglen,
+    shake256incctx *state, const uint8_t *pk);
+
 /*
  * Compute a signature on a message and pack the signature and message
  * into a single object, written into sm[]. The length of that output is
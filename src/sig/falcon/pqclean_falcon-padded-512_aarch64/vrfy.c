@@ -33,7 +33,7 @@ void PQCLEAN_FALCONPADDED512_AARCH64_to_ntt_monty(int16_t *h) {
 
 /* see inner.h */
 int PQCLEAN_FALCONPADDED512_AARCH64_verify_raw(const int16_t *c0, const int16_t *s2,
-        int16_t *h, int16_t *tmp) {
+        const int16_t *h, int16_t *tmp) {
     int16_t *tt = tmp;
 
     /*
@@ -41,7 +41,6 @@ int PQCLEAN_FALCONPADDED512_AARCH64_verify_raw(const int16_t *c0, const int16_t
      */
 
     memcpy(tt, s2, sizeof(int16_t) * FALCON_N);
-    PQCLEAN_FALCONPADDED512_AARCH64_poly_ntt(h, NTT_NONE);
     PQCLEAN_FALCONPADDED512_AARCH64_poly_ntt(tt, NTT_MONT_INV);
     PQCLEAN_FALCONPADDED512_AARCH64_poly_montmul_ntt(tt, h);
     PQCLEAN_FALCONPADDED512_AARCH64_poly_invntt(tt, INVNTT_NONE);
@@ -9,6 +9,8 @@
 #define OQS_SIG_falcon_512_length_public_key 897
 #define OQS_SIG_falcon_512_length_secret_key 1281
 #define OQS_SIG_falcon_512_length_signature 752
+#define OQS_SIG_falcon_512_length_prepared_secret_key 57344
+#define OQS_SIG_falcon_512_length_prepared_public_key 1024
 
 OQS_SIG *OQS_SIG_falcon_512_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -18,12 +20,22 @@ OQS_API OQS_STATUS OQS_SIG_falcon_512_sign(uint8_t *signature, size_t *signature
 OQS_API OQS_STATUS OQS_SIG_falcon_512_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_512_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_512_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_1024)
 #define OQS_SIG_falcon_1024_length_public_key 1793
 #define OQS_SIG_falcon_1024_length_secret_key 2305
 #define OQS_SIG_falcon_1024_length_signature 1462
+#define OQS_SIG_falcon_1024_length_prepared_secret_key 122880
+#define OQS_SIG_falcon_1024_length_prepared_public_key 2048
 
 OQS_SIG *OQS_SIG_falcon_1024_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -33,12 +45,22 @@ OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign(uint8_t *signature, size_t *signatur
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_512)
 #define OQS_SIG_falcon_padded_512_length_public_key 897
 #define OQS_SIG_falcon_padded_512_length_secret_key 1281
 #define OQS_SIG_falcon_padded_512_length_signature 666
+#define OQS_SIG_falcon_padded_512_length_prepared_secret_key 57344
+#define OQS_SIG_falcon_padded_512_length_prepared_public_key 1024
 
 OQS_SIG *OQS_SIG_falcon_padded_512_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -48,12 +70,22 @@ OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign(uint8_t *signature, size_t *si
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_512_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_padded_1024)
 #define OQS_SIG_falcon_padded_1024_length_public_key 1793
 #define OQS_SIG_falcon_padded_1024_length_secret_key 2305
 #define OQS_SIG_falcon_padded_1024_length_signature 1280
+#define OQS_SIG_falcon_padded_1024_length_prepared_secret_key 122880
+#define OQS_SIG_falcon_padded_1024_length_prepared_public_key 2048
 
 OQS_SIG *OQS_SIG_falcon_padded_1024_new(void);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -63,6 +95,14 @@ OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign(uint8_t *signature, size_t *s
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_falcon_padded_1024_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #endif
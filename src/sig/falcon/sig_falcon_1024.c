@@ -3,8 +3,19 @@
 #include <stdlib.h>
 
 #include <oqs/sig_falcon.h>
+#include <oqs/sha3.h>
 
 #if defined(OQS_ENABLE_SIG_falcon_1024)
+/* The message is hashed together with the nonce, which is kept until the signature is written. */
+struct falcon_1024_stream_state {
+	OQS_SHA3_shake256_stack_ctx shake;
+	uint8_t nonce[40];
+};
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_falcon_1024_avx2) || defined(OQS_ENABLE_SIG_falcon_1024_aarch64))
+static void falcon_1024_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_falcon_1024_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +40,30 @@ OQS_SIG *OQS_SIG_falcon_1024_new(void) {
 	sig->verify = OQS_SIG_falcon_1024_verify;
 	sig->sign_with_ctx_str = OQS_SIG_falcon_1024_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_falcon_1024_verify_with_ctx_str;
+	sig->length_prepared_secret_key = OQS_SIG_falcon_1024_length_prepared_secret_key;
+	sig->prepare_secret_key = OQS_SIG_falcon_1024_prepare_secret_key;
+	sig->sign_prepared = OQS_SIG_falcon_1024_sign_prepared;
+	sig->sign_prepared_threaded = NULL;
+	sig->length_prepared_public_key = OQS_SIG_falcon_1024_length_prepared_public_key;
+	sig->prepare_public_key = OQS_SIG_falcon_1024_prepare_public_key;
+	sig->verify_prepared = OQS_SIG_falcon_1024_verify_prepared;
+	sig->length_stream_state = sizeof(struct falcon_1024_stream_state);
+	sig->sign_init = OQS_SIG_falcon_1024_sign_init;
+	sig->sign_final = OQS_SIG_falcon_1024_sign_final;
+	sig->verify_init = OQS_SIG_falcon_1024_verify_init;
+	sig->verify_final = OQS_SIG_falcon_1024_verify_final;
+	sig->stream_update = NULL;
+	sig->stream_release = NULL;
+	sig->length_mu = 0;
+	sig->compute_mu = NULL;
+	sig->sign_mu = NULL;
+	sig->verify_mu = NULL;
+	sig->sign_prehash = NULL;
+	sig->verify_prehash = NULL;
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_falcon_1024_avx2) || defined(OQS_ENABLE_SIG_falcon_1024_aarch64))
+	falcon_1024_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -38,6 +73,14 @@ extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_keypair_from_fseed(uint8_t *pk,
 extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(uint8_t *epk, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(OQS_SHA3_shake256_stack_ctx *state, uint8_t *nonce);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(uint8_t *sig, size_t *siglen, const uint8_t *nonce, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sig, size_t siglen);
+extern int PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
 extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
@@ -45,6 +88,14 @@ extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_keypair_from_fseed(uint8_t *pk, u
 extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_pubkey(uint8_t *epk, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_init(OQS_SHA3_shake256_stack_ctx *state, uint8_t *nonce);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_final(uint8_t *sig, size_t *siglen, const uint8_t *nonce, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sig, size_t siglen);
+extern int PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 #endif
 
 #if defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
@@ -53,6 +104,14 @@ extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_keypair_from_fseed(uint8_t *pk
 extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_pubkey(uint8_t *epk, const uint8_t *pk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_init(OQS_SHA3_shake256_stack_ctx *state, uint8_t *nonce);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_final(uint8_t *sig, size_t *siglen, const uint8_t *nonce, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sig, size_t siglen);
+extern int PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_falcon_1024_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -200,4 +259,497 @@ OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_with_ctx_str(const uint8_t *messag
 		return OQS_ERROR;
 	}
 }
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) secret_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_init(&s->shake, s->nonce);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(&s->shake, s->nonce);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_init(&s->shake, s->nonce);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(&s->shake, s->nonce);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(&s->shake, s->nonce);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_init(&s->shake, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(&s->shake, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_init(&s->shake, signature, signature_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(&s->shake, signature, signature_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(&s->shake, signature, signature_len);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_falcon_1024_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && (defined(OQS_ENABLE_SIG_falcon_1024_avx2) || defined(OQS_ENABLE_SIG_falcon_1024_aarch64))
+/* Implementation-specific entry points, bound by OQS_SIG_falcon_1024_new once per object. */
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+static OQS_STATUS falcon_1024_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS falcon_1024_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) secret_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_init(&s->shake, s->nonce);
+}
+
+static OQS_STATUS falcon_1024_avx2_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+}
+
+static OQS_STATUS falcon_1024_avx2_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_init(&s->shake, signature, signature_len);
+}
+
+static OQS_STATUS falcon_1024_avx2_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AVX2_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+}
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+static OQS_STATUS falcon_1024_aarch64_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS falcon_1024_aarch64_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) secret_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_init(&s->shake, s->nonce);
+}
+
+static OQS_STATUS falcon_1024_aarch64_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+}
+
+static OQS_STATUS falcon_1024_aarch64_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_init(&s->shake, signature, signature_len);
+}
+
+static OQS_STATUS falcon_1024_aarch64_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_AARCH64_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+}
+#endif
+
+static OQS_STATUS falcon_1024_clean_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS falcon_1024_clean_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS falcon_1024_clean_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+}
+
+static OQS_STATUS falcon_1024_clean_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+}
+
+static OQS_STATUS falcon_1024_clean_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) secret_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_init(&s->shake, s->nonce);
+}
+
+static OQS_STATUS falcon_1024_clean_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_signature_final(signature, signature_len, s->nonce, &s->shake, secret_key);
+}
+
+static OQS_STATUS falcon_1024_clean_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	(void) public_key;
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_init(&s->shake, signature, signature_len);
+}
+
+static OQS_STATUS falcon_1024_clean_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	struct falcon_1024_stream_state *s = state;
+	return (OQS_STATUS) PQCLEAN_FALCON1024_CLEAN_crypto_sign_verify_final(signature, signature_len, &s->shake, public_key);
+}
+
+static void falcon_1024_bind_impl(OQS_SIG *sig) {
+#if defined(OQS_ENABLE_SIG_falcon_1024_avx2)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+		sig->keypair = falcon_1024_avx2_keypair;
+		sig->keypair_from_fseed = falcon_1024_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = falcon_1024_avx2_pubkey_from_privkey;
+		sig->sign = falcon_1024_avx2_sign;
+		sig->verify = falcon_1024_avx2_verify;
+		sig->prepare_secret_key = falcon_1024_avx2_prepare_secret_key;
+		sig->sign_prepared = falcon_1024_avx2_sign_prepared;
+		sig->prepare_public_key = falcon_1024_avx2_prepare_public_key;
+		sig->verify_prepared = falcon_1024_avx2_verify_prepared;
+		sig->sign_init = falcon_1024_avx2_sign_init;
+		sig->sign_final = falcon_1024_avx2_sign_final;
+		sig->verify_init = falcon_1024_avx2_verify_init;
+		sig->verify_final = falcon_1024_avx2_verify_final;
+		return;
+	}
+#elif defined(OQS_ENABLE_SIG_falcon_1024_aarch64)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_NEON)) {
+		sig->keypair = falcon_1024_aarch64_keypair;
+		sig->keypair_from_fseed = falcon_1024_aarch64_keypair_from_fseed;
+		sig->pubkey_from_privkey = falcon_1024_aarch64_pubkey_from_privkey;
+		sig->sign = falcon_1024_aarch64_sign;
+		sig->verify = falcon_1024_aarch64_verify;
+		sig->prepare_secret_key = falcon_1024_aarch64_prepare_secret_key;
+		sig->sign_prepared = falcon_1024_aarch64_sign_prepared;
+		sig->prepare_public_key = falcon_1024_aarch64_prepare_public_key;
+		sig->verify_prepared = falcon_1024_aarch64_verify_prepared;
+		sig->sign_init = falcon_1024_aarch64_sign_init;
+		sig->sign_final = falcon_1024_aarch64_sign_final;
+		sig->verify_init = falcon_1024_aarch64_verify_init;
+		sig->verify_final = falcon_1024_aarch64_verify_final;
+		return;
+	}
+#endif
+	sig->keypair = falcon_1024_clean_keypair;
+	sig->keypair_from_fseed = falcon_1024_clean_keypair_from_fseed;
+	sig->pubkey_from_privkey = falcon_1024_clean_pubkey_from_privkey;
+	sig->sign = falcon_1024_clean_sign;
+	sig->verify = falcon_1024_clean_verify;
+	sig->prepare_secret_key = falcon_1024_clean_prepare_secret_key;
+	sig->sign_prepared = falcon_1024_clean_sign_prepared;
+	sig->prepare_public_key = falcon_1024_clean_prepare_public_key;
+	sig->verify_prepared = falcon_1024_clean_verify_prepared;
+	sig->sign_init = falcon_1024_clean_sign_init;
+	sig->sign_final = falcon_1024_clean_sign_final;
+	sig->verify_init = falcon_1024_clean_verify_init;
+	sig->verify_final = falcon_1024_clean_verify_final;
+}
+#endif
+
 #endif
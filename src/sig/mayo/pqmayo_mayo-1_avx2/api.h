@@ -8,6 +8,8 @@
 #define CRYPTO_SECRETKEYBYTES 24
 #define CRYPTO_PUBLICKEYBYTES 1168
 #define CRYPTO_BYTES 321
+#define CRYPTO_EXPANDEDSECRETKEYBYTES 69856
+#define CRYPTO_EXPANDEDPUBLICKEYBYTES 70752
 
 #define CRYPTO_ALGNAME "MAYO-1"
 
@@ -39,5 +41,25 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
                    const unsigned char *m, size_t mlen,
                    const unsigned char *pk);
 
+#define crypto_sign_expand_privkey MAYO_NAMESPACE(crypto_sign_expand_privkey)
+int
+crypto_sign_expand_privkey(unsigned char *esk, const unsigned char *sk);
+
+#define crypto_sign_signature_expanded MAYO_NAMESPACE(crypto_sign_signature_expanded)
+int
+crypto_sign_signature_expanded(unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk);
+
+#define crypto_sign_expand_pubkey MAYO_NAMESPACE(crypto_sign_expand_pubkey)
+int
+crypto_sign_expand_pubkey(unsigned char *epk, const unsigned char *pk);
+
+#define crypto_sign_verify_expanded MAYO_NAMESPACE(crypto_sign_verify_expanded)
+int
+crypto_sign_verify_expanded(const unsigned char *sig, size_t siglen,
+                            const unsigned char *m, size_t mlen,
+                            const unsigned char *epk);
+
 #endif /* api_h */
 
@@ -431,5 +431,76 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
                 size_t mlen, const unsigned char *sig,
                 const unsigned char *pk);
 
+/**
+ * Mayo prepare secret key.
+ *
+ * Performs Mayo.expandSK() once, so that repeated signing with the same key
+ * can use mayo_sign_signature_prepared(). The prepared key holds P1 and
+ * L = (P1 + P1^t)*O + P2 as 64-bit words in host byte order, followed by the
+ * encoded O and seed_sk, esk_bytes in total. esk must be 32-byte aligned.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] csk Compacted secret key.
+ * @param[out] esk Prepared secret key.
+ * @return int return code
+ */
+#define mayo_prepare_sk MAYO_NAMESPACE(mayo_prepare_sk)
+int mayo_prepare_sk(const mayo_params_t *p, const unsigned char *csk,
+                    unsigned char *esk);
+
+/**
+ * Mayo signature generation with a prepared secret key.
+ *
+ * Same as mayo_sign_signature(), with a secret key output by
+ * mayo_prepare_sk(). For the same randomness, both produce the same
+ * signature.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[out] sig Signature
+ * @param[out] siglen Pointer to the length of sig
+ * @param[in] m Message to be signed
+ * @param[in] mlen Message length
+ * @param[in] esk Prepared secret key
+ * @return int status code
+ */
+#define mayo_sign_signature_prepared MAYO_NAMESPACE(mayo_sign_signature_prepared)
+int mayo_sign_signature_prepared(const mayo_params_t *p, unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk);
+
+/**
+ * Mayo prepare public key.
+ *
+ * Performs Mayo.expandPK() once, so that repeated verification with the same
+ * key can use mayo_verify_prepared(). The prepared key holds P1, P2 and P3
+ * as 64-bit words in host byte order, epk_bytes in total. epk must be
+ * 32-byte aligned.
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] cpk Compacted public key.
+ * @param[out] epk Prepared public key.
+ * @return int return code
+ */
+#define mayo_prepare_pk MAYO_NAMESPACE(mayo_prepare_pk)
+int mayo_prepare_pk(const mayo_params_t *p, const unsigned char *cpk,
+                    unsigned char *epk);
+
+/**
+ * Mayo verify signature with a prepared public key.
+ *
+ * Same as mayo_verify(), with a public key output by mayo_prepare_pk().
+ *
+ * @param[in] p Mayo parameter set
+ * @param[in] m Message
+ * @param[in] mlen Message length
+ * @param[in] sig Signature
+ * @param[in] epk Prepared public key
+ * @return int 0 if verification succeeded, 1 otherwise.
+ */
+#define mayo_verify_prepared MAYO_NAMESPACE(mayo_verify_prepared)
+int mayo_verify_prepared(const mayo_params_t *p, const unsigned char *m,
+                size_t mlen, const unsigned char *sig,
+                const unsigned char *epk);
+
 #endif
 
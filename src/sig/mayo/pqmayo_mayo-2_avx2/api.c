@@ -44,3 +44,29 @@ crypto_sign_verify(const unsigned char *sig, size_t siglen,
     return mayo_verify(MAYO_PARAMS, m, mlen, sig, pk);
 }
 
+int
+crypto_sign_expand_privkey(unsigned char *esk, const unsigned char *sk) {
+    return mayo_prepare_sk(MAYO_PARAMS, sk, esk);
+}
+
+int
+crypto_sign_signature_expanded(unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk) {
+    return mayo_sign_signature_prepared(MAYO_PARAMS, sig, siglen, m, mlen, esk);
+}
+
+int
+crypto_sign_expand_pubkey(unsigned char *epk, const unsigned char *pk) {
+    return mayo_prepare_pk(MAYO_PARAMS, pk, epk);
+}
+
+int
+crypto_sign_verify_expanded(const unsigned char *sig, size_t siglen,
+                            const unsigned char *m, size_t mlen,
+                            const unsigned char *epk) {
+    if (siglen != CRYPTO_BYTES)
+        return -1;
+    return mayo_verify_prepared(MAYO_PARAMS, m, mlen, sig, epk);
+}
+
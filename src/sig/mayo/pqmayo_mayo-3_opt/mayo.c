@@ -253,9 +253,13 @@ err:
     return ret;
 }
 
-int mayo_sign_signature(const mayo_params_t *p, unsigned char *sig,
+// Signs with an expanded secret key: P1 and L = (P1 + P1^t)*O + P2 as
+// uint64_t words in host byte order, the encoded oil space Oenc and seed_sk.
+static int mayo_sign_signature_expanded(const mayo_params_t *p, unsigned char *sig,
               size_t *siglen, const unsigned char *m,
-              size_t mlen, const unsigned char *csk) {
+              size_t mlen, const unsigned char *seed_sk,
+              const uint64_t *P1, const uint64_t *L,
+              const unsigned char *Oenc) {
     int ret = MAYO_OK;
     unsigned char tenc[M_BYTES_MAX], t[M_MAX]; // no secret data
     unsigned char y[M_MAX];                    // secret data
@@ -266,9 +270,7 @@ int mayo_sign_signature(const mayo_params_t *p, unsigned char *sig,
     unsigned char x[K_MAX * N_MAX];                       // not secret data
     unsigned char r[K_MAX * O_MAX + 1] = { 0 };           // secret data
     unsigned char s[K_MAX * N_MAX];                       // not secret data
-    const unsigned char *seed_sk;
     unsigned char O[(N_MINUS_O_MAX)*O_MAX]; // secret data
-    alignas(32) sk_t sk;                    // secret data
     unsigned char Ox[N_MINUS_O_MAX];        // secret data
     // unsigned char Mdigest[DIGEST_BYTES];
     unsigned char tmp[DIGEST_BYTES_MAX + SALT_BYTES_MAX + SK_SEED_BYTES_MAX + 1];
@@ -282,40 +284,19 @@ int mayo_sign_signature(const mayo_params_t *p, unsigned char *sig,
     const int param_m_bytes = PARAM_m_bytes(p);
     const int param_v_bytes = PARAM_v_bytes(p);
     const int param_r_bytes = PARAM_r_bytes(p);
-    const int param_P1_bytes = PARAM_P1_bytes(p);
-#ifdef TARGET_BIG_ENDIAN
-    const int param_P2_bytes = PARAM_P2_bytes(p);
-#endif
     const int param_sig_bytes = PARAM_sig_bytes(p);
     const int param_A_cols = PARAM_A_cols(p);
     const int param_digest_bytes = PARAM_digest_bytes(p);
     const int param_sk_seed_bytes = PARAM_sk_seed_bytes(p);
     const int param_salt_bytes = PARAM_salt_bytes(p);
 
-    ret = mayo_expand_sk(p, csk, &sk);
-    if (ret != MAYO_OK) {
-        goto err;
-    }
-
-    seed_sk = csk;
-    decode(sk.o, O, (param_n - param_o) * param_o);
+    decode(Oenc, O, (param_n - param_o) * param_o);
 
     // hash message
     shake256(tmp, param_digest_bytes, m, mlen);
 
-    uint64_t *P1 = sk.p;
-    uint64_t *L  = P1 + (param_P1_bytes/8);
     alignas (32) uint64_t Mtmp[K_MAX * O_MAX * M_MAX / 16] = {0};
 
-#ifdef TARGET_BIG_ENDIAN
-    for (int i = 0; i < param_P1_bytes / 8; ++i) {
-        P1[i] = BSWAP64(P1[i]);
-    }
-    for (int i = 0; i < param_P2_bytes / 8; ++i) {
-        L[i] = BSWAP64(L[i]);
-    }
-#endif
-
     // choose the randomizer
     #if defined(PQM4) || defined(HAVE_RANDOMBYTES_NORETVAL)
     randombytes(tmp + param_digest_bytes, param_salt_bytes);
@@ -385,19 +366,69 @@ int mayo_sign_signature(const mayo_params_t *p, unsigned char *sig,
     encode(s, sig, param_n * param_k);
     memcpy(sig + param_sig_bytes - param_salt_bytes, salt, param_salt_bytes);
     *siglen = param_sig_bytes;
+#if !defined(PQM4) && !defined(HAVE_RANDOMBYTES_NORETVAL)
 err:
+#endif
     mayo_secure_clear(V, K_MAX * V_BYTES_MAX + R_BYTES_MAX);
     mayo_secure_clear(Vdec, N_MINUS_O_MAX * K_MAX);
     mayo_secure_clear(A, M_MAX * (K_MAX * O_MAX + 1));
     mayo_secure_clear(r, K_MAX * O_MAX + 1);
     mayo_secure_clear(O, (N_MINUS_O_MAX)*O_MAX);
-    mayo_secure_clear(&sk, sizeof(sk_t));
     mayo_secure_clear(Ox, N_MINUS_O_MAX);
     mayo_secure_clear(tmp,
                       DIGEST_BYTES_MAX + SALT_BYTES_MAX + SK_SEED_BYTES_MAX + 1);
     return ret;
 }
 
+int mayo_sign_signature(const mayo_params_t *p, unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *csk) {
+    int ret = MAYO_OK;
+    alignas(32) sk_t sk; // secret data
+
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+#ifdef TARGET_BIG_ENDIAN
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+#endif
+
+    ret = mayo_expand_sk(p, csk, &sk);
+    if (ret != MAYO_OK) {
+        goto err;
+    }
+
+    uint64_t *P1 = sk.p;
+    uint64_t *L  = P1 + (param_P1_bytes/8);
+
+#ifdef TARGET_BIG_ENDIAN
+    for (int i = 0; i < param_P1_bytes / 8; ++i) {
+        P1[i] = BSWAP64(P1[i]);
+    }
+    for (int i = 0; i < param_P2_bytes / 8; ++i) {
+        L[i] = BSWAP64(L[i]);
+    }
+#endif
+
+    ret = mayo_sign_signature_expanded(p, sig, siglen, m, mlen, csk, P1, L, sk.o);
+err:
+    mayo_secure_clear(&sk, sizeof(sk_t));
+    return ret;
+}
+
+int mayo_sign_signature_prepared(const mayo_params_t *p, unsigned char *sig,
+              size_t *siglen, const unsigned char *m,
+              size_t mlen, const unsigned char *esk) {
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+    const int param_O_bytes = PARAM_O_bytes(p);
+
+    const uint64_t *P1 = (const uint64_t *)esk;
+    const uint64_t *L  = P1 + (param_P1_bytes/8);
+    const unsigned char *Oenc = esk + param_P1_bytes + param_P2_bytes;
+
+    return mayo_sign_signature_expanded(p, sig, siglen, m, mlen,
+                                        Oenc + param_O_bytes, P1, L, Oenc);
+}
+
 int mayo_sign(const mayo_params_t *p, unsigned char *sm,
               size_t *smlen, const unsigned char *m,
               size_t mlen, const unsigned char *csk) {
@@ -581,14 +612,65 @@ int mayo_expand_sk(const mayo_params_t *p, const unsigned char *csk,
     return ret;
 }
 
-int mayo_verify(const mayo_params_t *p, const unsigned char *m,
+int mayo_prepare_sk(const mayo_params_t *p, const unsigned char *csk,
+                    unsigned char *esk) {
+    int ret = MAYO_OK;
+    alignas(32) sk_t sk; // secret data
+
+    const int param_O_bytes = PARAM_O_bytes(p);
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+    const int param_sk_seed_bytes = PARAM_sk_seed_bytes(p);
+
+    ret = mayo_expand_sk(p, csk, &sk);
+    if (ret != MAYO_OK) {
+        goto err;
+    }
+
+#ifdef TARGET_BIG_ENDIAN
+    for (int i = 0; i < (param_P1_bytes + param_P2_bytes) / 8; ++i) {
+        sk.p[i] = BSWAP64(sk.p[i]);
+    }
+#endif
+
+    memcpy(esk, sk.p, param_P1_bytes + param_P2_bytes);
+    esk += param_P1_bytes + param_P2_bytes;
+    memcpy(esk, sk.o, param_O_bytes);
+    esk += param_O_bytes;
+    memcpy(esk, csk, param_sk_seed_bytes);
+err:
+    mayo_secure_clear(&sk, sizeof(sk_t));
+    return ret;
+}
+
+int mayo_prepare_pk(const mayo_params_t *p, const unsigned char *cpk,
+                    unsigned char *epk) {
+    int ret = mayo_expand_pk(p, cpk, epk);
+    if (ret != MAYO_OK) {
+        return ret;
+    }
+
+#ifdef TARGET_BIG_ENDIAN
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+    const int param_P3_bytes = PARAM_P3_bytes(p);
+    uint64_t *pk = (uint64_t *)epk;
+    for (int i = 0; i < (param_P1_bytes + param_P2_bytes + param_P3_bytes) / 8; ++i) {
+        pk[i] = BSWAP64(pk[i]);
+    }
+#endif
+    return MAYO_OK;
+}
+
+// Verifies against an expanded public key given as uint64_t words in host
+// byte order.
+static int mayo_verify_expanded(const mayo_params_t *p, const unsigned char *m,
                 size_t mlen, const unsigned char *sig,
-                const unsigned char *cpk) {
+                const uint64_t *P1, const uint64_t *P2, const uint64_t *P3) {
     unsigned char tEnc[M_BYTES_MAX];
     unsigned char t[M_MAX];
     unsigned char y[2 * M_MAX] = {0}; // extra space for reduction mod f(X)
     unsigned char s[K_MAX * N_MAX];
-    alignas (64) uint64_t pk[EPK_BYTES_MAX / 8];
     unsigned char tmp[DIGEST_BYTES_MAX + SALT_BYTES_MAX];
 
     const int param_m = PARAM_m(p);
@@ -597,36 +679,10 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
     const int param_o = PARAM_o(p);
     const int param_k = PARAM_k(p);
     const int param_m_bytes = PARAM_m_bytes(p);
-    const int param_P1_bytes = PARAM_P1_bytes(p);
-    const int param_P2_bytes = PARAM_P2_bytes(p);
-#ifdef TARGET_BIG_ENDIAN
-    const int param_P3_bytes = PARAM_P3_bytes(p);
-#endif
     const int param_sig_bytes = PARAM_sig_bytes(p);
     const int param_digest_bytes = PARAM_digest_bytes(p);
     const int param_salt_bytes = PARAM_salt_bytes(p);
 
-    int ret = mayo_expand_pk(p, cpk, (unsigned char *)pk);
-    if (ret != MAYO_OK) {
-        return MAYO_ERR;
-    }
-
-    uint64_t *P1 = pk;
-    uint64_t *P2 = pk + (param_P1_bytes / 8);
-    uint64_t *P3 = P2 + (param_P2_bytes / 8);
-
-#ifdef TARGET_BIG_ENDIAN
-    for (int i = 0; i < param_P1_bytes / 8; ++i) {
-        P1[i] = BSWAP64(P1[i]);
-    }
-    for (int i = 0; i < param_P2_bytes / 8; ++i) {
-        P2[i] = BSWAP64(P2[i]);
-    }
-    for (int i = 0; i < param_P3_bytes / 8; ++i) {
-        P3[i] = BSWAP64(P3[i]);
-    }
-#endif
-
     // hash m
     shake256(tmp, param_digest_bytes, m, mlen);
 
@@ -654,3 +710,51 @@ int mayo_verify(const mayo_params_t *p, const unsigned char *m,
     return MAYO_ERR; // bad signature
 }
 
+int mayo_verify_prepared(const mayo_params_t *p, const unsigned char *m,
+                size_t mlen, const unsigned char *sig,
+                const unsigned char *epk) {
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+
+    const uint64_t *P1 = (const uint64_t *)epk;
+    const uint64_t *P2 = P1 + (param_P1_bytes / 8);
+    const uint64_t *P3 = P2 + (param_P2_bytes / 8);
+
+    return mayo_verify_expanded(p, m, mlen, sig, P1, P2, P3);
+}
+
+int mayo_verify(const mayo_params_t *p, const unsigned char *m,
+                size_t mlen, const unsigned char *sig,
+                const unsigned char *cpk) {
+    alignas (64) uint64_t pk[EPK_BYTES_MAX / 8];
+
+    const int param_P1_bytes = PARAM_P1_bytes(p);
+    const int param_P2_bytes = PARAM_P2_bytes(p);
+#ifdef TARGET_BIG_ENDIAN
+    const int param_P3_bytes = PARAM_P3_bytes(p);
+#endif
+
+    int ret = mayo_expand_pk(p, cpk, (unsigned char *)pk);
+    if (ret != MAYO_OK) {
+        return MAYO_ERR;
+    }
+
+    uint64_t *P1 = pk;
+    uint64_t *P2 = pk + (param_P1_bytes / 8);
+    uint64_t *P3 = P2 + (param_P2_bytes / 8);
+
+#ifdef TARGET_BIG_ENDIAN
+    for (int i = 0; i < param_P1_bytes / 8; ++i) {
+        P1[i] = BSWAP64(P1[i]);
+    }
+    for (int i = 0; i < param_P2_bytes / 8; ++i) {
+        P2[i] = BSWAP64(P2[i]);
+    }
+    for (int i = 0; i < param_P3_bytes / 8; ++i) {
+        P3[i] = BSWAP64(P3[i]);
+    }
+#endif
+
+    return mayo_verify_expanded(p, m, mlen, sig, P1, P2, P3);
+}
+
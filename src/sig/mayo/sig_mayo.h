@@ -9,6 +9,8 @@
 #define OQS_SIG_mayo_1_length_public_key 1168
 #define OQS_SIG_mayo_1_length_secret_key 24
 #define OQS_SIG_mayo_1_length_signature 321
+#define OQS_SIG_mayo_1_length_prepared_secret_key 69856
+#define OQS_SIG_mayo_1_length_prepared_public_key 70752
 
 OQS_SIG *OQS_SIG_mayo_1_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -18,12 +20,18 @@ OQS_API OQS_STATUS OQS_SIG_mayo_1_sign(uint8_t *signature, size_t *signature_len
 OQS_API OQS_STATUS OQS_SIG_mayo_1_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_1_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_1_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_2)
 #define OQS_SIG_mayo_2_length_public_key 5488
 #define OQS_SIG_mayo_2_length_secret_key 24
 #define OQS_SIG_mayo_2_length_signature 180
+#define OQS_SIG_mayo_2_length_prepared_secret_key 93684
+#define OQS_SIG_mayo_2_length_prepared_public_key 98592
 
 OQS_SIG *OQS_SIG_mayo_2_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -33,12 +41,18 @@ OQS_API OQS_STATUS OQS_SIG_mayo_2_sign(uint8_t *signature, size_t *signature_len
 OQS_API OQS_STATUS OQS_SIG_mayo_2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_2_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_2_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_3)
 #define OQS_SIG_mayo_3_length_public_key 2656
 #define OQS_SIG_mayo_3_length_secret_key 32
 #define OQS_SIG_mayo_3_length_signature 577
+#define OQS_SIG_mayo_3_length_prepared_secret_key 235437
+#define OQS_SIG_mayo_3_length_prepared_public_key 237600
 
 OQS_SIG *OQS_SIG_mayo_3_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -48,12 +62,18 @@ OQS_API OQS_STATUS OQS_SIG_mayo_3_sign(uint8_t *signature, size_t *signature_len
 OQS_API OQS_STATUS OQS_SIG_mayo_3_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_3_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_3_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_mayo_5)
 #define OQS_SIG_mayo_5_length_public_key 5008
 #define OQS_SIG_mayo_5_length_secret_key 40
 #define OQS_SIG_mayo_5_length_signature 838
+#define OQS_SIG_mayo_5_length_prepared_secret_key 566078
+#define OQS_SIG_mayo_5_length_prepared_public_key 570304
 
 OQS_SIG *OQS_SIG_mayo_5_new(void);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -63,6 +83,10 @@ OQS_API OQS_STATUS OQS_SIG_mayo_5_sign(uint8_t *signature, size_t *signature_len
 OQS_API OQS_STATUS OQS_SIG_mayo_5_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_mayo_5_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_mayo_5_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
 #endif
 
 #endif
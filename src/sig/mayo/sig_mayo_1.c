@@ -5,6 +5,10 @@
 #include <oqs/sig_mayo.h>
 
 #if defined(OQS_ENABLE_SIG_mayo_1)
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_mayo_1_avx2)
+static void mayo_1_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_mayo_1_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +33,30 @@ OQS_SIG *OQS_SIG_mayo_1_new(void) {
 	sig->verify = OQS_SIG_mayo_1_verify;
 	sig->sign_with_ctx_str = OQS_SIG_mayo_1_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_mayo_1_verify_with_ctx_str;
+	sig->length_prepared_secret_key = OQS_SIG_mayo_1_length_prepared_secret_key;
+	sig->prepare_secret_key = OQS_SIG_mayo_1_prepare_secret_key;
+	sig->sign_prepared = OQS_SIG_mayo_1_sign_prepared;
+	sig->sign_prepared_threaded = NULL;
+	sig->length_prepared_public_key = OQS_SIG_mayo_1_length_prepared_public_key;
+	sig->prepare_public_key = OQS_SIG_mayo_1_prepare_public_key;
+	sig->verify_prepared = OQS_SIG_mayo_1_verify_prepared;
+	sig->length_stream_state = 0;
+	sig->sign_init = NULL;
+	sig->sign_final = NULL;
+	sig->verify_init = NULL;
+	sig->verify_final = NULL;
+	sig->stream_update = NULL;
+	sig->stream_release = NULL;
+	sig->length_mu = 0;
+	sig->compute_mu = NULL;
+	sig->sign_mu = NULL;
+	sig->verify_mu = NULL;
+	sig->sign_prehash = NULL;
+	sig->verify_prehash = NULL;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_mayo_1_avx2)
+	mayo_1_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -38,6 +66,10 @@ extern int PQCLEAN_MAYO1_OPT_crypto_sign_keypair_from_fseed(uint8_t *pk, uint8_t
 extern int PQCLEAN_MAYO1_OPT_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqmayo_MAYO_1_opt_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqmayo_MAYO_1_opt_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqmayo_MAYO_1_opt_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int pqmayo_MAYO_1_opt_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int pqmayo_MAYO_1_opt_crypto_sign_expand_pubkey(uint8_t *epk, const uint8_t *pk);
+extern int pqmayo_MAYO_1_opt_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
 
 #if defined(OQS_ENABLE_SIG_mayo_1_avx2)
 extern int pqmayo_MAYO_1_avx2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
@@ -45,6 +77,10 @@ extern int PQCLEAN_MAYO1_AVX2_crypto_sign_keypair_from_fseed(uint8_t *pk, uint8_
 extern int PQCLEAN_MAYO1_AVX2_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqmayo_MAYO_1_avx2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int pqmayo_MAYO_1_avx2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int pqmayo_MAYO_1_avx2_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int pqmayo_MAYO_1_avx2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int pqmayo_MAYO_1_avx2_crypto_sign_expand_pubkey(uint8_t *epk, const uint8_t *pk);
+extern int pqmayo_MAYO_1_avx2_crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *epk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_mayo_1_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -142,4 +178,186 @@ OQS_API OQS_STATUS OQS_SIG_mayo_1_verify_with_ctx_str(const uint8_t *message, si
 		return OQS_ERROR;
 	}
 }
+
+OQS_API OQS_STATUS OQS_SIG_mayo_1_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_mayo_1_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_1_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_mayo_1_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_1_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_mayo_1_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_mayo_1_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_mayo_1_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_mayo_1_avx2)
+/* Implementation-specific entry points, bound by OQS_SIG_mayo_1_new once per object. */
+static OQS_STATUS mayo_1_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_MAYO1_AVX2_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS mayo_1_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MAYO1_AVX2_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS mayo_1_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS mayo_1_avx2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_avx2_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS mayo_1_avx2_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+}
+
+static OQS_STATUS mayo_1_avx2_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqmayo_MAYO_1_avx2_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+}
+
+static OQS_STATUS mayo_1_opt_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_opt_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_MAYO1_OPT_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS mayo_1_opt_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MAYO1_OPT_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_opt_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS mayo_1_opt_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS mayo_1_opt_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS mayo_1_opt_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS mayo_1_opt_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_expand_pubkey(prepared_public_key, public_key);
+}
+
+static OQS_STATUS mayo_1_opt_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) pqmayo_MAYO_1_opt_crypto_sign_verify_expanded(signature, signature_len, message, message_len, prepared_public_key);
+}
+
+static void mayo_1_bind_impl(OQS_SIG *sig) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+		sig->keypair = mayo_1_avx2_keypair;
+		sig->keypair_from_fseed = mayo_1_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = mayo_1_avx2_pubkey_from_privkey;
+		sig->sign = mayo_1_avx2_sign;
+		sig->verify = mayo_1_avx2_verify;
+		sig->prepare_secret_key = mayo_1_avx2_prepare_secret_key;
+		sig->sign_prepared = mayo_1_avx2_sign_prepared;
+		sig->prepare_public_key = mayo_1_avx2_prepare_public_key;
+		sig->verify_prepared = mayo_1_avx2_verify_prepared;
+		return;
+	}
+	sig->keypair = mayo_1_opt_keypair;
+	sig->keypair_from_fseed = mayo_1_opt_keypair_from_fseed;
+	sig->pubkey_from_privkey = mayo_1_opt_pubkey_from_privkey;
+	sig->sign = mayo_1_opt_sign;
+	sig->verify = mayo_1_opt_verify;
+	sig->prepare_secret_key = mayo_1_opt_prepare_secret_key;
+	sig->sign_prepared = mayo_1_opt_sign_prepared;
+	sig->prepare_public_key = mayo_1_opt_prepare_public_key;
+	sig->verify_prepared = mayo_1_opt_verify_prepared;
+}
+#endif
+
 #endif
@@ -10,6 +10,23 @@
 #include "symmetric.h"
 #include "fips202.h"
 
+/* Secret key with matrix A expanded and s1, s2, t0 in NTT domain */
+typedef struct {
+  polyvecl mat[K];
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  uint8_t tr[TRBYTES];
+  uint8_t key[SEEDBYTES];
+} expanded_sk;
+
+/* Public key with matrix A expanded and 2^d*t1 in NTT domain */
+typedef struct {
+  polyvecl mat[K];
+  polyveck t1;
+  uint8_t tr[TRBYTES];
+} expanded_pk;
+
 static inline void polyvec_matrix_expand_row(polyvecl **row, polyvecl buf[2], const uint8_t rho[SEEDBYTES], unsigned int i) {
   switch(i) {
     case 0:
@@ -137,32 +154,75 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature_internal
+* Name:        compute_mu
 *
-* Description: Computes signature. Internal API.
+* Description: Computes message representative mu = CRH(tr, pre, msg).
+*
+* Arguments:   - uint8_t *mu: pointer to output mu (of length CRHBYTES)
+*              - const uint8_t *tr: pointer to public key hash
+*              - const uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+**************************************************/
+static void compute_mu(uint8_t mu[CRHBYTES], const uint8_t tr[TRBYTES], const uint8_t *pre, size_t prelen,
+                       const uint8_t *m, size_t mlen)
+{
+  shake256incctx state;
+
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, tr, TRBYTES);
+  shake256_inc_absorb(&state, pre, prelen);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+}
+
+/*************************************************
+* Name:        expand_sk
+*
+* Description: Unpacks secret key, expands matrix A and
+*              transforms s1, s2 and t0 to NTT domain.
+*
+* Arguments:   - expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk: pointer to bit-packed secret key
+**************************************************/
+static void expand_sk(expanded_sk *esk, const uint8_t *sk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_sk(rho, esk->tr, esk->key, &esk->t0, &esk->s1, &esk->s2, sk);
+  polyvec_matrix_expand(esk->mat, rho);
+  polyvecl_ntt(&esk->s1);
+  polyveck_ntt(&esk->s2);
+  polyveck_ntt(&esk->t0);
+}
+
+/*************************************************
+* Name:        signature_mu_internal
+*
+* Description: Computes signature of message representative mu
+*              with expanded secret key.
 *
 * Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m: pointer to message to be signed
-*              - size_t mlen: length of message
-*              - uint8_t *pre: pointer to prefix string
-*              - size_t prelen: length of prefix string
+*              - uint8_t *mu: pointer to message representative (of length CRHBYTES)
 *              - uint8_t *rnd: pointer to random seed
-*              - uint8_t *sk: pointer to bit-packed secret key
+*              - const expanded_sk *esk: pointer to expanded secret key
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
-                                   const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES], const uint8_t *sk)
+static int signature_mu_internal(uint8_t *sig, size_t *siglen, const uint8_t mu[CRHBYTES],
+                                 const uint8_t rnd[RNDBYTES], const expanded_sk *esk)
 {
   unsigned int i, n, pos;
-  uint8_t seedbuf[2*SEEDBYTES + TRBYTES + 2*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
+  uint8_t rhoprime[CRHBYTES];
   uint8_t hintbuf[N];
   uint8_t *hint = sig + CTILDEBYTES + L*POLYZ_PACKEDBYTES;
   uint64_t nonce = 0;
-  polyvecl mat[K], s1, z;
-  polyveck t0, s2, w1;
+  polyvecl z;
+  polyveck w1;
   poly c, tmp;
   union {
     polyvecl y;
@@ -170,35 +230,14 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *
   } tmpv;
   shake256incctx state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + TRBYTES;
-  mu = key + SEEDBYTES;
-  rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
-
-  /* Compute mu = CRH(tr, pre, msg) */
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, TRBYTES);
-  shake256_inc_absorb(&state, pre, prelen);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-
   /* Compute rhoprime = CRH(key, rnd, mu) */
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, key, SEEDBYTES);
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, esk->key, SEEDBYTES);
   shake256_inc_absorb(&state, rnd, RNDBYTES);
   shake256_inc_absorb(&state, mu, CRHBYTES);
   shake256_inc_finalize(&state);
   shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
 rej:
   /* Sample intermediate vector y */
 #if L == 4
@@ -223,7 +262,7 @@ rej:
   /* Matrix-vector product */
   tmpv.y = z;
   polyvecl_ntt(&tmpv.y);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &tmpv.y);
+  polyvec_matrix_pointwise_montgomery(&w1, esk->mat, &tmpv.y);
   polyveck_invntt_tomont(&w1);
 
   /* Decompose w and call the random oracle */
@@ -241,7 +280,7 @@ rej:
 
   /* Compute z, reject if it reveals secret */
   for(i = 0; i < L; i++) {
-    poly_pointwise_montgomery(&tmp, &c, &s1.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->s1.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_add(&z.vec[i], &z.vec[i], &tmp);
     poly_reduce(&z.vec[i]);
@@ -256,7 +295,7 @@ rej:
   for(i = 0; i < K; i++) {
     /* Check that subtracting cs2 does not change high bits of w and low bits
      * do not reveal secret information */
-    poly_pointwise_montgomery(&tmp, &c, &s2.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->s2.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_sub(&tmpv.w0.vec[i], &tmpv.w0.vec[i], &tmp);
     poly_reduce(&tmpv.w0.vec[i]);
@@ -264,7 +303,7 @@ rej:
       goto rej;
 
     /* Compute hints */
-    poly_pointwise_montgomery(&tmp, &c, &t0.vec[i]);
+    poly_pointwise_montgomery(&tmp, &c, &esk->t0.vec[i]);
     poly_invntt_tomont(&tmp);
     poly_reduce(&tmp);
     if(poly_chknorm(&tmp, GAMMA2))
@@ -289,6 +328,58 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        signature_expanded_internal
+*
+* Description: Computes signature with expanded secret key.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - uint8_t *rnd: pointer to random seed
+*              - const expanded_sk *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+static int signature_expanded_internal(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                                       const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES],
+                                       const expanded_sk *esk)
+{
+  uint8_t mu[CRHBYTES];
+
+  compute_mu(mu, esk->tr, pre, prelen, m, mlen);
+  return signature_mu_internal(sig, siglen, mu, rnd, esk);
+}
+
+
+/*************************************************
+* Name:        crypto_sign_signature_internal
+*
+* Description: Computes signature. Internal API.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m: pointer to message to be signed
+*              - size_t mlen: length of message
+*              - uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - uint8_t *rnd: pointer to random seed
+*              - uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen, const uint8_t rnd[RNDBYTES], const uint8_t *sk)
+{
+  expanded_sk esk;
+
+  expand_sk(&esk, sk);
+  return signature_expanded_internal(sig, siglen, m, mlen, pre, prelen, rnd, &esk);
+}
+
 /*************************************************
 * Name:        crypto_sign_signature
 *
@@ -360,26 +451,46 @@ int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen, const
 }
 
 /*************************************************
-* Name:        crypto_sign_verify_internal
+* Name:        expand_pk
 *
-* Description: Verifies signature. Internal API.
+* Description: Unpacks public key, expands matrix A, transforms
+*              2^d*t1 to NTT domain and computes tr = H(rho, t1).
+*
+* Arguments:   - expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to bit-packed public key
+**************************************************/
+static void expand_pk(expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_pk(rho, &epk->t1, pk);
+  polyvec_matrix_expand(epk->mat, rho);
+  polyveck_shiftl(&epk->t1);
+  polyveck_ntt(&epk->t1);
+  shake256(epk->tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+}
+
+/*************************************************
+* Name:        verify_core
+*
+* Description: Verifies signature of message representative mu given
+*              either the bit-packed public key, whose matrix rows are
+*              expanded on the fly, or an expanded public key.
 *
 * Arguments:   - uint8_t *m: pointer to input signature
 *              - size_t siglen: length of signature
-*              - const uint8_t *m: pointer to message
-*              - size_t mlen: length of message
-*              - const uint8_t *pre: pointer to prefix string
-*              - size_t prelen: length of prefix string
-*              - const uint8_t *pk: pointer to bit-packed public key
+*              - const uint8_t *mu: pointer to message representative
+*              - const uint8_t *pk: pointer to bit-packed public key or NULL
+*              - const expanded_pk *epk: pointer to expanded public key or NULL
 *
 * Returns 0 if signature could be verified correctly and -1 otherwise
 **************************************************/
-int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,
-                                const uint8_t *pre, size_t prelen, const uint8_t *pk) {
+static int verify_core(const uint8_t *sig, size_t siglen, const uint8_t mu[CRHBYTES],
+                       const uint8_t *pk, const expanded_pk *epk)
+{
   unsigned int i, j, pos = 0;
   /* polyw1_pack writes additional 14 bytes */
   ALIGNED_UINT8(K*POLYW1_PACKEDBYTES+14) buf;
-  uint8_t mu[CRHBYTES];
   const uint8_t *hint = sig + CTILDEBYTES + L*POLYZ_PACKEDBYTES;
   polyvecl rowbuf[2];
   polyvecl *row = rowbuf;
@@ -390,15 +501,6 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t
   if(siglen != CRYPTO_BYTES)
     return -1;
 
-  /* Compute CRH(H(rho, t1), pre, msg) */
-  shake256(mu, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, mu, CRHBYTES);
-  shake256_inc_absorb(&state, pre, prelen);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-
   /* Expand challenge */
   poly_challenge(&c, sig);
   poly_ntt(&c);
@@ -410,16 +512,23 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t
   }
 
   for(i = 0; i < K; i++) {
-    /* Expand matrix row */
-    polyvec_matrix_expand_row(&row, rowbuf, pk, i);
+    if(epk) {
+      /* Compute i-th row of Az - c2^Dt1 from expanded public key */
+      polyvecl_pointwise_acc_montgomery(&w1, &epk->mat[i], &z);
+      poly_pointwise_montgomery(&h, &c, &epk->t1.vec[i]);
+    }
+    else {
+      /* Expand matrix row */
+      polyvec_matrix_expand_row(&row, rowbuf, pk, i);
 
-    /* Compute i-th row of Az - c2^Dt1 */
-    polyvecl_pointwise_acc_montgomery(&w1, row, &z);
+      /* Compute i-th row of Az - c2^Dt1 */
+      polyvecl_pointwise_acc_montgomery(&w1, row, &z);
 
-    polyt1_unpack(&h, pk + SEEDBYTES + i*POLYT1_PACKEDBYTES);
-    poly_shiftl(&h);
-    poly_ntt(&h);
-    poly_pointwise_montgomery(&h, &c, &h);
+      polyt1_unpack(&h, pk + SEEDBYTES + i*POLYT1_PACKEDBYTES);
+      poly_shiftl(&h);
+      poly_ntt(&h);
+      poly_pointwise_montgomery(&h, &c, &h);
+    }
 
     poly_sub(&w1, &w1, &h);
     poly_reduce(&w1);
@@ -427,17 +536,13 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t
 
     /* Get hint polynomial and reconstruct w1 */
     memset(h.vec, 0, sizeof(poly));
-    if(hint[OMEGA + i] < pos || hint[OMEGA + i] > OMEGA) {
-      shake256_inc_ctx_release(&state);
+    if(hint[OMEGA + i] < pos || hint[OMEGA + i] > OMEGA)
       return -1;
-    }
 
     for(j = pos; j < hint[OMEGA + i]; ++j) {
       /* Coefficients are ordered for strong unforgeability */
-      if(j > pos && hint[j] <= hint[j-1]) {
-        shake256_inc_ctx_release(&state);
+      if(j > pos && hint[j] <= hint[j-1])
         return -1;
-      }
       h.coeffs[hint[j]] = 1;
     }
     pos = hint[OMEGA + i];
@@ -449,13 +554,11 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t
 
   /* Extra indices are zero for strong unforgeability */
   for(j = pos; j < OMEGA; ++j)
-    if(hint[j]) {
-      shake256_inc_ctx_release(&state);
+    if(hint[j])
       return -1;
-    }
 
   /* Call random oracle and verify challenge */
-  shake256_inc_ctx_reset(&state);
+  shake256_inc_init(&state);
   shake256_inc_absorb(&state, mu, CRHBYTES);
   shake256_inc_absorb(&state, buf.coeffs, K*POLYW1_PACKEDBYTES);
   shake256_inc_finalize(&state);
@@ -468,6 +571,32 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t
   return 0;
 }
 
+
+/*************************************************
+* Name:        crypto_sign_verify_internal
+*
+* Description: Verifies signature. Internal API.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,
+                                const uint8_t *pre, size_t prelen, const uint8_t *pk) {
+  uint8_t tr[TRBYTES];
+  uint8_t mu[CRHBYTES];
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  compute_mu(mu, tr, pre, prelen, m, mlen);
+  return verify_core(sig, siglen, mu, pk, NULL);
+}
+
 /*************************************************
 * Name:        crypto_sign_verify
 *
@@ -538,3 +667,386 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+* Name:        crypto_sign_expand_sk
+*
+* Description: Expands secret key for use with
+*              crypto_sign_signature_expanded.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (allocated array of CRYPTO_EXPANDEDSKBYTES bytes,
+*                              aligned to 32 bytes)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk)
+{
+  expand_sk((expanded_sk *)esk, sk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_expanded
+*
+* Description: Computes signature with expanded secret key.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *ctx:   pointer to contex string
+*              - size_t ctxlen:  length of contex string
+*              - uint8_t *esk:   pointer to expanded secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen, const uint8_t *esk)
+{
+  uint8_t pre[257];
+  uint8_t rnd[RNDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  /* Prepare pre = (0, ctxlen, ctx) */
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  memcpy(&pre[2], ctx, ctxlen);
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  memset(rnd, 0, RNDBYTES);
+#endif
+
+  signature_expanded_internal(sig,siglen,m,mlen,pre,2+ctxlen,rnd,(const expanded_sk *)esk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_expand_pk
+*
+* Description: Expands public key for use with
+*              crypto_sign_verify_expanded.
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*                              (allocated array of CRYPTO_EXPANDEDPKBYTES bytes,
+*                              aligned to 32 bytes)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk)
+{
+  expand_pk((expanded_pk *)epk, pk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_expanded
+*
+* Description: Verifies signature with expanded public key.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen, const uint8_t *epk)
+{
+  uint8_t pre[257];
+  uint8_t mu[CRHBYTES];
+  const expanded_pk *pk = (const expanded_pk *)epk;
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  memcpy(&pre[2], ctx, ctxlen);
+
+  compute_mu(mu, pk->tr, pre, 2+ctxlen, m, mlen);
+  return verify_core(sig, siglen, mu, NULL, pk);
+}
+
+/*************************************************
+* Name:        mu_init
+*
+* Description: Starts computation of mu = CRH(tr, pre, msg) with
+*              pre = (0, ctxlen, ctx).
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *tr: pointer to public key hash
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+static int mu_init(shake256incctx *state, const uint8_t tr[TRBYTES], const uint8_t *ctx, size_t ctxlen)
+{
+  uint8_t pre[2];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  shake256_inc_init(state);
+  shake256_inc_absorb(state, tr, TRBYTES);
+  shake256_inc_absorb(state, pre, 2);
+  shake256_inc_absorb(state, ctx, ctxlen);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_init
+*
+* Description: Starts incremental signing. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature computed with crypto_sign_signature_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_init(shake256incctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
+{
+  return mu_init(state, sk + 2*SEEDBYTES, ctx, ctxlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_final
+*
+* Description: Computes signature of the message absorbed into state
+*              and releases state.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - shake256incctx *state: pointer to hash state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_final(uint8_t *sig, size_t *siglen, shake256incctx *state, const uint8_t *sk)
+{
+  uint8_t mu[CRHBYTES];
+
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
+  shake256_inc_ctx_release(state);
+
+  return crypto_sign_signature_extmu(sig, siglen, mu, sk);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_init
+*
+* Description: Starts incremental verification. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature checked with crypto_sign_verify_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_verify_init(shake256incctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
+{
+  uint8_t tr[TRBYTES];
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  return mu_init(state, tr, ctx, ctxlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_final
+*
+* Description: Verifies signature of the message absorbed into state
+*              and releases state.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - shake256incctx *state: pointer to hash state
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen, shake256incctx *state, const uint8_t *pk)
+{
+  uint8_t mu[CRHBYTES];
+
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
+  shake256_inc_ctx_release(state);
+
+  return verify_core(sig, siglen, mu, pk, NULL);
+}
+
+/*************************************************
+* Name:        crypto_sign_compute_mu
+*
+* Description: Computes the message representative mu of a message
+*              for use with crypto_sign_signature_extmu and
+*              crypto_sign_verify_extmu. Only needs the public key.
+*
+* Arguments:   - uint8_t *mu: pointer to output mu (of length CRHBYTES)
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_compute_mu(uint8_t mu[CRHBYTES], const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                           const uint8_t *pk)
+{
+  uint8_t pre[257];
+  uint8_t tr[TRBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  memcpy(&pre[2], ctx, ctxlen);
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  compute_mu(mu, tr, pre, 2+ctxlen, m, mlen);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_extmu
+*
+* Description: Computes signature from an externally computed
+*              message representative mu.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen, const uint8_t mu[CRHBYTES], const uint8_t *sk)
+{
+  uint8_t rnd[RNDBYTES];
+  expanded_sk esk;
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  memset(rnd, 0, RNDBYTES);
+#endif
+
+  expand_sk(&esk, sk);
+  return signature_mu_internal(sig, siglen, mu, rnd, &esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_extmu
+*
+* Description: Verifies signature against an externally computed
+*              message representative mu.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen, const uint8_t mu[CRHBYTES], const uint8_t *pk)
+{
+  return verify_core(sig, siglen, mu, pk, NULL);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_prehash
+*
+* Description: Computes HashML-DSA signature of a pre-hashed message.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *ph: pointer to message digest
+*              - size_t phlen: length of message digest
+*              - const uint8_t *oid: pointer to DER-encoded OID of the
+*                                    hash function (of length OIDBYTES)
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_prehash(uint8_t *sig, size_t *siglen, const uint8_t *ph, size_t phlen,
+                                  const uint8_t oid[OIDBYTES], const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
+{
+  uint8_t pre[257 + OIDBYTES];
+  uint8_t rnd[RNDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  /* Prepare pre = (1, ctxlen, ctx, oid) */
+  pre[0] = 1;
+  pre[1] = ctxlen;
+  memcpy(&pre[2], ctx, ctxlen);
+  memcpy(&pre[2 + ctxlen], oid, OIDBYTES);
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  memset(rnd, 0, RNDBYTES);
+#endif
+
+  crypto_sign_signature_internal(sig,siglen,ph,phlen,pre,2+ctxlen+OIDBYTES,rnd,sk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_prehash
+*
+* Description: Verifies HashML-DSA signature of a pre-hashed message.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *ph: pointer to message digest
+*              - size_t phlen: length of message digest
+*              - const uint8_t *oid: pointer to DER-encoded OID of the
+*                                    hash function (of length OIDBYTES)
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_prehash(const uint8_t *sig, size_t siglen, const uint8_t *ph, size_t phlen,
+                               const uint8_t oid[OIDBYTES], const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
+{
+  uint8_t pre[257 + OIDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 1;
+  pre[1] = ctxlen;
+  memcpy(&pre[2], ctx, ctxlen);
+  memcpy(&pre[2 + ctxlen], oid, OIDBYTES);
+
+  return crypto_sign_verify_internal(sig,siglen,ph,phlen,pre,2+ctxlen+OIDBYTES,pk);
+}
@@ -7,6 +7,7 @@
 #define CRHBYTES 64
 #define TRBYTES 64
 #define RNDBYTES 32
+#define OIDBYTES 11
 #define N 256
 #define Q 8380417
 #define D 13
@@ -77,4 +78,11 @@
                                + K*POLYT0_PACKEDBYTES)
 #define CRYPTO_BYTES (CTILDEBYTES + L*POLYZ_PACKEDBYTES + POLYVECH_PACKEDBYTES)
 
+/* Sizes of the in-memory expanded keys; every poly holds N 32-bit coefficients */
+#define POLY_UNPACKEDBYTES (4*N)
+#define CRYPTO_EXPANDEDSKBYTES ((K*L + L + 2*K)*POLY_UNPACKEDBYTES \
+                                + TRBYTES \
+                                + SEEDBYTES)
+#define CRYPTO_EXPANDEDPKBYTES ((K*L + K)*POLY_UNPACKEDBYTES + TRBYTES)
+
 #endif
@@ -8,6 +8,7 @@
 #include "params.h"
 #include "polyvec.h"
 #include "poly.h"
+#include "fips202.h"
 
 #define crypto_sign_keypair DILITHIUM_NAMESPACE(keypair)
 int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
@@ -49,6 +50,74 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk);
 
+#define crypto_sign_expand_sk DILITHIUM_NAMESPACE(expand_sk)
+int crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded DILITHIUM_NAMESPACE(signature_expanded)
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const uint8_t *esk);
+
+#define crypto_sign_expand_pk DILITHIUM_NAMESPACE(expand_pk)
+int crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+#define crypto_sign_verify_expanded DILITHIUM_NAMESPACE(verify_expanded)
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const uint8_t *epk);
+
+#define crypto_sign_signature_init DILITHIUM_NAMESPACE(signature_init)
+int crypto_sign_signature_init(shake256incctx *state,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t *sk);
+
+#define crypto_sign_signature_final DILITHIUM_NAMESPACE(signature_final)
+int crypto_sign_signature_final(uint8_t *sig, size_t *siglen,
+                                shake256incctx *state,
+                                const uint8_t *sk);
+
+#define crypto_sign_verify_init DILITHIUM_NAMESPACE(verify_init)
+int crypto_sign_verify_init(shake256incctx *state,
+                            const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk);
+
+#define crypto_sign_verify_final DILITHIUM_NAMESPACE(verify_final)
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+                             shake256incctx *state,
+                             const uint8_t *pk);
+
+#define crypto_sign_compute_mu DILITHIUM_NAMESPACE(compute_mu)
+int crypto_sign_compute_mu(uint8_t mu[CRHBYTES],
+                           const uint8_t *m, size_t mlen,
+                           const uint8_t *ctx, size_t ctxlen,
+                           const uint8_t *pk);
+
+#define crypto_sign_signature_extmu DILITHIUM_NAMESPACE(signature_extmu)
+int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
+                                const uint8_t mu[CRHBYTES],
+                                const uint8_t *sk);
+
+#define crypto_sign_verify_extmu DILITHIUM_NAMESPACE(verify_extmu)
+int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
+                             const uint8_t mu[CRHBYTES],
+                             const uint8_t *pk);
+
+#define crypto_sign_signature_prehash DILITHIUM_NAMESPACE(signature_prehash)
+int crypto_sign_signature_prehash(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *ph, size_t phlen,
+                                  const uint8_t oid[OIDBYTES],
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *sk);
+
+#define crypto_sign_verify_prehash DILITHIUM_NAMESPACE(verify_prehash)
+int crypto_sign_verify_prehash(const uint8_t *sig, size_t siglen,
+                               const uint8_t *ph, size_t phlen,
+                               const uint8_t oid[OIDBYTES],
+                               const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t *pk);
+
 #define crypto_sign_open DILITHIUM_NAMESPACE(open)
 int crypto_sign_open(uint8_t *m, size_t *mlen,
                      const uint8_t *sm, size_t smlen,
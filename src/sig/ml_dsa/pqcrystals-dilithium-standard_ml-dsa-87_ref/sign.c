@@ -8,6 +8,23 @@
 #include "symmetric.h"
 #include "fips202.h"
 
+/* Secret key with matrix A expanded and s1, s2, t0 in NTT domain */
+typedef struct {
+  polyvecl mat[K];
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  uint8_t tr[TRBYTES];
+  uint8_t key[SEEDBYTES];
+} expanded_sk;
+
+/* Public key with matrix A expanded and 2^d*t1 in NTT domain */
+typedef struct {
+  polyvecl mat[K];
+  polyveck t1;
+  uint8_t tr[TRBYTES];
+} expanded_pk;
+
 /*************************************************
 * Name:        crypto_sign_keypair
 *
@@ -67,68 +84,91 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
 }
 
 /*************************************************
-* Name:        crypto_sign_signature_internal
+* Name:        compute_mu
 *
-* Description: Computes signature. Internal API.
+* Description: Computes message representative mu = CRH(tr, pre, msg).
+*
+* Arguments:   - uint8_t *mu: pointer to output mu (of length CRHBYTES)
+*              - const uint8_t *tr: pointer to public key hash
+*              - const uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+**************************************************/
+static void compute_mu(uint8_t mu[CRHBYTES],
+                       const uint8_t tr[TRBYTES],
+                       const uint8_t *pre,
+                       size_t prelen,
+                       const uint8_t *m,
+                       size_t mlen)
+{
+  shake256incctx state;
+
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, tr, TRBYTES);
+  shake256_inc_absorb(&state, pre, prelen);
+  shake256_inc_absorb(&state, m, mlen);
+  shake256_inc_finalize(&state);
+  shake256_inc_squeeze(mu, CRHBYTES, &state);
+  shake256_inc_ctx_release(&state);
+}
+
+/*************************************************
+* Name:        expand_sk
+*
+* Description: Unpacks secret key, expands matrix A and
+*              transforms s1, s2 and t0 to NTT domain.
+*
+* Arguments:   - expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk: pointer to bit-packed secret key
+**************************************************/
+static void expand_sk(expanded_sk *esk, const uint8_t *sk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_sk(rho, esk->tr, esk->key, &esk->t0, &esk->s1, &esk->s2, sk);
+  polyvec_matrix_expand(esk->mat, rho);
+  polyvecl_ntt(&esk->s1);
+  polyveck_ntt(&esk->s2);
+  polyveck_ntt(&esk->t0);
+}
+
+/*************************************************
+* Name:        signature_mu_internal
+*
+* Description: Computes signature of message representative mu
+*              with expanded secret key.
 *
 * Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
 *              - size_t *siglen: pointer to output length of signature
-*              - uint8_t *m:     pointer to message to be signed
-*              - size_t mlen:    length of message
-*              - uint8_t *pre:   pointer to prefix string
-*              - size_t prelen:  length of prefix string
+*              - uint8_t *mu:    pointer to message representative (of length CRHBYTES)
 *              - uint8_t *rnd:   pointer to random seed
-*              - uint8_t *sk:    pointer to bit-packed secret key
+*              - const expanded_sk *esk: pointer to expanded secret key
 *
 * Returns 0 (success)
 **************************************************/
-int crypto_sign_signature_internal(uint8_t *sig,
-                                   size_t *siglen,
-                                   const uint8_t *m,
-                                   size_t mlen,
-                                   const uint8_t *pre,
-                                   size_t prelen,
-                                   const uint8_t rnd[RNDBYTES],
-                                   const uint8_t *sk)
+static int signature_mu_internal(uint8_t *sig,
+                                 size_t *siglen,
+                                 const uint8_t mu[CRHBYTES],
+                                 const uint8_t rnd[RNDBYTES],
+                                 const expanded_sk *esk)
 {
   unsigned int n;
-  uint8_t seedbuf[2*SEEDBYTES + TRBYTES + 2*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
+  uint8_t rhoprime[CRHBYTES];
   uint16_t nonce = 0;
-  polyvecl mat[K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
+  polyvecl y, z;
+  polyveck w1, w0, h;
   poly cp;
   shake256incctx state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + TRBYTES;
-  mu = key + SEEDBYTES;
-  rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
-
-  /* Compute mu = CRH(tr, pre, msg) */
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, tr, TRBYTES);
-  shake256_inc_absorb(&state, pre, prelen);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-
   /* Compute rhoprime = CRH(key, rnd, mu) */
-  shake256_inc_ctx_reset(&state);
-  shake256_inc_absorb(&state, key, SEEDBYTES);
+  shake256_inc_init(&state);
+  shake256_inc_absorb(&state, esk->key, SEEDBYTES);
   shake256_inc_absorb(&state, rnd, RNDBYTES);
   shake256_inc_absorb(&state, mu, CRHBYTES);
   shake256_inc_finalize(&state);
   shake256_inc_squeeze(rhoprime, CRHBYTES, &state);
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
 rej:
   /* Sample intermediate vector y */
   polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
@@ -136,7 +176,7 @@ rej:
   /* Matrix-vector multiplication */
   z = y;
   polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvec_matrix_pointwise_montgomery(&w1, esk->mat, &z);
   polyveck_reduce(&w1);
   polyveck_invntt_tomont(&w1);
 
@@ -154,7 +194,7 @@ rej:
   poly_ntt(&cp);
 
   /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
+  polyvecl_pointwise_poly_montgomery(&z, &cp, &esk->s1);
   polyvecl_invntt_tomont(&z);
   polyvecl_add(&z, &z, &y);
   polyvecl_reduce(&z);
@@ -163,7 +203,7 @@ rej:
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &esk->s2);
   polyveck_invntt_tomont(&h);
   polyveck_sub(&w0, &w0, &h);
   polyveck_reduce(&w0);
@@ -171,7 +211,7 @@ rej:
     goto rej;
 
   /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &esk->t0);
   polyveck_invntt_tomont(&h);
   polyveck_reduce(&h);
   if(polyveck_chknorm(&h, GAMMA2))
@@ -190,6 +230,69 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        signature_expanded_internal
+*
+* Description: Computes signature with expanded secret key.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *pre:   pointer to prefix string
+*              - size_t prelen:  length of prefix string
+*              - uint8_t *rnd:   pointer to random seed
+*              - const expanded_sk *esk: pointer to expanded secret key
+*
+* Returns 0 (success)
+**************************************************/
+static int signature_expanded_internal(uint8_t *sig,
+                                       size_t *siglen,
+                                       const uint8_t *m,
+                                       size_t mlen,
+                                       const uint8_t *pre,
+                                       size_t prelen,
+                                       const uint8_t rnd[RNDBYTES],
+                                       const expanded_sk *esk)
+{
+  uint8_t mu[CRHBYTES];
+
+  compute_mu(mu, esk->tr, pre, prelen, m, mlen);
+  return signature_mu_internal(sig, siglen, mu, rnd, esk);
+}
+
+
+/*************************************************
+* Name:        crypto_sign_signature_internal
+*
+* Description: Computes signature. Internal API.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *pre:   pointer to prefix string
+*              - size_t prelen:  length of prefix string
+*              - uint8_t *rnd:   pointer to random seed
+*              - uint8_t *sk:    pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_internal(uint8_t *sig,
+                                   size_t *siglen,
+                                   const uint8_t *m,
+                                   size_t mlen,
+                                   const uint8_t *pre,
+                                   size_t prelen,
+                                   const uint8_t rnd[RNDBYTES],
+                                   const uint8_t *sk)
+{
+  expanded_sk esk;
+
+  expand_sk(&esk, sk);
+  return signature_expanded_internal(sig, siglen, m, mlen, pre, prelen, rnd, &esk);
+}
+
 /*************************************************
 * Name:        crypto_sign_signature
 *
@@ -274,68 +377,68 @@ int crypto_sign(uint8_t *sm,
 }
 
 /*************************************************
-* Name:        crypto_sign_verify_internal
+* Name:        expand_pk
 *
-* Description: Verifies signature. Internal API.
+* Description: Unpacks public key, expands matrix A, transforms
+*              2^d*t1 to NTT domain and computes tr = H(rho, t1).
+*
+* Arguments:   - expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk: pointer to bit-packed public key
+**************************************************/
+static void expand_pk(expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_pk(rho, &epk->t1, pk);
+  polyvec_matrix_expand(epk->mat, rho);
+  polyveck_shiftl(&epk->t1);
+  polyveck_ntt(&epk->t1);
+  shake256(epk->tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+}
+
+/*************************************************
+* Name:        verify_mu_internal
+*
+* Description: Verifies signature of message representative mu
+*              with expanded public key.
 *
 * Arguments:   - uint8_t *m: pointer to input signature
 *              - size_t siglen: length of signature
-*              - const uint8_t *m: pointer to message
-*              - size_t mlen: length of message
-*              - const uint8_t *pre: pointer to prefix string
-*              - size_t prelen: length of prefix string
-*              - const uint8_t *pk: pointer to bit-packed public key
+*              - const uint8_t *mu: pointer to message representative
+*              - const expanded_pk *epk: pointer to expanded public key
 *
 * Returns 0 if signature could be verified correctly and -1 otherwise
 **************************************************/
-int crypto_sign_verify_internal(const uint8_t *sig,
-                                size_t siglen,
-                                const uint8_t *m,
-                                size_t mlen,
-                                const uint8_t *pre,
-                                size_t prelen,
-                                const uint8_t *pk)
+static int verify_mu_internal(const uint8_t *sig,
+                              size_t siglen,
+                              const uint8_t mu[CRHBYTES],
+                              const expanded_pk *epk)
 {
   unsigned int i;
   uint8_t buf[K*POLYW1_PACKEDBYTES];
-  uint8_t rho[SEEDBYTES];
-  uint8_t mu[CRHBYTES];
   uint8_t c[CTILDEBYTES];
   uint8_t c2[CTILDEBYTES];
   poly cp;
-  polyvecl mat[K], z;
+  polyvecl z;
   polyveck t1, w1, h;
   shake256incctx state;
 
   if(siglen != CRYPTO_BYTES)
     return -1;
 
-  unpack_pk(rho, &t1, pk);
   if(unpack_sig(c, &z, &h, sig))
     return -1;
   if(polyvecl_chknorm(&z, GAMMA1 - BETA))
     return -1;
 
-  /* Compute CRH(H(rho, t1), pre, msg) */
-  shake256(mu, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-  shake256_inc_init(&state);
-  shake256_inc_absorb(&state, mu, TRBYTES);
-  shake256_inc_absorb(&state, pre, prelen);
-  shake256_inc_absorb(&state, m, mlen);
-  shake256_inc_finalize(&state);
-  shake256_inc_squeeze(mu, CRHBYTES, &state);
-
   /* Matrix-vector multiplication; compute Az - c2^dt1 */
   poly_challenge(&cp, c);
-  polyvec_matrix_expand(mat, rho);
 
   polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvec_matrix_pointwise_montgomery(&w1, epk->mat, &z);
 
   poly_ntt(&cp);
-  polyveck_shiftl(&t1);
-  polyveck_ntt(&t1);
-  polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
+  polyveck_pointwise_poly_montgomery(&t1, &cp, &epk->t1);
 
   polyveck_sub(&w1, &w1, &t1);
   polyveck_reduce(&w1);
@@ -347,7 +450,7 @@ int crypto_sign_verify_internal(const uint8_t *sig,
   polyveck_pack_w1(buf, &w1);
 
   /* Call random oracle and verify challenge */
-  shake256_inc_ctx_reset(&state);
+  shake256_inc_init(&state);
   shake256_inc_absorb(&state, mu, CRHBYTES);
   shake256_inc_absorb(&state, buf, K*POLYW1_PACKEDBYTES);
   shake256_inc_finalize(&state);
@@ -360,6 +463,68 @@ int crypto_sign_verify_internal(const uint8_t *sig,
   return 0;
 }
 
+/*************************************************
+* Name:        verify_expanded_internal
+*
+* Description: Verifies signature with expanded public key.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - const expanded_pk *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_expanded_internal(const uint8_t *sig,
+                                    size_t siglen,
+                                    const uint8_t *m,
+                                    size_t mlen,
+                                    const uint8_t *pre,
+                                    size_t prelen,
+                                    const expanded_pk *epk)
+{
+  uint8_t mu[CRHBYTES];
+
+  compute_mu(mu, epk->tr, pre, prelen, m, mlen);
+  return verify_mu_internal(sig, siglen, mu, epk);
+}
+
+
+/*************************************************
+* Name:        crypto_sign_verify_internal
+*
+* Description: Verifies signature. Internal API.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *pre: pointer to prefix string
+*              - size_t prelen: length of prefix string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_internal(const uint8_t *sig,
+                                size_t siglen,
+                                const uint8_t *m,
+                                size_t mlen,
+                                const uint8_t *pre,
+                                size_t prelen,
+                                const uint8_t *pk)
+{
+  expanded_pk epk;
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  expand_pk(&epk, pk);
+  return verify_expanded_internal(sig, siglen, m, mlen, pre, prelen, &epk);
+}
+
 /*************************************************
 * Name:        crypto_sign_verify
 *
@@ -444,3 +609,457 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+* Name:        crypto_sign_expand_sk
+*
+* Description: Expands secret key for use with
+*              crypto_sign_signature_expanded.
+*
+* Arguments:   - uint8_t *esk: pointer to output expanded secret key
+*                              (allocated array of CRYPTO_EXPANDEDSKBYTES bytes,
+*                              aligned to 32 bytes)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk)
+{
+  expand_sk((expanded_sk *)esk, sk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_expanded
+*
+* Description: Computes signature with expanded secret key.
+*
+* Arguments:   - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*              - uint8_t *ctx:   pointer to contex string
+*              - size_t ctxlen:  length of contex string
+*              - uint8_t *esk:   pointer to expanded secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig,
+                                   size_t *siglen,
+                                   const uint8_t *m,
+                                   size_t mlen,
+                                   const uint8_t *ctx,
+                                   size_t ctxlen,
+                                   const uint8_t *esk)
+{
+  size_t i;
+  uint8_t pre[257];
+  uint8_t rnd[RNDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  /* Prepare pre = (0, ctxlen, ctx) */
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for(i = 0; i < ctxlen; i++)
+    pre[2 + i] = ctx[i];
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  for(i=0;i<RNDBYTES;i++)
+    rnd[i] = 0;
+#endif
+
+  signature_expanded_internal(sig,siglen,m,mlen,pre,2+ctxlen,rnd,(const expanded_sk *)esk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_expand_pk
+*
+* Description: Expands public key for use with
+*              crypto_sign_verify_expanded.
+*
+* Arguments:   - uint8_t *epk: pointer to output expanded public key
+*                              (allocated array of CRYPTO_EXPANDEDPKBYTES bytes,
+*                              aligned to 32 bytes)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk)
+{
+  expand_pk((expanded_pk *)epk, pk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_expanded
+*
+* Description: Verifies signature with expanded public key.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *epk: pointer to expanded public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig,
+                                size_t siglen,
+                                const uint8_t *m,
+                                size_t mlen,
+                                const uint8_t *ctx,
+                                size_t ctxlen,
+                                const uint8_t *epk)
+{
+  size_t i;
+  uint8_t pre[257];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for(i = 0; i < ctxlen; i++)
+    pre[2 + i] = ctx[i];
+
+  return verify_expanded_internal(sig,siglen,m,mlen,pre,2+ctxlen,(const expanded_pk *)epk);
+}
+
+/*************************************************
+* Name:        mu_init
+*
+* Description: Starts computation of mu = CRH(tr, pre, msg) with
+*              pre = (0, ctxlen, ctx).
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *tr: pointer to public key hash
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+static int mu_init(shake256incctx *state,
+                   const uint8_t tr[TRBYTES],
+                   const uint8_t *ctx,
+                   size_t ctxlen)
+{
+  uint8_t pre[2];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  shake256_inc_init(state);
+  shake256_inc_absorb(state, tr, TRBYTES);
+  shake256_inc_absorb(state, pre, 2);
+  shake256_inc_absorb(state, ctx, ctxlen);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_init
+*
+* Description: Starts incremental signing. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature computed with crypto_sign_signature_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_init(shake256incctx *state,
+                               const uint8_t *ctx,
+                               size_t ctxlen,
+                               const uint8_t *sk)
+{
+  return mu_init(state, sk + 2*SEEDBYTES, ctx, ctxlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_final
+*
+* Description: Computes signature of the message absorbed into state
+*              and releases state.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - shake256incctx *state: pointer to hash state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_final(uint8_t *sig,
+                                size_t *siglen,
+                                shake256incctx *state,
+                                const uint8_t *sk)
+{
+  uint8_t mu[CRHBYTES];
+
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
+  shake256_inc_ctx_release(state);
+
+  return crypto_sign_signature_extmu(sig, siglen, mu, sk);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_init
+*
+* Description: Starts incremental verification. The message is then
+*              absorbed into state in chunks with shake256_inc_absorb
+*              and the signature checked with crypto_sign_verify_final.
+*
+* Arguments:   - shake256incctx *state: pointer to output hash state
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_verify_init(shake256incctx *state,
+                            const uint8_t *ctx,
+                            size_t ctxlen,
+                            const uint8_t *pk)
+{
+  uint8_t tr[TRBYTES];
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  return mu_init(state, tr, ctx, ctxlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_final
+*
+* Description: Verifies signature of the message absorbed into state
+*              and releases state.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - shake256incctx *state: pointer to hash state
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_final(const uint8_t *sig,
+                             size_t siglen,
+                             shake256incctx *state,
+                             const uint8_t *pk)
+{
+  uint8_t mu[CRHBYTES];
+  expanded_pk epk;
+
+  shake256_inc_finalize(state);
+  shake256_inc_squeeze(mu, CRHBYTES, state);
+  shake256_inc_ctx_release(state);
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  expand_pk(&epk, pk);
+  return verify_mu_internal(sig, siglen, mu, &epk);
+}
+
+/*************************************************
+* Name:        crypto_sign_compute_mu
+*
+* Description: Computes the message representative mu of a message
+*              for use with crypto_sign_signature_extmu and
+*              crypto_sign_verify_extmu. Only needs the public key.
+*
+* Arguments:   - uint8_t *mu: pointer to output mu (of length CRHBYTES)
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_compute_mu(uint8_t mu[CRHBYTES],
+                           const uint8_t *m,
+                           size_t mlen,
+                           const uint8_t *ctx,
+                           size_t ctxlen,
+                           const uint8_t *pk)
+{
+  size_t i;
+  uint8_t pre[257];
+  uint8_t tr[TRBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for(i = 0; i < ctxlen; i++)
+    pre[2 + i] = ctx[i];
+
+  shake256(tr, TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  compute_mu(mu, tr, pre, 2+ctxlen, m, mlen);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_extmu
+*
+* Description: Computes signature from an externally computed
+*              message representative mu.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_extmu(uint8_t *sig,
+                                size_t *siglen,
+                                const uint8_t mu[CRHBYTES],
+                                const uint8_t *sk)
+{
+  uint8_t rnd[RNDBYTES];
+  expanded_sk esk;
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  size_t i;
+  for(i=0;i<RNDBYTES;i++)
+    rnd[i] = 0;
+#endif
+
+  expand_sk(&esk, sk);
+  return signature_mu_internal(sig, siglen, mu, rnd, &esk);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_extmu
+*
+* Description: Verifies signature against an externally computed
+*              message representative mu.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *mu: pointer to mu (of length CRHBYTES)
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_extmu(const uint8_t *sig,
+                             size_t siglen,
+                             const uint8_t mu[CRHBYTES],
+                             const uint8_t *pk)
+{
+  expanded_pk epk;
+
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+
+  expand_pk(&epk, pk);
+  return verify_mu_internal(sig, siglen, mu, &epk);
+}
+
+/*************************************************
+* Name:        crypto_sign_signature_prehash
+*
+* Description: Computes HashML-DSA signature of a pre-hashed message.
+*
+* Arguments:   - uint8_t *sig: pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t *ph: pointer to message digest
+*              - size_t phlen: length of message digest
+*              - const uint8_t *oid: pointer to DER-encoded OID of the
+*                                    hash function (of length OIDBYTES)
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success) or -1 (context string too long)
+**************************************************/
+int crypto_sign_signature_prehash(uint8_t *sig,
+                                  size_t *siglen,
+                                  const uint8_t *ph,
+                                  size_t phlen,
+                                  const uint8_t oid[OIDBYTES],
+                                  const uint8_t *ctx,
+                                  size_t ctxlen,
+                                  const uint8_t *sk)
+{
+  size_t i;
+  uint8_t pre[257 + OIDBYTES];
+  uint8_t rnd[RNDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  /* Prepare pre = (1, ctxlen, ctx, oid) */
+  pre[0] = 1;
+  pre[1] = ctxlen;
+  for(i = 0; i < ctxlen; i++)
+    pre[2 + i] = ctx[i];
+  for(i = 0; i < OIDBYTES; i++)
+    pre[2 + ctxlen + i] = oid[i];
+
+#ifdef DILITHIUM_RANDOMIZED_SIGNING
+  randombytes(rnd, RNDBYTES);
+#else
+  for(i=0;i<RNDBYTES;i++)
+    rnd[i] = 0;
+#endif
+
+  crypto_sign_signature_internal(sig,siglen,ph,phlen,pre,2+ctxlen+OIDBYTES,rnd,sk);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_prehash
+*
+* Description: Verifies HashML-DSA signature of a pre-hashed message.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *ph: pointer to message digest
+*              - size_t phlen: length of message digest
+*              - const uint8_t *oid: pointer to DER-encoded OID of the
+*                                    hash function (of length OIDBYTES)
+*              - const uint8_t *ctx: pointer to context string
+*              - size_t ctxlen: length of context string
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_prehash(const uint8_t *sig,
+                               size_t siglen,
+                               const uint8_t *ph,
+                               size_t phlen,
+                               const uint8_t oid[OIDBYTES],
+                               const uint8_t *ctx,
+                               size_t ctxlen,
+                               const uint8_t *pk)
+{
+  size_t i;
+  uint8_t pre[257 + OIDBYTES];
+
+  if(ctxlen > 255)
+    return -1;
+
+  pre[0] = 1;
+  pre[1] = ctxlen;
+  for(i = 0; i < ctxlen; i++)
+    pre[2 + i] = ctx[i];
+  for(i = 0; i < OIDBYTES; i++)
+    pre[2 + ctxlen + i] = oid[i];
+
+  return crypto_sign_verify_internal(sig,siglen,ph,phlen,pre,2+ctxlen+OIDBYTES,pk);
+}
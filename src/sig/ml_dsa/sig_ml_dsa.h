@@ -9,6 +9,9 @@
 #define OQS_SIG_ml_dsa_44_length_public_key 1312
 #define OQS_SIG_ml_dsa_44_length_secret_key 2560
 #define OQS_SIG_ml_dsa_44_length_signature 2420
+#define OQS_SIG_ml_dsa_44_length_prepared_secret_key 28768
+#define OQS_SIG_ml_dsa_44_length_prepared_public_key 20544
+#define OQS_SIG_ml_dsa_44_length_mu 64
 
 OQS_SIG *OQS_SIG_ml_dsa_44_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -18,12 +21,28 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign(uint8_t *signature, size_t *signature_
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_65)
 #define OQS_SIG_ml_dsa_65_length_public_key 1952
 #define OQS_SIG_ml_dsa_65_length_secret_key 4032
 #define OQS_SIG_ml_dsa_65_length_signature 3309
+#define OQS_SIG_ml_dsa_65_length_prepared_secret_key 48224
+#define OQS_SIG_ml_dsa_65_length_prepared_public_key 36928
+#define OQS_SIG_ml_dsa_65_length_mu 64
 
 OQS_SIG *OQS_SIG_ml_dsa_65_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -33,12 +52,28 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign(uint8_t *signature, size_t *signature_
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_65_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_87)
 #define OQS_SIG_ml_dsa_87_length_public_key 2592
 #define OQS_SIG_ml_dsa_87_length_secret_key 4896
 #define OQS_SIG_ml_dsa_87_length_signature 4627
+#define OQS_SIG_ml_dsa_87_length_prepared_secret_key 80992
+#define OQS_SIG_ml_dsa_87_length_prepared_public_key 65600
+#define OQS_SIG_ml_dsa_87_length_mu 64
 
 OQS_SIG *OQS_SIG_ml_dsa_87_new(void);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -48,6 +83,19 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign(uint8_t *signature, size_t *signature_
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_87_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 #endif
 
 #endif
@@ -3,8 +3,13 @@
 #include <stdlib.h>
 
 #include <oqs/sig_ml_dsa.h>
+#include <oqs/sha3.h>
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_44)
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+static void ml_dsa_44_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_ml_dsa_44_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +34,30 @@ OQS_SIG *OQS_SIG_ml_dsa_44_new(void) {
 	sig->verify = OQS_SIG_ml_dsa_44_verify;
 	sig->sign_with_ctx_str = OQS_SIG_ml_dsa_44_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_ml_dsa_44_verify_with_ctx_str;
+	sig->length_prepared_secret_key = OQS_SIG_ml_dsa_44_length_prepared_secret_key;
+	sig->prepare_secret_key = OQS_SIG_ml_dsa_44_prepare_secret_key;
+	sig->sign_prepared = OQS_SIG_ml_dsa_44_sign_prepared;
+	sig->sign_prepared_threaded = NULL;
+	sig->length_prepared_public_key = OQS_SIG_ml_dsa_44_length_prepared_public_key;
+	sig->prepare_public_key = OQS_SIG_ml_dsa_44_prepare_public_key;
+	sig->verify_prepared = OQS_SIG_ml_dsa_44_verify_prepared;
+	sig->length_stream_state = sizeof(OQS_SHA3_shake256_stack_ctx);
+	sig->sign_init = OQS_SIG_ml_dsa_44_sign_init;
+	sig->sign_final = OQS_SIG_ml_dsa_44_sign_final;
+	sig->verify_init = OQS_SIG_ml_dsa_44_verify_init;
+	sig->verify_final = OQS_SIG_ml_dsa_44_verify_final;
+	sig->stream_update = NULL;
+	sig->stream_release = NULL;
+	sig->length_mu = OQS_SIG_ml_dsa_44_length_mu;
+	sig->compute_mu = OQS_SIG_ml_dsa_44_compute_mu;
+	sig->sign_mu = OQS_SIG_ml_dsa_44_sign_mu;
+	sig->verify_mu = OQS_SIG_ml_dsa_44_verify_mu;
+	sig->sign_prehash = OQS_SIG_ml_dsa_44_sign_prehash;
+	sig->verify_prehash = OQS_SIG_ml_dsa_44_verify_prehash;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+	ml_dsa_44_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -38,6 +67,19 @@ extern int PQCLEAN_MLDSA44_REF_crypto_sign_keypair_from_fseed(uint8_t *pk, uint8
 extern int PQCLEAN_MLDSA44_REF_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_44_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_44_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_ref_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *esk);
+extern int pqcrystals_ml_dsa_44_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *epk);
+extern int pqcrystals_ml_dsa_44_ref_signature_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_ref_signature_final(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_ref_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_compute_mu(uint8_t *mu, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_signature_extmu(uint8_t *sig, size_t *siglen, const uint8_t *mu, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_ref_verify_extmu(const uint8_t *sig, size_t siglen, const uint8_t *mu, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_ref_signature_prehash(uint8_t *sig, size_t *siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_ref_verify_prehash(const uint8_t *sig, size_t siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
 #if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
 extern int pqcrystals_ml_dsa_44_avx2_keypair(uint8_t *pk, uint8_t *sk);
@@ -45,6 +87,19 @@ extern int PQCLEAN_MLDSA44_AVX2_crypto_sign_keypair_from_fseed(uint8_t *pk, uint
 extern int PQCLEAN_MLDSA44_AVX2_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_44_avx2_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 extern int pqcrystals_ml_dsa_44_avx2_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_expand_sk(uint8_t *esk, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_avx2_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *esk);
+extern int pqcrystals_ml_dsa_44_avx2_expand_pk(uint8_t *epk, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_verify_expanded(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *epk);
+extern int pqcrystals_ml_dsa_44_avx2_signature_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_avx2_signature_final(uint8_t *sig, size_t *siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_avx2_verify_init(OQS_SHA3_shake256_stack_ctx *state, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_verify_final(const uint8_t *sig, size_t siglen, OQS_SHA3_shake256_stack_ctx *state, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_compute_mu(uint8_t *mu, const uint8_t *m, size_t mlen, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_signature_extmu(uint8_t *sig, size_t *siglen, const uint8_t *mu, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_avx2_verify_extmu(const uint8_t *sig, size_t siglen, const uint8_t *mu, const uint8_t *pk);
+extern int pqcrystals_ml_dsa_44_avx2_signature_prehash(uint8_t *sig, size_t *siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+extern int pqcrystals_ml_dsa_44_avx2_verify_prehash(const uint8_t *sig, size_t siglen, const uint8_t *ph, size_t phlen, const uint8_t *oid, const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -157,4 +212,428 @@ OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_with_ctx_str(const uint8_t *message,
 	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
 #endif
 }
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_expand_sk(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_sk(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_sk(prepared_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_expand_pk(prepared_public_key, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_pk(prepared_public_key, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_pk(prepared_public_key, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_extmu(signature, signature_len, mu, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_extmu(signature, signature_len, mu, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_extmu(signature, signature_len, mu, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_extmu(signature, signature_len, mu, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_extmu(signature, signature_len, mu, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_extmu(signature, signature_len, mu, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_ml_dsa_44_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, public_key);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_ml_dsa_44_avx2)
+/* Implementation-specific entry points, bound by OQS_SIG_ml_dsa_44_new once per object. */
+static OQS_STATUS ml_dsa_44_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_MLDSA44_AVX2_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MLDSA44_AVX2_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_expand_sk(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_expand_pk(prepared_public_key, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_extmu(signature, signature_len, mu, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_extmu(signature, signature_len, mu, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_signature_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_avx2_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_avx2_verify_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_MLDSA44_REF_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS ml_dsa_44_ref_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_MLDSA44_REF_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature(signature, signature_len, message, message_len, NULL, 0, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify(signature, signature_len, message, message_len, NULL, 0, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify(signature, signature_len, message, message_len, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_sk(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_prepare_public_key(uint8_t *prepared_public_key, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_expand_pk(prepared_public_key, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_prepared(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_expanded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, prepared_public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_init(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_final(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	(void) signature;
+	(void) signature_len;
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_init((OQS_SHA3_shake256_stack_ctx *) state, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_final(signature, signature_len, (OQS_SHA3_shake256_stack_ctx *) state, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_compute_mu(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_mu(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_extmu(signature, signature_len, mu, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_mu(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_extmu(signature, signature_len, mu, public_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_sign_prehash(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_signature_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, secret_key);
+}
+
+static OQS_STATUS ml_dsa_44_ref_verify_prehash(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	return (OQS_STATUS) pqcrystals_ml_dsa_44_ref_verify_prehash(signature, signature_len, digest, digest_len, digest_oid, ctx_str, ctx_str_len, public_key);
+}
+
+static void ml_dsa_44_bind_impl(OQS_SIG *sig) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT)) {
+		sig->keypair = ml_dsa_44_avx2_keypair;
+		sig->keypair_from_fseed = ml_dsa_44_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = ml_dsa_44_avx2_pubkey_from_privkey;
+		sig->sign = ml_dsa_44_avx2_sign;
+		sig->verify = ml_dsa_44_avx2_verify;
+		sig->sign_with_ctx_str = ml_dsa_44_avx2_sign_with_ctx_str;
+		sig->verify_with_ctx_str = ml_dsa_44_avx2_verify_with_ctx_str;
+		sig->prepare_secret_key = ml_dsa_44_avx2_prepare_secret_key;
+		sig->sign_prepared = ml_dsa_44_avx2_sign_prepared;
+		sig->prepare_public_key = ml_dsa_44_avx2_prepare_public_key;
+		sig->verify_prepared = ml_dsa_44_avx2_verify_prepared;
+		sig->sign_init = ml_dsa_44_avx2_sign_init;
+		sig->sign_final = ml_dsa_44_avx2_sign_final;
+		sig->verify_init = ml_dsa_44_avx2_verify_init;
+		sig->verify_final = ml_dsa_44_avx2_verify_final;
+		sig->compute_mu = ml_dsa_44_avx2_compute_mu;
+		sig->sign_mu = ml_dsa_44_avx2_sign_mu;
+		sig->verify_mu = ml_dsa_44_avx2_verify_mu;
+		sig->sign_prehash = ml_dsa_44_avx2_sign_prehash;
+		sig->verify_prehash = ml_dsa_44_avx2_verify_prehash;
+		return;
+	}
+	sig->keypair = ml_dsa_44_ref_keypair;
+	sig->keypair_from_fseed = ml_dsa_44_ref_keypair_from_fseed;
+	sig->pubkey_from_privkey = ml_dsa_44_ref_pubkey_from_privkey;
+	sig->sign = ml_dsa_44_ref_sign;
+	sig->verify = ml_dsa_44_ref_verify;
+	sig->sign_with_ctx_str = ml_dsa_44_ref_sign_with_ctx_str;
+	sig->verify_with_ctx_str = ml_dsa_44_ref_verify_with_ctx_str;
+	sig->prepare_secret_key = ml_dsa_44_ref_prepare_secret_key;
+	sig->sign_prepared = ml_dsa_44_ref_sign_prepared;
+	sig->prepare_public_key = ml_dsa_44_ref_prepare_public_key;
+	sig->verify_prepared = ml_dsa_44_ref_verify_prepared;
+	sig->sign_init = ml_dsa_44_ref_sign_init;
+	sig->sign_final = ml_dsa_44_ref_sign_final;
+	sig->verify_init = ml_dsa_44_ref_verify_init;
+	sig->verify_final = ml_dsa_44_ref_verify_final;
+	sig->compute_mu = ml_dsa_44_ref_compute_mu;
+	sig->sign_mu = ml_dsa_44_ref_sign_mu;
+	sig->verify_mu = ml_dsa_44_ref_verify_mu;
+	sig->sign_prehash = ml_dsa_44_ref_sign_prehash;
+	sig->verify_prehash = ml_dsa_44_ref_verify_prehash;
+}
+#endif
+
 #endif
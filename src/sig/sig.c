@@ -2,8 +2,8 @@
 
 #include <assert.h>
 #include <stdlib.h>
-#if defined(_WIN32)
 #include <string.h>
+#if defined(_WIN32)
 #define strcasecmp _stricmp
 #else
 #include <strings.h>
@@ -11,6 +11,12 @@
 
 #include <oqs/oqs.h>
 
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+#include <oqs/sha2.h>
+#include <oqs/sha3.h>
+
 OQS_API const char *OQS_SIG_alg_identifier(size_t i) {
 	// EDIT-WHEN-ADDING-SIG
 	const char *a[OQS_SIG_algs_length] = {
@@ -71,695 +77,824 @@ OQS_API int OQS_SIG_alg_count(void) {
 	return OQS_SIG_algs_length;
 }
 
-OQS_API int OQS_SIG_alg_is_enabled(const char *method_name) {
-	if (method_name == NULL) {
-		return 0;
-	}
-	if (0) {
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_ENABLED_CASE_START
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_2)) {
+/* Registry of all signature schemes; new_sig is NULL for the ones not enabled at compile time */
+typedef struct {
+	const char *method_name;
+	OQS_SIG *(*new_sig)(void);
+} sig_registry_entry;
+
+static const sig_registry_entry sig_registry[OQS_SIG_algs_length] = {
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_REGISTRY_ENTRY_START
 #ifdef OQS_ENABLE_SIG_dilithium_2
-		return 1;
+	{OQS_SIG_alg_dilithium_2, OQS_SIG_dilithium_2_new},
 #else
-		return 0;
+	{OQS_SIG_alg_dilithium_2, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_3)) {
 #ifdef OQS_ENABLE_SIG_dilithium_3
-		return 1;
+	{OQS_SIG_alg_dilithium_3, OQS_SIG_dilithium_3_new},
 #else
-		return 0;
+	{OQS_SIG_alg_dilithium_3, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_5)) {
 #ifdef OQS_ENABLE_SIG_dilithium_5
-		return 1;
+	{OQS_SIG_alg_dilithium_5, OQS_SIG_dilithium_5_new},
 #else
-		return 0;
+	{OQS_SIG_alg_dilithium_5, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_44)) {
 #ifdef OQS_ENABLE_SIG_ml_dsa_44
-		return 1;
+	{OQS_SIG_alg_ml_dsa_44, OQS_SIG_ml_dsa_44_new},
 #else
-		return 0;
+	{OQS_SIG_alg_ml_dsa_44, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_65)) {
 #ifdef OQS_ENABLE_SIG_ml_dsa_65
-		return 1;
+	{OQS_SIG_alg_ml_dsa_65, OQS_SIG_ml_dsa_65_new},
 #else
-		return 0;
+	{OQS_SIG_alg_ml_dsa_65, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_87)) {
 #ifdef OQS_ENABLE_SIG_ml_dsa_87
-		return 1;
+	{OQS_SIG_alg_ml_dsa_87, OQS_SIG_ml_dsa_87_new},
 #else
-		return 0;
+	{OQS_SIG_alg_ml_dsa_87, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_512)) {
 #ifdef OQS_ENABLE_SIG_falcon_512
-		return 1;
+	{OQS_SIG_alg_falcon_512, OQS_SIG_falcon_512_new},
 #else
-		return 0;
+	{OQS_SIG_alg_falcon_512, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_1024)) {
 #ifdef OQS_ENABLE_SIG_falcon_1024
-		return 1;
+	{OQS_SIG_alg_falcon_1024, OQS_SIG_falcon_1024_new},
 #else
-		return 0;
+	{OQS_SIG_alg_falcon_1024, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_512)) {
 #ifdef OQS_ENABLE_SIG_falcon_padded_512
-		return 1;
+	{OQS_SIG_alg_falcon_padded_512, OQS_SIG_falcon_padded_512_new},
 #else
-		return 0;
+	{OQS_SIG_alg_falcon_padded_512, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_1024)) {
 #ifdef OQS_ENABLE_SIG_falcon_padded_1024
-		return 1;
+	{OQS_SIG_alg_falcon_padded_1024, OQS_SIG_falcon_padded_1024_new},
 #else
-		return 0;
+	{OQS_SIG_alg_falcon_padded_1024, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_128f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_128f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_128f_simple, OQS_SIG_sphincs_sha2_128f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_128f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_128s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_128s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_128s_simple, OQS_SIG_sphincs_sha2_128s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_128s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_192f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_192f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_192f_simple, OQS_SIG_sphincs_sha2_192f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_192f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_192s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_192s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_192s_simple, OQS_SIG_sphincs_sha2_192s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_192s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_256f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_256f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_256f_simple, OQS_SIG_sphincs_sha2_256f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_256f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_256s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_sha2_256s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_sha2_256s_simple, OQS_SIG_sphincs_sha2_256s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_sha2_256s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_128f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_128f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_128f_simple, OQS_SIG_sphincs_shake_128f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_128f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_128s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_128s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_128s_simple, OQS_SIG_sphincs_shake_128s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_128s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_192f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_192f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_192f_simple, OQS_SIG_sphincs_shake_192f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_192f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_192s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_192s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_192s_simple, OQS_SIG_sphincs_shake_192s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_192s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_256f_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_256f_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_256f_simple, OQS_SIG_sphincs_shake_256f_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_256f_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_256s_simple)) {
 #ifdef OQS_ENABLE_SIG_sphincs_shake_256s_simple
-		return 1;
+	{OQS_SIG_alg_sphincs_shake_256s_simple, OQS_SIG_sphincs_shake_256s_simple_new},
 #else
-		return 0;
+	{OQS_SIG_alg_sphincs_shake_256s_simple, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_1)) {
 #ifdef OQS_ENABLE_SIG_mayo_1
-		return 1;
+	{OQS_SIG_alg_mayo_1, OQS_SIG_mayo_1_new},
 #else
-		return 0;
+	{OQS_SIG_alg_mayo_1, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_2)) {
 #ifdef OQS_ENABLE_SIG_mayo_2
-		return 1;
+	{OQS_SIG_alg_mayo_2, OQS_SIG_mayo_2_new},
 #else
-		return 0;
+	{OQS_SIG_alg_mayo_2, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_3)) {
 #ifdef OQS_ENABLE_SIG_mayo_3
-		return 1;
+	{OQS_SIG_alg_mayo_3, OQS_SIG_mayo_3_new},
 #else
-		return 0;
+	{OQS_SIG_alg_mayo_3, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_5)) {
 #ifdef OQS_ENABLE_SIG_mayo_5
-		return 1;
+	{OQS_SIG_alg_mayo_5, OQS_SIG_mayo_5_new},
 #else
-		return 0;
+	{OQS_SIG_alg_mayo_5, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_128_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_128_balanced, OQS_SIG_cross_rsdp_128_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_128_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_128_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_128_fast, OQS_SIG_cross_rsdp_128_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_128_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_128_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_128_small, OQS_SIG_cross_rsdp_128_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_128_small, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_192_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_192_balanced, OQS_SIG_cross_rsdp_192_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_192_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_192_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_192_fast, OQS_SIG_cross_rsdp_192_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_192_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_192_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_192_small, OQS_SIG_cross_rsdp_192_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_192_small, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_256_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_256_balanced, OQS_SIG_cross_rsdp_256_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_256_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_256_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_256_fast, OQS_SIG_cross_rsdp_256_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_256_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdp_256_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdp_256_small, OQS_SIG_cross_rsdp_256_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdp_256_small, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_128_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_128_balanced, OQS_SIG_cross_rsdpg_128_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_128_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_128_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_128_fast, OQS_SIG_cross_rsdpg_128_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_128_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_128_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_128_small, OQS_SIG_cross_rsdpg_128_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_128_small, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_192_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_192_balanced, OQS_SIG_cross_rsdpg_192_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_192_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_192_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_192_fast, OQS_SIG_cross_rsdpg_192_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_192_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_192_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_192_small, OQS_SIG_cross_rsdpg_192_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_192_small, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_balanced)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_256_balanced
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_256_balanced, OQS_SIG_cross_rsdpg_256_balanced_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_256_balanced, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_fast)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_256_fast
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_256_fast, OQS_SIG_cross_rsdpg_256_fast_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_256_fast, NULL},
 #endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_small)) {
 #ifdef OQS_ENABLE_SIG_cross_rsdpg_256_small
-		return 1;
+	{OQS_SIG_alg_cross_rsdpg_256_small, OQS_SIG_cross_rsdpg_256_small_new},
 #else
-		return 0;
+	{OQS_SIG_alg_cross_rsdpg_256_small, NULL},
 #endif
-///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_ENABLED_CASE_END
-	} else {
-		return 0;
+	///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_REGISTRY_ENTRY_END
+	// EDIT-WHEN-ADDING-SIG
+};
+
+/* Built on first use: registry indices in strcasecmp order of the names, and
+ * one shared descriptor per enabled algorithm for OQS_SIG_get */
+static size_t sig_sorted[OQS_SIG_algs_length];
+static OQS_SIG sig_descriptors[OQS_SIG_algs_length];
+static bool sig_descriptor_ok[OQS_SIG_algs_length];
+#if defined(OQS_USE_PTHREADS)
+static pthread_once_t sig_registry_once_control = PTHREAD_ONCE_INIT;
+#else
+static bool sig_registry_init_done = false;
+#endif
+
+static void init_sig_registry(void) {
+	for (size_t i = 0; i < OQS_SIG_algs_length; i++) {
+		size_t j = i;
+		while (j > 0 && strcasecmp(sig_registry[sig_sorted[j - 1]].method_name, sig_registry[i].method_name) > 0) {
+			sig_sorted[j] = sig_sorted[j - 1];
+			j--;
+		}
+		sig_sorted[j] = i;
+
+		if (sig_registry[i].new_sig != NULL) {
+			OQS_SIG *sig = sig_registry[i].new_sig();
+			if (sig != NULL) {
+				sig_descriptors[i] = *sig;
+				sig_descriptor_ok[i] = true;
+				OQS_SIG_free(sig);
+			}
+		}
 	}
+#if !defined(OQS_USE_PTHREADS)
+	sig_registry_init_done = true;
+#endif
 }
 
-OQS_API OQS_SIG *OQS_SIG_new(const char *method_name) {
+/* Returns the registry index of method_name, or -1 if it is not a known algorithm */
+static int find_sig(const char *method_name) {
+	size_t lo = 0, hi = OQS_SIG_algs_length;
+
 	if (method_name == NULL) {
-		return NULL;
+		return -1;
 	}
-	if (0) {
-		///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_NEW_CASE_START
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_2)) {
-#ifdef OQS_ENABLE_SIG_dilithium_2
-		return OQS_SIG_dilithium_2_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_3)) {
-#ifdef OQS_ENABLE_SIG_dilithium_3
-		return OQS_SIG_dilithium_3_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_dilithium_5)) {
-#ifdef OQS_ENABLE_SIG_dilithium_5
-		return OQS_SIG_dilithium_5_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_44)) {
-#ifdef OQS_ENABLE_SIG_ml_dsa_44
-		return OQS_SIG_ml_dsa_44_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_65)) {
-#ifdef OQS_ENABLE_SIG_ml_dsa_65
-		return OQS_SIG_ml_dsa_65_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_ml_dsa_87)) {
-#ifdef OQS_ENABLE_SIG_ml_dsa_87
-		return OQS_SIG_ml_dsa_87_new();
-#else
-		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_512)) {
-#ifdef OQS_ENABLE_SIG_falcon_512
-		return OQS_SIG_falcon_512_new();
+#if defined(OQS_USE_PTHREADS)
+	pthread_once(&sig_registry_once_control, &init_sig_registry);
 #else
-		return NULL;
+	if (!sig_registry_init_done) {
+		init_sig_registry();
+	}
 #endif
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		int c = strcasecmp(method_name, sig_registry[sig_sorted[mid]].method_name);
+		if (c == 0) {
+			return (int)sig_sorted[mid];
+		} else if (c < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return -1;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_1024)) {
-#ifdef OQS_ENABLE_SIG_falcon_1024
-		return OQS_SIG_falcon_1024_new();
-#else
-		return NULL;
-#endif
+OQS_API int OQS_SIG_alg_is_enabled(const char *method_name) {
+	int i = find_sig(method_name);
+	return (i >= 0 && sig_registry[i].new_sig != NULL) ? 1 : 0;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_512)) {
-#ifdef OQS_ENABLE_SIG_falcon_padded_512
-		return OQS_SIG_falcon_padded_512_new();
-#else
+OQS_API OQS_SIG *OQS_SIG_new(const char *method_name) {
+	int i = find_sig(method_name);
+	if (i < 0 || sig_registry[i].new_sig == NULL) {
 		return NULL;
-#endif
+	}
+	return sig_registry[i].new_sig();
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_falcon_padded_1024)) {
-#ifdef OQS_ENABLE_SIG_falcon_padded_1024
-		return OQS_SIG_falcon_padded_1024_new();
-#else
+OQS_API const OQS_SIG *OQS_SIG_get(const char *method_name) {
+	int i = find_sig(method_name);
+	if (i < 0 || !sig_descriptor_ok[i]) {
 		return NULL;
-#endif
+	}
+	return &sig_descriptors[i];
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_128f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_128f_simple
-		return OQS_SIG_sphincs_sha2_128f_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_keypair(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key) {
+	if (sig == NULL || sig->keypair(public_key, secret_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_128s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_128s_simple
-		return OQS_SIG_sphincs_sha2_128s_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_keypair_from_fseed(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	if (sig == NULL || sig->keypair_from_fseed(public_key, secret_key, seed) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_192f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_192f_simple
-		return OQS_SIG_sphincs_sha2_192f_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_pubkey_from_privkey(const OQS_SIG *sig, uint8_t *public_key, const uint8_t *secret_key) {
+	if (sig == NULL || sig->pubkey_from_privkey(public_key, secret_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_192s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_192s_simple
-		return OQS_SIG_sphincs_sha2_192s_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_sign(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	if (sig == NULL || sig->sign(signature, signature_len, message, message_len, secret_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_256f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_256f_simple
-		return OQS_SIG_sphincs_sha2_256f_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_sign_with_ctx_str(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (sig == NULL || sig->sign_with_ctx_str(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_sha2_256s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_sha2_256s_simple
-		return OQS_SIG_sphincs_sha2_256s_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	if (sig == NULL || sig->verify(message, message_len, signature, signature_len, public_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_128f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_128f_simple
-		return OQS_SIG_sphincs_shake_128f_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (sig == NULL || sig->verify_with_ctx_str(message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key) != OQS_SUCCESS) {
+		return OQS_ERROR;
+	} else {
+		return OQS_SUCCESS;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_128s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_128s_simple
-		return OQS_SIG_sphincs_shake_128s_simple_new();
-#else
+struct OQS_SIG_SECRET_KEY {
+	/* The method_name of the OQS_SIG object the key was constructed for. */
+	const char *method_name;
+	/* The length, in bytes, of key_data. */
+	size_t length_key_data;
+	/* The prepared secret key, or a copy of the encoded secret key if the scheme does not support prepared keys. */
+	uint8_t *key_data;
+	/* Whether key_data holds a prepared secret key. */
+	bool prepared;
+	/* The number of threads to sign with, as set by OQS_SIG_SECRET_KEY_set_threads. */
+	unsigned int num_threads;
+};
+
+OQS_API OQS_SIG_SECRET_KEY *OQS_SIG_SECRET_KEY_new(const OQS_SIG *sig, const uint8_t *secret_key) {
+	if (sig == NULL || secret_key == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_192f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_192f_simple
-		return OQS_SIG_sphincs_shake_192f_simple_new();
-#else
+	}
+	OQS_SIG_SECRET_KEY *sk = OQS_MEM_malloc(sizeof(OQS_SIG_SECRET_KEY));
+	if (sk == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_192s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_192s_simple
-		return OQS_SIG_sphincs_shake_192s_simple_new();
-#else
+	}
+	sk->method_name = sig->method_name;
+	sk->prepared = sig->prepare_secret_key != NULL && sig->sign_prepared != NULL;
+	sk->num_threads = 1;
+	sk->length_key_data = (sk->prepared ? sig->length_prepared_secret_key : sig->length_secret_key);
+	/* Rounded up, so that OQS_SIG_SECRET_KEY_free can cleanse the whole allocation */
+	sk->length_key_data = (sk->length_key_data + 31) & ~(size_t)31;
+	sk->key_data = OQS_MEM_aligned_alloc(32, sk->length_key_data);
+	if (sk->key_data == NULL) {
+		OQS_MEM_insecure_free(sk);
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_256f_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_256f_simple
-		return OQS_SIG_sphincs_shake_256f_simple_new();
-#else
+	}
+	if (!sk->prepared) {
+		memcpy(sk->key_data, secret_key, sig->length_secret_key);
+	} else if (sig->prepare_secret_key(sk->key_data, secret_key) != OQS_SUCCESS) {
+		OQS_SIG_SECRET_KEY_free(sk);
 		return NULL;
-#endif
+	}
+	return sk;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_sphincs_shake_256s_simple)) {
-#ifdef OQS_ENABLE_SIG_sphincs_shake_256s_simple
-		return OQS_SIG_sphincs_shake_256s_simple_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_sign_prepared(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_SECRET_KEY *secret_key) {
+	OQS_STATUS rc;
+	if (sig == NULL || secret_key == NULL || strcmp(sig->method_name, secret_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (secret_key->prepared && secret_key->num_threads != 1 && sig->sign_prepared_threaded != NULL) {
+		rc = sig->sign_prepared_threaded(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->num_threads, secret_key->key_data);
+	} else if (secret_key->prepared) {
+		rc = sig->sign_prepared(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->key_data);
+	} else {
+		rc = sig->sign_with_ctx_str(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key->key_data);
+	}
+	return rc == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_1)) {
-#ifdef OQS_ENABLE_SIG_mayo_1
-		return OQS_SIG_mayo_1_new();
-#else
-		return NULL;
-#endif
+OQS_API void OQS_SIG_SECRET_KEY_set_threads(OQS_SIG_SECRET_KEY *secret_key, unsigned int num_threads) {
+	if (secret_key != NULL) {
+		secret_key->num_threads = num_threads;
+	}
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_2)) {
-#ifdef OQS_ENABLE_SIG_mayo_2
-		return OQS_SIG_mayo_2_new();
-#else
-		return NULL;
-#endif
+OQS_API void OQS_SIG_SECRET_KEY_free(OQS_SIG_SECRET_KEY *secret_key) {
+	if (secret_key == NULL) {
+		return;
+	}
+	OQS_MEM_cleanse(secret_key->key_data, secret_key->length_key_data);
+	OQS_MEM_aligned_free(secret_key->key_data);
+	OQS_MEM_insecure_free(secret_key);
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_3)) {
-#ifdef OQS_ENABLE_SIG_mayo_3
-		return OQS_SIG_mayo_3_new();
-#else
-		return NULL;
-#endif
+struct OQS_SIG_PUBLIC_KEY {
+	/* The method_name of the OQS_SIG object the key was constructed for. */
+	const char *method_name;
+	/* The length, in bytes, of key_data. */
+	size_t length_key_data;
+	/* The prepared public key, or a copy of the encoded public key if the scheme does not support prepared keys. */
+	uint8_t *key_data;
+	/* Whether key_data holds a prepared public key. */
+	bool prepared;
+};
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_mayo_5)) {
-#ifdef OQS_ENABLE_SIG_mayo_5
-		return OQS_SIG_mayo_5_new();
-#else
+OQS_API OQS_SIG_PUBLIC_KEY *OQS_SIG_PUBLIC_KEY_new(const OQS_SIG *sig, const uint8_t *public_key) {
+	if (sig == NULL || public_key == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_128_balanced
-		return OQS_SIG_cross_rsdp_128_balanced_new();
-#else
+	}
+	OQS_SIG_PUBLIC_KEY *pk = OQS_MEM_malloc(sizeof(OQS_SIG_PUBLIC_KEY));
+	if (pk == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_128_fast
-		return OQS_SIG_cross_rsdp_128_fast_new();
-#else
+	}
+	pk->method_name = sig->method_name;
+	pk->prepared = sig->prepare_public_key != NULL && sig->verify_prepared != NULL;
+	pk->length_key_data = pk->prepared ? sig->length_prepared_public_key : sig->length_public_key;
+	/* OQS_MEM_aligned_alloc requires the size to be a multiple of the alignment */
+	pk->key_data = OQS_MEM_aligned_alloc(32, (pk->length_key_data + 31) & ~(size_t)31);
+	if (pk->key_data == NULL) {
+		OQS_MEM_insecure_free(pk);
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_128_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_128_small
-		return OQS_SIG_cross_rsdp_128_small_new();
-#else
+	}
+	if (!pk->prepared) {
+		memcpy(pk->key_data, public_key, sig->length_public_key);
+	} else if (sig->prepare_public_key(pk->key_data, public_key) != OQS_SUCCESS) {
+		OQS_SIG_PUBLIC_KEY_free(pk);
 		return NULL;
-#endif
+	}
+	return pk;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_192_balanced
-		return OQS_SIG_cross_rsdp_192_balanced_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_verify_prepared(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_PUBLIC_KEY *public_key) {
+	OQS_STATUS rc;
+	if (sig == NULL || public_key == NULL || strcmp(sig->method_name, public_key->method_name) != 0) {
+		return OQS_ERROR;
+	} else if (public_key->prepared) {
+		rc = sig->verify_prepared(message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key->key_data);
+	} else {
+		rc = sig->verify_with_ctx_str(message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key->key_data);
+	}
+	return rc == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_192_fast
-		return OQS_SIG_cross_rsdp_192_fast_new();
-#else
-		return NULL;
-#endif
+OQS_API void OQS_SIG_PUBLIC_KEY_free(OQS_SIG_PUBLIC_KEY *public_key) {
+	if (public_key == NULL) {
+		return;
+	}
+	OQS_MEM_aligned_free(public_key->key_data);
+	OQS_MEM_insecure_free(public_key);
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_192_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_192_small
-		return OQS_SIG_cross_rsdp_192_small_new();
-#else
-		return NULL;
-#endif
+struct OQS_SIG_STREAM {
+	/* The method_name of the OQS_SIG object the stream was constructed for. */
+	const char *method_name;
+	/* Whether the stream signs rather than verifies. */
+	bool signing;
+	/* Whether the scheme hashes the message incrementally into state; otherwise it is buffered. */
+	bool incremental;
+	/* Whether state holds a hash context that has not been released yet. */
+	bool active;
+	/* The scheme's stream_update and stream_release, or NULL for a SHAKE256 state. */
+	void (*update)(void *state, const uint8_t *chunk, size_t chunk_len);
+	void (*release)(void *state);
+	/* Whether the final call has been made. */
+	bool finished;
+	/* The scheme's stream state, of length_stream_state bytes, or NULL when buffering. */
+	void *state;
+	size_t length_state;
+	/* A copy of the secret key (when signing) or the public key (when verifying). */
+	uint8_t *key;
+	size_t length_key;
+	/* A copy of the signature, when verifying. */
+	uint8_t *signature;
+	size_t signature_len;
+	/* A copy of the context string, when buffering. */
+	uint8_t *ctx_str;
+	size_t ctx_str_len;
+	/* The message received so far, when buffering. */
+	uint8_t *message;
+	size_t message_len;
+	size_t message_capacity;
+};
+
+static uint8_t *OQS_SIG_STREAM_dup(const uint8_t *data, size_t len) {
+	uint8_t *copy = OQS_MEM_malloc(len > 0 ? len : 1);
+	if (copy != NULL && len > 0) {
+		memcpy(copy, data, len);
+	}
+	return copy;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_256_balanced
-		return OQS_SIG_cross_rsdp_256_balanced_new();
-#else
+static OQS_SIG_STREAM *OQS_SIG_STREAM_new(const OQS_SIG *sig, bool signing, bool incremental, const uint8_t *key, size_t length_key, const uint8_t *ctx_str, size_t ctx_str_len) {
+	OQS_SIG_STREAM *stream = OQS_MEM_calloc(1, sizeof(OQS_SIG_STREAM));
+	if (stream == NULL) {
 		return NULL;
-#endif
+	}
+	stream->method_name = sig->method_name;
+	stream->signing = signing;
+	stream->incremental = incremental;
+	stream->length_key = length_key;
+	stream->key = OQS_SIG_STREAM_dup(key, length_key);
+	if (stream->key == NULL) {
+		goto err;
+	}
+	if (incremental) {
+		stream->length_state = sig->length_stream_state;
+		stream->update = sig->stream_update;
+		stream->release = sig->stream_release;
+		stream->state = OQS_MEM_aligned_alloc(OQS_SHA3_STACK_CTX_ALIGNMENT, stream->length_state);
+		if (stream->state == NULL) {
+			goto err;
+		}
+	} else if (ctx_str != NULL) {
+		/* A NULL context string stays NULL, since some schemes only accept it that way */
+		stream->ctx_str_len = ctx_str_len;
+		stream->ctx_str = OQS_SIG_STREAM_dup(ctx_str, ctx_str_len);
+		if (stream->ctx_str == NULL) {
+			goto err;
+		}
+	}
+	return stream;
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_256_fast
-		return OQS_SIG_cross_rsdp_256_fast_new();
-#else
-		return NULL;
-#endif
+err:
+	OQS_SIG_STREAM_free(stream);
+	return NULL;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdp_256_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdp_256_small
-		return OQS_SIG_cross_rsdp_256_small_new();
-#else
-		return NULL;
-#endif
+static OQS_STATUS OQS_SIG_STREAM_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, bool signing, const uint8_t *chunk, size_t chunk_len) {
+	if (sig == NULL || stream == NULL || stream->signing != signing || stream->finished || strcmp(sig->method_name, stream->method_name) != 0) {
+		return OQS_ERROR;
+	}
+	if (chunk_len == 0) {
+		return OQS_SUCCESS;
+	}
+	if (stream->incremental) {
+		if (stream->update != NULL) {
+			stream->update(stream->state, chunk, chunk_len);
+		} else {
+			/* The stream state starts with the hash context the message is absorbed into */
+			OQS_SHA3_shake256_stack_absorb((OQS_SHA3_shake256_stack_ctx *) stream->state, chunk, chunk_len);
+		}
+		return OQS_SUCCESS;
+	}
+	if (chunk_len > stream->message_capacity - stream->message_len) {
+		size_t capacity = stream->message_capacity > 0 ? stream->message_capacity : 4096;
+		while (capacity - stream->message_len < chunk_len) {
+			if (capacity > SIZE_MAX / 2) {
+				return OQS_ERROR;
+			}
+			capacity *= 2;
+		}
+		uint8_t *message = OQS_MEM_malloc(capacity);
+		if (message == NULL) {
+			return OQS_ERROR;
+		}
+		if (stream->message_len > 0) {
+			memcpy(message, stream->message, stream->message_len);
+		}
+		OQS_MEM_insecure_free(stream->message);
+		stream->message = message;
+		stream->message_capacity = capacity;
+	}
+	memcpy(stream->message + stream->message_len, chunk, chunk_len);
+	stream->message_len += chunk_len;
+	return OQS_SUCCESS;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_128_balanced
-		return OQS_SIG_cross_rsdpg_128_balanced_new();
-#else
+OQS_API OQS_SIG_STREAM *OQS_SIG_sign_init(const OQS_SIG *sig, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (sig == NULL || secret_key == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_128_fast
-		return OQS_SIG_cross_rsdpg_128_fast_new();
-#else
+	}
+	bool incremental = sig->length_stream_state > 0 && sig->sign_init != NULL && sig->sign_final != NULL;
+	OQS_SIG_STREAM *stream = OQS_SIG_STREAM_new(sig, true, incremental, secret_key, sig->length_secret_key, ctx_str, ctx_str_len);
+	if (stream == NULL) {
 		return NULL;
-#endif
+	}
+	if (incremental) {
+		if (sig->sign_init(stream->state, ctx_str, ctx_str_len, secret_key) != OQS_SUCCESS) {
+			OQS_SIG_STREAM_free(stream);
+			return NULL;
+		}
+		stream->active = true;
+	}
+	return stream;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_128_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_128_small
-		return OQS_SIG_cross_rsdpg_128_small_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_sign_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len) {
+	return OQS_SIG_STREAM_update(sig, stream, true, chunk, chunk_len);
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_192_balanced
-		return OQS_SIG_cross_rsdpg_192_balanced_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_sign_final(const OQS_SIG *sig, OQS_SIG_STREAM *stream, uint8_t *signature, size_t *signature_len) {
+	OQS_STATUS rc;
+	if (sig == NULL || stream == NULL || !stream->signing || stream->finished || strcmp(sig->method_name, stream->method_name) != 0) {
+		return OQS_ERROR;
+	}
+	stream->finished = true;
+	if (stream->incremental) {
+		stream->active = false;
+		rc = sig->sign_final(stream->state, signature, signature_len, stream->key);
+	} else {
+		rc = sig->sign_with_ctx_str(signature, signature_len, stream->message, stream->message_len, stream->ctx_str, stream->ctx_str_len, stream->key);
+	}
+	return rc == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_192_fast
-		return OQS_SIG_cross_rsdpg_192_fast_new();
-#else
+OQS_API OQS_SIG_STREAM *OQS_SIG_verify_init(const OQS_SIG *sig, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (sig == NULL || signature == NULL || public_key == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_192_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_192_small
-		return OQS_SIG_cross_rsdpg_192_small_new();
-#else
+	}
+	bool incremental = sig->length_stream_state > 0 && sig->verify_init != NULL && sig->verify_final != NULL;
+	OQS_SIG_STREAM *stream = OQS_SIG_STREAM_new(sig, false, incremental, public_key, sig->length_public_key, ctx_str, ctx_str_len);
+	if (stream == NULL) {
 		return NULL;
-#endif
-
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_balanced)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_256_balanced
-		return OQS_SIG_cross_rsdpg_256_balanced_new();
-#else
+	}
+	stream->signature_len = signature_len;
+	stream->signature = OQS_SIG_STREAM_dup(signature, signature_len);
+	if (stream->signature == NULL) {
+		OQS_SIG_STREAM_free(stream);
 		return NULL;
-#endif
+	}
+	if (incremental) {
+		if (sig->verify_init(stream->state, signature, signature_len, ctx_str, ctx_str_len, public_key) != OQS_SUCCESS) {
+			OQS_SIG_STREAM_free(stream);
+			return NULL;
+		}
+		stream->active = true;
+	}
+	return stream;
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_fast)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_256_fast
-		return OQS_SIG_cross_rsdpg_256_fast_new();
-#else
-		return NULL;
-#endif
+OQS_API OQS_STATUS OQS_SIG_verify_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len) {
+	return OQS_SIG_STREAM_update(sig, stream, false, chunk, chunk_len);
+}
 
-	} else if (0 == strcasecmp(method_name, OQS_SIG_alg_cross_rsdpg_256_small)) {
-#ifdef OQS_ENABLE_SIG_cross_rsdpg_256_small
-		return OQS_SIG_cross_rsdpg_256_small_new();
-#else
-		return NULL;
-#endif
-///// OQS_COPY_FROM_UPSTREAM_FRAGMENT_NEW_CASE_END
-		// EDIT-WHEN-ADDING-SIG
+OQS_API OQS_STATUS OQS_SIG_verify_final(const OQS_SIG *sig, OQS_SIG_STREAM *stream) {
+	OQS_STATUS rc;
+	if (sig == NULL || stream == NULL || stream->signing || stream->finished || strcmp(sig->method_name, stream->method_name) != 0) {
+		return OQS_ERROR;
+	}
+	stream->finished = true;
+	if (stream->incremental) {
+		stream->active = false;
+		rc = sig->verify_final(stream->state, stream->signature, stream->signature_len, stream->key);
 	} else {
-		return NULL;
+		rc = sig->verify_with_ctx_str(stream->message, stream->message_len, stream->signature, stream->signature_len, stream->ctx_str, stream->ctx_str_len, stream->key);
 	}
+	return rc == OQS_SUCCESS ? OQS_SUCCESS : OQS_ERROR;
 }
 
-OQS_API OQS_STATUS OQS_SIG_keypair(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key) {
-	if (sig == NULL || sig->keypair(public_key, secret_key) != OQS_SUCCESS) {
-		return OQS_ERROR;
-	} else {
-		return OQS_SUCCESS;
+OQS_API void OQS_SIG_STREAM_free(OQS_SIG_STREAM *stream) {
+	if (stream == NULL) {
+		return;
+	}
+	if (stream->active) {
+		if (stream->release != NULL) {
+			stream->release(stream->state);
+		} else {
+			OQS_SHA3_shake256_stack_ctx_release((OQS_SHA3_shake256_stack_ctx *) stream->state);
+		}
+	}
+	if (stream->state != NULL) {
+		OQS_MEM_cleanse(stream->state, stream->length_state);
+		OQS_MEM_aligned_free(stream->state);
 	}
+	if (stream->key != NULL) {
+		if (stream->signing) {
+			OQS_MEM_secure_free(stream->key, stream->length_key);
+		} else {
+			OQS_MEM_insecure_free(stream->key);
+		}
+	}
+	OQS_MEM_insecure_free(stream->signature);
+	OQS_MEM_insecure_free(stream->ctx_str);
+	OQS_MEM_insecure_free(stream->message);
+	OQS_MEM_insecure_free(stream);
 }
 
-OQS_API OQS_STATUS OQS_SIG_keypair_from_fseed(const OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
-	if (sig == NULL || sig->keypair_from_fseed(public_key, secret_key, seed) != OQS_SUCCESS) {
+OQS_API OQS_STATUS OQS_SIG_compute_mu(const OQS_SIG *sig, uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (sig == NULL || sig->compute_mu == NULL || sig->compute_mu(mu, message, message_len, ctx_str, ctx_str_len, public_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
 	} else {
 		return OQS_SUCCESS;
 	}
 }
 
-OQS_API OQS_STATUS OQS_SIG_pubkey_from_privkey(const OQS_SIG *sig, uint8_t *public_key, const uint8_t *secret_key) {
-	if (sig == NULL || sig->pubkey_from_privkey(public_key, secret_key) != OQS_SUCCESS) {
+OQS_API OQS_STATUS OQS_SIG_sign_mu(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key) {
+	if (sig == NULL || sig->sign_mu == NULL || sig->sign_mu(signature, signature_len, mu, secret_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
 	} else {
 		return OQS_SUCCESS;
 	}
 }
 
-OQS_API OQS_STATUS OQS_SIG_sign(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
-	if (sig == NULL || sig->sign(signature, signature_len, message, message_len, secret_key) != OQS_SUCCESS) {
+OQS_API OQS_STATUS OQS_SIG_verify_mu(const OQS_SIG *sig, const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	if (sig == NULL || sig->verify_mu == NULL || sig->verify_mu(mu, signature, signature_len, public_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
 	} else {
 		return OQS_SUCCESS;
 	}
 }
 
-OQS_API OQS_STATUS OQS_SIG_sign_with_ctx_str(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
-	if (sig == NULL || sig->sign_with_ctx_str(signature, signature_len, message, message_len, ctx_str, ctx_str_len, secret_key) != OQS_SUCCESS) {
-		return OQS_ERROR;
-	} else {
+/* DER encodings of the hash function OIDs 2.16.840.1.101.3.4.2.x, as used by HashML-DSA */
+#define OQS_SIG_PREHASH_OID_LEN 11
+#define OQS_SIG_PREHASH_OID(x) { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, (x) }
+
+static const struct {
+	size_t digest_len;
+	uint8_t oid[OQS_SIG_PREHASH_OID_LEN];
+} OQS_SIG_prehash_info[] = {
+	[OQS_SIG_PREHASH_SHA2_256] = { 32, OQS_SIG_PREHASH_OID(0x01) },
+	[OQS_SIG_PREHASH_SHA2_384] = { 48, OQS_SIG_PREHASH_OID(0x02) },
+	[OQS_SIG_PREHASH_SHA2_512] = { 64, OQS_SIG_PREHASH_OID(0x03) },
+	[OQS_SIG_PREHASH_SHA3_256] = { 32, OQS_SIG_PREHASH_OID(0x08) },
+	[OQS_SIG_PREHASH_SHA3_384] = { 48, OQS_SIG_PREHASH_OID(0x09) },
+	[OQS_SIG_PREHASH_SHA3_512] = { 64, OQS_SIG_PREHASH_OID(0x0a) },
+	[OQS_SIG_PREHASH_SHAKE128] = { 32, OQS_SIG_PREHASH_OID(0x0b) },
+	[OQS_SIG_PREHASH_SHAKE256] = { 64, OQS_SIG_PREHASH_OID(0x0c) },
+};
+
+OQS_API size_t OQS_SIG_prehash_length(OQS_SIG_PREHASH prehash) {
+	if ((size_t) prehash >= sizeof(OQS_SIG_prehash_info) / sizeof(OQS_SIG_prehash_info[0])) {
+		return 0;
+	}
+	return OQS_SIG_prehash_info[prehash].digest_len;
+}
+
+OQS_API OQS_STATUS OQS_SIG_prehash(OQS_SIG_PREHASH prehash, uint8_t *digest, const uint8_t *message, size_t message_len) {
+	switch (prehash) {
+	case OQS_SIG_PREHASH_SHA2_256:
+		OQS_SHA2_sha256(digest, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHA2_384:
+		OQS_SHA2_sha384(digest, message, message_len);
 		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHA2_512:
+		OQS_SHA2_sha512(digest, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHA3_256:
+		OQS_SHA3_sha3_256(digest, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHA3_384:
+		OQS_SHA3_sha3_384(digest, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHA3_512:
+		OQS_SHA3_sha3_512(digest, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHAKE128:
+		OQS_SHA3_shake128(digest, 32, message, message_len);
+		return OQS_SUCCESS;
+	case OQS_SIG_PREHASH_SHAKE256:
+		OQS_SHA3_shake256(digest, 64, message, message_len);
+		return OQS_SUCCESS;
+	default:
+		return OQS_ERROR;
 	}
 }
 
-OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
-	if (sig == NULL || sig->verify(message, message_len, signature, signature_len, public_key) != OQS_SUCCESS) {
+OQS_API OQS_STATUS OQS_SIG_sign_prehash(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, OQS_SIG_PREHASH prehash, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key) {
+	if (sig == NULL || sig->sign_prehash == NULL || digest_len == 0 || digest_len != OQS_SIG_prehash_length(prehash)) {
+		return OQS_ERROR;
+	} else if (sig->sign_prehash(signature, signature_len, digest, digest_len, OQS_SIG_prehash_info[prehash].oid, ctx_str, ctx_str_len, secret_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
 	} else {
 		return OQS_SUCCESS;
 	}
 }
 
-OQS_API OQS_STATUS OQS_SIG_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
-	if (sig == NULL || sig->verify_with_ctx_str(message, message_len, signature, signature_len, ctx_str, ctx_str_len, public_key) != OQS_SUCCESS) {
+OQS_API OQS_STATUS OQS_SIG_verify_prehash(const OQS_SIG *sig, const uint8_t *digest, size_t digest_len, OQS_SIG_PREHASH prehash, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (sig == NULL || sig->verify_prehash == NULL || digest_len == 0 || digest_len != OQS_SIG_prehash_length(prehash)) {
+		return OQS_ERROR;
+	} else if (sig->verify_prehash(digest, digest_len, OQS_SIG_prehash_info[prehash].oid, signature, signature_len, ctx_str, ctx_str_len, public_key) != OQS_SUCCESS) {
 		return OQS_ERROR;
 	} else {
 		return OQS_SUCCESS;
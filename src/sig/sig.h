@@ -272,9 +272,324 @@ typedef struct OQS_SIG {
 	 */
 	OQS_STATUS (*verify_with_ctx_str)(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 
+	/** The length, in bytes, of prepared secret keys for this signature scheme, or 0 if prepared secret keys are not supported. */
+	size_t length_prepared_secret_key;
+
+	/**
+	 * Secret key preparation algorithm.
+	 *
+	 * Expands `secret_key` into a scheme-specific representation that `sign_prepared`
+	 * can reuse across any number of signatures, so that work depending only on the
+	 * secret key is done once. Caller is responsible for providing `length_prepared_secret_key`
+	 * bytes of 32-byte aligned memory for `prepared_secret_key`; OQS_SIG_SECRET_KEY_new
+	 * takes care of this.
+	 *
+	 * May be `NULL` if the scheme does not support prepared secret keys.
+	 *
+	 * @param[out] prepared_secret_key The prepared secret key.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*prepare_secret_key)(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+
+	/**
+	 * Signature generation algorithm using a prepared secret key, with custom context string.
+	 *
+	 * Produces the same output as `sign_with_ctx_str` for the secret key that
+	 * `prepared_secret_key` was prepared from.
+	 *
+	 * May be `NULL` if the scheme does not support prepared secret keys.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] message The message to sign represented as a byte string.
+	 * @param[in] message_len The length of the message to sign.
+	 * @param[in] ctx_str The context string used for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] prepared_secret_key The secret key as output by `prepare_secret_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_prepared)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+
+	/**
+	 * Same as `sign_prepared`, but computes independent parts of the signature on up to
+	 * `num_threads` threads. The signature is the same as the one `sign_prepared` would
+	 * produce with the same randomness, whatever the number of threads.
+	 *
+	 * May be `NULL` if the scheme has no threaded signing algorithm.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] message The message to sign represented as a byte string.
+	 * @param[in] message_len The length of the message to sign.
+	 * @param[in] ctx_str The context string used for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] num_threads The maximum number of threads to use; 0 uses one per online CPU.
+	 * @param[in] prepared_secret_key The secret key as output by `prepare_secret_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_prepared_threaded)(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+
+	/** The length, in bytes, of prepared public keys for this signature scheme, or 0 if prepared public keys are not supported. */
+	size_t length_prepared_public_key;
+
+	/**
+	 * Public key preparation algorithm.
+	 *
+	 * Expands `public_key` into a scheme-specific representation that `verify_prepared`
+	 * can reuse across any number of verifications. Caller is responsible for providing
+	 * `length_prepared_public_key` bytes of 32-byte aligned memory for `prepared_public_key`;
+	 * OQS_SIG_PUBLIC_KEY_new takes care of this.
+	 *
+	 * May be `NULL` if the scheme does not support prepared public keys.
+	 *
+	 * @param[out] prepared_public_key The prepared public key.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*prepare_public_key)(uint8_t *prepared_public_key, const uint8_t *public_key);
+
+	/**
+	 * Signature verification algorithm using a prepared public key, with custom context string.
+	 *
+	 * Produces the same result as `verify_with_ctx_str` for the public key that
+	 * `prepared_public_key` was prepared from.
+	 *
+	 * May be `NULL` if the scheme does not support prepared public keys.
+	 *
+	 * @param[in] message The message represented as a byte string.
+	 * @param[in] message_len The length of the message.
+	 * @param[in] signature The signature on the message represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] ctx_str The context string for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] prepared_public_key The public key as output by `prepare_public_key`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_prepared)(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_public_key);
+
+	/**
+	 * The length, in bytes, of the state used by `sign_init`/`sign_final` and
+	 * `verify_init`/`verify_final`, or 0 if the scheme hashes messages in one pass only.
+	 *
+	 * Between the init and final calls, the message is added to the state with
+	 * `stream_update`. When that is `NULL`, the state starts with an
+	 * OQS_SHA3_shake256_stack_ctx into which the message is absorbed.
+	 */
+	size_t length_stream_state;
+
+	/**
+	 * Starts incremental signature generation, with custom context string.
+	 *
+	 * On success, `state` holds an initialized hash context which is released by `sign_final`.
+	 *
+	 * May be `NULL` if the scheme does not support incremental signing.
+	 *
+	 * @param[out] state The stream state, of `length_stream_state` bytes.
+	 * @param[in] ctx_str The context string used for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_init)(void *state, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+
+	/**
+	 * Completes incremental signature generation over the message absorbed into `state`.
+	 *
+	 * Produces a signature that verifies like one from `sign_with_ctx_str` over the
+	 * concatenated message. Always releases the hash context in `state`.
+	 *
+	 * May be `NULL` if the scheme does not support incremental signing.
+	 *
+	 * @param[in,out] state The stream state, as set up by `sign_init`.
+	 * @param[out] signature The signature represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] secret_key The secret key given to `sign_init`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_final)(void *state, uint8_t *signature, size_t *signature_len, const uint8_t *secret_key);
+
+	/**
+	 * Starts incremental signature verification, with custom context string.
+	 *
+	 * On success, `state` holds an initialized hash context which is released by `verify_final`.
+	 *
+	 * May be `NULL` if the scheme does not support incremental verification.
+	 *
+	 * @param[out] state The stream state, of `length_stream_state` bytes.
+	 * @param[in] signature The signature represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] ctx_str The context string for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_init)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
+	/**
+	 * Completes incremental signature verification over the message absorbed into `state`.
+	 *
+	 * Always releases the hash context in `state`.
+	 *
+	 * May be `NULL` if the scheme does not support incremental verification.
+	 *
+	 * @param[in,out] state The stream state, as set up by `verify_init`.
+	 * @param[in] signature The signature given to `verify_init`.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] public_key The public key given to `verify_init`.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_final)(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+	/**
+	 * Adds a chunk of the message to a state set up by `sign_init` or `verify_init`.
+	 *
+	 * May be `NULL` if the state starts with an OQS_SHA3_shake256_stack_ctx, into which
+	 * the chunk is then absorbed.
+	 *
+	 * @param[in,out] state The stream state.
+	 * @param[in] chunk The next chunk of the message.
+	 * @param[in] chunk_len The length of the chunk.
+	 */
+	void (*stream_update)(void *state, const uint8_t *chunk, size_t chunk_len);
+
+	/**
+	 * Releases the hash context in a state set up by `sign_init` or `verify_init`
+	 * when the stream is freed before the final call.
+	 *
+	 * May be `NULL` if the state starts with an OQS_SHA3_shake256_stack_ctx, which is
+	 * then released.
+	 *
+	 * @param[in,out] state The stream state.
+	 */
+	void (*stream_release)(void *state);
+
+	/**
+	 * The length, in bytes, of the message representative mu used by `compute_mu`,
+	 * `sign_mu` and `verify_mu`, or 0 if the scheme does not support an external mu.
+	 */
+	size_t length_mu;
+
+	/**
+	 * Computes the message representative mu of a message, with custom context string.
+	 * Only the public key is needed, so this can run apart from the signer.
+	 *
+	 * May be `NULL` if the scheme does not support an external mu.
+	 *
+	 * @param[out] mu The message representative, of `length_mu` bytes.
+	 * @param[in] message The message.
+	 * @param[in] message_len The length of the message.
+	 * @param[in] ctx_str The context string for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*compute_mu)(uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
+	/**
+	 * Signature generation from a message representative computed by `compute_mu`.
+	 *
+	 * May be `NULL` if the scheme does not support an external mu.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] mu The message representative, of `length_mu` bytes.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_mu)(uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key);
+
+	/**
+	 * Signature verification against a message representative computed by `compute_mu`.
+	 *
+	 * May be `NULL` if the scheme does not support an external mu.
+	 *
+	 * @param[in] mu The message representative, of `length_mu` bytes.
+	 * @param[in] signature The signature on the message represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_mu)(const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+	/**
+	 * Pre-hash signature generation (HashML-DSA), with custom context string.
+	 *
+	 * May be `NULL` if the scheme does not support pre-hash signing.
+	 *
+	 * @param[out] signature The signature on the message represented as a byte string.
+	 * @param[out] signature_len The actual length of the signature.
+	 * @param[in] digest The digest of the message.
+	 * @param[in] digest_len The length of the digest.
+	 * @param[in] digest_oid The DER encoding of the OID of the hash function, of 11 bytes.
+	 * @param[in] ctx_str The context string for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] secret_key The secret key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*sign_prehash)(uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+
+	/**
+	 * Pre-hash signature verification (HashML-DSA), with custom context string.
+	 *
+	 * May be `NULL` if the scheme does not support pre-hash signing.
+	 *
+	 * @param[in] digest The digest of the message.
+	 * @param[in] digest_len The length of the digest.
+	 * @param[in] digest_oid The DER encoding of the OID of the hash function, of 11 bytes.
+	 * @param[in] signature The signature on the message represented as a byte string.
+	 * @param[in] signature_len The length of the signature.
+	 * @param[in] ctx_str The context string for the signature, or NULL.
+	 * @param[in] ctx_str_len The length of the context string, or 0.
+	 * @param[in] public_key The public key represented as a byte string.
+	 * @return OQS_SUCCESS or OQS_ERROR
+	 */
+	OQS_STATUS (*verify_prehash)(const uint8_t *digest, size_t digest_len, const uint8_t *digest_oid, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 
 } OQS_SIG;
 
+/**
+ * Opaque secret key object for repeated signing with the same secret key.
+ *
+ * Constructed from an encoded secret key by OQS_SIG_SECRET_KEY_new and used with
+ * OQS_SIG_sign_prepared. The object holds secret data and is cleansed when freed
+ * with OQS_SIG_SECRET_KEY_free.
+ */
+typedef struct OQS_SIG_SECRET_KEY OQS_SIG_SECRET_KEY;
+
+/**
+ * Opaque public key object for repeated verification against the same public key.
+ *
+ * Constructed from an encoded public key by OQS_SIG_PUBLIC_KEY_new and used with
+ * OQS_SIG_verify_prepared.
+ */
+typedef struct OQS_SIG_PUBLIC_KEY OQS_SIG_PUBLIC_KEY;
+
+/**
+ * Opaque object for signing or verifying a message that is supplied in chunks.
+ *
+ * Constructed by OQS_SIG_sign_init or OQS_SIG_verify_init, fed with
+ * OQS_SIG_sign_update or OQS_SIG_verify_update, completed with OQS_SIG_sign_final
+ * or OQS_SIG_verify_final and freed with OQS_SIG_STREAM_free.
+ */
+typedef struct OQS_SIG_STREAM OQS_SIG_STREAM;
+
+/**
+ * Hash functions for pre-hash signing with OQS_SIG_sign_prehash and OQS_SIG_verify_prehash.
+ *
+ * SHAKE128 and SHAKE256 produce 32- and 64-byte digests, respectively.
+ */
+typedef enum {
+	OQS_SIG_PREHASH_SHA2_256,
+	OQS_SIG_PREHASH_SHA2_384,
+	OQS_SIG_PREHASH_SHA2_512,
+	OQS_SIG_PREHASH_SHA3_256,
+	OQS_SIG_PREHASH_SHA3_384,
+	OQS_SIG_PREHASH_SHA3_512,
+	OQS_SIG_PREHASH_SHAKE128,
+	OQS_SIG_PREHASH_SHAKE256,
+} OQS_SIG_PREHASH;
+
 /**
  * Constructs an OQS_SIG object for a particular algorithm.
  *
@@ -286,6 +601,18 @@ typedef struct OQS_SIG {
  */
 OQS_API OQS_SIG *OQS_SIG_new(const char *method_name);
 
+/**
+ * Returns the shared descriptor of a particular algorithm, without allocating memory.
+ *
+ * The names are matched case-insensitively, as in OQS_SIG_new. Every call for the same
+ * algorithm returns the same immutable object, which remains valid for the lifetime of
+ * the program and can be used from any thread. It must not be passed to OQS_SIG_free.
+ *
+ * @param[in] method_name Name of the desired algorithm; one of the names in `OQS_SIG_algs`.
+ * @return The descriptor of the algorithm, or `NULL` if the name is invalid or the algorithm has been disabled at compile-time.
+ */
+OQS_API const OQS_SIG *OQS_SIG_get(const char *method_name);
+
 /**
  * Keypair generation algorithm.
  *
@@ -374,6 +701,291 @@ OQS_API OQS_STATUS OQS_SIG_verify(const OQS_SIG *sig, const uint8_t *message, si
  */
 OQS_API OQS_STATUS OQS_SIG_verify_with_ctx_str(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
 
+/**
+ * Constructs an OQS_SIG_SECRET_KEY object from an encoded secret key.
+ *
+ * For schemes that support prepared secret keys, the object stores the secret key in the
+ * form the signing algorithm works on, so that OQS_SIG_sign_prepared skips that work: for
+ * ML-DSA, the unpacked secret key in NTT domain together with the expanded matrix A; for
+ * Falcon, the B0 matrix and ffLDL tree in FFT representation; for MAYO, the expanded
+ * secret key (P1, L and O); for SPHINCS+, all nodes of the top hypertree layer, so the
+ * last layer's WOTS+ signature and authentication path are read rather than
+ * recomputed. For all other schemes, the object stores a copy of
+ * `secret_key` and OQS_SIG_sign_prepared behaves like OQS_SIG_sign_with_ctx_str.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return An OQS_SIG_SECRET_KEY for use with `sig`, or `NULL` on error.
+ */
+OQS_API OQS_SIG_SECRET_KEY *OQS_SIG_SECRET_KEY_new(const OQS_SIG *sig, const uint8_t *secret_key);
+
+/**
+ * Signature generation algorithm using a secret key object, with custom context string.
+ *
+ * Caller is responsible for allocating sufficient memory for `signature`,
+ * based on the `length_*` members in this object or the per-scheme
+ * compile-time macros `OQS_SIG_*_length_*`.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The actual length of the signature. May be smaller than `length_signature` for some algorithms since some algorithms have variable length signatures.
+ * @param[in] message The message to sign represented as a byte string.
+ * @param[in] message_len The length of the message to sign.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] secret_key The secret key object, constructed by OQS_SIG_SECRET_KEY_new for the same signature scheme.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_prepared(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_SECRET_KEY *secret_key);
+
+/**
+ * Sets the number of threads OQS_SIG_sign_prepared uses with a secret key object.
+ *
+ * Newly constructed objects sign on the calling thread only. A different value only has an
+ * effect for schemes with a threaded signing algorithm, currently SPHINCS+ in builds with
+ * `OQS_SPHINCS_USE_PTHREADS`, which compute the FORS trees and the subtrees of the
+ * hypertree in parallel. Signatures do not depend on the number of threads.
+ *
+ * @param[in] secret_key The secret key object.
+ * @param[in] num_threads The maximum number of threads to use; 0 uses one per online CPU.
+ */
+OQS_API void OQS_SIG_SECRET_KEY_set_threads(OQS_SIG_SECRET_KEY *secret_key, unsigned int num_threads);
+
+/**
+ * Frees an OQS_SIG_SECRET_KEY object that was constructed by OQS_SIG_SECRET_KEY_new,
+ * cleansing the key material first.
+ *
+ * @param[in] secret_key The OQS_SIG_SECRET_KEY object to free.
+ */
+OQS_API void OQS_SIG_SECRET_KEY_free(OQS_SIG_SECRET_KEY *secret_key);
+
+/**
+ * Constructs an OQS_SIG_PUBLIC_KEY object from an encoded public key.
+ *
+ * For schemes that support prepared public keys, OQS_SIG_verify_prepared skips decoding
+ * and transforming the key: for ML-DSA, the object stores the expanded matrix A, t1 in NTT
+ * domain and the public key hash; for Falcon, it stores h in NTT representation; for MAYO,
+ * it stores the expanded public key (P1, P2 and P3). For all other schemes, the object
+ * stores a copy of `public_key` and OQS_SIG_verify_prepared behaves like
+ * OQS_SIG_verify_with_ctx_str.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return An OQS_SIG_PUBLIC_KEY for use with `sig`, or `NULL` on error.
+ */
+OQS_API OQS_SIG_PUBLIC_KEY *OQS_SIG_PUBLIC_KEY_new(const OQS_SIG *sig, const uint8_t *public_key);
+
+/**
+ * Signature verification algorithm using a public key object, with custom context string.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] message The message represented as a byte string.
+ * @param[in] message_len The length of the message.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] public_key The public key object, constructed by OQS_SIG_PUBLIC_KEY_new for the same signature scheme.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_prepared(const OQS_SIG *sig, const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const OQS_SIG_PUBLIC_KEY *public_key);
+
+/**
+ * Frees an OQS_SIG_PUBLIC_KEY object that was constructed by OQS_SIG_PUBLIC_KEY_new.
+ *
+ * @param[in] public_key The OQS_SIG_PUBLIC_KEY object to free.
+ */
+OQS_API void OQS_SIG_PUBLIC_KEY_free(OQS_SIG_PUBLIC_KEY *public_key);
+
+/**
+ * Starts signing a message that is supplied in chunks, with custom context string.
+ *
+ * For schemes that support incremental signing (currently ML-DSA, Dilithium and Falcon),
+ * each chunk is hashed as it arrives and memory use does not depend on the message length.
+ * For all other schemes, the chunks are buffered and signed by OQS_SIG_sign_final; this
+ * includes SPHINCS+, whose signing algorithm reads the message twice.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return An OQS_SIG_STREAM for use with `sig`, or `NULL` on error.
+ */
+OQS_API OQS_SIG_STREAM *OQS_SIG_sign_init(const OQS_SIG *sig, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+
+/**
+ * Adds a chunk of the message to a stream constructed by OQS_SIG_sign_init.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in,out] stream The stream object.
+ * @param[in] chunk The next part of the message.
+ * @param[in] chunk_len The length of the chunk.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len);
+
+/**
+ * Computes the signature on the message supplied to a stream constructed by OQS_SIG_sign_init.
+ *
+ * The stream cannot be used afterwards, except to be freed with OQS_SIG_STREAM_free.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in,out] stream The stream object.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The actual length of the signature. May be smaller than `length_signature` for some algorithms since some algorithms have variable length signatures.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_final(const OQS_SIG *sig, OQS_SIG_STREAM *stream, uint8_t *signature, size_t *signature_len);
+
+/**
+ * Starts verifying a signature on a message that is supplied in chunks, with custom context string.
+ *
+ * For schemes that support incremental verification (currently ML-DSA, Dilithium, Falcon
+ * and SPHINCS+), each chunk is hashed as it arrives and memory use
+ * does not depend on the message length. For all other schemes, the chunks are buffered and
+ * verified by OQS_SIG_verify_final.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed (i.e., for algorithms that do not support context strings or if an empty context string is used).
+ * @param[in] public_key The public key represented as a byte string.
+ * @return An OQS_SIG_STREAM for use with `sig`, or `NULL` on error (including a malformed signature that is rejected early).
+ */
+OQS_API OQS_SIG_STREAM *OQS_SIG_verify_init(const OQS_SIG *sig, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
+/**
+ * Adds a chunk of the message to a stream constructed by OQS_SIG_verify_init.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in,out] stream The stream object.
+ * @param[in] chunk The next part of the message.
+ * @param[in] chunk_len The length of the chunk.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, const uint8_t *chunk, size_t chunk_len);
+
+/**
+ * Verifies the signature on the message supplied to a stream constructed by OQS_SIG_verify_init.
+ *
+ * The stream cannot be used afterwards, except to be freed with OQS_SIG_STREAM_free.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in,out] stream The stream object.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_final(const OQS_SIG *sig, OQS_SIG_STREAM *stream);
+
+/**
+ * Frees an OQS_SIG_STREAM object, whether or not it has been completed, cleansing
+ * any secret key material first.
+ *
+ * @param[in] stream The OQS_SIG_STREAM object to free.
+ */
+OQS_API void OQS_SIG_STREAM_free(OQS_SIG_STREAM *stream);
+
+/**
+ * Computes the message representative mu of a message, with custom context string.
+ *
+ * Only the public key is needed, so mu can be computed apart from the signer and
+ * passed to OQS_SIG_sign_mu, whose cost does not depend on the message length.
+ * Supported if `sig->length_mu` is non-zero (currently ML-DSA).
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] mu The message representative, of `sig->length_mu` bytes.
+ * @param[in] message The message.
+ * @param[in] message_len The length of the message.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed.
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_compute_mu(const OQS_SIG *sig, uint8_t *mu, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
+/**
+ * Signature generation from a message representative computed by OQS_SIG_compute_mu.
+ *
+ * The signature verifies with OQS_SIG_verify_with_ctx_str against the message and
+ * context string that mu was computed from.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The actual length of the signature.
+ * @param[in] mu The message representative, of `sig->length_mu` bytes.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_mu(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *mu, const uint8_t *secret_key);
+
+/**
+ * Signature verification against a message representative computed by OQS_SIG_compute_mu.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] mu The message representative, of `sig->length_mu` bytes.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_mu(const OQS_SIG *sig, const uint8_t *mu, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+
+/**
+ * Returns the length, in bytes, of the digest produced by a pre-hash function.
+ *
+ * @param[in] prehash The pre-hash function.
+ * @return The digest length, or 0 if `prehash` is not a valid OQS_SIG_PREHASH value.
+ */
+OQS_API size_t OQS_SIG_prehash_length(OQS_SIG_PREHASH prehash);
+
+/**
+ * Computes the digest of a message for use with OQS_SIG_sign_prehash and OQS_SIG_verify_prehash.
+ *
+ * @param[in] prehash The pre-hash function.
+ * @param[out] digest The digest, of OQS_SIG_prehash_length(prehash) bytes.
+ * @param[in] message The message.
+ * @param[in] message_len The length of the message.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_prehash(OQS_SIG_PREHASH prehash, uint8_t *digest, const uint8_t *message, size_t message_len);
+
+/**
+ * Pre-hash signature generation (HashML-DSA), with custom context string.
+ *
+ * Signs the digest of a message, computed with OQS_SIG_prehash or elsewhere, bound
+ * to the pre-hash function. The signature is not valid for the message under
+ * OQS_SIG_verify_with_ctx_str. Supported if `sig->sign_prehash` is non-NULL
+ * (currently ML-DSA).
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[out] signature The signature on the message represented as a byte string.
+ * @param[out] signature_len The actual length of the signature.
+ * @param[in] digest The digest of the message.
+ * @param[in] digest_len The length of the digest; must be OQS_SIG_prehash_length(prehash).
+ * @param[in] prehash The pre-hash function used to compute the digest.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed.
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed.
+ * @param[in] secret_key The secret key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_sign_prehash(const OQS_SIG *sig, uint8_t *signature, size_t *signature_len, const uint8_t *digest, size_t digest_len, OQS_SIG_PREHASH prehash, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *secret_key);
+
+/**
+ * Pre-hash signature verification (HashML-DSA), with custom context string.
+ *
+ * @param[in] sig The OQS_SIG object representing the signature scheme.
+ * @param[in] digest The digest of the message.
+ * @param[in] digest_len The length of the digest; must be OQS_SIG_prehash_length(prehash).
+ * @param[in] prehash The pre-hash function used to compute the digest.
+ * @param[in] signature The signature on the message represented as a byte string.
+ * @param[in] signature_len The length of the signature.
+ * @param[in] ctx_str The context string used for the signature. This value can be set to NULL if a context string is not needed.
+ * @param[in] ctx_str_len The length of the context string. This value can be set to 0 if a context string is not needed.
+ * @param[in] public_key The public key represented as a byte string.
+ * @return OQS_SUCCESS or OQS_ERROR
+ */
+OQS_API OQS_STATUS OQS_SIG_verify_prehash(const OQS_SIG *sig, const uint8_t *digest, size_t digest_len, OQS_SIG_PREHASH prehash, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+
 /**
  * Frees an OQS_SIG object that was constructed by OQS_SIG_new.
  *
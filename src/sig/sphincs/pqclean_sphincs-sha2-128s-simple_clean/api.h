@@ -11,6 +11,8 @@
 #define PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_CRYPTO_BYTES          7856
 
 #define PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_CRYPTO_SEEDBYTES      48
+#define PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_CRYPTO_EXPANDEDSECRETKEYBYTES 16416
+#define PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_CRYPTO_VERIFYSTATEBYTES 288
 
 /*
  * Returns the length of a secret key, in bytes
@@ -54,6 +56,29 @@ int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_signature(uint8_t *sig, size
         const uint8_t *m, size_t mlen,
         const uint8_t *sk);
 
+/**
+ * Expands a secret key for crypto_sign_signature_expanded() by computing the
+ * nodes of the top subtree once. esk must hold CRYPTO_EXPANDEDSECRETKEYBYTES.
+ */
+int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+
+/**
+ * Same as crypto_sign_signature(), using an expanded secret key.
+ */
+int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk);
+
+/**
+ * Same as crypto_sign_signature_expanded(), computing the independent trees
+ * of the signature on up to num_threads threads (0: one per online CPU) when
+ * built with OQS_SPHINCS_USE_PTHREADS.
+ */
+int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk,
+        unsigned int num_threads);
+
 /**
  * Verifies a detached signature and message under a given public key.
  */
@@ -61,6 +86,25 @@ int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_verify(const uint8_t *sig, s
         const uint8_t *m, size_t mlen,
         const uint8_t *pk);
 
+/**
+ * Incremental variant of crypto_sign_verify(). The init call checks the
+ * signature length and starts hashing into state, which must hold
+ * CRYPTO_VERIFYSTATEBYTES bytes; the message is then added in chunks with
+ * the update call, and the final call checks the signature and releases
+ * state. The release call frees state when verification is abandoned.
+ */
+int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_verify_init(void *state,
+        const uint8_t *sig, size_t siglen,
+        const uint8_t *pk);
+
+void PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_verify_update(void *state,
+        const uint8_t *m, size_t mlen);
+
+int PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+        void *state, const uint8_t *pk);
+
+void PQCLEAN_SPHINCSSHA2128SSIMPLE_CLEAN_crypto_sign_verify_release(void *state);
+
 /**
  * Returns an array containing the signature followed by the message.
  */
@@ -23,6 +23,36 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
                   const unsigned char *m, size_t mlen,
                   const spx_ctx *ctx);
 
+/* The hash SHA-X(R || PK.seed || PK.root || M) of hash_message() in
+   progress, and the input that does not fill a whole block yet. */
+typedef struct {
+#if SPX_SHA512
+    sha512ctx state;
+    unsigned char buf[SPX_SHA512_BLOCK_BYTES];
+#else
+    sha256ctx state;
+    unsigned char buf[SPX_SHA256_BLOCK_BYTES];
+#endif
+    size_t buflen;
+} spx_msg_state;
+
+#define hash_message_init SPX_NAMESPACE(hash_message_init)
+void hash_message_init(spx_msg_state *state,
+                       const unsigned char *R, const unsigned char *pk);
+
+#define hash_message_update SPX_NAMESPACE(hash_message_update)
+void hash_message_update(spx_msg_state *state,
+                         const unsigned char *m, size_t mlen);
+
+#define hash_message_final SPX_NAMESPACE(hash_message_final)
+void hash_message_final(unsigned char *digest, uint64_t *tree,
+                        uint32_t *leaf_idx, const unsigned char *R,
+                        const unsigned char *pk, spx_msg_state *state,
+                        const spx_ctx *ctx);
+
+#define hash_message_release SPX_NAMESPACE(hash_message_release)
+void hash_message_release(spx_msg_state *state);
+
 #   define SPX_SHA256_ADDR_BYTES 22
 
 #   define mgf1_256 SPX_NAMESPACE(mgf1_256)
@@ -127,54 +127,78 @@ static void message_to_indices(uint32_t *indices, const unsigned char *m) {
 }
 
 /**
- * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Computes the part of a FORS signature that belongs to tree i, writing it
+ * to sig + i * (SPX_FORS_HEIGHT + 1) * SPX_N and the root of the tree to
+ * roots + i * SPX_N. The trees are independent of each other, so they can
+ * be computed in any order.
  * Assumes m contains at least SPX_FORS_HEIGHT * SPX_FORS_TREES bits.
  */
-void fors_sign(unsigned char *sig, unsigned char *pk,
-               const unsigned char *m,
-               const spx_ctx *ctx,
-               const uint32_t fors_addr[8]) {
+void fors_sign_tree(unsigned char *sig, unsigned char *roots,
+                    const unsigned char *m,
+                    const spx_ctx *ctx,
+                    const uint32_t fors_addr[8], unsigned int i) {
     uint32_t indices[SPX_FORS_TREES];
-    unsigned char roots[SPX_FORS_TREES * SPX_N];
     uint32_t fors_tree_addr[8 * 8] = {0};
     struct fors_gen_leaf_info fors_info = {0};
     uint32_t *fors_leaf_addr = fors_info.leaf_addrx;
-    uint32_t fors_pk_addr[8] = {0};
-    uint32_t idx_offset;
-    unsigned int i;
+    uint32_t idx_offset = i * (1 << SPX_FORS_HEIGHT);
+    unsigned int j;
 
-    for (i = 0; i < 8; i++) {
-        copy_keypair_addr(fors_tree_addr + 8 * i, fors_addr);
-        set_type(fors_tree_addr + 8 * i, SPX_ADDR_TYPE_FORSTREE);
-        copy_keypair_addr(fors_leaf_addr + 8 * i, fors_addr);
+    for (j = 0; j < 8; j++) {
+        copy_keypair_addr(fors_tree_addr + 8 * j, fors_addr);
+        set_type(fors_tree_addr + 8 * j, SPX_ADDR_TYPE_FORSTREE);
+        copy_keypair_addr(fors_leaf_addr + 8 * j, fors_addr);
     }
-    copy_keypair_addr(fors_pk_addr, fors_addr);
-    set_type(fors_pk_addr, SPX_ADDR_TYPE_FORSPK);
 
     message_to_indices(indices, m);
+    sig += i * (SPX_FORS_HEIGHT + 1) * SPX_N;
 
-    for (i = 0; i < SPX_FORS_TREES; i++) {
-        idx_offset = i * (1 << SPX_FORS_HEIGHT);
+    set_tree_height(fors_tree_addr, 0);
+    set_tree_index(fors_tree_addr, indices[i] + idx_offset);
 
-        set_tree_height(fors_tree_addr, 0);
-        set_tree_index(fors_tree_addr, indices[i] + idx_offset);
+    /* Include the secret key part that produces the selected leaf node. */
+    set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSPRF);
+    fors_gen_sk(sig, ctx, fors_tree_addr);
+    set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSTREE);
+    sig += SPX_N;
 
-        /* Include the secret key part that produces the selected leaf node. */
-        set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSPRF);
-        fors_gen_sk(sig, ctx, fors_tree_addr);
-        set_type(fors_tree_addr, SPX_ADDR_TYPE_FORSTREE);
-        sig += SPX_N;
+    /* Compute the authentication path for this leaf node. */
+    treehashx8(roots + i * SPX_N, sig, ctx,
+               indices[i], idx_offset, SPX_FORS_HEIGHT, fors_gen_leafx8,
+               fors_tree_addr, &fors_info);
+}
 
-        /* Compute the authentication path for this leaf node. */
-        treehashx8(roots + i * SPX_N, sig, ctx,
-                   indices[i], idx_offset, SPX_FORS_HEIGHT, fors_gen_leafx8,
-                   fors_tree_addr, &fors_info);
+/**
+ * Hashes the roots of all FORS trees into the FORS public key.
+ */
+void fors_roots_to_pk(unsigned char *pk, const unsigned char *roots,
+                      const spx_ctx *ctx,
+                      const uint32_t fors_addr[8]) {
+    uint32_t fors_pk_addr[8] = {0};
 
-        sig += SPX_N * SPX_FORS_HEIGHT;
+    copy_keypair_addr(fors_pk_addr, fors_addr);
+    set_type(fors_pk_addr, SPX_ADDR_TYPE_FORSPK);
+
+    thash(pk, roots, SPX_FORS_TREES, ctx, fors_pk_addr);
+}
+
+/**
+ * Signs a message m, deriving the secret key from sk_seed and the FTS address.
+ * Assumes m contains at least SPX_FORS_HEIGHT * SPX_FORS_TREES bits.
+ */
+void fors_sign(unsigned char *sig, unsigned char *pk,
+               const unsigned char *m,
+               const spx_ctx *ctx,
+               const uint32_t fors_addr[8]) {
+    unsigned char roots[SPX_FORS_TREES * SPX_N];
+    unsigned int i;
+
+    for (i = 0; i < SPX_FORS_TREES; i++) {
+        fors_sign_tree(sig, roots, m, ctx, fors_addr, i);
     }
 
     /* Hash horizontally across all tree roots to derive the public key. */
-    thash(pk, roots, SPX_FORS_TREES, ctx, fors_pk_addr);
+    fors_roots_to_pk(pk, roots, ctx, fors_addr);
 }
 
 /**
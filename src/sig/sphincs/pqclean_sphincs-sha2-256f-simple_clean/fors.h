@@ -16,6 +16,24 @@ void fors_sign(unsigned char *sig, unsigned char *pk,
                const spx_ctx *ctx,
                const uint32_t fors_addr[8]);
 
+/**
+ * Computes the part of a FORS signature that belongs to tree i, and the root
+ * of that tree; see fors.c.
+ */
+#define fors_sign_tree SPX_NAMESPACE(fors_sign_tree)
+void fors_sign_tree(unsigned char *sig, unsigned char *roots,
+                    const unsigned char *m,
+                    const spx_ctx *ctx,
+                    const uint32_t fors_addr[8], unsigned int i);
+
+/**
+ * Hashes the roots of all FORS trees into the FORS public key.
+ */
+#define fors_roots_to_pk SPX_NAMESPACE(fors_roots_to_pk)
+void fors_roots_to_pk(unsigned char *pk, const unsigned char *roots,
+                      const spx_ctx *ctx,
+                      const uint32_t fors_addr[8]);
+
 /**
  * Derives the FORS public key from a signature.
  * This can be used for verification by comparing to a known public key, or to
@@ -4,6 +4,7 @@
 #include "address.h"
 #include "merkle.h"
 #include "params.h"
+#include "thash.h"
 #include "utils.h"
 #include "utilsx1.h"
 #include "wots.h"
@@ -57,3 +58,108 @@ void merkle_gen_root(unsigned char *root, const spx_ctx *ctx) {
                 wots_addr, top_tree_addr,
                 ~0U /* ~0 means "don't bother generating an auth path */ );
 }
+
+/*
+ * Computes the nodes of the top-most subtree, except for its root, into
+ * nodes: first the 2^SPX_TREE_HEIGHT leaves, then each level above them up
+ * to the two children of the root, SPX_TOP_TREE_BYTES in total.
+ */
+void merkle_gen_top_tree(unsigned char *nodes, const spx_ctx *ctx) {
+    uint32_t tree_addr[8] = {0};
+    struct leaf_info_x1 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ] = { 0 };
+    unsigned char *level = nodes;
+    uint32_t h, i, width;
+
+    info.wots_sign_leaf = ~0U;
+    info.wots_steps = steps;
+    set_layer_addr(&info.leaf_addr[0], SPX_D - 1);
+    set_layer_addr(&info.pk_addr[0], SPX_D - 1);
+    set_type(&info.pk_addr[0], SPX_ADDR_TYPE_WOTSPK);
+
+    for (i = 0; i < (1U << SPX_TREE_HEIGHT); i += 1) {
+        wots_gen_leafx1(level + i * SPX_N, ctx, i, &info);
+    }
+
+    set_layer_addr(tree_addr, SPX_D - 1);
+    set_type(tree_addr, SPX_ADDR_TYPE_HASHTREE);
+    for (h = 1, width = 1U << SPX_TREE_HEIGHT; h < SPX_TREE_HEIGHT; h++, width >>= 1) {
+        unsigned char *parent = level + width * SPX_N;
+        set_tree_height(tree_addr, h);
+        for (i = 0; i < width / 2; i++) {
+            set_tree_index(tree_addr, i);
+            thash(parent + i * SPX_N, level + 2 * i * SPX_N, 2, ctx, tree_addr);
+        }
+        level = parent;
+    }
+}
+
+/*
+ * Same as merkle_sign(), but without the WOTS signature: computes the
+ * authentication path of idx_leaf and the root of the subtree only.
+ */
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf) {
+    struct leaf_info_x1 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ] = { 0 };
+
+    info.wots_steps = steps;
+
+    set_type(&tree_addr[0], SPX_ADDR_TYPE_HASHTREE);
+    set_type(&info.pk_addr[0], SPX_ADDR_TYPE_WOTSPK);
+    copy_subtree_addr(&info.leaf_addr[0], wots_addr);
+    copy_subtree_addr(&info.pk_addr[0], wots_addr);
+
+    info.wots_sign_leaf = ~0U;
+
+    treehashx1(root, auth_path, ctx,
+               idx_leaf, 0,
+               SPX_TREE_HEIGHT,
+               wots_gen_leafx1,
+               tree_addr, &info);
+}
+
+/*
+ * Generates the WOTS signature on msg by the leaf idx_leaf of the subtree
+ * given by wots_addr, the part of merkle_sign() that merkle_gen_auth_path()
+ * leaves out.
+ */
+void merkle_sign_wots(uint8_t *sig, const unsigned char *msg,
+                      const spx_ctx *ctx, uint32_t wots_addr[8],
+                      uint32_t idx_leaf) {
+    unsigned char leaf[SPX_N];
+    struct leaf_info_x1 info = { 0 };
+    unsigned steps[ SPX_WOTS_LEN ];
+
+    info.wots_sig = sig;
+    chain_lengths(steps, msg);
+    info.wots_steps = steps;
+
+    set_type(&info.pk_addr[0], SPX_ADDR_TYPE_WOTSPK);
+    copy_subtree_addr(&info.leaf_addr[0], wots_addr);
+    copy_subtree_addr(&info.pk_addr[0], wots_addr);
+
+    info.wots_sign_leaf = idx_leaf;
+    wots_gen_leafx1(leaf, ctx, idx_leaf, &info);
+}
+
+/*
+ * Same as merkle_sign() on the top-most subtree, taking the authentication
+ * path from the nodes computed by merkle_gen_top_tree(); only the WOTS key
+ * pair of the signing leaf is generated. Does not output the root.
+ */
+void merkle_sign_top(uint8_t *sig, const unsigned char *msg,
+                     const spx_ctx *ctx, uint32_t wots_addr[8],
+                     uint32_t idx_leaf, const unsigned char *nodes) {
+    unsigned char *auth_path = sig + SPX_WOTS_BYTES;
+    uint32_t h, width;
+
+    merkle_sign_wots(sig, msg, ctx, wots_addr, idx_leaf);
+
+    for (h = 0, width = 1U << SPX_TREE_HEIGHT; h < SPX_TREE_HEIGHT; h++, width >>= 1) {
+        memcpy(auth_path + h * SPX_N, nodes + ((idx_leaf >> h) ^ 1) * SPX_N, SPX_N);
+        nodes += width * SPX_N;
+    }
+}
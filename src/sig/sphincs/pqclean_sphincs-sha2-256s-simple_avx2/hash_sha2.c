@@ -11,6 +11,7 @@
 #define SPX_SHAX_BLOCK_BYTES SPX_SHA512_BLOCK_BYTES
 #define shaX_inc_init sha512_inc_init
 #define shaX_inc_blocks sha512_inc_blocks
+#define shaX_inc_ctx_release sha512_inc_ctx_release
 #define shaX_inc_finalize sha512_inc_finalize
 #define shaX sha512
 #define mgf1_X mgf1_512
@@ -145,14 +146,63 @@ void gen_message_random(unsigned char *R, const unsigned char *sk_prf,
 }
 
 /**
- * Computes the message hash using R, the public key, and the message.
- * Outputs the message digest and the index of the leaf. The index is split in
- * the tree index and the leaf index, for convenient copying to an address.
+ * Starts the message hash by buffering R and the public key. The message is
+ * then added with hash_message_update().
  */
-void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
-                  const unsigned char *R, const unsigned char *pk,
-                  const unsigned char *m, size_t mlen,
-                  const spx_ctx *ctx) {
+void hash_message_init(spx_msg_state *state,
+                       const unsigned char *R, const unsigned char *pk) {
+#if SPX_N + SPX_PK_BYTES >= SPX_SHAX_BLOCK_BYTES
+#error "R and the public key are expected to fit in one hash block"
+#endif
+    shaX_inc_init(&state->state);
+    memcpy(state->buf, R, SPX_N);
+    memcpy(state->buf + SPX_N, pk, SPX_PK_BYTES);
+    state->buflen = SPX_N + SPX_PK_BYTES;
+}
+
+/**
+ * Adds mlen bytes of the message to the hash started by hash_message_init().
+ * Whole blocks are hashed directly from m; the rest is kept in state.
+ */
+void hash_message_update(spx_msg_state *state,
+                         const unsigned char *m, size_t mlen) {
+    size_t n;
+
+    if (state->buflen > 0) {
+        n = SPX_SHAX_BLOCK_BYTES - state->buflen;
+        if (n > mlen) {
+            n = mlen;
+        }
+        memcpy(state->buf + state->buflen, m, n);
+        state->buflen += n;
+        m += n;
+        mlen -= n;
+        if (state->buflen < SPX_SHAX_BLOCK_BYTES) {
+            return;
+        }
+        shaX_inc_blocks(&state->state, state->buf, 1);
+        state->buflen = 0;
+    }
+
+    n = mlen / SPX_SHAX_BLOCK_BYTES;
+    if (n > 0) {
+        shaX_inc_blocks(&state->state, m, n);
+        m += n * SPX_SHAX_BLOCK_BYTES;
+        mlen -= n * SPX_SHAX_BLOCK_BYTES;
+    }
+    memcpy(state->buf, m, mlen);
+    state->buflen = mlen;
+}
+
+/**
+ * Completes the message hash started by hash_message_init() and releases
+ * state. R and pk must be the values given to hash_message_init(). Outputs
+ * the message digest and the index of the leaf, as hash_message() does.
+ */
+void hash_message_final(unsigned char *digest, uint64_t *tree,
+                        uint32_t *leaf_idx, const unsigned char *R,
+                        const unsigned char *pk, spx_msg_state *state,
+                        const spx_ctx *ctx) {
     (void)ctx;
 #define SPX_TREE_BITS (SPX_TREE_HEIGHT * (SPX_D - 1))
 #define SPX_TREE_BYTES ((SPX_TREE_BITS + 7) / 8)
@@ -161,37 +211,11 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
 #define SPX_DGST_BYTES (SPX_FORS_MSG_BYTES + SPX_TREE_BYTES + SPX_LEAF_BYTES)
 
     unsigned char seed[2 * SPX_N + SPX_SHAX_OUTPUT_BYTES];
-
-    /* Round to nearest multiple of SPX_SHAX_BLOCK_BYTES */
-#define SPX_INBLOCKS (((SPX_N + SPX_PK_BYTES + SPX_SHAX_BLOCK_BYTES - 1) & \
-                       -SPX_SHAX_BLOCK_BYTES) / SPX_SHAX_BLOCK_BYTES)
-    unsigned char inbuf[SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES];
-
     unsigned char buf[SPX_DGST_BYTES];
     unsigned char *bufp = buf;
-    shaXstate state;
-
-    shaX_inc_init(&state);
 
     // seed: SHA-X(R ‖ PK.seed ‖ PK.root ‖ M)
-    memcpy(inbuf, R, SPX_N);
-    memcpy(inbuf + SPX_N, pk, SPX_PK_BYTES);
-
-    /* If R + pk + message cannot fill up an entire block */
-    if (SPX_N + SPX_PK_BYTES + mlen < SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES) {
-        memcpy(inbuf + SPX_N + SPX_PK_BYTES, m, mlen);
-        shaX_inc_finalize(seed + 2 * SPX_N, &state, inbuf, SPX_N + SPX_PK_BYTES + mlen);
-    }
-    /* Otherwise first fill a block, so that finalize only uses the message */
-    else {
-        memcpy(inbuf + SPX_N + SPX_PK_BYTES, m,
-               SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES - SPX_N - SPX_PK_BYTES);
-        shaX_inc_blocks(&state, inbuf, SPX_INBLOCKS);
-
-        m += SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES - SPX_N - SPX_PK_BYTES;
-        mlen -= SPX_INBLOCKS * SPX_SHAX_BLOCK_BYTES - SPX_N - SPX_PK_BYTES;
-        shaX_inc_finalize(seed + 2 * SPX_N, &state, m, (size_t)mlen);
-    }
+    shaX_inc_finalize(seed + 2 * SPX_N, &state->state, state->buf, state->buflen);
 
     // H_msg: MGF1-SHA-X(R ‖ PK.seed ‖ seed)
     memcpy(seed, R, SPX_N);
@@ -211,3 +235,27 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
     *leaf_idx = (uint32_t)bytes_to_ull(bufp, SPX_LEAF_BYTES);
     *leaf_idx &= (~(uint32_t)0) >> (32 - SPX_LEAF_BITS);
 }
+
+/**
+ * Releases a message hash started by hash_message_init() without completing
+ * it.
+ */
+void hash_message_release(spx_msg_state *state) {
+    shaX_inc_ctx_release(&state->state);
+}
+
+/**
+ * Computes the message hash using R, the public key, and the message.
+ * Outputs the message digest and the index of the leaf. The index is split in
+ * the tree index and the leaf index, for convenient copying to an address.
+ */
+void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                  const unsigned char *R, const unsigned char *pk,
+                  const unsigned char *m, size_t mlen,
+                  const spx_ctx *ctx) {
+    spx_msg_state state;
+
+    hash_message_init(&state, R, pk);
+    hash_message_update(&state, m, mlen);
+    hash_message_final(digest, tree, leaf_idx, R, pk, &state, ctx);
+}
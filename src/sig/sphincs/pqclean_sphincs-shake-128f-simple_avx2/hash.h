@@ -5,6 +5,7 @@
 #include <stdint.h>
 
 #include "context.h"
+#include "fips202.h"
 #include "params.h"
 
 #define prf_addr SPX_NAMESPACE(prf_addr)
@@ -23,4 +24,13 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
                   const unsigned char *m, size_t mlen,
                   const spx_ctx *ctx);
 
+#define hash_message_init SPX_NAMESPACE(hash_message_init)
+void hash_message_init(shake256incctx *state,
+                       const unsigned char *R, const unsigned char *pk);
+
+#define hash_message_final SPX_NAMESPACE(hash_message_final)
+void hash_message_final(unsigned char *digest, uint64_t *tree,
+                        uint32_t *leaf_idx, shake256incctx *state,
+                        const spx_ctx *ctx);
+
 #endif
@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
+
 #define PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_CRYPTO_ALGNAME "SPHINCS+-shake-128s-simple"
 
 #define PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_CRYPTO_SECRETKEYBYTES 64
@@ -11,6 +13,7 @@
 #define PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_CRYPTO_BYTES          7856
 
 #define PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_CRYPTO_SEEDBYTES      48
+#define PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_CRYPTO_EXPANDEDSECRETKEYBYTES 16416
 
 /*
  * Returns the length of a secret key, in bytes
@@ -54,6 +57,29 @@ int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_signature(uint8_t *sig, size
         const uint8_t *m, size_t mlen,
         const uint8_t *sk);
 
+/**
+ * Expands a secret key for crypto_sign_signature_expanded() by computing the
+ * nodes of the top subtree once. esk must hold CRYPTO_EXPANDEDSECRETKEYBYTES.
+ */
+int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+
+/**
+ * Same as crypto_sign_signature(), using an expanded secret key.
+ */
+int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk);
+
+/**
+ * Same as crypto_sign_signature_expanded(), computing the independent trees
+ * of the signature on up to num_threads threads (0: one per online CPU) when
+ * built with OQS_SPHINCS_USE_PTHREADS.
+ */
+int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk,
+        unsigned int num_threads);
+
 /**
  * Verifies a detached signature and message under a given public key.
  */
@@ -61,6 +87,19 @@ int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_verify(const uint8_t *sig, s
         const uint8_t *m, size_t mlen,
         const uint8_t *pk);
 
+/**
+ * Incremental variant of crypto_sign_verify(). The init call checks the
+ * signature length and starts hashing; the message is then absorbed into
+ * state in chunks with shake256_inc_absorb(), and the final call checks
+ * the signature and releases state.
+ */
+int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_verify_init(shake256incctx *state,
+        const uint8_t *sig, size_t siglen,
+        const uint8_t *pk);
+
+int PQCLEAN_SPHINCSSHAKE128SSIMPLE_AVX2_crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+        shake256incctx *state, const uint8_t *pk);
+
 /**
  * Returns an array containing the signature followed by the message.
  */
@@ -14,6 +14,168 @@
 #include "utils.h"
 #include "wots.h"
 
+#if defined(OQS_SPHINCS_USE_PTHREADS)
+#include <pthread.h>
+#include <unistd.h>
+
+/* Upper bound on the worker threads used for one signature. */
+#define SPX_MAX_THREADS 64
+
+/*
+ * Work shared by the threads computing one signature. The first pass
+ * computes the SPX_D subtrees of the hypertree (authentication path and
+ * root) and the SPX_FORS_TREES FORS trees; the second pass computes the
+ * SPX_D WOTS signatures, each of which signs the root of the layer below.
+ * Jobs are handed out in order through next_job.
+ */
+typedef struct {
+    const spx_ctx *ctx;
+    uint8_t *sig;
+    const unsigned char *mhash;
+    const unsigned char *top_tree;
+    uint32_t fors_addr[8];
+    uint64_t tree[SPX_D];
+    uint32_t idx_leaf[SPX_D];
+    unsigned char fors_roots[SPX_FORS_TREES * SPX_N];
+    /* roots[0] is the FORS public key, roots[i + 1] the root of layer i. */
+    unsigned char roots[(SPX_D + 1) * SPX_N];
+    pthread_mutex_t lock;
+    unsigned int next_job;
+    unsigned int num_jobs;
+    int wots_pass;
+} sign_jobs;
+
+static void run_job(sign_jobs *jobs, unsigned int job) {
+    uint32_t wots_addr[8] = {0};
+    uint32_t tree_addr[8] = {0};
+    uint8_t *sig = jobs->sig + SPX_FORS_BYTES +
+                   job * (SPX_WOTS_BYTES + SPX_TREE_HEIGHT * SPX_N);
+
+    if (!jobs->wots_pass && job >= SPX_D) {
+        fors_sign_tree(jobs->sig, jobs->fors_roots,
+                       jobs->mhash, jobs->ctx, jobs->fors_addr, job - SPX_D);
+        return;
+    }
+
+    set_layer_addr(tree_addr, job);
+    set_tree_addr(tree_addr, jobs->tree[job]);
+    set_type(tree_addr, SPX_ADDR_TYPE_HASHTREE);
+    set_type(wots_addr, SPX_ADDR_TYPE_WOTS);
+    copy_subtree_addr(wots_addr, tree_addr);
+    set_keypair_addr(wots_addr, jobs->idx_leaf[job]);
+
+    if (jobs->top_tree != NULL && job == SPX_D - 1) {
+        /* The root of the top layer is not needed. */
+        if (jobs->wots_pass) {
+            merkle_sign_top(sig, jobs->roots + job * SPX_N, jobs->ctx,
+                            wots_addr, jobs->idx_leaf[job], jobs->top_tree);
+        }
+    } else if (!jobs->wots_pass) {
+        merkle_gen_auth_path(sig + SPX_WOTS_BYTES,
+                             jobs->roots + (job + 1) * SPX_N,
+                             jobs->ctx, wots_addr, tree_addr,
+                             jobs->idx_leaf[job]);
+    } else {
+        merkle_sign_wots(sig, jobs->roots + job * SPX_N, jobs->ctx,
+                         wots_addr, jobs->idx_leaf[job]);
+    }
+}
+
+static void *sign_worker(void *arg) {
+    sign_jobs *jobs = arg;
+    unsigned int job;
+
+    for (;;) {
+        pthread_mutex_lock(&jobs->lock);
+        job = jobs->next_job++;
+        pthread_mutex_unlock(&jobs->lock);
+        if (job >= jobs->num_jobs) {
+            return NULL;
+        }
+        run_job(jobs, job);
+    }
+}
+
+/*
+ * Runs num_jobs jobs on up to num_threads threads. The calling thread takes
+ * jobs too, until none are left, so jobs are never lost to a thread that
+ * could not be started.
+ */
+static void run_jobs(sign_jobs *jobs, unsigned int num_jobs,
+                     unsigned int num_threads) {
+    pthread_t threads[SPX_MAX_THREADS];
+    int started[SPX_MAX_THREADS];
+    unsigned int t;
+
+    jobs->next_job = 0;
+    jobs->num_jobs = num_jobs;
+    if (num_threads > num_jobs) {
+        num_threads = num_jobs;
+    }
+
+    for (t = 1; t < num_threads; t++) {
+        started[t] = pthread_create(&threads[t], NULL, sign_worker, jobs) == 0;
+    }
+    sign_worker(jobs);
+    for (t = 1; t < num_threads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+}
+
+static unsigned int sign_num_threads(unsigned int num_threads) {
+    if (num_threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (unsigned int)cpus : 1;
+    }
+    if (num_threads > SPX_MAX_THREADS) {
+        num_threads = SPX_MAX_THREADS;
+    }
+    return num_threads;
+}
+
+/*
+ * Computes the FORS signature and the hypertree signature that follow R,
+ * spreading the trees over num_threads threads. The result is the same as
+ * that of the sequential code in sign_signature(). Returns -1, having
+ * written nothing, if the threads cannot be coordinated.
+ */
+static int sign_threaded(uint8_t *sig, const unsigned char *mhash,
+                         uint64_t tree, uint32_t idx_leaf,
+                         const spx_ctx *ctx, const unsigned char *top_tree,
+                         unsigned int num_threads) {
+    sign_jobs jobs;
+    uint32_t i;
+
+    if (pthread_mutex_init(&jobs.lock, NULL) != 0) {
+        return -1;
+    }
+    jobs.ctx = ctx;
+    jobs.sig = sig;
+    jobs.mhash = mhash;
+    jobs.top_tree = top_tree;
+    for (i = 0; i < SPX_D; i++) {
+        jobs.tree[i] = tree;
+        jobs.idx_leaf[i] = idx_leaf;
+        idx_leaf = (tree & ((1 << SPX_TREE_HEIGHT) - 1));
+        tree = tree >> SPX_TREE_HEIGHT;
+    }
+    memset(jobs.fors_addr, 0, sizeof(jobs.fors_addr));
+    set_tree_addr(jobs.fors_addr, jobs.tree[0]);
+    set_keypair_addr(jobs.fors_addr, jobs.idx_leaf[0]);
+
+    jobs.wots_pass = 0;
+    run_jobs(&jobs, SPX_D + SPX_FORS_TREES, num_threads);
+    fors_roots_to_pk(jobs.roots, jobs.fors_roots, ctx, jobs.fors_addr);
+    jobs.wots_pass = 1;
+    run_jobs(&jobs, SPX_D, num_threads);
+
+    pthread_mutex_destroy(&jobs.lock);
+    return 0;
+}
+#endif
+
 /*
  * Returns the length of a secret key, in bytes
  */
@@ -87,11 +249,17 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk) {
     return 0;
 }
 
-/**
- * Returns an array containing a detached signature.
+/*
+ * Computes a detached signature. If top_tree is not NULL, it holds the nodes
+ * of the top subtree as produced by merkle_gen_top_tree(), and the last
+ * layer is signed from it instead of regenerating the subtree. num_threads
+ * is the number of threads to use when built with OQS_SPHINCS_USE_PTHREADS,
+ * 0 meaning one per online CPU.
  */
-int crypto_sign_signature(uint8_t *sig, size_t *siglen,
-                          const uint8_t *m, size_t mlen, const uint8_t *sk) {
+static int sign_signature(uint8_t *sig, size_t *siglen,
+                          const uint8_t *m, size_t mlen, const uint8_t *sk,
+                          const unsigned char *top_tree,
+                          unsigned int num_threads) {
     spx_ctx ctx;
 
     const uint8_t *sk_prf = sk + SPX_N;
@@ -127,6 +295,18 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
     hash_message(mhash, &tree, &idx_leaf, sig, pk, m, mlen, &ctx);
     sig += SPX_N;
 
+#if defined(OQS_SPHINCS_USE_PTHREADS)
+    num_threads = sign_num_threads(num_threads);
+    if (num_threads > 1 &&
+            sign_threaded(sig, mhash, tree, idx_leaf, &ctx, top_tree, num_threads) == 0) {
+        free_hash_function(&ctx);
+        *siglen = SPX_BYTES;
+        return 0;
+    }
+#else
+    (void)num_threads;
+#endif
+
     set_tree_addr(wots_addr, tree);
     set_keypair_addr(wots_addr, idx_leaf);
 
@@ -141,7 +321,11 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
         copy_subtree_addr(wots_addr, tree_addr);
         set_keypair_addr(wots_addr, idx_leaf);
 
-        merkle_sign(sig, root, &ctx, wots_addr, tree_addr, idx_leaf);
+        if (top_tree != NULL && i == SPX_D - 1) {
+            merkle_sign_top(sig, root, &ctx, wots_addr, idx_leaf, top_tree);
+        } else {
+            merkle_sign(sig, root, &ctx, wots_addr, tree_addr, idx_leaf);
+        }
         sig += SPX_WOTS_BYTES + SPX_TREE_HEIGHT * SPX_N;
 
         /* Update the indices for the next layer. */
@@ -157,10 +341,79 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
 }
 
 /**
- * Verifies a detached signature and message under a given public key.
+ * Returns an array containing a detached signature.
  */
-int crypto_sign_verify(const uint8_t *sig, size_t siglen,
-                       const uint8_t *m, size_t mlen, const uint8_t *pk) {
+int crypto_sign_signature(uint8_t *sig, size_t *siglen,
+                          const uint8_t *m, size_t mlen, const uint8_t *sk) {
+    return sign_signature(sig, siglen, m, mlen, sk, NULL, 1);
+}
+
+/*
+ * Expands a secret key for crypto_sign_signature_expanded().
+ * Format esk: [sk || nodes of the top subtree below its root]
+ */
+int crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk) {
+    spx_ctx ctx;
+
+    memcpy(ctx.sk_seed, sk, SPX_N);
+    memcpy(ctx.pub_seed, sk + 2 * SPX_N, SPX_N);
+
+    initialize_hash_function(&ctx);
+
+    memcpy(esk, sk, SPX_SK_BYTES);
+    merkle_gen_top_tree(esk + SPX_SK_BYTES, &ctx);
+
+    free_hash_function(&ctx);
+
+    return 0;
+}
+
+/**
+ * Same as crypto_sign_signature(), using a secret key expanded by
+ * crypto_sign_expand_privkey().
+ */
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *esk) {
+    return sign_signature(sig, siglen, m, mlen, esk, esk + SPX_SK_BYTES, 1);
+}
+
+/**
+ * Same as crypto_sign_signature_expanded(), computing the independent trees
+ * of the signature on up to num_threads threads (0: one per online CPU) when
+ * built with OQS_SPHINCS_USE_PTHREADS. The signature does not depend on the
+ * number of threads.
+ */
+int crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk,
+        unsigned int num_threads) {
+    return sign_signature(sig, siglen, m, mlen, esk, esk + SPX_SK_BYTES, num_threads);
+}
+
+/**
+ * Starts incremental verification of a detached signature under a given
+ * public key. The message is then absorbed into state in chunks with
+ * shake256_inc_absorb() and the signature checked with
+ * crypto_sign_verify_final().
+ */
+int crypto_sign_verify_init(shake256incctx *state,
+                            const uint8_t *sig, size_t siglen,
+                            const uint8_t *pk) {
+    if (siglen != SPX_BYTES) {
+        return -1;
+    }
+
+    hash_message_init(state, sig, pk);
+    return 0;
+}
+
+/**
+ * Completes incremental verification of the signature given to
+ * crypto_sign_verify_init() and releases state.
+ */
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+                             shake256incctx *state, const uint8_t *pk) {
     spx_ctx ctx;
     const uint8_t *pub_root = pk + SPX_N;
     uint8_t mhash[SPX_FORS_MSG_BYTES];
@@ -175,6 +428,7 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
     uint32_t wots_pk_addr[8] = {0};
 
     if (siglen != SPX_BYTES) {
+        shake256_inc_ctx_release(state);
         return -1;
     }
 
@@ -190,7 +444,7 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
 
     /* Derive the message digest and leaf index from R || PK || M. */
     /* The additional SPX_N is a result of the hash domain separator. */
-    hash_message(mhash, &tree, &idx_leaf, sig, pk, m, mlen, &ctx);
+    hash_message_final(mhash, &tree, &idx_leaf, state, &ctx);
     sig += SPX_N;
 
     /* Layer correctly defaults to 0, so no need to set_layer_addr */
@@ -240,6 +494,20 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
     return 0;
 }
 
+/**
+ * Verifies a detached signature and message under a given public key.
+ */
+int crypto_sign_verify(const uint8_t *sig, size_t siglen,
+                       const uint8_t *m, size_t mlen, const uint8_t *pk) {
+    shake256incctx state;
+
+    if (crypto_sign_verify_init(&state, sig, siglen, pk)) {
+        return -1;
+    }
+    shake256_inc_absorb(&state, m, mlen);
+    return crypto_sign_verify_final(sig, siglen, &state, pk);
+}
+
 /**
  * Returns an array containing the signature followed by the message.
  */
@@ -43,14 +43,24 @@ void gen_message_random(unsigned char *R, const unsigned char *sk_prf,
 }
 
 /**
- * Computes the message hash using R, the public key, and the message.
- * Outputs the message digest and the index of the leaf. The index is split in
- * the tree index and the leaf index, for convenient copying to an address.
+ * Starts the message hash by absorbing R and the public key into state.
+ * The message is then absorbed with shake256_inc_absorb().
  */
-void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
-                  const unsigned char *R, const unsigned char *pk,
-                  const unsigned char *m, size_t mlen,
-                  const spx_ctx *ctx) {
+void hash_message_init(shake256incctx *state,
+                       const unsigned char *R, const unsigned char *pk) {
+    shake256_inc_init(state);
+    shake256_inc_absorb(state, R, SPX_N);
+    shake256_inc_absorb(state, pk, SPX_PK_BYTES);
+}
+
+/**
+ * Completes the message hash started by hash_message_init() and releases
+ * state. Outputs the message digest and the index of the leaf, as
+ * hash_message() does.
+ */
+void hash_message_final(unsigned char *digest, uint64_t *tree,
+                        uint32_t *leaf_idx, shake256incctx *state,
+                        const spx_ctx *ctx) {
     (void)ctx;
 #define SPX_TREE_BITS (SPX_TREE_HEIGHT * (SPX_D - 1))
 #define SPX_TREE_BYTES ((SPX_TREE_BITS + 7) / 8)
@@ -60,15 +70,10 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
 
     unsigned char buf[SPX_DGST_BYTES];
     unsigned char *bufp = buf;
-    shake256incctx s_inc;
 
-    shake256_inc_init(&s_inc);
-    shake256_inc_absorb(&s_inc, R, SPX_N);
-    shake256_inc_absorb(&s_inc, pk, SPX_PK_BYTES);
-    shake256_inc_absorb(&s_inc, m, mlen);
-    shake256_inc_finalize(&s_inc);
-    shake256_inc_squeeze(buf, SPX_DGST_BYTES, &s_inc);
-    shake256_inc_ctx_release(&s_inc);
+    shake256_inc_finalize(state);
+    shake256_inc_squeeze(buf, SPX_DGST_BYTES, state);
+    shake256_inc_ctx_release(state);
 
     memcpy(digest, bufp, SPX_FORS_MSG_BYTES);
     bufp += SPX_FORS_MSG_BYTES;
@@ -80,3 +85,19 @@ void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
     *leaf_idx = (uint32_t)bytes_to_ull(bufp, SPX_LEAF_BYTES);
     *leaf_idx &= (~(uint32_t)0) >> (32 - SPX_LEAF_BITS);
 }
+
+/**
+ * Computes the message hash using R, the public key, and the message.
+ * Outputs the message digest and the index of the leaf. The index is split in
+ * the tree index and the leaf index, for convenient copying to an address.
+ */
+void hash_message(unsigned char *digest, uint64_t *tree, uint32_t *leaf_idx,
+                  const unsigned char *R, const unsigned char *pk,
+                  const unsigned char *m, size_t mlen,
+                  const spx_ctx *ctx) {
+    shake256incctx s_inc;
+
+    hash_message_init(&s_inc, R, pk);
+    shake256_inc_absorb(&s_inc, m, mlen);
+    hash_message_final(digest, tree, leaf_idx, &s_inc, ctx);
+}
@@ -18,4 +18,31 @@ void merkle_sign(uint8_t *sig, unsigned char *root,
 #define merkle_gen_root SPX_NAMESPACE(merkle_gen_root)
 void merkle_gen_root(unsigned char *root, const spx_ctx *ctx);
 
+/* Size of the nodes of the top-most subtree below its root */
+#define SPX_TOP_TREE_BYTES (((1U << (SPX_TREE_HEIGHT + 1)) - 2) * SPX_N)
+
+/* Compute all nodes of the top-most subtree except its root. */
+#define merkle_gen_top_tree SPX_NAMESPACE(merkle_gen_top_tree)
+void merkle_gen_top_tree(unsigned char *nodes, const spx_ctx *ctx);
+
+/* Compute the authentication path and root of a subtree, without the WOTS */
+/* signature */
+#define merkle_gen_auth_path SPX_NAMESPACE(merkle_gen_auth_path)
+void merkle_gen_auth_path(unsigned char *auth_path, unsigned char *root,
+                          const spx_ctx *ctx,
+                          uint32_t wots_addr[8], uint32_t tree_addr[8],
+                          uint32_t idx_leaf);
+
+/* Generate only the WOTS signature of a Merkle signature */
+#define merkle_sign_wots SPX_NAMESPACE(merkle_sign_wots)
+void merkle_sign_wots(uint8_t *sig, const unsigned char *msg,
+                      const spx_ctx *ctx, uint32_t wots_addr[8],
+                      uint32_t idx_leaf);
+
+/* Generate a Merkle signature on the top-most subtree from its cached nodes */
+#define merkle_sign_top SPX_NAMESPACE(merkle_sign_top)
+void merkle_sign_top(uint8_t *sig, const unsigned char *msg,
+                     const spx_ctx *ctx, uint32_t wots_addr[8],
+                     uint32_t idx_leaf, const unsigned char *nodes);
+
 #endif /* MERKLE_H_ */
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "fips202.h"
 #include "params.h"
 
 #define CRYPTO_ALGNAME "SPHINCS+"
@@ -61,6 +62,20 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 int crypto_sign_signature(uint8_t *sig, size_t *siglen,
                           const uint8_t *m, size_t mlen, const uint8_t *sk);
 
+#define crypto_sign_expand_privkey SPX_NAMESPACE(crypto_sign_expand_privkey)
+int crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded SPX_NAMESPACE(crypto_sign_signature_expanded)
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *esk);
+
+#define crypto_sign_signature_expanded_threaded SPX_NAMESPACE(crypto_sign_signature_expanded_threaded)
+int crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen,
+        const uint8_t *m, size_t mlen,
+        const uint8_t *esk,
+        unsigned int num_threads);
+
 /**
  * Verifies a detached signature and message under a given public key.
  */
@@ -68,6 +83,18 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
 int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *m, size_t mlen, const uint8_t *pk);
 
+/**
+ * Incremental variant of crypto_sign_verify(); see sign.c.
+ */
+#define crypto_sign_verify_init SPX_NAMESPACE(crypto_sign_verify_init)
+int crypto_sign_verify_init(shake256incctx *state,
+                            const uint8_t *sig, size_t siglen,
+                            const uint8_t *pk);
+
+#define crypto_sign_verify_final SPX_NAMESPACE(crypto_sign_verify_final)
+int crypto_sign_verify_final(const uint8_t *sig, size_t siglen,
+                             shake256incctx *state, const uint8_t *pk);
+
 /**
  * Returns an array containing the signature followed by the message.
  */
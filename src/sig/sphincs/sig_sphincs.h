@@ -9,6 +9,8 @@
 #define OQS_SIG_sphincs_sha2_128f_simple_length_public_key 32
 #define OQS_SIG_sphincs_sha2_128f_simple_length_secret_key 64
 #define OQS_SIG_sphincs_sha2_128f_simple_length_signature 17088
+#define OQS_SIG_sphincs_sha2_128f_simple_length_prepared_secret_key 288
+#define OQS_SIG_sphincs_sha2_128f_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_128f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -18,12 +20,21 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_128f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_128f_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_128s_simple)
 #define OQS_SIG_sphincs_sha2_128s_simple_length_public_key 32
 #define OQS_SIG_sphincs_sha2_128s_simple_length_secret_key 64
 #define OQS_SIG_sphincs_sha2_128s_simple_length_signature 7856
+#define OQS_SIG_sphincs_sha2_128s_simple_length_prepared_secret_key 16416
+#define OQS_SIG_sphincs_sha2_128s_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_128s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -33,12 +44,21 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_128s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_128s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_128s_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192f_simple)
 #define OQS_SIG_sphincs_sha2_192f_simple_length_public_key 48
 #define OQS_SIG_sphincs_sha2_192f_simple_length_secret_key 96
 #define OQS_SIG_sphincs_sha2_192f_simple_length_signature 35664
+#define OQS_SIG_sphincs_sha2_192f_simple_length_prepared_secret_key 432
+#define OQS_SIG_sphincs_sha2_192f_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_192f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -48,12 +68,21 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_192f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_192f_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple)
 #define OQS_SIG_sphincs_sha2_192s_simple_length_public_key 48
 #define OQS_SIG_sphincs_sha2_192s_simple_length_secret_key 96
 #define OQS_SIG_sphincs_sha2_192s_simple_length_signature 16224
+#define OQS_SIG_sphincs_sha2_192s_simple_length_prepared_secret_key 24624
+#define OQS_SIG_sphincs_sha2_192s_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_192s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -63,12 +92,21 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_192s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_192s_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_256f_simple)
 #define OQS_SIG_sphincs_sha2_256f_simple_length_public_key 64
 #define OQS_SIG_sphincs_sha2_256f_simple_length_secret_key 128
 #define OQS_SIG_sphincs_sha2_256f_simple_length_signature 49856
+#define OQS_SIG_sphincs_sha2_256f_simple_length_prepared_secret_key 1088
+#define OQS_SIG_sphincs_sha2_256f_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_256f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -78,12 +116,21 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_256f_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_256f_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_256s_simple)
 #define OQS_SIG_sphincs_sha2_256s_simple_length_public_key 64
 #define OQS_SIG_sphincs_sha2_256s_simple_length_secret_key 128
 #define OQS_SIG_sphincs_sha2_256s_simple_length_signature 29792
+#define OQS_SIG_sphincs_sha2_256s_simple_length_prepared_secret_key 16448
+#define OQS_SIG_sphincs_sha2_256s_simple_length_stream_state 288
 
 OQS_SIG *OQS_SIG_sphincs_sha2_256s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -93,12 +140,20 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign(uint8_t *signature, siz
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_256s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
+OQS_API void OQS_SIG_sphincs_sha2_256s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len);
+OQS_API void OQS_SIG_sphincs_sha2_256s_simple_stream_release(void *state);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_128f_simple)
 #define OQS_SIG_sphincs_shake_128f_simple_length_public_key 32
 #define OQS_SIG_sphincs_shake_128f_simple_length_secret_key 64
 #define OQS_SIG_sphincs_shake_128f_simple_length_signature 17088
+#define OQS_SIG_sphincs_shake_128f_simple_length_prepared_secret_key 288
 
 OQS_SIG *OQS_SIG_sphincs_shake_128f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -108,12 +163,18 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_128s_simple)
 #define OQS_SIG_sphincs_shake_128s_simple_length_public_key 32
 #define OQS_SIG_sphincs_shake_128s_simple_length_secret_key 64
 #define OQS_SIG_sphincs_shake_128s_simple_length_signature 7856
+#define OQS_SIG_sphincs_shake_128s_simple_length_prepared_secret_key 16416
 
 OQS_SIG *OQS_SIG_sphincs_shake_128s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -123,12 +184,18 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_128s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_192f_simple)
 #define OQS_SIG_sphincs_shake_192f_simple_length_public_key 48
 #define OQS_SIG_sphincs_shake_192f_simple_length_secret_key 96
 #define OQS_SIG_sphincs_shake_192f_simple_length_signature 35664
+#define OQS_SIG_sphincs_shake_192f_simple_length_prepared_secret_key 432
 
 OQS_SIG *OQS_SIG_sphincs_shake_192f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -138,12 +205,18 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_192s_simple)
 #define OQS_SIG_sphincs_shake_192s_simple_length_public_key 48
 #define OQS_SIG_sphincs_shake_192s_simple_length_secret_key 96
 #define OQS_SIG_sphincs_shake_192s_simple_length_signature 16224
+#define OQS_SIG_sphincs_shake_192s_simple_length_prepared_secret_key 24624
 
 OQS_SIG *OQS_SIG_sphincs_shake_192s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -153,12 +226,18 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_192s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_256f_simple)
 #define OQS_SIG_sphincs_shake_256f_simple_length_public_key 64
 #define OQS_SIG_sphincs_shake_256f_simple_length_secret_key 128
 #define OQS_SIG_sphincs_shake_256f_simple_length_signature 49856
+#define OQS_SIG_sphincs_shake_256f_simple_length_prepared_secret_key 1088
 
 OQS_SIG *OQS_SIG_sphincs_shake_256f_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -168,12 +247,18 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256f_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #if defined(OQS_ENABLE_SIG_sphincs_shake_256s_simple)
 #define OQS_SIG_sphincs_shake_256s_simple_length_public_key 64
 #define OQS_SIG_sphincs_shake_256s_simple_length_secret_key 128
 #define OQS_SIG_sphincs_shake_256s_simple_length_signature 29792
+#define OQS_SIG_sphincs_shake_256s_simple_length_prepared_secret_key 16448
 
 OQS_SIG *OQS_SIG_sphincs_shake_256s_simple_new(void);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_keypair(uint8_t *public_key, uint8_t *secret_key);
@@ -183,6 +268,11 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign(uint8_t *signature, si
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign_with_ctx_str(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *secret_key);
 OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_verify_with_ctx_str(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *ctx, size_t ctxlen, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key);
+OQS_API OQS_STATUS OQS_SIG_sphincs_shake_256s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key);
 #endif
 
 #endif
@@ -5,6 +5,10 @@
 #include <oqs/sig_sphincs.h>
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple)
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+static void sphincs_sha2_192s_simple_bind_impl(OQS_SIG *sig);
+#endif
+
 OQS_SIG *OQS_SIG_sphincs_sha2_192s_simple_new(void) {
 
 	OQS_SIG *sig = OQS_MEM_malloc(sizeof(OQS_SIG));
@@ -29,6 +33,30 @@ OQS_SIG *OQS_SIG_sphincs_sha2_192s_simple_new(void) {
 	sig->verify = OQS_SIG_sphincs_sha2_192s_simple_verify;
 	sig->sign_with_ctx_str = OQS_SIG_sphincs_sha2_192s_simple_sign_with_ctx_str;
 	sig->verify_with_ctx_str = OQS_SIG_sphincs_sha2_192s_simple_verify_with_ctx_str;
+	sig->length_prepared_secret_key = OQS_SIG_sphincs_sha2_192s_simple_length_prepared_secret_key;
+	sig->prepare_secret_key = OQS_SIG_sphincs_sha2_192s_simple_prepare_secret_key;
+	sig->sign_prepared = OQS_SIG_sphincs_sha2_192s_simple_sign_prepared;
+	sig->sign_prepared_threaded = OQS_SIG_sphincs_sha2_192s_simple_sign_prepared_threaded;
+	sig->length_prepared_public_key = 0;
+	sig->prepare_public_key = NULL;
+	sig->verify_prepared = NULL;
+	sig->length_stream_state = OQS_SIG_sphincs_sha2_192s_simple_length_stream_state;
+	sig->sign_init = NULL;
+	sig->sign_final = NULL;
+	sig->verify_init = OQS_SIG_sphincs_sha2_192s_simple_verify_init;
+	sig->verify_final = OQS_SIG_sphincs_sha2_192s_simple_verify_final;
+	sig->stream_update = OQS_SIG_sphincs_sha2_192s_simple_stream_update;
+	sig->stream_release = OQS_SIG_sphincs_sha2_192s_simple_stream_release;
+	sig->length_mu = 0;
+	sig->compute_mu = NULL;
+	sig->sign_mu = NULL;
+	sig->verify_mu = NULL;
+	sig->sign_prehash = NULL;
+	sig->verify_prehash = NULL;
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+	sphincs_sha2_192s_simple_bind_impl(sig);
+#endif
 
 	return sig;
 }
@@ -38,6 +66,13 @@ extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_keypair_from_fseed(ui
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk, unsigned int num_threads);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_init(void *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, void *state, const uint8_t *pk);
+extern void PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_update(void *state, const uint8_t *m, size_t mlen);
+extern void PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_release(void *state);
 
 #if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
@@ -45,6 +80,13 @@ extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_keypair_from_fseed(uin
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_pubkey_from_privkey(uint8_t *pk, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *sk);
 extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m, size_t mlen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_expand_privkey(uint8_t *esk, const uint8_t *sk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded_threaded(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen, const uint8_t *esk, unsigned int num_threads);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_init(void *state, const uint8_t *sig, size_t siglen, const uint8_t *pk);
+extern int PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_final(const uint8_t *sig, size_t siglen, void *state, const uint8_t *pk);
+extern void PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_update(void *state, const uint8_t *m, size_t mlen);
+extern void PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_release(void *state);
 #endif
 
 OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_keypair(uint8_t *public_key, uint8_t *secret_key) {
@@ -142,4 +184,273 @@ OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_with_ctx_str(const ui
 		return OQS_ERROR;
 	}
 }
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded_threaded(signature, signature_len, message, message_len, prepared_secret_key, num_threads);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded_threaded(signature, signature_len, message, message_len, prepared_secret_key, num_threads);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded_threaded(signature, signature_len, message, message_len, prepared_secret_key, num_threads);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_init(state, signature, signature_len, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_init(state, signature, signature_len, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_init(state, signature, signature_len, public_key);
+#endif
+}
+
+OQS_API OQS_STATUS OQS_SIG_sphincs_sha2_192s_simple_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_final(signature, signature_len, state, public_key);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_final(signature, signature_len, state, public_key);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_final(signature, signature_len, state, public_key);
+#endif
+}
+
+OQS_API void OQS_SIG_sphincs_sha2_192s_simple_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_update(state, chunk, chunk_len);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_update(state, chunk, chunk_len);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_update(state, chunk, chunk_len);
+#endif
+}
+
+OQS_API void OQS_SIG_sphincs_sha2_192s_simple_stream_release(void *state) {
+#if defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+#if defined(OQS_DIST_BUILD)
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+#endif /* OQS_DIST_BUILD */
+		PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_release(state);
+#if defined(OQS_DIST_BUILD)
+	} else {
+		PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_release(state);
+	}
+#endif /* OQS_DIST_BUILD */
+#else
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_release(state);
+#endif
+}
+
+#if defined(OQS_DIST_BUILD) && defined(OQS_ENABLE_SIG_sphincs_sha2_192s_simple_avx2)
+/* Implementation-specific entry points, bound by OQS_SIG_sphincs_sha2_192s_simple_new once per object. */
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_signature_expanded_threaded(signature, signature_len, message, message_len, prepared_secret_key, num_threads);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_init(state, signature, signature_len, public_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_avx2_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_final(signature, signature_len, state, public_key);
+}
+
+static void sphincs_sha2_192s_simple_avx2_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_update(state, chunk, chunk_len);
+}
+
+static void sphincs_sha2_192s_simple_avx2_stream_release(void *state) {
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_AVX2_crypto_sign_verify_release(state);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_keypair(uint8_t *public_key, uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_keypair(public_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_keypair_from_fseed(uint8_t *public_key, uint8_t *secret_key, const uint8_t *seed) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_keypair_from_fseed(public_key, secret_key, seed);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_pubkey_from_privkey(uint8_t *public_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_pubkey_from_privkey(public_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_sign(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature(signature, signature_len, message, message_len, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_verify(const uint8_t *message, size_t message_len, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify(signature, signature_len, message, message_len, public_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_prepare_secret_key(uint8_t *prepared_secret_key, const uint8_t *secret_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_expand_privkey(prepared_secret_key, secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_sign_prepared(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded(signature, signature_len, message, message_len, prepared_secret_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_sign_prepared_threaded(uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len, const uint8_t *ctx_str, size_t ctx_str_len, unsigned int num_threads, const uint8_t *prepared_secret_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_signature_expanded_threaded(signature, signature_len, message, message_len, prepared_secret_key, num_threads);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_verify_init(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *ctx_str, size_t ctx_str_len, const uint8_t *public_key) {
+	if (ctx_str != NULL || ctx_str_len != 0) {
+		return OQS_ERROR;
+	}
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_init(state, signature, signature_len, public_key);
+}
+
+static OQS_STATUS sphincs_sha2_192s_simple_clean_verify_final(void *state, const uint8_t *signature, size_t signature_len, const uint8_t *public_key) {
+	return (OQS_STATUS) PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_final(signature, signature_len, state, public_key);
+}
+
+static void sphincs_sha2_192s_simple_clean_stream_update(void *state, const uint8_t *chunk, size_t chunk_len) {
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_update(state, chunk, chunk_len);
+}
+
+static void sphincs_sha2_192s_simple_clean_stream_release(void *state) {
+	PQCLEAN_SPHINCSSHA2192SSIMPLE_CLEAN_crypto_sign_verify_release(state);
+}
+
+static void sphincs_sha2_192s_simple_bind_impl(OQS_SIG *sig) {
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_AVX2)) {
+		sig->keypair = sphincs_sha2_192s_simple_avx2_keypair;
+		sig->keypair_from_fseed = sphincs_sha2_192s_simple_avx2_keypair_from_fseed;
+		sig->pubkey_from_privkey = sphincs_sha2_192s_simple_avx2_pubkey_from_privkey;
+		sig->sign = sphincs_sha2_192s_simple_avx2_sign;
+		sig->verify = sphincs_sha2_192s_simple_avx2_verify;
+		sig->prepare_secret_key = sphincs_sha2_192s_simple_avx2_prepare_secret_key;
+		sig->sign_prepared = sphincs_sha2_192s_simple_avx2_sign_prepared;
+		sig->sign_prepared_threaded = sphincs_sha2_192s_simple_avx2_sign_prepared_threaded;
+		sig->verify_init = sphincs_sha2_192s_simple_avx2_verify_init;
+		sig->verify_final = sphincs_sha2_192s_simple_avx2_verify_final;
+		sig->stream_update = sphincs_sha2_192s_simple_avx2_stream_update;
+		sig->stream_release = sphincs_sha2_192s_simple_avx2_stream_release;
+		return;
+	}
+	sig->keypair = sphincs_sha2_192s_simple_clean_keypair;
+	sig->keypair_from_fseed = sphincs_sha2_192s_simple_clean_keypair_from_fseed;
+	sig->pubkey_from_privkey = sphincs_sha2_192s_simple_clean_pubkey_from_privkey;
+	sig->sign = sphincs_sha2_192s_simple_clean_sign;
+	sig->verify = sphincs_sha2_192s_simple_clean_verify;
+	sig->prepare_secret_key = sphincs_sha2_192s_simple_clean_prepare_secret_key;
+	sig->sign_prepared = sphincs_sha2_192s_simple_clean_sign_prepared;
+	sig->sign_prepared_threaded = sphincs_sha2_192s_simple_clean_sign_prepared_threaded;
+	sig->verify_init = sphincs_sha2_192s_simple_clean_verify_init;
+	sig->verify_final = sphincs_sha2_192s_simple_clean_verify_final;
+	sig->stream_update = sphincs_sha2_192s_simple_clean_stream_update;
+	sig->stream_release = sphincs_sha2_192s_simple_clean_stream_release;
+}
+#endif
+
 #endif
@@ -26,6 +26,9 @@
 #define MIN_HSS_LEVELS 1    /* Minumum levels we allow */
 #define MAX_HSS_LEVELS 8    /* Maximum levels we allow */
 
+/* The largest number of Winternitz chains in an LM-OTS signature (W1) */
+#define LM_OTS_MAX_P 265
+
 /* This is the length of our internal seed values */
 #define SEED_LEN 32         /* Enough to make Grover's infeasible */
 
@@ -60,6 +60,23 @@ void hss_hash(void *result, int hash_type,
     hss_zeroize(&ctx, sizeof ctx);
 }
 
+/*
+ * This hashes eight messages of the same length side by side; with SHA-256,
+ * this can use a multi-buffer implementation.  A result buffer may overlap
+ * its own message (as it does when iterating a chain in place)
+ */
+void hss_hash_x8(unsigned char *const result[8], int hash_type,
+          const unsigned char *const message[8], size_t message_len) {
+    switch (hash_type) {
+    case HASH_SHA256:
+        OQS_SHA2_sha256_x8(result[0], result[1], result[2], result[3],
+                           result[4], result[5], result[6], result[7],
+                           message[0], message[1], message[2], message[3],
+                           message[4], message[5], message[6], message[7],
+                           message_len);
+        break;
+    }
+}
 
 /*
  * This provides an API to do incremental hashing.  We use it when hashing the
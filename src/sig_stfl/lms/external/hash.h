@@ -34,6 +34,10 @@ void hss_hash(void *result, int hash_type,
 void hss_hash_ctx(void *result, int hash_type, union hash_context *ctx,
           const void *message, size_t message_len);
 
+/* Hash eight equal-length messages at once, into eight result buffers */
+void hss_hash_x8(unsigned char *const result[8], int hash_type,
+          const unsigned char *const message[8], size_t message_len);
+
 /*
  * This is a debugging flag; turning this on will cause the system to dump
  * the inputs and the outputs of all hash functions.  It only works if
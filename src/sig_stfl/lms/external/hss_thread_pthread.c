@@ -3,6 +3,7 @@
 
 #include <pthread.h>
 #include <string.h>
+#include <oqs/common.h>
 
 /*
  * This is an implementation of our threaded abstraction using the
@@ -3,9 +3,12 @@
  * This is the code that implements the one-time-signature part of the LMS hash
  * based signatures
  */
+#include <string.h>
 #include "lm_ots_common.h"
 #include "common_defs.h"
 #include "hash.h"
+#include "endian.h"
+#include "hss_zeroize.h"
 
 /*
  * Convert the external name of a parameter set into the set of values we care
@@ -98,3 +101,92 @@ unsigned lm_ots_compute_checksum(const unsigned char *Q, unsigned Q_len,
     }
     return sum << ls;
 }
+
+/*
+ * This advances the p Winternitz chains in y (n bytes each, in place) from
+ * digit begin[i] to digit end[i]; a NULL begin means 0 and a NULL end means
+ * the top of the chain (2**w-1).
+ *
+ * This is where we spend the majority of the time during key gen, signing
+ * and verification, so the chains are run eight at a time through
+ * hss_hash_x8.  Each of the eight lanes holds one chain; when a chain is
+ * done, its lane is refilled with the next one, so chains of different
+ * lengths still share hash calls.  Once fewer than eight chains are left,
+ * they are finished one at a time.
+ */
+void lm_ots_run_chains(int h, unsigned n, unsigned w,
+                       const unsigned char *I, merkle_index_t q,
+                       unsigned p, unsigned char *y,
+                       const unsigned *begin, const unsigned *end) {
+    unsigned char buf[8][ITER_MAX_LEN];
+    unsigned char *lane[8];         /* The iteration buffer of each lane */
+    unsigned lane_chain[8];         /* Which chain the lane is working on */
+    unsigned lane_end[8];           /* Where that chain stops */
+    unsigned char *result[8];
+    const unsigned char *message[8];
+    unsigned max_digit = (1<<w) - 1;
+    unsigned active = 0;
+    unsigned next = 0;
+    unsigned i, j;
+    union hash_context ctx;
+
+    for (i=0; i<8; i++) {
+        lane[i] = buf[i];
+        memcpy( buf[i] + ITER_I, I, I_LEN );
+        put_bigendian( buf[i] + ITER_Q, q, 4 );
+    }
+
+    for (;;) {
+        /* Fill the idle lanes with chains that still have work to do */
+        while (active < 8 && next < p) {
+            unsigned b = begin ? begin[next] : 0;
+            unsigned e = end ? end[next] : max_digit;
+            if (b < e) {
+                unsigned char *t = lane[active];
+                put_bigendian( t + ITER_K, next, 2 );
+                t[ITER_J] = (unsigned char)b;
+                memcpy( t + ITER_PREV, y + next*n, n );
+                lane_chain[active] = next;
+                lane_end[active] = e;
+                active++;
+            }
+            next++;
+        }
+        if (active < 8) break;
+
+        for (i=0; i<8; i++) {
+            result[i] = lane[i] + ITER_PREV;
+            message[i] = lane[i];
+        }
+        hss_hash_x8( result, h, message, ITER_LEN(n) );
+
+        /* Step every lane; a finished chain is written back, and its lane */
+        /* is swapped with the last active one */
+        for (i=0; i<active; ) {
+            unsigned char *t = lane[i];
+            t[ITER_J] += 1;
+            if (t[ITER_J] == lane_end[i]) {
+                memcpy( y + lane_chain[i]*n, t + ITER_PREV, n );
+                active--;
+                lane[i] = lane[active]; lane[active] = t;
+                lane_chain[i] = lane_chain[active];
+                lane_end[i] = lane_end[active];
+            } else {
+                i++;
+            }
+        }
+    }
+
+    /* Finish off the chains that didn't fill all eight lanes */
+    for (i=0; i<active; i++) {
+        unsigned char *t = lane[i];
+        for (j=t[ITER_J]; j<lane_end[i]; j++) {
+            t[ITER_J] = (unsigned char)j;
+            hss_hash_ctx( t + ITER_PREV, h, &ctx, t, ITER_LEN(n) );
+        }
+        memcpy( y + lane_chain[i]*n, t + ITER_PREV, n );
+    }
+
+    hss_zeroize( buf, sizeof buf );
+    hss_zeroize( &ctx, sizeof ctx );
+}
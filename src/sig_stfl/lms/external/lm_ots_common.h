@@ -14,5 +14,9 @@ unsigned lm_ots_hashes_per_public_key(param_set_t lm_ots_type);
 unsigned lm_ots_compute_checksum(const unsigned char *Q, unsigned Q_len,
                                  unsigned w, unsigned ls);
 unsigned lm_ots_coef(const unsigned char *Q, unsigned i, unsigned w);
+void lm_ots_run_chains(int h, unsigned n, unsigned w,
+                       const unsigned char *I, merkle_index_t q,
+                       unsigned p, unsigned char *y,
+                       const unsigned *begin, const unsigned *end);
 
 #endif /* LM_OTS_COMMON_H_ */
@@ -39,36 +39,25 @@ bool lm_ots_generate_public_key(
     }
 
     /* Now generate the public key */
-    /* This is where we spend the majority of the time during key gen and */
-    /* signing operations; it would make sense to attempt to try to take */
-    /* advantage of parallel (SIMD) hardware; even if we use it nowhere */
-    /* else, we'd get a significant speed up */
-    unsigned i, j;
-
-    unsigned char buf[ ITER_MAX_LEN ];
-    memcpy( buf + ITER_I, I, I_LEN );
-    put_bigendian( buf + ITER_Q, q, 4 );
-    union hash_context ctx;
+    /* Derive the start of every chain, and then run them all to the top */
+    /* (lm_ots_run_chains does them several at a time) */
+    unsigned i;
+    unsigned char y[ LM_OTS_MAX_P * MAX_HASH ];
 
     hss_seed_derive_set_j( seed, 0 );
 
     for (i=0; i<p; i++) {
-        hss_seed_derive( buf + ITER_PREV, seed, i < p-1 );
-        put_bigendian( buf + ITER_K, i, 2 );
-        /* We'll place j in the buffer below */
-        for (j=0; j < (unsigned)(1<<w) - 1; j++) {
-            buf[ITER_J] = j;
-
-            hss_hash_ctx( buf + ITER_PREV, h, &ctx, buf, ITER_LEN(n) );
-        }
-        /* Include that in the hash */
-        hss_update_hash_context(h, &public_ctx, buf + ITER_PREV, n );
+        hss_seed_derive( y + i*n, seed, i < p-1 );
     }
+    lm_ots_run_chains( h, n, w, I, q, p, y, NULL, NULL );
+
+    /* Include the chain ends in the hash */
+    hss_update_hash_context(h, &public_ctx, y, p*n );
 
     /* And the result of the running hash is the public key */
     hss_finalize_hash_context( h, &public_ctx, public_key );
 
-    hss_zeroize( &ctx, sizeof ctx );
+    hss_zeroize( y, p*n );
 
     return true;
 }
@@ -144,24 +133,17 @@ bool lm_ots_generate_signature(
     put_bigendian( &Q[n], lm_ots_compute_checksum(Q, n, w, ls), 2 );
 
     unsigned i;
-    unsigned char tmp[ITER_MAX_LEN];
-
-    /* Preset the parts of tmp that don't change */
-    memcpy( tmp + ITER_I, I, I_LEN );
-    put_bigendian( tmp + ITER_Q, q, 4 );
+    unsigned coef[LM_OTS_MAX_P];
+    unsigned char *y = &signature[ 4 + n ];
 
+    /* Place the start of every chain in the signature, and then advance */
+    /* each one to its digit of Q */
     hss_seed_derive_set_j( seed, 0 );
     for (i=0; i<p; i++) {
-        put_bigendian( tmp + ITER_K, i, 2 );
-        hss_seed_derive( tmp + ITER_PREV, seed, i<p-1 );
-        unsigned a = lm_ots_coef( Q, i, w );
-        unsigned j;
-        for (j=0; j<a; j++) {
-            tmp[ITER_J] = j;
-            hss_hash_ctx( tmp + ITER_PREV, h, &ctx, tmp, ITER_LEN(n) );
-        }
-        memcpy( &signature[ 4 + n + n*i ], tmp + ITER_PREV, n );
+        hss_seed_derive( y + n*i, seed, i<p-1 );
+        coef[i] = lm_ots_coef( Q, i, w );
     }
+    lm_ots_run_chains( h, n, w, I, q, p, y, NULL, coef );
 
     hss_zeroize( &ctx, sizeof ctx );
 
@@ -91,26 +91,17 @@ bool lm_ots_validate_signature_compute(
     }
 
     unsigned i;
-    unsigned char tmp[ITER_MAX_LEN];
+    unsigned coef[LM_OTS_MAX_P];
+    unsigned char tmp[LM_OTS_MAX_P * MAX_HASH];
 
-    /* Preset the parts of tmp that don't change */
-    memcpy( tmp + ITER_I, I, I_LEN );
-    put_bigendian( tmp + ITER_Q, q, 4 );
-
-    unsigned max_digit = (1<<w) - 1;
+    /* Run every chain from its digit of Q to the top */
+    memcpy( tmp, y, p*n );
     for (i=0; i<p; i++) {
-        put_bigendian( tmp + ITER_K, i, 2 );
-        memcpy( tmp + ITER_PREV, y + i*n, n );
-        unsigned a = lm_ots_coef( Q, i, w );
-        unsigned j;
-        for (j=a; j<max_digit; j++) {
-            union hash_context ctx;
-            tmp[ITER_J] = j;
-            hss_hash_ctx( tmp + ITER_PREV, h, &ctx, tmp, ITER_LEN(n) );
-        }
-
-        hss_update_hash_context(h, &final_ctx, tmp + ITER_PREV, n );
+        coef[i] = lm_ots_coef( Q, i, w );
     }
+    lm_ots_run_chains( h, n, w, I, q, p, tmp, coef, NULL );
+
+    hss_update_hash_context(h, &final_ctx, tmp, p*n );
 
     /* Ok, finalize the public key hash */
     hss_finalize_hash_context( h, &final_ctx, computed_public_key );
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 
+#include <limits.h>
 #include <string.h>
 #include <oqs/oqs.h>
 #include "sig_stfl_lms.h"
@@ -48,6 +49,9 @@ typedef struct OQS_LMS_KEY_DATA {
 	/* secret key data */
 	uint8_t *sec_key;
 
+	/* Loaded working key, kept for the lifetime of the secret key object */
+	struct hss_working_key *working_key;
+
 	/* app specific */
 	void *context;
 } oqs_lms_key_data;
@@ -208,6 +212,11 @@ OQS_API OQS_STATUS OQS_SIG_STFL_lms_sigs_total(unsigned long long *total, const
 		return OQS_ERROR;
 	}
 
+	if (oqs_key_data->working_key) {
+		*total = (unsigned long long)oqs_key_data->working_key->max_count;
+		return OQS_SUCCESS;
+	}
+
 	working_key = hss_load_private_key(NULL, priv_key,
 	                                   0,
 	                                   NULL,
@@ -226,6 +235,14 @@ OQS_API OQS_STATUS OQS_SIG_STFL_lms_sigs_total(unsigned long long *total, const
  * identify the parameter set to be used
  */
 
+#ifdef OQS_ALLOW_LMS_KEY_AND_SIG_GEN
+/* Pass the secret key's thread count on to the HSS library */
+static void lms_init_extra_info(struct hss_extra_info *info, const OQS_SIG_STFL_SECRET_KEY *sk) {
+	hss_init_extra_info(info);
+	hss_extra_info_set_threads(info, sk->num_threads > INT_MAX ? INT_MAX : (int)sk->num_threads);
+}
+#endif
+
 bool LMS_randombytes(void *buffer, size_t length) {
 
 	OQS_randombytes((uint8_t *)buffer, length);
@@ -245,6 +262,7 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 
 	size_t len_public_key = 60;
 	oqs_lms_key_data *oqs_key_data = NULL;
+	struct hss_extra_info info;
 
 	if (!pk || !sk || !oid) {
 		return -1;
@@ -483,6 +501,8 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 		return -1;
 	}
 
+	lms_init_extra_info(&info, sk);
+
 	/*
 	 * This creates a private key (and the correspond public key, and optionally
 	 * the aux data for that key)
@@ -522,7 +542,7 @@ int oqs_sig_stfl_lms_keypair(uint8_t *pk, OQS_SIG_STFL_SECRET_KEY *sk, const uin
 	            oqs_key_data->sec_key,
 	            oqs_key_data->public_key, len_public_key,
 	            oqs_key_data->aux_data, oqs_key_data->len_aux_data,
-	            NULL);
+	            &info);
 	if (b_ret) {
 		memcpy(pk, oqs_key_data->public_key, len_public_key);
 		sk->secret_key_data = oqs_key_data;
@@ -551,72 +571,59 @@ int oqs_sig_stfl_lms_sign(OQS_SIG_STFL_SECRET_KEY *sk,
 
 	size_t sig_len;
 	bool status;
-	uint8_t *sig = NULL;
 	uint8_t *priv_key = NULL;
 	oqs_lms_key_data *oqs_key_data = NULL;
 	struct hss_working_key *w = NULL;
-	struct hss_sign_inc ctx;
-	if (sk) {
+	struct hss_extra_info info;
+	if (sk && sk->secret_key_data) {
 		oqs_key_data = sk->secret_key_data;
 		priv_key = oqs_key_data->sec_key;
 	} else {
 		return -1;
 	}
-	w = hss_load_private_key(NULL, priv_key,
-	                         0,
-	                         NULL,
-	                         0,
-	                         0);
+
+	/*
+	 * Load the working key on first use only; it tracks the private key
+	 * in place from then on, so later signatures only advance the Merkle
+	 * auth path instead of rebuilding it from the seed.
+	 */
+	lms_init_extra_info(&info, sk);
+	w = oqs_key_data->working_key;
 	if (!w) {
-		hss_free_working_key(w);
-		return 0;
+		w = hss_load_private_key(NULL, priv_key,
+		                         0,
+		                         oqs_key_data->aux_data,
+		                         oqs_key_data->len_aux_data,
+		                         &info);
+		if (!w) {
+			return -1;
+		}
+		oqs_key_data->working_key = w;
 	}
 
-	/* Now, go through the file list, and generate the signatures for each */
-
 	/* Look up the signature length */
 
 	sig_len = hss_get_signature_len_from_working_key(w);
 	if (sig_len == 0) {
-		hss_free_working_key(w);
-		return 0;
-	}
-
-	sig = OQS_MEM_malloc(sig_len);
-	if (!sig) {
-		hss_free_working_key(w);
 		return -1;
 	}
 
-	(void)hss_sign_init(
-	    &ctx,                 /* Incremental signing context */
-	    w,                    /* Working key */
-	    NULL,                 /* Routine to update the */
-	    priv_key,       /* private key */
-	    sig, sig_len,         /* Where to place the signature */
-	    0);
-
-	(void)hss_sign_update(
-	    &ctx,           /* Incremental signing context */
-	    m,         /* Next piece of the message */
-	    mlen);             /* Length of this piece */
-
-	status = hss_sign_finalize(
-	             &ctx,               /* Incremental signing context */
+	status = hss_generate_signature(
 	             w,                  /* Working key */
-	             sig,                /* Signature */
-	             0);
+	             NULL,               /* Routine to update the */
+	             priv_key,           /* private key */
+	             m, mlen,            /* Message to sign */
+	             signature, sig_len, /* Where to place the signature */
+	             &info);
 
 	if (!status) {
+		/* Drop the working key; it is reloaded from the private key on the next call */
 		hss_free_working_key(w);
-		OQS_MEM_insecure_free(sig);
+		oqs_key_data->working_key = NULL;
 		return -1;
 	}
 
 	*signature_len = sig_len;
-	memcpy(signature, sig, sig_len);
-	OQS_MEM_insecure_free(sig);
-	hss_free_working_key(w);
 
 	return 0;
 }
@@ -661,6 +668,9 @@ void oqs_secret_lms_key_free(OQS_SIG_STFL_SECRET_KEY *sk) {
 	if (sk->secret_key_data) {
 		oqs_lms_key_data *key_data = (oqs_lms_key_data *)sk->secret_key_data;
 		if (key_data) {
+			hss_free_working_key(key_data->working_key);
+			key_data->working_key = NULL;
+
 			OQS_MEM_secure_free(key_data->sec_key, key_data->len_sec_key);
 			key_data->sec_key = NULL;
 
@@ -767,6 +777,7 @@ OQS_STATUS oqs_deserialize_lms_key(OQS_SIG_STFL_SECRET_KEY *sk, const uint8_t *s
 		goto err;
 	}
 
+	memset(lms_key_data, 0, sizeof(oqs_lms_key_data));
 	memcpy(lms_sk, sk_buf, lms_sk_len);
 	lms_key_data->sec_key = lms_sk;
 	lms_key_data->len_sec_key = lms_sk_len;
@@ -1570,6 +1570,14 @@ OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_mutex(OQS_SIG_STFL_SECRET_KEY *sk, void
 	sk->mutex = mutex;
 }
 
+/*  OQS_SIG_STFL_SECRET_KEY_SET_threads */
+OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_threads(OQS_SIG_STFL_SECRET_KEY *sk, unsigned int num_threads) {
+	if (sk == NULL) {
+		return;
+	}
+	sk->num_threads = num_threads;
+}
+
 /* OQS_SIG_STFL_SECRET_KEY_lock  */
 OQS_STATUS OQS_SIG_STFL_SECRET_KEY_lock(OQS_SIG_STFL_SECRET_KEY *sk) {
 	if (sk == NULL) {
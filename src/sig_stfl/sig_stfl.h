@@ -315,6 +315,9 @@ typedef struct OQS_SIG_STFL_SECRET_KEY {
 	/* Application-managed data related to secure storage of secret key data */
 	void *context;
 
+	/* Number of threads to use when building or rebuilding the key's trees (0 = implementation default) */
+	unsigned int num_threads;
+
 	/**
 	 * Serialize the stateful secret key.
 	 *
@@ -575,6 +578,20 @@ OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_unlock(OQS_SIG_STFL_SECRET_KEY *sk, unl
  */
 OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_mutex(OQS_SIG_STFL_SECRET_KEY *sk, void *mutex);
 
+/**
+ * Set the number of threads used to build and rebuild the trees of a secret key.
+ *
+ * The value is used by key generation and by the tree updates performed while signing.
+ * It only has an effect for schemes and builds with a threaded implementation (LMS with
+ * `OQS_LMS_USE_PTHREADS`, XMSS key generation with `OQS_XMSS_USE_PTHREADS`); otherwise the
+ * work is always done on the calling thread.
+ *
+ * @param[in] sk Pointer to the secret key object.
+ * @param[in] num_threads Maximum number of threads to use; 0 selects the implementation default.
+ * @return None.
+ */
+OQS_API void OQS_SIG_STFL_SECRET_KEY_SET_threads(OQS_SIG_STFL_SECRET_KEY *sk, unsigned int num_threads);
+
 /**
  * Lock the secret key to ensure exclusive access in a concurrent environment.
  *
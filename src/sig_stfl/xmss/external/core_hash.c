@@ -37,3 +37,27 @@ int core_hash(const xmss_params *params,
 
 	return 0;
 }
+
+#if defined(XMSS_CORE_HASH_X8)
+int core_hash_x8(const xmss_params *params,
+                 unsigned char *const out[8],
+                 const unsigned char *const in[8], unsigned long long inlen) {
+
+	(void)params;
+#if HASH == XMSS_CORE_HASH_SHA256_N24
+	unsigned char buf[8][32];
+	unsigned int i;
+	OQS_SHA2_sha256_x8(buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], buf[7],
+	                   in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], inlen);
+	for (i = 0; i < 8; i++) {
+		memcpy(out[i], buf[i], 24);
+	}
+
+#else
+	OQS_SHA2_sha256_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7],
+	                   in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], inlen);
+#endif
+
+	return 0;
+}
+#endif
@@ -21,4 +21,14 @@ int core_hash(const xmss_params *params,
               unsigned char *out,
               const unsigned char *in, unsigned long long inlen);
 
+/* The SHA-256 parameter sets can hash eight equal-length inputs at once. */
+#if HASH == XMSS_CORE_HASH_SHA256_N24 || HASH == XMSS_CORE_HASH_SHA256_N32
+#define XMSS_CORE_HASH_X8
+
+#define core_hash_x8 XMSS_PARAMS_INNER_CORE_HASH(core_hash_x8)
+int core_hash_x8(const xmss_params *params,
+                 unsigned char *const out[8],
+                 const unsigned char *const in[8], unsigned long long inlen);
+#endif
+
 #endif
@@ -2,6 +2,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <oqs/common.h>
 #include <oqs/sha2.h>
 #include <oqs/sha3.h>
 
@@ -152,3 +153,121 @@ int thash_f(const xmss_params *params,
 
     return ret;
 }
+
+#if defined(XMSS_CORE_HASH_X8)
+/* Large enough for the padding and inputs of every SHA-256 parameter set. */
+#define XMSS_X8_BUF_BYTES (32 + 3 * 32)
+
+/*
+ * Computes the eight PRF(pub_seed, addr[i]) values of a thash call, after
+ * setting key_and_mask in every lane address.
+ */
+static void prf_x8(const xmss_params *params, unsigned char *const out[8],
+                   const unsigned char *pub_seed, uint32_t addr[8][8],
+                   uint32_t key_and_mask)
+{
+    unsigned char bufs[8][XMSS_X8_BUF_BYTES];
+    const unsigned char *in[8];
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        set_key_and_mask(addr[i], key_and_mask);
+        ull_to_bytes(bufs[i], params->padding_len, XMSS_HASH_PADDING_PRF);
+        memcpy(bufs[i] + params->padding_len, pub_seed, params->n);
+        addr_to_bytes(bufs[i] + params->padding_len + params->n, addr[i]);
+        in[i] = bufs[i];
+    }
+    core_hash_x8(params, out, in, params->padding_len + params->n + 32);
+}
+
+void prf_keygen_x8(const xmss_params *params,
+                   unsigned char *const out[8], const unsigned char *const in[8],
+                   const unsigned char *key)
+{
+    unsigned char bufs[8][XMSS_X8_BUF_BYTES];
+    const unsigned char *lanes[8];
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        ull_to_bytes(bufs[i], params->padding_len, XMSS_HASH_PADDING_PRF_KEYGEN);
+        memcpy(bufs[i] + params->padding_len, key, params->n);
+        memcpy(bufs[i] + params->padding_len + params->n, in[i], params->n + 32);
+        lanes[i] = bufs[i];
+    }
+    core_hash_x8(params, out, lanes, params->padding_len + 2*params->n + 32);
+
+    OQS_MEM_cleanse(bufs, sizeof(bufs));
+}
+
+/*
+ * All inputs are consumed before any output is written, so out[i] may alias
+ * any in[j].
+ */
+void thash_h_x8(const xmss_params *params,
+                unsigned char *const out[8], const unsigned char *const in[8],
+                const unsigned char *pub_seed, uint32_t addr[8][8])
+{
+    unsigned char bufs[8][XMSS_X8_BUF_BYTES];
+    unsigned char bitmasks[8][2 * 32];
+    unsigned char *keys[8];
+    unsigned char *masks[8];
+    const unsigned char *lanes[8];
+    unsigned int i, j;
+
+    for (i = 0; i < 8; i++) {
+        ull_to_bytes(bufs[i], params->padding_len, XMSS_HASH_PADDING_H);
+        keys[i] = bufs[i] + params->padding_len;
+        lanes[i] = bufs[i];
+    }
+    prf_x8(params, keys, pub_seed, addr, 0);
+
+    for (i = 0; i < 8; i++) {
+        masks[i] = bitmasks[i];
+    }
+    prf_x8(params, masks, pub_seed, addr, 1);
+
+    for (i = 0; i < 8; i++) {
+        masks[i] = bitmasks[i] + params->n;
+    }
+    prf_x8(params, masks, pub_seed, addr, 2);
+
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < 2 * params->n; j++) {
+            bufs[i][params->padding_len + params->n + j] = in[i][j] ^ bitmasks[i][j];
+        }
+    }
+    core_hash_x8(params, out, lanes, params->padding_len + 3 * params->n);
+}
+
+/*
+ * All inputs are consumed before any output is written, so out[i] may alias
+ * any in[j].
+ */
+void thash_f_x8(const xmss_params *params,
+                unsigned char *const out[8], const unsigned char *const in[8],
+                const unsigned char *pub_seed, uint32_t addr[8][8])
+{
+    unsigned char bufs[8][XMSS_X8_BUF_BYTES];
+    unsigned char bitmasks[8][32];
+    unsigned char *keys[8];
+    unsigned char *masks[8];
+    const unsigned char *lanes[8];
+    unsigned int i, j;
+
+    for (i = 0; i < 8; i++) {
+        ull_to_bytes(bufs[i], params->padding_len, XMSS_HASH_PADDING_F);
+        keys[i] = bufs[i] + params->padding_len;
+        masks[i] = bitmasks[i];
+        lanes[i] = bufs[i];
+    }
+    prf_x8(params, keys, pub_seed, addr, 0);
+    prf_x8(params, masks, pub_seed, addr, 1);
+
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < params->n; j++) {
+            bufs[i][params->padding_len + params->n + j] = in[i][j] ^ bitmasks[i][j];
+        }
+    }
+    core_hash_x8(params, out, lanes, params->padding_len + 2 * params->n);
+}
+#endif
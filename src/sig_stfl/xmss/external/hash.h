@@ -39,6 +39,24 @@ int thash_f(const xmss_params *params,
             const unsigned char *pub_seed, uint32_t addr[8],
             unsigned char *buf);
 
+#if defined(XMSS_CORE_HASH_X8)
+/* Eight-way versions of the functions above; lane i uses addr[i]. */
+#define prf_keygen_x8 XMSS_INNER_NAMESPACE(prf_keygen_x8)
+void prf_keygen_x8(const xmss_params *params,
+                   unsigned char *const out[8], const unsigned char *const in[8],
+                   const unsigned char *key);
+
+#define thash_h_x8 XMSS_INNER_NAMESPACE(thash_h_x8)
+void thash_h_x8(const xmss_params *params,
+                unsigned char *const out[8], const unsigned char *const in[8],
+                const unsigned char *pub_seed, uint32_t addr[8][8]);
+
+#define thash_f_x8 XMSS_INNER_NAMESPACE(thash_f_x8)
+void thash_f_x8(const xmss_params *params,
+                unsigned char *const out[8], const unsigned char *const in[8],
+                const unsigned char *pub_seed, uint32_t addr[8][8]);
+#endif
+
 #define hash_message XMSS_INNER_NAMESPACE(hash_message)
 int hash_message(const xmss_params *params, unsigned char *out,
                  const unsigned char *R, const unsigned char *root,
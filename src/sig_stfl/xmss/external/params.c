@@ -749,6 +749,7 @@ int xmss_xmssmt_initialize_params(xmss_params *params)
 
     params->pk_bytes = 2 * params->n;
     params->sk_bytes = xmss_xmssmt_core_sk_bytes(params);
+    params->num_threads = 0;
 
     return 0;
 }
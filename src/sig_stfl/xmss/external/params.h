@@ -32,6 +32,7 @@ typedef struct {
     unsigned int pk_bytes;
     unsigned long long sk_bytes;
     unsigned int bds_k;
+    unsigned int num_threads;
 } xmss_params;
 
 /**
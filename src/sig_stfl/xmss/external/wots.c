@@ -17,19 +17,40 @@ static void expand_seed(const xmss_params *params,
                         const unsigned char *pub_seed, uint32_t addr[8],
                         unsigned char *buf)
 {
-    unsigned int i;
+    unsigned int i = 0;
     unsigned char *prf_buf = buf + params->n + 32;
+#if defined(XMSS_CORE_HASH_X8)
+    unsigned char lane_bufs[8][32 + 32];
+    unsigned char *lane_out[8];
+    const unsigned char *lane_in[8];
+    unsigned int j;
+#endif
 
     set_hash_addr(addr, 0);
     set_key_and_mask(addr, 0);
     memcpy(buf, pub_seed, params->n);
-    for (i = 0; i < params->wots_len; i++) {
+#if defined(XMSS_CORE_HASH_X8)
+    for (j = 0; j < 8; j++) {
+        memcpy(lane_bufs[j], pub_seed, params->n);
+        lane_in[j] = lane_bufs[j];
+    }
+    for (; i + 8 <= params->wots_len; i += 8) {
+        for (j = 0; j < 8; j++) {
+            set_chain_addr(addr, i + j);
+            addr_to_bytes(lane_bufs[j] + params->n, addr);
+            lane_out[j] = outseeds + (i + j)*params->n;
+        }
+        prf_keygen_x8(params, lane_out, lane_in, inseed);
+    }
+#endif
+    for (; i < params->wots_len; i++) {
         set_chain_addr(addr, i);
         addr_to_bytes(buf + params->n, addr);
         prf_keygen(params, outseeds + i*params->n, buf, inseed, prf_buf);
     }
 }
 
+#if !defined(XMSS_CORE_HASH_X8)
 /**
  * Computes the chaining function.
  * out and in have to be n-byte arrays.
@@ -54,6 +75,98 @@ static void gen_chain(const xmss_params *params,
         thash_f(params, out, out, pub_seed, addr, thash_buf);
     }
 }
+#endif
+
+/**
+ * Runs gen_chain over all wots_len chains, chain i starting from
+ * in + i*n at position start[i] (0 if start is NULL) and taking steps[i]
+ * steps (up to w - 1 if steps is NULL). out and in may be equal.
+ *
+ * With an eight-way hash, chains are kept in eight lanes that are refilled
+ * as soon as a chain reaches its end, so chains of different lengths still
+ * share hash calls; the last few chains are finished one at a time.
+ */
+static void gen_chains(const xmss_params *params,
+                       unsigned char *out, const unsigned char *in,
+                       const unsigned int *start, const unsigned int *steps,
+                       const unsigned char *pub_seed, uint32_t addr[8],
+                       unsigned char *thash_buf)
+{
+    unsigned int i;
+#if defined(XMSS_CORE_HASH_X8)
+    uint32_t lane_addr[8][8];
+    unsigned char *lane_out[8];
+    const unsigned char *lane_in[8];
+    unsigned int lane_pos[8];
+    unsigned int lane_end[8];
+    unsigned int active = 0;
+    unsigned int next = 0;
+    unsigned int s, e, j;
+
+    if (out != in) {
+        memcpy(out, in, params->wots_len * params->n);
+    }
+
+    while (1) {
+        /* Refill idle lanes with chains that still have steps to take. */
+        while (active < 8 && next < params->wots_len) {
+            s = start == NULL ? 0 : start[next];
+            e = steps == NULL ? params->wots_w - 1 : s + steps[next];
+            if (e > params->wots_w) {
+                e = params->wots_w;
+            }
+            if (s < e) {
+                memcpy(lane_addr[active], addr, sizeof(lane_addr[active]));
+                set_chain_addr(lane_addr[active], next);
+                lane_out[active] = out + next*params->n;
+                lane_pos[active] = s;
+                lane_end[active] = e;
+                active++;
+            }
+            next++;
+        }
+        if (active < 8) {
+            break;
+        }
+
+        for (j = 0; j < 8; j++) {
+            set_hash_addr(lane_addr[j], lane_pos[j]);
+            lane_in[j] = lane_out[j];
+        }
+        thash_f_x8(params, lane_out, lane_in, pub_seed, lane_addr);
+
+        /* Retire finished chains by moving the last active lane into their slot. */
+        for (j = 0; j < active;) {
+            lane_pos[j]++;
+            if (lane_pos[j] == lane_end[j]) {
+                active--;
+                memcpy(lane_addr[j], lane_addr[active], sizeof(lane_addr[j]));
+                lane_out[j] = lane_out[active];
+                lane_pos[j] = lane_pos[active];
+                lane_end[j] = lane_end[active];
+            }
+            else {
+                j++;
+            }
+        }
+    }
+
+    for (j = 0; j < active; j++) {
+        for (i = lane_pos[j]; i < lane_end[j]; i++) {
+            set_hash_addr(lane_addr[j], i);
+            thash_f(params, lane_out[j], lane_out[j], pub_seed, lane_addr[j], thash_buf);
+        }
+    }
+#else
+    for (i = 0; i < params->wots_len; i++) {
+        set_chain_addr(addr, i);
+        gen_chain(params, out + i*params->n, in + i*params->n,
+                  start == NULL ? 0 : start[i],
+                  steps == NULL ? params->wots_w - 1 - (start == NULL ? 0 : start[i]) : steps[i],
+                  pub_seed, addr, thash_buf);
+    }
+#endif
+}
 
 /**
  * base_w algorithm as described in draft.
@@ -127,7 +240,6 @@ void wots_pkgen(const xmss_params *params,
                 unsigned char *pk, const unsigned char *seed,
                 const unsigned char *pub_seed, uint32_t addr[8])
 {
-    unsigned int i;
     const size_t buf_size = 2 * params->padding_len + 4 * params->n + 64;
     unsigned char *buf = OQS_MEM_malloc(buf_size);
     if (buf == NULL) {
@@ -137,11 +249,7 @@ void wots_pkgen(const xmss_params *params,
     /* The WOTS+ private key is derived from the seed. */
     expand_seed(params, pk, seed, pub_seed, addr, buf);
 
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, pk + i*params->n, pk + i*params->n,
-                  0, params->wots_w - 1, pub_seed, addr, buf);
-    }
+    gen_chains(params, pk, pk, NULL, NULL, pub_seed, addr, buf);
 
     OQS_MEM_secure_free(buf, buf_size);
 }
@@ -158,7 +266,6 @@ void wots_sign(const xmss_params *params,
     const size_t buf_size = 2 * params->padding_len + 4 * params->n + 64;
     unsigned int *lengths = OQS_MEM_calloc(params->wots_len, sizeof(unsigned int));
     unsigned char *buf = OQS_MEM_malloc(buf_size);
-    unsigned int i;
     if (lengths == NULL || buf == NULL) {
         return;
     }
@@ -168,11 +275,7 @@ void wots_sign(const xmss_params *params,
     /* The WOTS+ private key is derived from the seed. */
     expand_seed(params, sig, seed, pub_seed, addr, buf);
 
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, sig + i*params->n, sig + i*params->n,
-                  0, lengths[i], pub_seed, addr, buf);
-    }
+    gen_chains(params, sig, sig, NULL, lengths, pub_seed, addr, buf);
 
     OQS_MEM_insecure_free(lengths);
     OQS_MEM_secure_free(buf, buf_size);
@@ -190,18 +293,13 @@ void wots_pk_from_sig(const xmss_params *params, unsigned char *pk,
     unsigned int *lengths = OQS_MEM_calloc(params->wots_len, sizeof(unsigned int ));
     const size_t thash_buf_len = 2 * params->padding_len + 4 * params->n + 32;
     unsigned char *thash_buf = OQS_MEM_malloc(thash_buf_len);
-    unsigned int i;
     if (lengths == NULL || thash_buf == NULL) {
         return;
     }
 
     chain_lengths(params, lengths, msg);
 
-    for (i = 0; i < params->wots_len; i++) {
-        set_chain_addr(addr, i);
-        gen_chain(params, pk + i*params->n, sig + i*params->n,
-                  lengths[i], params->wots_w - 1 - lengths[i], pub_seed, addr, thash_buf);
-    }
+    gen_chains(params, pk, sig, lengths, NULL, pub_seed, addr, thash_buf);
 
     OQS_MEM_insecure_free(lengths);
     OQS_MEM_insecure_free(thash_buf);
@@ -28,17 +28,21 @@ it falls back to the regular XMSS core functions. */
  * @param oid The `oid` parameter is an identifier for the XMSS variant to be used. It is used to
  * determine the parameters for the XMSS algorithm, such as the tree height and the number of signature
  * iterations. The `oid` value is typically encoded as a 32-bit integer
+ * @param num_threads The maximum number of threads used to compute the tree leaves when built with
+ * OQS_XMSS_USE_PTHREADS. 0 uses one thread per online CPU. Ignored otherwise.
  * 
  * @return an integer value. If the function executes successfully, it will return 0. If there is an
  * error, it will return -1.
  */
 #ifndef OQS_ALLOW_XMSS_KEY_AND_SIG_GEN
-int xmss_keypair(XMSS_UNUSED_ATT unsigned char *pk, XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT const uint32_t oid)
+int xmss_keypair(XMSS_UNUSED_ATT unsigned char *pk, XMSS_UNUSED_ATT unsigned char *sk, XMSS_UNUSED_ATT const uint32_t oid,
+                 XMSS_UNUSED_ATT unsigned int num_threads)
 {
     return -1;
 }
 #else
-int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
+int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                 unsigned int num_threads)
 {
     xmss_params params;
     unsigned int i;
@@ -46,6 +50,7 @@ int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
     if (xmss_parse_oid(&params, oid)) {
         return -1;
     }
+    params.num_threads = num_threads;
     for (i = 0; i < XMSS_OID_LEN; i++) {
         pk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
         /* For an implementation that uses runtime parameters, it is crucial
@@ -194,7 +199,8 @@ int xmss_total_signatures(unsigned long long *max, const unsigned  char *sk)
     return 0;
 }
 
-int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
+int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                   unsigned int num_threads)
 {
     xmss_params params;
     unsigned int i;
@@ -202,6 +208,7 @@ int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid)
     if (xmssmt_parse_oid(&params, oid)) {
         return -1;
     }
+    params.num_threads = num_threads;
     for (i = 0; i < XMSS_OID_LEN; i++) {
         pk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
         sk[XMSS_OID_LEN - i - 1] = (oid >> (8 * i)) & 0xFF;
@@ -9,9 +9,12 @@
  * Generates a XMSS key pair for a given parameter set.
  * Format sk: [OID || (32bit) idx || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [OID || root || PUB_SEED]
+ * num_threads bounds the worker threads used to compute the leaves when
+ * built with OQS_XMSS_USE_PTHREADS; 0 uses one per online CPU.
  */
 #define xmss_keypair XMSS_NAMESPACE(xmss_keypair)
-int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
+int xmss_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                 unsigned int num_threads);
 
 /**
  * Signs a message using an XMSS secret key.
@@ -52,9 +55,11 @@ int xmss_total_signatures(unsigned long long *max, const unsigned  char *sk);
  * Generates a XMSSMT key pair for a given parameter set.
  * Format sk: [OID || (ceil(h/8) bit) idx || SK_SEED || SK_PRF || PUB_SEED || root]
  * Format pk: [OID || root || PUB_SEED]
+ * num_threads is used as in xmss_keypair.
  */
 #define xmssmt_keypair XMSS_NAMESPACE(xmssmt_keypair)
-int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid);
+int xmssmt_keypair(unsigned char *pk, unsigned char *sk, const uint32_t oid,
+                   unsigned int num_threads);
 
 /**
  * Signs a message using an XMSSMT secret key.
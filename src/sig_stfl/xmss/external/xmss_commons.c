@@ -23,12 +23,32 @@ static void l_tree(const xmss_params *params,
     unsigned int parent_nodes;
     uint32_t i;
     uint32_t height = 0;
+#if defined(XMSS_CORE_HASH_X8)
+    uint32_t lane_addr[8][8];
+    unsigned char *lane_out[8];
+    const unsigned char *lane_in[8];
+    unsigned int j;
+#endif
 
     set_tree_height(addr, height);
 
     while (l > 1) {
         parent_nodes = l >> 1;
-        for (i = 0; i < parent_nodes; i++) {
+        i = 0;
+#if defined(XMSS_CORE_HASH_X8)
+        /* Hash eight pairs of nodes at a time; inputs are read before any
+           output is written, so the batch may overwrite its own inputs. */
+        for (; i + 8 <= parent_nodes; i += 8) {
+            for (j = 0; j < 8; j++) {
+                memcpy(lane_addr[j], addr, sizeof(lane_addr[j]));
+                set_tree_index(lane_addr[j], i + j);
+                lane_out[j] = wots_pk + (i + j)*params->n;
+                lane_in[j] = wots_pk + ((i + j)*2)*params->n;
+            }
+            thash_h_x8(params, lane_out, lane_in, pub_seed, lane_addr);
+        }
+#endif
+        for (; i < parent_nodes; i++) {
             set_tree_index(addr, i);
             /* Hashes the nodes at (i*2)*params->n and (i*2)*params->n + 1 */
             thash_h(params, wots_pk + i*params->n,
@@ -12,6 +12,16 @@
 #include "xmss_commons.h"
 #include "xmss_core.h"
 
+#if defined(OQS_XMSS_USE_PTHREADS)
+#include <pthread.h>
+#include <unistd.h>
+
+/* Upper bound on the worker threads used during key generation. */
+#define XMSS_MAX_THREADS 64
+/* Number of leaves each worker computes before they are merged into the tree. */
+#define XMSS_LEAVES_PER_THREAD 32
+#endif
+
 typedef struct{
     unsigned char h;
     unsigned long long next_idx;
@@ -215,10 +225,102 @@ static int treehash_minheight_on_stack(const xmss_params *params,
     return r;
 }
 
+#if defined(OQS_XMSS_USE_PTHREADS)
+typedef struct {
+    const xmss_params *params;
+    unsigned char *leaves;
+    const unsigned char *sk_seed;
+    const unsigned char *pub_seed;
+    const uint32_t *addr;
+    uint32_t first;
+    uint32_t count;
+} leaf_job;
+
+static void *gen_leaves(void *arg)
+{
+    const leaf_job *job = arg;
+    uint32_t ots_addr[8] = {0};
+    uint32_t ltree_addr[8] = {0};
+    uint32_t i;
+
+    copy_subtree_addr(ots_addr, job->addr);
+    set_type(ots_addr, 0);
+    copy_subtree_addr(ltree_addr, job->addr);
+    set_type(ltree_addr, 1);
+
+    for (i = 0; i < job->count; i++) {
+        set_ltree_addr(ltree_addr, job->first + i);
+        set_ots_addr(ots_addr, job->first + i);
+        gen_leaf_wots(job->params, job->leaves + i*job->params->n, job->sk_seed, job->pub_seed, ltree_addr, ots_addr);
+    }
+    return NULL;
+}
+
+static unsigned int treehash_num_threads(const xmss_params *params)
+{
+    unsigned int num_threads = params->num_threads;
+
+    if (num_threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (unsigned int)cpus : 1;
+    }
+    if (num_threads > XMSS_MAX_THREADS) {
+        num_threads = XMSS_MAX_THREADS;
+    }
+    return num_threads;
+}
+
+/**
+ * Computes the count leaves starting at index first into leaves, splitting
+ * the range evenly across num_threads threads. The calling thread takes the
+ * first share; a share whose thread cannot be started is computed inline.
+ */
+static void gen_leaves_parallel(const xmss_params *params,
+                                unsigned char *leaves, uint32_t first, uint32_t count,
+                                unsigned int num_threads,
+                                const unsigned char *sk_seed,
+                                const unsigned char *pub_seed, const uint32_t addr[8])
+{
+    pthread_t threads[XMSS_MAX_THREADS];
+    leaf_job jobs[XMSS_MAX_THREADS];
+    int started[XMSS_MAX_THREADS];
+    uint32_t share = (count + num_threads - 1) / num_threads;
+    uint32_t offset = 0;
+    unsigned int t;
+
+    for (t = 0; t < num_threads; t++) {
+        jobs[t].params = params;
+        jobs[t].leaves = leaves + offset*params->n;
+        jobs[t].sk_seed = sk_seed;
+        jobs[t].pub_seed = pub_seed;
+        jobs[t].addr = addr;
+        jobs[t].first = first + offset;
+        jobs[t].count = count - offset < share ? count - offset : share;
+        offset += jobs[t].count;
+    }
+
+    for (t = 1; t < num_threads; t++) {
+        started[t] = jobs[t].count > 0 && pthread_create(&threads[t], NULL, gen_leaves, &jobs[t]) == 0;
+        if (!started[t]) {
+            gen_leaves(&jobs[t]);
+        }
+    }
+    gen_leaves(&jobs[0]);
+    for (t = 1; t < num_threads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+}
+#endif
+
 /**
  * Merkle's TreeHash algorithm. The address only needs to initialize the first 78 bits of addr. Everything else will be set by treehash.
  * Currently only used for key generation.
  *
+ * When built with OQS_XMSS_USE_PTHREADS, the leaves are computed ahead in
+ * batches on worker threads and then merged here in the usual order, so the
+ * root and the BDS state are identical to the single-threaded computation.
  */
 static void treehash_init(const xmss_params *params,
                           unsigned char *node, int height, int index,
@@ -251,6 +353,19 @@ static void treehash_init(const xmss_params *params,
         return;
     }
 
+#if defined(OQS_XMSS_USE_PTHREADS)
+    unsigned int num_threads = treehash_num_threads(params);
+    uint32_t batch = num_threads * XMSS_LEAVES_PER_THREAD;
+    if (batch > lastnode - idx) {
+        batch = lastnode - idx;
+    }
+    const size_t leaves_size = batch * params->n;
+    unsigned char *leaves = NULL;
+    if (num_threads > 1) {
+        leaves = OQS_MEM_malloc(leaves_size);
+    }
+#endif
+
     unsigned int stackoffset=0;
     unsigned int nodeh;
 
@@ -264,7 +379,19 @@ static void treehash_init(const xmss_params *params,
     for (; idx < lastnode; idx++) {
         set_ltree_addr(ltree_addr, idx);
         set_ots_addr(ots_addr, idx);
-        gen_leaf_wots(params, stack+stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr);
+#if defined(OQS_XMSS_USE_PTHREADS)
+        if (leaves != NULL) {
+            if (i % batch == 0) {
+                gen_leaves_parallel(params, leaves, idx, lastnode - idx < batch ? lastnode - idx : batch,
+                                    num_threads, sk_seed, pub_seed, addr);
+            }
+            memcpy(stack+stackoffset*params->n, leaves + (i % batch)*params->n, params->n);
+        }
+        else
+#endif
+        {
+            gen_leaf_wots(params, stack+stackoffset*params->n, sk_seed, pub_seed, ltree_addr, ots_addr);
+        }
         stacklevels[stackoffset] = 0;
         stackoffset++;
         if (params->tree_height - params->bds_k > 0 && i == 3) {
@@ -294,6 +421,9 @@ static void treehash_init(const xmss_params *params,
 
     memcpy(node, stack, params->n);
 
+#if defined(OQS_XMSS_USE_PTHREADS)
+    OQS_MEM_secure_free(leaves, leaves_size);
+#endif
     OQS_MEM_insecure_free(stacklevels);
     OQS_MEM_secure_free(stack, stack_size);
     OQS_MEM_secure_free(thash_buf, thash_buf_size);
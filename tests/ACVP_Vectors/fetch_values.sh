@@ -2,6 +2,10 @@
 # SPDX-License-Identifier: MIT
 
 # This script fetches the ACVP vectors for ML-DSA and ML-KEM
+#
+# ML-DSA-sigGen-FIPS204/externalInterface.json is not fetched: it holds
+# HashML-DSA (SHA2-512) and external-mu sigGen vectors in the same layout,
+# which this ACVP-Server release does not include
 
 rel_name="1.1.0.35"
 rel_url="https://github.com/usnistgov/ACVP-Server/archive/refs/tags/v$rel_name.tar.gz"
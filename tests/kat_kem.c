@@ -20,11 +20,10 @@
 
 #include "system_info.c"
 
-static OQS_STATUS kem_kat(const char *method_name, bool all) {
+static OQS_STATUS kem_kat(const char *method_name, bool all, FILE *fh) {
 
 	uint8_t entropy_input[48];
 	uint8_t seed[48];
-	FILE *fh = NULL;
 	OQS_KEM *kem = NULL;
 	uint8_t *public_key = NULL;
 	uint8_t *secret_key = NULL;
@@ -43,7 +42,7 @@ static OQS_STATUS kem_kat(const char *method_name, bool all) {
 
 	kem = OQS_KEM_new(method_name);
 	if (kem == NULL) {
-		printf("[kem_kat] %s was not enabled at compile-time.\n", method_name);
+		fprintf(fh, "[kem_kat] %s was not enabled at compile-time.\n", method_name);
 		goto algo_not_enabled;
 	}
 
@@ -53,8 +52,6 @@ static OQS_STATUS kem_kat(const char *method_name, bool all) {
 
 	OQS_KAT_PRNG_seed(prng, entropy_input, NULL);
 
-	fh = stdout;
-
 	public_key = OQS_MEM_malloc(kem->length_public_key);
 	secret_key = OQS_MEM_malloc(kem->length_secret_key);
 	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
@@ -136,11 +133,47 @@ cleanup:
 	return ret;
 }
 
+struct kat_args {
+	char **alg_names;
+	size_t num_algs;
+	bool all;
+};
+
+static OQS_STATUS kem_kat_job(size_t i, FILE *fh, void *arg) {
+	const struct kat_args *args = arg;
+	if (args->num_algs > 1) {
+		fprintf(fh, "# %s\n", args->alg_names[i]);
+	}
+	return kem_kat(args->alg_names[i], args->all, fh);
+}
+
 int main(int argc, char **argv) {
 
+	struct kat_args args = {NULL, 0, false};
+	size_t max_threads = 0;
+	bool usage_error = false;
+
 	OQS_init();
-	if (argc < 2 || argc > 3 || (argc == 3 && strcmp(argv[2], "--all"))) {
-		fprintf(stderr, "Usage: kat_kem algname [--all]\n");
+	args.alg_names = OQS_MEM_calloc((size_t)argc, sizeof(char *));
+	if (args.alg_names == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_calloc failed\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--all") == 0) {
+			args.all = true;
+		} else if (strncmp(argv[i], "--threads=", 10) == 0) {
+			max_threads = strtoul(argv[i] + 10, NULL, 10);
+		} else if (strncmp(argv[i], "--", 2) == 0) {
+			usage_error = true;
+		} else {
+			args.alg_names[args.num_algs++] = argv[i];
+		}
+	}
+
+	if (usage_error || args.num_algs == 0) {
+		fprintf(stderr, "Usage: kat_kem algname [algname ...] [--all] [--threads=N]\n");
 		fprintf(stderr, "  algname: ");
 		for (size_t i = 0; i < OQS_KEM_algs_length; i++) {
 			if (i > 0) {
@@ -149,15 +182,17 @@ int main(int argc, char **argv) {
 			fprintf(stderr, "%s", OQS_KEM_alg_identifier(i));
 		}
 		fprintf(stderr, "\n");
+		fprintf(stderr, "  Several algorithms are run in parallel on up to N threads (default: one per CPU),\n");
+		fprintf(stderr, "  and the output for each is preceded by a line \"# algname\".\n");
 		printf("\n");
 		print_system_info();
+		OQS_MEM_insecure_free(args.alg_names);
 		OQS_destroy();
 		return EXIT_FAILURE;
 	}
 
-	char *alg_name = argv[1];
-	bool all = (argc == 3);
-	OQS_STATUS rc = kem_kat(alg_name, all);
+	OQS_STATUS rc = OQS_KAT_run_jobs(args.num_algs, max_threads, kem_kat_job, &args, stdout);
+	OQS_MEM_insecure_free(args.alg_names);
 	if (rc != OQS_SUCCESS) {
 		OQS_destroy();
 		return EXIT_FAILURE;
@@ -498,11 +498,10 @@ OQS_STATUS combine_message_signature(uint8_t **signed_msg, size_t *signed_msg_le
 	}
 }
 
-OQS_STATUS sig_kat(const char *method_name, bool all) {
+OQS_STATUS sig_kat(const char *method_name, bool all, FILE *fh) {
 
 	uint8_t entropy_input[48];
 	uint8_t seed[48];
-	FILE *fh = NULL;
 	OQS_SIG *sig = NULL;
 	uint8_t *msg = NULL;
 	size_t msg_len = 0;
@@ -523,7 +522,7 @@ OQS_STATUS sig_kat(const char *method_name, bool all) {
 
 	sig = OQS_SIG_new(method_name);
 	if (sig == NULL) {
-		printf("[sig_kat] %s was not enabled at compile-time.\n", method_name);
+		fprintf(fh, "[sig_kat] %s was not enabled at compile-time.\n", method_name);
 		goto algo_not_enabled;
 	}
 
@@ -533,8 +532,6 @@ OQS_STATUS sig_kat(const char *method_name, bool all) {
 
 	OQS_KAT_PRNG_seed(prng, entropy_input, NULL);
 
-	fh = stdout;
-
 	max_count = all ? prng->max_kats : 1;
 
 	public_key = OQS_MEM_malloc(sig->length_public_key);
@@ -621,11 +618,47 @@ cleanup:
 	return ret;
 }
 
+struct kat_args {
+	char **alg_names;
+	size_t num_algs;
+	bool all;
+};
+
+static OQS_STATUS sig_kat_job(size_t i, FILE *fh, void *arg) {
+	const struct kat_args *args = arg;
+	if (args->num_algs > 1) {
+		fprintf(fh, "# %s\n", args->alg_names[i]);
+	}
+	return sig_kat(args->alg_names[i], args->all, fh);
+}
+
 int main(int argc, char **argv) {
+	struct kat_args args = {NULL, 0, false};
+	size_t max_threads = 0;
+	bool usage_error = false;
+
 	OQS_init();
 
-	if (argc < 2 || argc > 3 || (argc == 3 && strcmp(argv[2], "--all"))) {
-		fprintf(stderr, "Usage: kat_sig algname [--all]\n");
+	args.alg_names = OQS_MEM_calloc((size_t)argc, sizeof(char *));
+	if (args.alg_names == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_calloc failed\n");
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--all") == 0) {
+			args.all = true;
+		} else if (strncmp(argv[i], "--threads=", 10) == 0) {
+			max_threads = strtoul(argv[i] + 10, NULL, 10);
+		} else if (strncmp(argv[i], "--", 2) == 0) {
+			usage_error = true;
+		} else {
+			args.alg_names[args.num_algs++] = argv[i];
+		}
+	}
+
+	if (usage_error || args.num_algs == 0) {
+		fprintf(stderr, "Usage: kat_sig algname [algname ...] [--all] [--threads=N]\n");
 		fprintf(stderr, "  algname: ");
 		for (size_t i = 0; i < OQS_SIG_algs_length; i++) {
 			if (i > 0) {
@@ -634,15 +667,17 @@ int main(int argc, char **argv) {
 			fprintf(stderr, "%s", OQS_SIG_alg_identifier(i));
 		}
 		fprintf(stderr, "\n");
+		fprintf(stderr, "  Several algorithms are run in parallel on up to N threads (default: one per CPU),\n");
+		fprintf(stderr, "  and the output for each is preceded by a line \"# algname\".\n");
 		printf("\n");
 		print_system_info();
+		OQS_MEM_insecure_free(args.alg_names);
 		OQS_destroy();
 		return EXIT_FAILURE;
 	}
 
-	char *alg_name = argv[1];
-	bool all = (argc == 3);
-	OQS_STATUS rc = sig_kat(alg_name, all);
+	OQS_STATUS rc = OQS_KAT_run_jobs(args.num_algs, max_threads, sig_kat_job, &args, stdout);
+	OQS_MEM_insecure_free(args.alg_names);
 	if (rc != OQS_SUCCESS) {
 		OQS_destroy();
 		return EXIT_FAILURE;
@@ -243,6 +243,96 @@ static OQS_STATUS speed_shake256(uint64_t duration, size_t message_len, size_t o
 	return OQS_SUCCESS;
 }
 
+/* Compares the one-shot APIs against hashing through a freshly set up
+ * incremental context on every call. With OQS_USE_OPENSSL the one-shot
+ * calls reuse a per-thread EVP_MD_CTX, while the incremental init/release
+ * pair still allocates and frees one, as the one-shot calls used to. */
+static OQS_STATUS speed_hash_ctx(uint64_t duration, size_t message_len) {
+	uint8_t *message = NULL;
+	uint8_t output[32];
+	OQS_SHA2_sha256_ctx sha256_ctx;
+	OQS_SHA3_sha3_256_inc_ctx sha3_256_ctx;
+	OQS_SHA3_shake128_inc_ctx shake128_ctx;
+	OQS_SHA3_shake256_inc_ctx shake256_ctx;
+
+	message = OQS_MEM_malloc(message_len);
+	if (message == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		return OQS_ERROR;
+	}
+
+	OQS_randombytes(message, message_len);
+
+	TIME_OPERATION_SECONDS(OQS_SHA2_sha256(output, message, message_len), "OQS_SHA2_sha256", duration);
+	TIME_OPERATION_SECONDS({ OQS_SHA2_sha256_inc_init(&sha256_ctx); OQS_SHA2_sha256_inc_finalize(output, &sha256_ctx, message, message_len); }, "OQS_SHA2_sha256 new ctx", duration);
+
+	TIME_OPERATION_SECONDS(OQS_SHA3_sha3_256(output, message, message_len), "OQS_SHA3_sha3_256", duration);
+	TIME_OPERATION_SECONDS({ OQS_SHA3_sha3_256_inc_init(&sha3_256_ctx); OQS_SHA3_sha3_256_inc_absorb(&sha3_256_ctx, message, message_len); OQS_SHA3_sha3_256_inc_finalize(output, &sha3_256_ctx); OQS_SHA3_sha3_256_inc_ctx_release(&sha3_256_ctx); }, "OQS_SHA3_sha3_256 new ctx", duration);
+
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake128(output, sizeof(output), message, message_len), "OQS_SHA3_shake128", duration);
+	TIME_OPERATION_SECONDS({ OQS_SHA3_shake128_inc_init(&shake128_ctx); OQS_SHA3_shake128_inc_absorb(&shake128_ctx, message, message_len); OQS_SHA3_shake128_inc_finalize(&shake128_ctx); OQS_SHA3_shake128_inc_squeeze(output, sizeof(output), &shake128_ctx); OQS_SHA3_shake128_inc_ctx_release(&shake128_ctx); }, "OQS_SHA3_shake128 new ctx", duration);
+
+	TIME_OPERATION_SECONDS(OQS_SHA3_shake256(output, sizeof(output), message, message_len), "OQS_SHA3_shake256", duration);
+	TIME_OPERATION_SECONDS({ OQS_SHA3_shake256_inc_init(&shake256_ctx); OQS_SHA3_shake256_inc_absorb(&shake256_ctx, message, message_len); OQS_SHA3_shake256_inc_finalize(&shake256_ctx); OQS_SHA3_shake256_inc_squeeze(output, sizeof(output), &shake256_ctx); OQS_SHA3_shake256_inc_ctx_release(&shake256_ctx); }, "OQS_SHA3_shake256 new ctx", duration);
+
+	OQS_MEM_insecure_free(message);
+
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS speed_randombytes(uint64_t duration, size_t output_len) {
+	uint8_t *output = NULL;
+
+	output = OQS_MEM_malloc(output_len);
+	if (output == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		return OQS_ERROR;
+	}
+
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_system);
+	TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes system", duration);
+#if defined(OQS_USE_OPENSSL)
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_openssl);
+	TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes OpenSSL", duration);
+#endif
+	if (OQS_randombytes_switch_algorithm(OQS_RAND_alg_buffered) == OQS_SUCCESS) {
+		TIME_OPERATION_SECONDS(OQS_randombytes(output, output_len), "OQS_randombytes buffered", duration);
+	}
+
+	OQS_randombytes_switch_algorithm(OQS_RAND_alg_system);
+	OQS_MEM_insecure_free(output);
+
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS speed_dispatch(uint64_t duration) {
+	volatile int has_avx2_bmi2_popcnt;
+
+	/* what each exported wrapper of a dist build pays before calling into its implementation */
+	TIME_OPERATION_SECONDS(has_avx2_bmi2_popcnt = OQS_CPU_has_extension(OQS_CPU_EXT_AVX2) && OQS_CPU_has_extension(OQS_CPU_EXT_BMI2) && OQS_CPU_has_extension(OQS_CPU_EXT_POPCNT), "OQS_CPU_has_extension x3", duration);
+	(void) has_avx2_bmi2_popcnt;
+
+#if defined(OQS_ENABLE_KEM_ml_kem_512)
+	OQS_KEM *kem = OQS_KEM_new(OQS_KEM_alg_ml_kem_512);
+	uint8_t public_key[OQS_KEM_ml_kem_512_length_public_key];
+	uint8_t secret_key[OQS_KEM_ml_kem_512_length_secret_key];
+	uint8_t ciphertext[OQS_KEM_ml_kem_512_length_ciphertext];
+	uint8_t shared_secret[OQS_KEM_ml_kem_512_length_shared_secret];
+
+	if (kem == NULL || OQS_KEM_keypair(kem, public_key, secret_key) != OQS_SUCCESS) {
+		OQS_KEM_free(kem);
+		return OQS_ERROR;
+	}
+	TIME_OPERATION_SECONDS(OQS_KEM_ml_kem_512_encaps(ciphertext, shared_secret, public_key), "ML-KEM-512 encaps exported", duration);
+	TIME_OPERATION_SECONDS(OQS_KEM_encaps(kem, ciphertext, shared_secret, public_key), "ML-KEM-512 encaps OQS_KEM", duration);
+	TIME_OPERATION_SECONDS(OQS_KEM_ml_kem_512_decaps(shared_secret, ciphertext, secret_key), "ML-KEM-512 decaps exported", duration);
+	TIME_OPERATION_SECONDS(OQS_KEM_decaps(kem, shared_secret, ciphertext, secret_key), "ML-KEM-512 decaps OQS_KEM", duration);
+	OQS_KEM_free(kem);
+#endif
+
+	return OQS_SUCCESS;
+}
+
 static OQS_STATUS printAlgs(void) {
 	printf("aes128\n");
 	printf("aes256\n");
@@ -252,6 +342,9 @@ static OQS_STATUS printAlgs(void) {
 	printf("sha3\n");
 	printf("shake128\n");
 	printf("shake256\n");
+	printf("hashctx\n");
+	printf("randombytes\n");
+	printf("dispatch\n");
 	return OQS_SUCCESS;
 }
 
@@ -386,6 +479,21 @@ int main(int argc, char **argv) {
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
+		} else if (strcmp(single_alg, "hashctx") == 0) {
+			rc = speed_hash_ctx(duration, message_len);
+			if (rc != OQS_SUCCESS) {
+				ret = EXIT_FAILURE;
+			}
+		} else if (strcmp(single_alg, "randombytes") == 0) {
+			rc = speed_randombytes(duration, output_len);
+			if (rc != OQS_SUCCESS) {
+				ret = EXIT_FAILURE;
+			}
+		} else if (strcmp(single_alg, "dispatch") == 0) {
+			rc = speed_dispatch(duration);
+			if (rc != OQS_SUCCESS) {
+				ret = EXIT_FAILURE;
+			}
 		} else {
 			fprintf(stderr, "ERROR: Algorithm not recognized. Try --help for help or --algs for a list of algorithms\n");
 			return EXIT_FAILURE;
@@ -435,6 +543,21 @@ int main(int argc, char **argv) {
 			ret = EXIT_FAILURE;
 		}
 
+		rc = speed_hash_ctx(duration, message_len);
+		if (rc != OQS_SUCCESS) {
+			ret = EXIT_FAILURE;
+		}
+
+		rc = speed_randombytes(duration, output_len);
+		if (rc != OQS_SUCCESS) {
+			ret = EXIT_FAILURE;
+		}
+
+		rc = speed_dispatch(duration);
+		if (rc != OQS_SUCCESS) {
+			ret = EXIT_FAILURE;
+		}
+
 	}
 	PRINT_TIMER_FOOTER
 
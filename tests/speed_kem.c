@@ -33,7 +33,106 @@ static void fullcycletest(OQS_KEM *kem, uint8_t *public_key, uint8_t *secret_key
 
 }
 
-static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle) {
+static OQS_STATUS kem_speed_batch(OQS_KEM *kem, uint64_t duration, size_t batch, const uint8_t *public_key, const uint8_t *secret_key) {
+	uint8_t *public_keys = OQS_MEM_malloc(batch * kem->length_public_key);
+	uint8_t *secret_keys = OQS_MEM_malloc(batch * kem->length_secret_key);
+	uint8_t *ciphertexts = OQS_MEM_malloc(batch * kem->length_ciphertext);
+	uint8_t *shared_secrets = OQS_MEM_malloc(batch * kem->length_shared_secret);
+	OQS_STATUS ret = OQS_ERROR;
+	char encaps_name[40], decaps_name[40];
+
+	if ((public_keys == NULL) || (secret_keys == NULL) || (ciphertexts == NULL) || (shared_secrets == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	for (size_t i = 0; i < batch; i++) {
+		memcpy(public_keys + i * kem->length_public_key, public_key, kem->length_public_key);
+		memcpy(secret_keys + i * kem->length_secret_key, secret_key, kem->length_secret_key);
+	}
+
+	snprintf(encaps_name, sizeof(encaps_name), "encaps_batch (x%zu)", batch);
+	snprintf(decaps_name, sizeof(decaps_name), "decaps_batch (x%zu)", batch);
+	TIME_OPERATION_SECONDS(OQS_KEM_encaps_batch(kem, batch, ciphertexts, shared_secrets, public_keys), encaps_name, duration)
+	TIME_OPERATION_SECONDS(OQS_KEM_decaps_batch(kem, batch, shared_secrets, ciphertexts, secret_keys), decaps_name, duration)
+	ret = OQS_SUCCESS;
+
+cleanup:
+	if (secret_keys != NULL) {
+		OQS_MEM_secure_free(secret_keys, batch * kem->length_secret_key);
+	}
+	if (shared_secrets != NULL) {
+		OQS_MEM_secure_free(shared_secrets, batch * kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_keys);
+	OQS_MEM_insecure_free(ciphertexts);
+	return ret;
+}
+
+static OQS_STATUS kem_speed_prepared(OQS_KEM *kem, uint64_t duration, const uint8_t *public_key, const uint8_t *secret_key, uint8_t *ciphertext, uint8_t *shared_secret) {
+	OQS_KEM_PUBLIC_KEY *prepared_public_key = NULL;
+	OQS_KEM_SECRET_KEY *prepared_secret_key = NULL;
+	OQS_STATUS ret = OQS_ERROR;
+
+	if (kem->prepare_public_key != NULL) {
+		prepared_public_key = OQS_KEM_PUBLIC_KEY_new(kem, public_key);
+		if (prepared_public_key == NULL) {
+			fprintf(stderr, "ERROR: OQS_KEM_PUBLIC_KEY_new failed\n");
+			goto cleanup;
+		}
+		TIME_OPERATION_SECONDS(OQS_KEM_encaps_prepared(kem, ciphertext, shared_secret, prepared_public_key), "encaps_prepared", duration)
+	}
+	if (kem->prepare_secret_key != NULL) {
+		prepared_secret_key = OQS_KEM_SECRET_KEY_new(kem, secret_key);
+		if (prepared_secret_key == NULL) {
+			fprintf(stderr, "ERROR: OQS_KEM_SECRET_KEY_new failed\n");
+			goto cleanup;
+		}
+		TIME_OPERATION_SECONDS(OQS_KEM_decaps_prepared(kem, shared_secret, ciphertext, prepared_secret_key), "decaps_prepared", duration)
+	}
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_KEM_PUBLIC_KEY_free(prepared_public_key);
+	OQS_KEM_SECRET_KEY_free(prepared_secret_key);
+	return ret;
+}
+
+/* Seeds for the derand operations are drawn from OQS_randombytes in blocks of this many */
+#define DERAND_SEEDS_PER_DRAW 256
+
+typedef struct {
+	uint8_t *seeds;
+	size_t length_seed;
+	size_t next;
+} derand_seed_pool;
+
+static const uint8_t *next_derand_seed(derand_seed_pool *pool) {
+	if (pool->next == DERAND_SEEDS_PER_DRAW) {
+		OQS_randombytes(pool->seeds, DERAND_SEEDS_PER_DRAW * pool->length_seed);
+		pool->next = 0;
+	}
+	return pool->seeds + pool->length_seed * pool->next++;
+}
+
+static OQS_STATUS kem_speed_derand(OQS_KEM *kem, uint64_t duration, uint8_t *public_key, uint8_t *secret_key, uint8_t *ciphertext, uint8_t *shared_secret) {
+	derand_seed_pool pool = {NULL, 0, DERAND_SEEDS_PER_DRAW};
+
+	if (kem->keypair_derand == NULL || kem->encaps_derand == NULL) {
+		return OQS_SUCCESS;
+	}
+	pool.length_seed = kem->length_keypair_seed > kem->length_encaps_seed ? kem->length_keypair_seed : kem->length_encaps_seed;
+	pool.seeds = OQS_MEM_malloc(DERAND_SEEDS_PER_DRAW * pool.length_seed);
+	if (pool.seeds == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		return OQS_ERROR;
+	}
+	TIME_OPERATION_SECONDS(OQS_KEM_keypair_derand(kem, public_key, secret_key, next_derand_seed(&pool)), "keygen_derand", duration)
+	TIME_OPERATION_SECONDS(OQS_KEM_encaps_derand(kem, ciphertext, shared_secret, public_key, next_derand_seed(&pool)), "encaps_derand", duration)
+	OQS_MEM_secure_free(pool.seeds, DERAND_SEEDS_PER_DRAW * pool.length_seed);
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle, size_t batch) {
 
 	OQS_KEM *kem = NULL;
 	uint8_t *public_key = NULL;
@@ -64,6 +163,15 @@ static OQS_STATUS kem_speed_wrapper(const char *method_name, uint64_t duration,
 		TIME_OPERATION_SECONDS(OQS_KEM_keypair(kem, public_key, secret_key), "keygen", duration)
 		TIME_OPERATION_SECONDS(OQS_KEM_encaps(kem, ciphertext, shared_secret_e, public_key), "encaps", duration)
 		TIME_OPERATION_SECONDS(OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key), "decaps", duration)
+		if (kem_speed_prepared(kem, duration, public_key, secret_key, ciphertext, shared_secret_d) != OQS_SUCCESS) {
+			goto err;
+		}
+		if (kem_speed_derand(kem, duration, public_key, secret_key, ciphertext, shared_secret_e) != OQS_SUCCESS) {
+			goto err;
+		}
+		if (batch > 0 && kem_speed_batch(kem, duration, batch, public_key, secret_key) != OQS_SUCCESS) {
+			goto err;
+		}
 	} else {
 		TIME_OPERATION_SECONDS(fullcycletest(kem, public_key, secret_key, ciphertext, shared_secret_e, shared_secret_d), "fullcycletest", duration)
 	}
@@ -113,6 +221,7 @@ int main(int argc, char **argv) {
 	uint64_t duration = 3;
 	bool printKemInfo = false;
 	bool doFullCycle = false;
+	size_t batch = 0;
 
 	OQS_KEM *single_kem = NULL;
 
@@ -143,6 +252,14 @@ int main(int argc, char **argv) {
 		} else if ((strcmp(argv[i], "--info") == 0) || (strcmp(argv[i], "-i") == 0)) {
 			printKemInfo = true;
 			continue;
+		} else if ((strcmp(argv[i], "--batch") == 0) || (strcmp(argv[i], "-b") == 0)) {
+			if (i < argc - 1) {
+				batch = (size_t)strtol(argv[i + 1], NULL, 10);
+				if (batch > 0) {
+					i += 1;
+					continue;
+				}
+			}
 		} else if ((strcmp(argv[i], "--fullcycle") == 0) || (strcmp(argv[i], "-f") == 0)) {
 			doFullCycle = true;
 			continue;
@@ -166,6 +283,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, " -h                Print usage\n");
 		fprintf(stderr, "--info\n");
 		fprintf(stderr, " -i                Print info (sizes, security level) about each KEM\n");
+		fprintf(stderr, "--batch n\n");
+		fprintf(stderr, " -b n              Also time OQS_KEM_encaps_batch/decaps_batch with n entries per call\n");
 		fprintf(stderr, "--fullcycle\n");
 		fprintf(stderr, " -f                Do full keygen-encaps-decaps cycle for each KEM\n");
 		fprintf(stderr, "\n");
@@ -180,14 +299,14 @@ int main(int argc, char **argv) {
 
 	PRINT_TIMER_HEADER
 	if (single_kem != NULL) {
-		rc = kem_speed_wrapper(single_kem->method_name, duration, printKemInfo, doFullCycle);
+		rc = kem_speed_wrapper(single_kem->method_name, duration, printKemInfo, doFullCycle, batch);
 		if (rc != OQS_SUCCESS) {
 			ret = EXIT_FAILURE;
 		}
 		OQS_KEM_free(single_kem);
 	} else {
 		for (size_t i = 0; i < OQS_KEM_algs_length; i++) {
-			rc = kem_speed_wrapper(OQS_KEM_alg_identifier(i), duration, printKemInfo, doFullCycle);
+			rc = kem_speed_wrapper(OQS_KEM_alg_identifier(i), duration, printKemInfo, doFullCycle, batch);
 			if (rc != OQS_SUCCESS) {
 				ret = EXIT_FAILURE;
 			}
@@ -17,6 +17,9 @@
 #include "ds_benchmark.h"
 #include "system_info.c"
 
+// number of threads used by sign_prepared (1 = calling thread only, 0 = one per CPU)
+static unsigned int num_threads = 1;
+
 static void fullcycle(OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, uint8_t *signature, size_t signature_len, uint8_t *message, size_t message_len) {
 	if (OQS_SIG_keypair(sig, public_key, secret_key) != OQS_SUCCESS) {
 		printf("keygen error. Exiting.\n");
@@ -32,6 +35,36 @@ static void fullcycle(OQS_SIG *sig, uint8_t *public_key, uint8_t *secret_key, ui
 	}
 }
 
+static OQS_STATUS sig_speed_prepared(OQS_SIG *sig, uint64_t duration, const uint8_t *public_key, const uint8_t *secret_key, uint8_t *signature, size_t *signature_len, const uint8_t *message, size_t message_len) {
+	OQS_SIG_SECRET_KEY *prepared_secret_key = NULL;
+	OQS_SIG_PUBLIC_KEY *prepared_public_key = NULL;
+	OQS_STATUS ret = OQS_ERROR;
+
+	if (sig->prepare_secret_key != NULL) {
+		prepared_secret_key = OQS_SIG_SECRET_KEY_new(sig, secret_key);
+		if (prepared_secret_key == NULL) {
+			fprintf(stderr, "ERROR: OQS_SIG_SECRET_KEY_new failed\n");
+			goto cleanup;
+		}
+		OQS_SIG_SECRET_KEY_set_threads(prepared_secret_key, num_threads);
+		TIME_OPERATION_SECONDS(OQS_SIG_sign_prepared(sig, signature, signature_len, message, message_len, NULL, 0, prepared_secret_key), "sign_prepared", duration)
+	}
+	if (sig->prepare_public_key != NULL) {
+		prepared_public_key = OQS_SIG_PUBLIC_KEY_new(sig, public_key);
+		if (prepared_public_key == NULL) {
+			fprintf(stderr, "ERROR: OQS_SIG_PUBLIC_KEY_new failed\n");
+			goto cleanup;
+		}
+		TIME_OPERATION_SECONDS(OQS_SIG_verify_prepared(sig, message, message_len, signature, *signature_len, NULL, 0, prepared_public_key), "verify_prepared", duration)
+	}
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_SECRET_KEY_free(prepared_secret_key);
+	OQS_SIG_PUBLIC_KEY_free(prepared_public_key);
+	return ret;
+}
+
 static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration, bool printInfo, bool doFullCycle) {
 
 	OQS_SIG *sig = NULL;
@@ -65,6 +98,9 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 		TIME_OPERATION_SECONDS(OQS_SIG_keypair(sig, public_key, secret_key), "keypair", duration)
 		TIME_OPERATION_SECONDS(OQS_SIG_sign(sig, signature, &signature_len, message, message_len, secret_key), "sign", duration)
 		TIME_OPERATION_SECONDS(OQS_SIG_verify(sig, message, message_len, signature, signature_len, public_key), "verify", duration)
+		if (sig_speed_prepared(sig, duration, public_key, secret_key, signature, &signature_len, message, message_len) != OQS_SUCCESS) {
+			goto err;
+		}
 	} else {
 		TIME_OPERATION_SECONDS(fullcycle(sig, public_key, secret_key, signature, signature_len, message, message_len), "fullcycle", duration)
 	}
@@ -141,6 +177,12 @@ int main(int argc, char **argv) {
 					continue;
 				}
 			}
+		} else if ((strcmp(argv[i], "--threads") == 0) || (strcmp(argv[i], "-t") == 0)) {
+			if (i < argc - 1) {
+				num_threads = (unsigned int)strtoul(argv[i + 1], NULL, 10);
+				i += 1;
+				continue;
+			}
 		} else if ((strcmp(argv[i], "--help") == 0) || (strcmp(argv[i], "-h") == 0)) {
 			printUsage = true;
 			break;
@@ -166,6 +208,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, "--algs             Print supported algorithms and terminate\n");
 		fprintf(stderr, "--duration n\n");
 		fprintf(stderr, " -d n              Run each speed test for approximately n seconds, default n=3\n");
+		fprintf(stderr, "--threads n\n");
+		fprintf(stderr, " -t n              Use up to n threads for sign_prepared, 0 for one per CPU, default n=1\n");
 		fprintf(stderr, "--help\n");
 		fprintf(stderr, " -h                Print usage\n");
 		fprintf(stderr, "--info\n");
@@ -182,6 +226,9 @@ int main(int argc, char **argv) {
 
 	printf("Speed test\n");
 	printf("==========\n");
+	if (num_threads != 1) {
+		printf("Threads: %u\n", num_threads);
+	}
 
 	PRINT_TIMER_HEADER
 	if (single_sig != NULL) {
@@ -25,11 +25,15 @@ OQS_STATUS dummy_secure_storage(uint8_t *sk_buf, size_t sk_buf_len, void *contex
 	return OQS_SUCCESS;
 }
 
+// number of threads used for key generation and tree updates (0 = library default)
+static unsigned int num_threads = 0;
+
 // reset secret key: some schemes fail to create a new secret key over a previous secret key
 OQS_SIG_STFL_SECRET_KEY *reset_secret_key(OQS_SIG_STFL *sig, OQS_SIG_STFL_SECRET_KEY *secret_key) {
 	OQS_SIG_STFL_SECRET_KEY_free(secret_key);
 	secret_key = OQS_SIG_STFL_SECRET_KEY_new(sig->method_name);
 	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(secret_key, &dummy_secure_storage, secret_key);
+	OQS_SIG_STFL_SECRET_KEY_SET_threads(secret_key, num_threads);
 	return secret_key;
 }
 
@@ -84,6 +88,7 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 	}
 	// for LMS context must not be NULL
 	OQS_SIG_STFL_SECRET_KEY_SET_store_cb(secret_key, &dummy_secure_storage, secret_key);
+	OQS_SIG_STFL_SECRET_KEY_SET_threads(secret_key, num_threads);
 
 	public_key = malloc(sig->length_public_key);
 	message = malloc(message_len);
@@ -115,6 +120,7 @@ static OQS_STATUS sig_speed_wrapper(const char *method_name, uint64_t duration,
 				printf("sign error. Exiting.\n");
 				exit(-1);
 			}
+			secret_key = reset_secret_key(sig, secret_key);
 			OQS_SIG_STFL_keypair(sig, public_key, secret_key);
 		})
 		// benchmark verification
@@ -196,6 +202,12 @@ int main(int argc, char **argv) {
 					continue;
 				}
 			}
+		} else if ((strcmp(argv[i], "--threads") == 0) || (strcmp(argv[i], "-t") == 0)) {
+			if (i < argc - 1) {
+				num_threads = (unsigned int)strtoul(argv[i + 1], NULL, 10);
+				i += 1;
+				continue;
+			}
 		} else if ((strcmp(argv[i], "--help") == 0) || (strcmp(argv[i], "-h") == 0)) {
 			printUsage = true;
 			break;
@@ -224,6 +236,8 @@ int main(int argc, char **argv) {
 		fprintf(stderr, "--algs             Print supported algorithms and terminate\n");
 		fprintf(stderr, "--duration n\n");
 		fprintf(stderr, " -d n              Run each speed test for approximately n seconds, default n=3\n");
+		fprintf(stderr, "--threads n\n");
+		fprintf(stderr, " -t n              Use up to n threads for key generation and tree updates, default n=0 (library default)\n");
 		fprintf(stderr, "--help\n");
 		fprintf(stderr, " -h                Print usage\n");
 		fprintf(stderr, "--info\n");
@@ -242,6 +256,9 @@ int main(int argc, char **argv) {
 
 	printf("Speed test\n");
 	printf("==========\n");
+	if (num_threads > 0) {
+		printf("Threads: %u\n", num_threads);
+	}
 
 	PRINT_TIMER_HEADER
 	if (single_sig != NULL) {
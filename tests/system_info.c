@@ -135,6 +135,12 @@ static void print_cpu_extensions(void) {
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_SSE3)) {
 		printf(" SSE3");
 	}
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_SHA)) {
+		printf(" SHA");
+	}
+	if (OQS_CPU_has_extension(OQS_CPU_EXT_VAES)) {
+		printf(" VAES");
+	}
 	if (OQS_CPU_has_extension(OQS_CPU_EXT_ARM_AES)) {
 		printf(" AES");
 	}
@@ -185,6 +191,12 @@ static void print_cpu_extensions(void) {
 #ifdef OQS_USE_SSE3_INSTRUCTIONS
 	printf(" SSE3");
 #endif
+#ifdef OQS_USE_SHA_INSTRUCTIONS
+	printf(" SHA");
+#endif
+#ifdef OQS_USE_VAES_INSTRUCTIONS
+	printf(" VAES");
+#endif
 #ifdef OQS_USE_ARM_AES_INSTRUCTIONS
 	printf(" AES");
 #endif
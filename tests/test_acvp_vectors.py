@@ -16,6 +16,9 @@ ml_kem_kg     = "ACVP_Vectors/ML-KEM-keyGen-FIPS203/internalProjection.json"
 ml_dsa_kg     = "ACVP_Vectors/ML-DSA-keyGen-FIPS204/internalProjection.json"
 ml_dsa_sig    = "ACVP_Vectors/ML-DSA-sigGen-FIPS204/internalProjection.json"
 ml_dsa_ver    = "ACVP_Vectors/ML-DSA-sigVer-FIPS204/internalProjection.json"
+# HashML-DSA and external-mu sigGen vectors in the ACVP JSON layout; the pinned
+# ACVP-Server release only ships the internal interface for ML-DSA
+ml_dsa_sig_ext = "ACVP_Vectors/ML-DSA-sigGen-FIPS204/externalInterface.json"
 
 @helpers.filtered_test
 @pytest.mark.parametrize('kem_name', helpers.available_kems_by_name())
@@ -183,6 +186,68 @@ def test_acvp_vec_sig_gen_randomized(sig_name):
 
         assert(variantFound == True)
 
+@helpers.filtered_test
+@pytest.mark.skipif(sys.platform.startswith("win"), reason="Not needed on Windows")
+@pytest.mark.parametrize('sig_name', helpers.available_sigs_by_name())
+def test_acvp_vec_sig_gen_prehash(sig_name):
+
+    if not(helpers.is_sig_enabled_by_name(sig_name)): pytest.skip('Not enabled')
+    if not(sig_name in fips_sig): pytest.skip("Not supported")
+
+    with open(os.path.join('tests', ml_dsa_sig_ext), 'r') as fp:
+        ml_sig_sig_acvp  = json.load(fp)
+
+        variantFound = False
+        for variant in ml_sig_sig_acvp["testGroups"]:
+            if variant["parameterSet"] == sig_name and variant["preHash"] == "preHash":
+                variantFound = True
+                for testCase in variant["tests"]:
+                    pk = testCase["pk"]
+                    sk = testCase["sk"]
+                    message = testCase["message"]
+                    context = testCase["context"]
+                    hashAlg = testCase["hashAlg"]
+                    signature = testCase["signature"]
+                    rnd = testCase["rnd"]
+
+                    build_dir = helpers.get_current_build_dir_name()
+                    helpers.run_subprocess(
+                        [f'{build_dir}/tests/vectors_sig', sig_name, "sigGen_preHash", pk, sk, message, context, hashAlg, signature, rnd]
+                    )
+
+        assert(variantFound == True)
+
+@helpers.filtered_test
+@pytest.mark.skipif(sys.platform.startswith("win"), reason="Not needed on Windows")
+@pytest.mark.parametrize('sig_name', helpers.available_sigs_by_name())
+def test_acvp_vec_sig_gen_external_mu(sig_name):
+
+    if not(helpers.is_sig_enabled_by_name(sig_name)): pytest.skip('Not enabled')
+    if not(sig_name in fips_sig): pytest.skip("Not supported")
+
+    with open(os.path.join('tests', ml_dsa_sig_ext), 'r') as fp:
+        ml_sig_sig_acvp  = json.load(fp)
+
+        variantFound = False
+        for variant in ml_sig_sig_acvp["testGroups"]:
+            if variant["parameterSet"] == sig_name and variant["externalMu"] == True:
+                variantFound = True
+                for testCase in variant["tests"]:
+                    pk = testCase["pk"]
+                    sk = testCase["sk"]
+                    message = testCase["message"]
+                    context = testCase["context"]
+                    mu = testCase["mu"]
+                    signature = testCase["signature"]
+                    rnd = testCase["rnd"]
+
+                    build_dir = helpers.get_current_build_dir_name()
+                    helpers.run_subprocess(
+                        [f'{build_dir}/tests/vectors_sig', sig_name, "sigGen_externalMu", pk, sk, message, context, mu, signature, rnd]
+                    )
+
+        assert(variantFound == True)
+
 @helpers.filtered_test
 @pytest.mark.skipif(sys.platform.startswith("win"), reason="Not needed on Windows")
 @pytest.mark.parametrize('sig_name', helpers.available_sigs_by_name())
@@ -115,6 +115,97 @@ static int test_aes256ctr_correctness(void) {
 	return EXIT_SUCCESS;
 }
 
+/* Big-endian 64-bit increment of the last eight bytes of a CTR block */
+static void ctr_block(const uint8_t *iv, uint64_t i, uint8_t *block) {
+	uint64_t ctr = 0;
+	memcpy(block, iv, 16);
+	for (size_t j = 8; j < 16; j++) {
+		ctr = (ctr << 8) | block[j];
+	}
+	ctr += i;
+	for (size_t j = 16; j > 8; j--) {
+		block[j - 1] = (uint8_t) ctr;
+		ctr >>= 8;
+	}
+}
+
+#define BULK_MAX_LEN 4160
+
+/* The multi-block ECB and CTR code may process several blocks per
+ * instruction; check it against single-block ECB calls. */
+static int test_aes_bulk_consistency(int aes256) {
+	static const size_t lens[] = {16, 32, 48, 64, 80, 112, 128, 144, 240, 256, 272, 496, 1037, BULK_MAX_LEN - 11};
+	static const uint8_t iv[16] = {0x00, 0x1C, 0xC5, 0xB7, 0x51, 0xA5, 0x1D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF5};
+	static uint8_t in[BULK_MAX_LEN], out[BULK_MAX_LEN], ecb_ref[BULK_MAX_LEN], ctr_ref[BULK_MAX_LEN];
+	uint8_t block[16];
+	void *schedule = NULL;
+	int ret = EXIT_SUCCESS;
+
+	for (size_t i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)(7 * i + 3);
+	}
+	if (aes256) {
+		OQS_AES256_CTR_inc_init(test_aes256_key, &schedule);
+	} else {
+		OQS_AES128_CTR_inc_init(test_aes128_key, &schedule);
+	}
+
+	for (size_t i = 0; i < BULK_MAX_LEN; i += 16) {
+		ctr_block(iv, i / 16, block);
+		if (aes256) {
+			OQS_AES256_ECB_enc_sch(in + i, 16, schedule, ecb_ref + i);
+			OQS_AES256_ECB_enc_sch(block, 16, schedule, ctr_ref + i);
+		} else {
+			OQS_AES128_ECB_enc_sch(in + i, 16, schedule, ecb_ref + i);
+			OQS_AES128_ECB_enc_sch(block, 16, schedule, ctr_ref + i);
+		}
+	}
+
+	for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]) && ret == EXIT_SUCCESS; l++) {
+		size_t len = lens[l];
+		size_t ecb_len = len - len % 16;
+
+		if (aes256) {
+			OQS_AES256_ECB_enc_sch(in, ecb_len, schedule, out);
+		} else {
+			OQS_AES128_ECB_enc_sch(in, ecb_len, schedule, out);
+		}
+		if (memcmp(out, ecb_ref, ecb_len) != 0) {
+			printf("test_aes_bulk_consistency ECB output does not match for %zu bytes\n", ecb_len);
+			ret = EXIT_FAILURE;
+		}
+
+		if (aes256) {
+			OQS_AES256_CTR_inc_stream_iv(iv, sizeof(iv), schedule, out, len);
+		} else {
+			OQS_AES128_CTR_inc_stream_iv(iv, sizeof(iv), schedule, out, len);
+		}
+		if (memcmp(out, ctr_ref, len) != 0) {
+			printf("test_aes_bulk_consistency CTR output does not match for %zu bytes\n", len);
+			ret = EXIT_FAILURE;
+		}
+
+		if (aes256) {
+			/* split the stream at an odd block count to also cover the tails */
+			size_t blks = len / 16;
+			OQS_AES256_CTR_inc_iv(iv, sizeof(iv), schedule);
+			OQS_AES256_CTR_inc_stream_blks(schedule, out, blks / 2 + 1);
+			OQS_AES256_CTR_inc_stream_blks(schedule, out + 16 * (blks / 2 + 1), blks - blks / 2 - 1);
+			if (memcmp(out, ctr_ref, 16 * blks) != 0) {
+				printf("test_aes_bulk_consistency CTR blocks do not match for %zu blocks\n", blks);
+				ret = EXIT_FAILURE;
+			}
+		}
+	}
+
+	if (aes256) {
+		OQS_AES256_free_schedule(schedule);
+	} else {
+		OQS_AES128_free_schedule(schedule);
+	}
+	return ret;
+}
+
 static void speed_aes128(void) {
 	uint8_t ciphertext[16];
 	void *schedule = NULL, *schedule_dec = NULL;
@@ -196,6 +287,10 @@ int main(int argc, char **argv) {
 		OQS_destroy();
 		return EXIT_FAILURE;
 	}
+	if (test_aes_bulk_consistency(0) != EXIT_SUCCESS || test_aes_bulk_consistency(1) != EXIT_SUCCESS) {
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
 
 	if (!aes_callback_called) {
 		printf("AES callback was not called\n");
@@ -245,6 +245,47 @@ static int do_sha512(void) {
 	return 0;
 }
 
+extern struct OQS_SHA2_callbacks sha2_default_callbacks;
+
+static int do_sha256_x8(void) {
+	// read message from stdin
+	uint8_t *msg;
+	size_t msg_len;
+	if (read_stdin(&msg, &msg_len) != 0) {
+		fprintf(stderr, "ERROR reading from stdin\n");
+		return -1;
+	}
+	// lane i hashes msg with its first byte flipped by i, so the lanes differ
+	uint8_t *in[8];
+	uint8_t out[8][32];
+	uint8_t expected[32];
+	int ret = 0;
+	for (size_t i = 0; i < 8; i++) {
+		in[i] = OQS_MEM_malloc(msg_len + 1);
+		memcpy(in[i], msg, msg_len);
+		if (msg_len > 0) {
+			in[i][0] ^= (uint8_t) i;
+		}
+	}
+	// the multi-buffer path is only taken with the default callbacks
+	OQS_SHA2_set_callbacks(&sha2_default_callbacks);
+	OQS_SHA2_sha256_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7],
+	                   in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], msg_len);
+	for (size_t i = 0; i < 8; i++) {
+		OQS_SHA2_sha256(expected, in[i], msg_len);
+		if (memcmp(out[i], expected, 32) != 0) {
+			fprintf(stderr, "ERROR: Lane %zu of the x8 API failed to match main API\n", i);
+			ret = -2;
+		}
+		OQS_MEM_insecure_free(in[i]);
+	}
+	if (ret == 0) {
+		print_hex(out[0], 32);
+	}
+	OQS_MEM_insecure_free(msg);
+	return ret;
+}
+
 static int do_arbitrary_hash(void (*hash)(uint8_t *, const uint8_t *, size_t), size_t hash_len) {
 	// read message from stdin
 	uint8_t *msg;
@@ -262,8 +303,6 @@ static int do_arbitrary_hash(void (*hash)(uint8_t *, const uint8_t *, size_t), s
 	return 0;
 }
 
-extern struct OQS_SHA2_callbacks sha2_default_callbacks;
-
 static void override_SHA2_sha256_inc_init(OQS_SHA2_sha256_ctx *state) {
 	sha2_callback_called = true;
 	sha2_default_callbacks.SHA2_sha256_inc_init(state);
@@ -279,7 +318,7 @@ int main(int argc, char **argv) {
 	OQS_init();
 	if (argc != 2) {
 		fprintf(stderr, "Usage: test_hash algname\n");
-		fprintf(stderr, "  algname: sha256, sha384, sha512, sha256inc, sha384inc, sha512inc\n");
+		fprintf(stderr, "  algname: sha256, sha384, sha512, sha256inc, sha384inc, sha512inc, sha256x8\n");
 		fprintf(stderr, "           sha3_256, sha3_384, sha3_512\n");
 		fprintf(stderr, "  test_hash reads input from stdin and outputs hash value as hex string to stdout");
 		printf("\n");
@@ -291,6 +330,8 @@ int main(int argc, char **argv) {
 
 	if (strcmp(hash_alg, "sha256inc") == 0) {
 		ret = do_sha256();
+	} else if (strcmp(hash_alg, "sha256x8") == 0) {
+		ret = do_sha256_x8();
 	} else if (strcmp(hash_alg, "sha384inc") == 0) {
 		ret = do_sha384();
 	} else if (strcmp(hash_alg, "sha512inc") == 0) {
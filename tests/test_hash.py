@@ -46,6 +46,14 @@ def test_hash_sha2_random(algname):
         if output.rstrip() != hasher.hexdigest():
             print(msg.hex())
             assert False, algname + " hashes (using liboqs incremental API) don't match for the above " + str(i) + "-byte hex string; liboqs output = " + output.rstrip() + "; Python output = " + hasher.hexdigest()
+        if algname != "sha256": continue
+        output = helpers.run_subprocess(
+            [helpers.path_to_executable('test_hash'), algname + 'x8'],
+            input = msg,
+        )
+        if output.rstrip() != hasher.hexdigest():
+            print(msg.hex())
+            assert False, algname + " hashes (using liboqs x8 API) don't match for the above " + str(i) + "-byte hex string; liboqs output = " + output.rstrip() + "; Python output = " + hasher.hexdigest()
 
 if __name__ == "__main__":
     import sys
@@ -7,53 +7,54 @@
 #include <oqs/rand_nist.h>  // Internal NIST DRBG API
 #include <oqs/sha3.h>       // Internal SHA3 API
 
+#if defined(OQS_USE_PTHREADS)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #include "test_helpers.h"
 
 /* HQC PRNG implementation */
 
-// State for HQC PRNG. Analogue of DRBG_ctx in rand/rand_nist.c
-static OQS_SHA3_shake256_inc_ctx hqc_prng_state = { NULL };
-
-// Allocate the state.
-static void hqc_prng_new(void) {
-	OQS_SHA3_shake256_inc_init(&hqc_prng_state);
-}
-
 // entropy_input must have length 48.
 // If personalization_string is non-null, its length must also be 48.
-static void hqc_prng_seed(const uint8_t *entropy_input, const uint8_t *personalization_string) {
+static void hqc_prng_seed(OQS_KAT_PRNG_state *state, const uint8_t *entropy_input, const uint8_t *personalization_string) {
 	uint8_t domain = 1;
 	// reset state
-	OQS_SHA3_shake256_inc_ctx_reset(&hqc_prng_state);
-	OQS_SHA3_shake256_inc_absorb(&hqc_prng_state, entropy_input, 48);
+	OQS_SHA3_shake256_inc_ctx_reset(&state->hqc_state);
+	OQS_SHA3_shake256_inc_absorb(&state->hqc_state, entropy_input, 48);
 	if (personalization_string != NULL) {
-		OQS_SHA3_shake256_inc_absorb(&hqc_prng_state, personalization_string, 48);
+		OQS_SHA3_shake256_inc_absorb(&state->hqc_state, personalization_string, 48);
 	}
-	OQS_SHA3_shake256_inc_absorb(&hqc_prng_state, &domain, 1);
-	OQS_SHA3_shake256_inc_finalize(&hqc_prng_state);
+	OQS_SHA3_shake256_inc_absorb(&state->hqc_state, &domain, 1);
+	OQS_SHA3_shake256_inc_finalize(&state->hqc_state);
 }
 
 // random_array must have length bytes_to_read.
-static void hqc_prng_randombytes(uint8_t *random_array, size_t bytes_to_read) {
-	OQS_SHA3_shake256_inc_squeeze(random_array, bytes_to_read, &hqc_prng_state);
+static void hqc_prng_randombytes(void *state, uint8_t *random_array, size_t bytes_to_read) {
+	OQS_SHA3_shake256_inc_squeeze(random_array, bytes_to_read, &((OQS_KAT_PRNG_state *)state)->hqc_state);
 }
 
-static void hqc_prng_get_state(void *out) {
-	OQS_SHA3_shake256_inc_ctx_clone((OQS_SHA3_shake256_inc_ctx *)out, &hqc_prng_state);
+static void hqc_prng_copy_state(OQS_KAT_PRNG_state *dest, const OQS_KAT_PRNG_state *src) {
+	OQS_SHA3_shake256_inc_ctx_clone(&dest->hqc_state, &src->hqc_state);
 }
 
-static void hqc_prng_set_state(const void *in) {
-	OQS_SHA3_shake256_inc_ctx_clone(&hqc_prng_state, (const OQS_SHA3_shake256_inc_ctx *)in);
+static void hqc_prng_free(OQS_KAT_PRNG_state *state) {
+	OQS_SHA3_shake256_inc_ctx_release(&state->hqc_state);
 }
 
-static void hqc_prng_free(OQS_KAT_PRNG_state *saved_state) {
-	if (saved_state != NULL) {
-		OQS_SHA3_shake256_inc_ctx_release(&saved_state->hqc_state);
-	}
-	if (hqc_prng_state.ctx != NULL) {
-		OQS_SHA3_shake256_inc_ctx_release(&hqc_prng_state);
-		hqc_prng_state.ctx = NULL;
-	}
+/* NIST DRBG, one instance per OQS_KAT_PRNG */
+
+static void nist_prng_seed(OQS_KAT_PRNG_state *state, const uint8_t *entropy_input, const uint8_t *personalization_string) {
+	OQS_randombytes_nist_kat_ctx_init_256bit(&state->nist_state, entropy_input, personalization_string);
+}
+
+static void nist_prng_randombytes(void *state, uint8_t *random_array, size_t bytes_to_read) {
+	OQS_randombytes_nist_kat_ctx(&((OQS_KAT_PRNG_state *)state)->nist_state, random_array, bytes_to_read);
+}
+
+static void nist_prng_copy_state(OQS_KAT_PRNG_state *dest, const OQS_KAT_PRNG_state *src) {
+	dest->nist_state = src->nist_state;
 }
 
 /* Helpers for identifying algorithms */
@@ -83,23 +84,19 @@ OQS_KAT_PRNG *OQS_KAT_PRNG_new(const char *method_name) {
 	if (prng != NULL) {
 		prng->max_kats = is_mceliece(method_name) ? 10 : 100;
 		if (is_hqc(method_name)) {
-			// set randombytes function
-			OQS_randombytes_custom_algorithm(&hqc_prng_randombytes);
-			// reset the PRNG
-			hqc_prng_new();
-			// initialize saved state
+			OQS_SHA3_shake256_inc_init(&prng->state.hqc_state);
 			OQS_SHA3_shake256_inc_init(&prng->saved_state.hqc_state);
 			prng->seed = &hqc_prng_seed;
-			prng->get_state = &hqc_prng_get_state;
-			prng->set_state = &hqc_prng_set_state;
+			prng->copy_state = &hqc_prng_copy_state;
 			prng->free = &hqc_prng_free;
+			// set randombytes function for this thread
+			OQS_randombytes_thread_custom_algorithm(&hqc_prng_randombytes, &prng->state);
 		} else {
-			// set randombytes function
-			OQS_randombytes_custom_algorithm(&OQS_randombytes_nist_kat);
-			prng->seed = &OQS_randombytes_nist_kat_init_256bit;
-			prng->get_state = &OQS_randombytes_nist_kat_get_state;
-			prng->set_state = &OQS_randombytes_nist_kat_set_state;
+			prng->seed = &nist_prng_seed;
+			prng->copy_state = &nist_prng_copy_state;
 			prng->free = NULL;
+			// set randombytes function for this thread
+			OQS_randombytes_thread_custom_algorithm(&nist_prng_randombytes, &prng->state);
 		}
 	}
 	return prng;
@@ -109,32 +106,153 @@ OQS_KAT_PRNG *OQS_KAT_PRNG_new(const char *method_name) {
 // If personalization_string is non-null, its length must also be 48.
 void OQS_KAT_PRNG_seed(OQS_KAT_PRNG *prng, const uint8_t *entropy_input, const uint8_t *personalization_string) {
 	if (prng != NULL) {
-		prng->seed(entropy_input, personalization_string);
+		prng->seed(&prng->state, entropy_input, personalization_string);
 	}
 }
 
 void OQS_KAT_PRNG_save_state(OQS_KAT_PRNG *prng) {
 	if (prng != NULL) {
-		prng->get_state(&prng->saved_state);
+		prng->copy_state(&prng->saved_state, &prng->state);
 	}
 }
 
 void OQS_KAT_PRNG_restore_state(OQS_KAT_PRNG *prng) {
 	if (prng != NULL) {
-		prng->set_state(&prng->saved_state);
+		prng->copy_state(&prng->state, &prng->saved_state);
 	}
 }
 
 void OQS_KAT_PRNG_free(OQS_KAT_PRNG *prng) {
 	if (prng != NULL) {
-		// saved_state needs to be handled dynamically
+		OQS_randombytes_thread_custom_algorithm(NULL, NULL);
+		// the states need to be handled dynamically
 		if (prng->free != NULL) {
+			prng->free(&prng->state);
 			prng->free(&prng->saved_state);
 		}
 	}
 	OQS_MEM_insecure_free(prng);
 }
 
+/* Runs KAT jobs on a pool of worker threads */
+
+#if defined(OQS_USE_PTHREADS)
+// Classic McEliece needs more stack than the default for a thread
+#define KAT_THREAD_STACK_SIZE ((size_t)64 << 20)
+
+typedef struct {
+	size_t count;
+	size_t next;
+	pthread_mutex_t lock;
+	OQS_STATUS (*job)(size_t, FILE *, void *);
+	void *arg;
+	FILE **files;
+	OQS_STATUS *results;
+} kat_pool;
+
+static void *kat_worker(void *arg) {
+	kat_pool *pool = arg;
+
+	for (;;) {
+		size_t i;
+		pthread_mutex_lock(&pool->lock);
+		i = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+		if (i >= pool->count) {
+			break;
+		}
+		pool->files[i] = tmpfile();
+		if (pool->files[i] == NULL) {
+			fprintf(stderr, "ERROR: tmpfile failed\n");
+			pool->results[i] = OQS_ERROR;
+			continue;
+		}
+		pool->results[i] = pool->job(i, pool->files[i], pool->arg);
+	}
+	OQS_thread_stop();
+	return NULL;
+}
+
+static size_t online_cpus(void) {
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (size_t)n : 1;
+}
+#endif
+
+OQS_STATUS OQS_KAT_run_jobs(size_t count, size_t max_threads, OQS_STATUS (*job)(size_t, FILE *, void *), void *arg, FILE *out) {
+	OQS_STATUS ret = OQS_SUCCESS;
+#if defined(OQS_USE_PTHREADS)
+	kat_pool pool;
+	pthread_t *threads = NULL;
+	pthread_attr_t attr;
+	size_t num_threads = 0;
+	char buf[4096];
+	size_t n;
+
+	if (max_threads == 0) {
+		max_threads = online_cpus();
+	}
+	if (count > 1 && max_threads > 1) {
+		pool.count = count;
+		pool.next = 0;
+		pool.job = job;
+		pool.arg = arg;
+		pool.files = OQS_MEM_calloc(count, sizeof(FILE *));
+		pool.results = OQS_MEM_calloc(count, sizeof(OQS_STATUS));
+		threads = OQS_MEM_calloc(max_threads < count ? max_threads : count, sizeof(pthread_t));
+		if (pool.files == NULL || pool.results == NULL || threads == NULL || pthread_mutex_init(&pool.lock, NULL)) {
+			fprintf(stderr, "ERROR: setting up the thread pool failed\n");
+			OQS_MEM_insecure_free(pool.files);
+			OQS_MEM_insecure_free(pool.results);
+			OQS_MEM_insecure_free(threads);
+			return OQS_ERROR;
+		}
+		pthread_attr_init(&attr);
+		pthread_attr_setstacksize(&attr, KAT_THREAD_STACK_SIZE);
+		while (num_threads < max_threads && num_threads < count) {
+			if (pthread_create(&threads[num_threads], &attr, kat_worker, &pool)) {
+				break;
+			}
+			num_threads++;
+		}
+		pthread_attr_destroy(&attr);
+		if (num_threads == 0) {
+			// no worker could be started, run the jobs on this thread
+			kat_worker(&pool);
+		}
+		for (size_t t = 0; t < num_threads; t++) {
+			pthread_join(threads[t], NULL);
+		}
+		pthread_mutex_destroy(&pool.lock);
+
+		for (size_t i = 0; i < count; i++) {
+			if (pool.files[i] != NULL) {
+				rewind(pool.files[i]);
+				while ((n = fread(buf, 1, sizeof(buf), pool.files[i])) > 0) {
+					fwrite(buf, 1, n, out);
+				}
+				fclose(pool.files[i]);
+			}
+			if (pool.results[i] != OQS_SUCCESS) {
+				ret = OQS_ERROR;
+			}
+		}
+		OQS_MEM_insecure_free(pool.files);
+		OQS_MEM_insecure_free(pool.results);
+		OQS_MEM_insecure_free(threads);
+		return ret;
+	}
+#else
+	(void)max_threads;
+#endif
+	for (size_t i = 0; i < count; i++) {
+		if (job(i, out, arg) != OQS_SUCCESS) {
+			ret = OQS_ERROR;
+		}
+	}
+	return ret;
+}
+
 /* Displays hexadecimal strings */
 void OQS_print_hex_string(const char *label, const uint8_t *str, size_t len) {
 	printf("%-20s (%4zu bytes):  ", label, len);
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <oqs/common.h>
 #include <oqs/sha3.h>
 #include <oqs/rand_nist.h>
 
@@ -16,14 +17,16 @@ typedef union {
 
 typedef struct {
 	size_t max_kats;
+	OQS_KAT_PRNG_state state;
 	OQS_KAT_PRNG_state saved_state;
 	// The caller should use the OQS_KAT_PRNG_* functions instead of these callbacks.
-	void (*seed)(const uint8_t *, const uint8_t *);
-	void (*get_state)(void *);
-	void (*set_state)(const void *);
+	void (*seed)(OQS_KAT_PRNG_state *, const uint8_t *, const uint8_t *);
+	void (*copy_state)(OQS_KAT_PRNG_state *, const OQS_KAT_PRNG_state *);
 	void (*free)(OQS_KAT_PRNG_state *);
 } OQS_KAT_PRNG;
 
+// Creates a PRNG for the KATs of method_name and binds OQS_randombytes to it
+// for the calling thread, until OQS_KAT_PRNG_free.
 OQS_KAT_PRNG *OQS_KAT_PRNG_new(const char *method_name);
 
 void OQS_KAT_PRNG_seed(OQS_KAT_PRNG *prng, const uint8_t *seed, const uint8_t *personalization_string);
@@ -34,6 +37,12 @@ void OQS_KAT_PRNG_restore_state(OQS_KAT_PRNG *prng);
 
 void OQS_KAT_PRNG_free(OQS_KAT_PRNG *prng);
 
+// Runs job(i, fh, arg) for i = 0, ..., count - 1 on up to max_threads worker
+// threads (0 means one per online CPU). Each job writes to its own temporary
+// file and the files are copied to out in order of i, so the output does not
+// depend on scheduling. Returns OQS_SUCCESS if every job succeeded.
+OQS_STATUS OQS_KAT_run_jobs(size_t count, size_t max_threads, OQS_STATUS (*job)(size_t, FILE *, void *), void *arg, FILE *out);
+
 void OQS_print_hex_string(const char *label, const uint8_t *str, size_t len);
 
 void OQS_fprintBstr(FILE *fp, const char *S, const uint8_t *A, size_t L);
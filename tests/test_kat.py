@@ -7,6 +7,11 @@ import pytest
 import platform
 from hashlib import sha256
 
+# Fast schemes run together by the parallel KAT tests; the full set is
+# already covered one scheme at a time by test_kem and test_sig
+parallel_kem_names = ['ML-KEM-512', 'ML-KEM-768', 'ML-KEM-1024', 'Kyber512']
+parallel_sig_names = ['ML-DSA-44', 'ML-DSA-65', 'Falcon-512', 'MAYO-1']
+
 @helpers.filtered_test
 @pytest.mark.parametrize('kem_name', helpers.available_kems_by_name())
 def test_kem(kem_name):
@@ -35,6 +40,42 @@ def test_sig(sig_name):
 
     assert(kats[sig_name]['single'] == h256.hexdigest())
 
+def split_kat_output(output):
+    # kat_kem and kat_sig precede the output of each algorithm with "# algname" when given several
+    blocks = {}
+    name = None
+    for line in output.replace("\r\n", "\n").splitlines(keepends=True):
+        if line.startswith("# "):
+            name = line[2:].strip()
+            blocks[name] = ""
+        else:
+            blocks[name] += line
+    return blocks
+
+@helpers.filtered_test
+def test_kem_parallel():
+    kats = helpers.get_kats("kem")
+    kem_names = [kem_name for kem_name in parallel_kem_names if helpers.is_kem_enabled_by_name(kem_name)]
+    if len(kem_names) < 2: pytest.skip('Fewer than two KEMs enabled')
+    output = helpers.run_subprocess(
+        [helpers.path_to_executable('kat_kem')] + kem_names + ['--threads=4'],
+    )
+    blocks = split_kat_output(output)
+    for kem_name in kem_names:
+        assert(kats[kem_name]['single'] == sha256(blocks[kem_name].encode()).hexdigest())
+
+@helpers.filtered_test
+def test_sig_parallel():
+    kats = helpers.get_kats("sig")
+    sig_names = [sig_name for sig_name in parallel_sig_names if helpers.is_sig_enabled_by_name(sig_name)]
+    if len(sig_names) < 2: pytest.skip('Fewer than two signature schemes enabled')
+    output = helpers.run_subprocess(
+        [helpers.path_to_executable('kat_sig')] + sig_names + ['--threads=4'],
+    )
+    blocks = split_kat_output(output)
+    for sig_name in sig_names:
+        assert(kats[sig_name]['single'] == sha256(blocks[sig_name].encode()).hexdigest())
+
 @helpers.filtered_test
 @pytest.mark.parametrize('sig_stfl_name', helpers.available_sig_stfls_by_name())
 def test_sig_stfl(sig_stfl_name):
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 
+#include <ctype.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -123,10 +124,266 @@ cleanup:
 }
 #endif //OQS_ENABLE_KEM_ML_KEM
 
+#define KEM_TEST_BATCH_COUNT 5
+
+/* Checks that the batch API agrees with the single-shot API for every entry */
+static OQS_STATUS kem_test_batch(OQS_KEM *kem, const uint8_t *public_key, const uint8_t *secret_key) {
+	uint8_t *public_keys = NULL;
+	uint8_t *secret_keys = NULL;
+	uint8_t *ciphertexts = NULL;
+	uint8_t *shared_secrets_e = NULL;
+	uint8_t *shared_secrets_d = NULL;
+	uint8_t *shared_secret = NULL;
+	OQS_STATUS rc, ret = OQS_ERROR;
+	const size_t count = KEM_TEST_BATCH_COUNT;
+
+	public_keys = OQS_MEM_malloc(count * kem->length_public_key);
+	secret_keys = OQS_MEM_malloc(count * kem->length_secret_key);
+	ciphertexts = OQS_MEM_malloc(count * kem->length_ciphertext);
+	shared_secrets_e = OQS_MEM_malloc(count * kem->length_shared_secret);
+	shared_secrets_d = OQS_MEM_malloc(count * kem->length_shared_secret);
+	shared_secret = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((public_keys == NULL) || (secret_keys == NULL) || (ciphertexts == NULL) || (shared_secrets_e == NULL) || (shared_secrets_d == NULL) || (shared_secret == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		memcpy(public_keys + i * kem->length_public_key, public_key, kem->length_public_key);
+		memcpy(secret_keys + i * kem->length_secret_key, secret_key, kem->length_secret_key);
+	}
+
+	rc = OQS_KEM_encaps_batch(kem, count, ciphertexts, shared_secrets_e, public_keys);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_batch failed\n");
+		goto cleanup;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(ciphertexts, count * kem->length_ciphertext);
+	rc = OQS_KEM_decaps_batch(kem, count, shared_secrets_d, ciphertexts, secret_keys);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_KEM_decaps_batch failed\n");
+		goto cleanup;
+	}
+
+	OQS_TEST_CT_DECLASSIFY(shared_secrets_e, count * kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secrets_d, count * kem->length_shared_secret);
+	for (size_t i = 0; i < count; i++) {
+		rc = OQS_KEM_decaps(kem, shared_secret, ciphertexts + i * kem->length_ciphertext, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(shared_secret, kem->length_shared_secret);
+		if (rc != OQS_SUCCESS ||
+		        memcmp(shared_secrets_e + i * kem->length_shared_secret, shared_secrets_d + i * kem->length_shared_secret, kem->length_shared_secret) != 0 ||
+		        memcmp(shared_secret, shared_secrets_d + i * kem->length_shared_secret, kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: batch shared secrets are not equal for entry %zu\n", i);
+			goto cleanup;
+		}
+	}
+	printf("batch shared secrets are equal\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	if (secret_keys) {
+		OQS_MEM_secure_free(secret_keys, count * kem->length_secret_key);
+	}
+	if (shared_secrets_e) {
+		OQS_MEM_secure_free(shared_secrets_e, count * kem->length_shared_secret);
+	}
+	if (shared_secrets_d) {
+		OQS_MEM_secure_free(shared_secrets_d, count * kem->length_shared_secret);
+	}
+	if (shared_secret) {
+		OQS_MEM_secure_free(shared_secret, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(public_keys);
+	OQS_MEM_insecure_free(ciphertexts);
+	return ret;
+}
+
 typedef struct magic_s {
 	uint8_t val[31];
 } magic_t;
 
+/* Encapsulates and decapsulates through OQS_KEM_PUBLIC_KEY and OQS_KEM_SECRET_KEY
+ * objects and checks the results against regular decapsulation, including for
+ * a modified ciphertext. */
+static OQS_STATUS kem_test_prepared(OQS_KEM *kem, const uint8_t *public_key, const uint8_t *secret_key) {
+	OQS_KEM_PUBLIC_KEY *prepared_public_key = NULL;
+	OQS_KEM_SECRET_KEY *prepared_secret_key = NULL;
+	uint8_t *ciphertext = NULL;
+	uint8_t *shared_secret_e = NULL;
+	uint8_t *shared_secret_d = NULL;
+	uint8_t *shared_secret_p = NULL;
+	OQS_STATUS rc, rc_p, ret = OQS_ERROR;
+
+	ciphertext = OQS_MEM_malloc(kem->length_ciphertext);
+	shared_secret_e = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_d = OQS_MEM_malloc(kem->length_shared_secret);
+	shared_secret_p = OQS_MEM_malloc(kem->length_shared_secret);
+	if ((ciphertext == NULL) || (shared_secret_e == NULL) || (shared_secret_d == NULL) || (shared_secret_p == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+
+	prepared_public_key = OQS_KEM_PUBLIC_KEY_new(kem, public_key);
+	if (prepared_public_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_PUBLIC_KEY_new failed\n");
+		goto cleanup;
+	}
+	prepared_secret_key = OQS_KEM_SECRET_KEY_new(kem, secret_key);
+	if (prepared_secret_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_SECRET_KEY_new failed\n");
+		goto cleanup;
+	}
+
+	/* Run twice to check that the prepared keys are not modified by use */
+	for (int i = 0; i < 2; i++) {
+		rc = OQS_KEM_encaps_prepared(kem, ciphertext, shared_secret_e, prepared_public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps_prepared failed\n");
+			goto cleanup;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(ciphertext, kem->length_ciphertext);
+		rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key);
+		rc_p = OQS_KEM_decaps_prepared(kem, shared_secret_p, ciphertext, prepared_secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		OQS_TEST_CT_DECLASSIFY(&rc_p, sizeof rc_p);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_e, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+		OQS_TEST_CT_DECLASSIFY(shared_secret_p, kem->length_shared_secret);
+		if (rc != OQS_SUCCESS || rc_p != OQS_SUCCESS ||
+		        memcmp(shared_secret_e, shared_secret_d, kem->length_shared_secret) != 0 ||
+		        memcmp(shared_secret_p, shared_secret_d, kem->length_shared_secret) != 0) {
+			fprintf(stderr, "ERROR: prepared key shared secrets are not equal\n");
+			goto cleanup;
+		}
+	}
+
+	/* Implicit rejection must not depend on the key representation */
+	ciphertext[0] ^= 1;
+	rc = OQS_KEM_decaps(kem, shared_secret_d, ciphertext, secret_key);
+	rc_p = OQS_KEM_decaps_prepared(kem, shared_secret_p, ciphertext, prepared_secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(&rc_p, sizeof rc_p);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_d, kem->length_shared_secret);
+	OQS_TEST_CT_DECLASSIFY(shared_secret_p, kem->length_shared_secret);
+	if (rc != rc_p || (rc == OQS_SUCCESS && memcmp(shared_secret_p, shared_secret_d, kem->length_shared_secret) != 0)) {
+		fprintf(stderr, "ERROR: prepared secret key differs from secret key on modified ciphertext\n");
+		goto cleanup;
+	}
+	printf("prepared key shared secrets are equal\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_KEM_PUBLIC_KEY_free(prepared_public_key);
+	OQS_KEM_SECRET_KEY_free(prepared_secret_key);
+	if (shared_secret_e) {
+		OQS_MEM_secure_free(shared_secret_e, kem->length_shared_secret);
+	}
+	if (shared_secret_d) {
+		OQS_MEM_secure_free(shared_secret_d, kem->length_shared_secret);
+	}
+	if (shared_secret_p) {
+		OQS_MEM_secure_free(shared_secret_p, kem->length_shared_secret);
+	}
+	OQS_MEM_insecure_free(ciphertext);
+	return ret;
+}
+
+/* Checks that keypair_derand and encaps_derand are deterministic in their seeds and
+ * that their outputs decapsulate correctly. */
+static OQS_STATUS kem_test_derand(OQS_KEM *kem) {
+	uint8_t *public_keys = NULL;
+	uint8_t *secret_keys = NULL;
+	uint8_t *ciphertexts = NULL;
+	uint8_t *shared_secrets = NULL;
+	uint8_t *seed = NULL;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	if (kem->keypair_derand == NULL || kem->encaps_derand == NULL) {
+		uint8_t unused[1] = {0};
+		if (kem->keypair_derand == NULL && OQS_KEM_keypair_derand(kem, unused, unused, unused) != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_KEM_keypair_derand succeeded without keypair_derand\n");
+			return OQS_ERROR;
+		}
+		if (kem->encaps_derand == NULL && OQS_KEM_encaps_derand(kem, unused, unused, unused, unused) != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps_derand succeeded without encaps_derand\n");
+			return OQS_ERROR;
+		}
+		return OQS_SUCCESS;
+	}
+
+	public_keys = OQS_MEM_malloc(2 * kem->length_public_key);
+	secret_keys = OQS_MEM_malloc(2 * kem->length_secret_key);
+	ciphertexts = OQS_MEM_malloc(2 * kem->length_ciphertext);
+	shared_secrets = OQS_MEM_malloc(3 * kem->length_shared_secret);
+	seed = OQS_MEM_malloc(kem->length_keypair_seed > kem->length_encaps_seed ? kem->length_keypair_seed : kem->length_encaps_seed);
+	if ((public_keys == NULL) || (secret_keys == NULL) || (ciphertexts == NULL) || (shared_secrets == NULL) || (seed == NULL)) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+
+	OQS_randombytes(seed, kem->length_keypair_seed);
+	for (size_t i = 0; i < 2; i++) {
+		rc = OQS_KEM_keypair_derand(kem, public_keys + i * kem->length_public_key, secret_keys + i * kem->length_secret_key, seed);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_keypair_derand failed\n");
+			goto cleanup;
+		}
+	}
+	OQS_TEST_CT_DECLASSIFY(public_keys, 2 * kem->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(secret_keys, 2 * kem->length_secret_key);
+	if (memcmp(public_keys, public_keys + kem->length_public_key, kem->length_public_key) != 0 ||
+	        memcmp(secret_keys, secret_keys + kem->length_secret_key, kem->length_secret_key) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_keypair_derand is not deterministic\n");
+		goto cleanup;
+	}
+
+	OQS_randombytes(seed, kem->length_encaps_seed);
+	for (size_t i = 0; i < 2; i++) {
+		rc = OQS_KEM_encaps_derand(kem, ciphertexts + i * kem->length_ciphertext, shared_secrets + i * kem->length_shared_secret, public_keys, seed);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_KEM_encaps_derand failed\n");
+			goto cleanup;
+		}
+	}
+	OQS_TEST_CT_DECLASSIFY(ciphertexts, 2 * kem->length_ciphertext);
+	rc = OQS_KEM_decaps(kem, shared_secrets + 2 * kem->length_shared_secret, ciphertexts, secret_keys);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	OQS_TEST_CT_DECLASSIFY(shared_secrets, 3 * kem->length_shared_secret);
+	if (memcmp(ciphertexts, ciphertexts + kem->length_ciphertext, kem->length_ciphertext) != 0 ||
+	        memcmp(shared_secrets, shared_secrets + kem->length_shared_secret, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: OQS_KEM_encaps_derand is not deterministic\n");
+		goto cleanup;
+	}
+	if (rc != OQS_SUCCESS || memcmp(shared_secrets, shared_secrets + 2 * kem->length_shared_secret, kem->length_shared_secret) != 0) {
+		fprintf(stderr, "ERROR: derand shared secrets are not equal\n");
+		goto cleanup;
+	}
+	printf("derand shared secrets are equal\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	if (secret_keys) {
+		OQS_MEM_secure_free(secret_keys, 2 * kem->length_secret_key);
+	}
+	if (shared_secrets) {
+		OQS_MEM_secure_free(shared_secrets, 3 * kem->length_shared_secret);
+	}
+	if (seed) {
+		OQS_MEM_secure_free(seed, kem->length_keypair_seed > kem->length_encaps_seed ? kem->length_keypair_seed : kem->length_encaps_seed);
+	}
+	OQS_MEM_insecure_free(public_keys);
+	OQS_MEM_insecure_free(ciphertexts);
+	return ret;
+}
+
 static OQS_STATUS kem_test_correctness(const char *method_name) {
 
 	OQS_KEM *kem = NULL;
@@ -219,6 +476,18 @@ static OQS_STATUS kem_test_correctness(const char *method_name) {
 		printf("shared secrets are equal\n");
 	}
 
+	if (kem_test_batch(kem, public_key, secret_key) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	if (kem_test_prepared(kem, public_key, secret_key) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	if (kem_test_derand(kem) != OQS_SUCCESS) {
+		goto err;
+	}
+
 #ifdef OQS_ENABLE_KEM_ML_KEM
 	/* check mlkem rejection testcases. returns true for all other kem algos */
 	if (false == mlkem_rej_testcase(kem, ciphertext, secret_key)) {
@@ -281,6 +550,51 @@ cleanup:
 	return ret;
 }
 
+/* Checks that OQS_KEM_get agrees with OQS_KEM_new and OQS_KEM_alg_is_enabled */
+static OQS_STATUS kem_test_registry(const char *method_name) {
+	char lower_name[128];
+	const OQS_KEM *desc;
+	OQS_KEM *kem;
+	size_t i;
+	OQS_STATUS ret = OQS_ERROR;
+
+	for (i = 0; i < OQS_KEM_algs_length; i++) {
+		const char *name = OQS_KEM_alg_identifier(i);
+		if ((OQS_KEM_get(name) != NULL) != (OQS_KEM_alg_is_enabled(name) != 0)) {
+			fprintf(stderr, "ERROR: OQS_KEM_get and OQS_KEM_alg_is_enabled disagree on %s\n", name);
+			return OQS_ERROR;
+		}
+	}
+	if (OQS_KEM_get("not-an-algorithm") != NULL || OQS_KEM_get(NULL) != NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_get accepted an invalid name\n");
+		return OQS_ERROR;
+	}
+
+	for (i = 0; method_name[i] != '\0' && i < sizeof(lower_name) - 1; i++) {
+		lower_name[i] = (char)tolower((unsigned char)method_name[i]);
+	}
+	lower_name[i] = '\0';
+	desc = OQS_KEM_get(method_name);
+	if (desc == NULL || OQS_KEM_get(lower_name) != desc) {
+		fprintf(stderr, "ERROR: OQS_KEM_get did not return the shared descriptor of %s\n", method_name);
+		return OQS_ERROR;
+	}
+
+	kem = OQS_KEM_new(method_name);
+	if (kem == NULL) {
+		fprintf(stderr, "ERROR: OQS_KEM_new failed\n");
+		return OQS_ERROR;
+	}
+	if (strcmp(desc->method_name, kem->method_name) != 0 || desc->length_public_key != kem->length_public_key ||
+	        desc->length_secret_key != kem->length_secret_key || desc->keypair != kem->keypair) {
+		fprintf(stderr, "ERROR: the descriptor of %s differs from OQS_KEM_new\n", method_name);
+	} else {
+		ret = OQS_SUCCESS;
+	}
+	OQS_KEM_free(kem);
+	return ret;
+}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 static void TEST_KEM_randombytes(uint8_t *random_array, size_t bytes_to_read) {
 	// We can't make direct calls to the system randombytes on some platforms,
@@ -338,6 +652,11 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 
+	if (kem_test_registry(alg_name) != OQS_SUCCESS) {
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 	OQS_randombytes_custom_algorithm(&TEST_KEM_randombytes);
 #else
@@ -1040,6 +1040,154 @@ int shake_256_x4_kat_test(void) {
 	return status;
 }
 
+/**
+* \brief Compares eight-way parallel SHAKE against the single-state functions.
+*
+* Every lane gets a different input, and the lengths cover partial,
+* exact and multi-block absorption as well as outputs longer than the rate.
+*
+* \param use_shake256 Selects SHAKE-256 instead of SHAKE-128
+*
+* \return status 0 for success
+*/
+static int shake_x8_test(int use_shake256) {
+	static const size_t inlens[] = { 0, 1, 32, 135, 136, 168, 169, 500 };
+	static const size_t outlens[] = { 1, 32, 136, 168, 337, 600 };
+	uint8_t in[8][500];
+	uint8_t out[8][600];
+	uint8_t exp[600];
+	int status = EXIT_SUCCESS;
+
+	for (size_t j = 0; j < 8; j++) {
+		for (size_t k = 0; k < sizeof(in[j]); k++) {
+			in[j][k] = (uint8_t)(31 * j + 7 * k + 1);
+		}
+	}
+
+	for (size_t i = 0; i < sizeof(inlens) / sizeof(inlens[0]); i++) {
+		for (size_t o = 0; o < sizeof(outlens) / sizeof(outlens[0]); o++) {
+			if (use_shake256) {
+				OQS_SHA3_shake256_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], outlens[o],
+				                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], inlens[i]);
+			} else {
+				OQS_SHA3_shake128_x8(out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], outlens[o],
+				                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], inlens[i]);
+			}
+			for (size_t j = 0; j < 8; j++) {
+				if (use_shake256) {
+					OQS_SHA3_shake256(exp, outlens[o], in[j], inlens[i]);
+				} else {
+					OQS_SHA3_shake128(exp, outlens[o], in[j], inlens[i]);
+				}
+				if (are_equal8(out[j], exp, outlens[o]) == EXIT_FAILURE) {
+					status = EXIT_FAILURE;
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+/**
+* \brief Compares the caller-allocated SHAKE states against the one-shot functions.
+*
+* Absorbs in uneven pieces, squeezes across block boundaries and checks that
+* clone and reset behave like their incremental counterparts.
+*
+* \return status 0 for success
+*/
+static int shake_stack_test(void) {
+	uint8_t in[4][400];
+	uint8_t out[4][500];
+	uint8_t exp[500];
+	int status = EXIT_SUCCESS;
+
+	for (size_t j = 0; j < 4; j++) {
+		for (size_t k = 0; k < sizeof(in[j]); k++) {
+			in[j][k] = (uint8_t)(17 * j + 3 * k + 5);
+		}
+	}
+
+	OQS_SHA3_shake128_stack_ctx s128, c128;
+	OQS_SHA3_shake128_stack_init(&s128);
+	OQS_SHA3_shake128_stack_init(&c128);
+	OQS_SHA3_shake128_stack_absorb(&s128, in[0], 1);
+	OQS_SHA3_shake128_stack_absorb(&s128, in[0] + 1, 200);
+	OQS_SHA3_shake128_stack_ctx_clone(&c128, &s128);
+	OQS_SHA3_shake128_stack_absorb(&s128, in[0] + 201, 199);
+	OQS_SHA3_shake128_stack_finalize(&s128);
+	OQS_SHA3_shake128_stack_squeeze(out[0], 37, &s128);
+	OQS_SHA3_shake128_stack_squeeze(out[0] + 37, 463, &s128);
+	OQS_SHA3_shake128(exp, 500, in[0], 400);
+	if (are_equal8(out[0], exp, 500) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	OQS_SHA3_shake128_stack_finalize(&c128);
+	OQS_SHA3_shake128_stack_squeeze(out[1], 168, &c128);
+	OQS_SHA3_shake128(exp, 168, in[0], 201);
+	if (are_equal8(out[1], exp, 168) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	OQS_SHA3_shake128_stack_ctx_reset(&s128);
+	OQS_SHA3_shake128_stack_absorb(&s128, in[1], 168);
+	OQS_SHA3_shake128_stack_finalize(&s128);
+	OQS_SHA3_shake128_stack_squeeze(out[2], 169, &s128);
+	OQS_SHA3_shake128(exp, 169, in[1], 168);
+	if (are_equal8(out[2], exp, 169) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	OQS_SHA3_shake128_stack_ctx_release(&s128);
+	OQS_SHA3_shake128_stack_ctx_release(&c128);
+
+	OQS_SHA3_shake256_stack_ctx s256;
+	OQS_SHA3_shake256_stack_init(&s256);
+	OQS_SHA3_shake256_stack_absorb(&s256, in[2], 135);
+	OQS_SHA3_shake256_stack_absorb(&s256, in[2] + 135, 265);
+	OQS_SHA3_shake256_stack_finalize(&s256);
+	OQS_SHA3_shake256_stack_squeeze(out[0], 136, &s256);
+	OQS_SHA3_shake256_stack_squeeze(out[0] + 136, 364, &s256);
+	OQS_SHA3_shake256(exp, 500, in[2], 400);
+	if (are_equal8(out[0], exp, 500) == EXIT_FAILURE) {
+		status = EXIT_FAILURE;
+	}
+	OQS_SHA3_shake256_stack_ctx_release(&s256);
+
+	OQS_SHA3_shake128_x4_stack_ctx x128;
+	OQS_SHA3_shake128_x4_stack_init(&x128);
+	OQS_SHA3_shake128_x4_stack_absorb(&x128, in[0], in[1], in[2], in[3], 100);
+	OQS_SHA3_shake128_x4_stack_absorb(&x128, in[0] + 100, in[1] + 100, in[2] + 100, in[3] + 100, 300);
+	OQS_SHA3_shake128_x4_stack_finalize(&x128);
+	OQS_SHA3_shake128_x4_stack_squeeze(out[0], out[1], out[2], out[3], 200, &x128);
+	OQS_SHA3_shake128_x4_stack_squeeze(out[0] + 200, out[1] + 200, out[2] + 200, out[3] + 200, 300, &x128);
+	OQS_SHA3_shake128_x4_stack_ctx_release(&x128);
+	for (size_t j = 0; j < 4; j++) {
+		OQS_SHA3_shake128(exp, 500, in[j], 400);
+		if (are_equal8(out[j], exp, 500) == EXIT_FAILURE) {
+			status = EXIT_FAILURE;
+		}
+	}
+
+	OQS_SHA3_shake256_x4_stack_ctx x256, y256;
+	OQS_SHA3_shake256_x4_stack_init(&x256);
+	OQS_SHA3_shake256_x4_stack_init(&y256);
+	OQS_SHA3_shake256_x4_stack_absorb(&x256, in[0], in[1], in[2], in[3], 400);
+	OQS_SHA3_shake256_x4_stack_ctx_clone(&y256, &x256);
+	OQS_SHA3_shake256_x4_stack_ctx_reset(&x256);
+	OQS_SHA3_shake256_x4_stack_finalize(&y256);
+	OQS_SHA3_shake256_x4_stack_squeeze(out[0], out[1], out[2], out[3], 500, &y256);
+	OQS_SHA3_shake256_x4_stack_ctx_release(&x256);
+	OQS_SHA3_shake256_x4_stack_ctx_release(&y256);
+	for (size_t j = 0; j < 4; j++) {
+		OQS_SHA3_shake256(exp, 500, in[j], 400);
+		if (are_equal8(out[j], exp, 500) == EXIT_FAILURE) {
+			status = EXIT_FAILURE;
+		}
+	}
+
+	return status;
+}
+
 extern struct OQS_SHA3_callbacks sha3_default_callbacks;
 
 static void override_SHA3_sha3_256_inc_init(OQS_SHA3_sha3_256_inc_ctx *state) {
@@ -1115,6 +1263,21 @@ int main(UNUSED int argc, UNUSED char **argv) {
 		ret = EXIT_FAILURE;
 	}
 
+	/* with an overridden x4 callback, the eight-way functions fall back to it */
+	if (shake_x8_test(0) == EXIT_SUCCESS && shake_x8_test(1) == EXIT_SUCCESS) {
+		printf("Success! passed eight-way parallel shake tests using x4 callbacks \n");
+	} else {
+		printf("Failure! failed eight-way parallel shake tests using x4 callbacks \n");
+		ret = EXIT_FAILURE;
+	}
+
+	if (shake_stack_test() == EXIT_SUCCESS) {
+		printf("Success! passed caller-allocated shake tests using replaced callbacks \n");
+	} else {
+		printf("Failure! failed caller-allocated shake tests using replaced callbacks \n");
+		ret = EXIT_FAILURE;
+	}
+
 	if (!sha3_callback_called) {
 		printf("Failure! SHA3 callback was not called\n");
 		ret = EXIT_FAILURE;
@@ -1125,6 +1288,30 @@ int main(UNUSED int argc, UNUSED char **argv) {
 		ret = EXIT_FAILURE;
 	}
 
+	OQS_SHA3_set_callbacks(&sha3_default_callbacks);
+	OQS_SHA3_x4_set_callbacks(&sha3_x4_default_callbacks);
+
+	if (shake_stack_test() == EXIT_SUCCESS) {
+		printf("Success! passed caller-allocated shake tests \n");
+	} else {
+		printf("Failure! failed caller-allocated shake tests \n");
+		ret = EXIT_FAILURE;
+	}
+
+	if (shake_x8_test(0) == EXIT_SUCCESS) {
+		printf("Success! passed eight-way parallel shake-128 tests \n");
+	} else {
+		printf("Failure! failed eight-way parallel shake-128 tests \n");
+		ret = EXIT_FAILURE;
+	}
+
+	if (shake_x8_test(1) == EXIT_SUCCESS) {
+		printf("Success! passed eight-way parallel shake-256 tests \n");
+	} else {
+		printf("Failure! failed eight-way parallel shake-256 tests \n");
+		ret = EXIT_FAILURE;
+	}
+
 	OQS_destroy();
 
 
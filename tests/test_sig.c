@@ -4,11 +4,13 @@
 #pragma warning(disable : 4244 4293)
 #endif
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <oqs/oqs.h>
+#include <oqs/sha3.h>
 
 #if OQS_USE_PTHREADS
 #include <pthread.h>
@@ -29,6 +31,401 @@ typedef struct magic_s {
 	uint8_t val[31];
 } magic_t;
 
+/* Signs and verifies through OQS_SIG_SECRET_KEY and OQS_SIG_PUBLIC_KEY objects
+ * and checks them against regular signing and verification, with and without a
+ * context string. */
+static OQS_STATUS sig_test_prepared(OQS_SIG *sig, const uint8_t *public_key, const uint8_t *secret_key, const uint8_t *message, size_t message_len, const uint8_t *ctx, uint8_t *signature) {
+	OQS_SIG_SECRET_KEY *prepared_secret_key = NULL;
+	OQS_SIG_PUBLIC_KEY *prepared_public_key = NULL;
+	size_t signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	prepared_secret_key = OQS_SIG_SECRET_KEY_new(sig, secret_key);
+	if (prepared_secret_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_SECRET_KEY_new failed\n");
+		goto cleanup;
+	}
+	prepared_public_key = OQS_SIG_PUBLIC_KEY_new(sig, public_key);
+	if (prepared_public_key == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_PUBLIC_KEY_new failed\n");
+		goto cleanup;
+	}
+
+	/* Run twice per context length to check that the prepared keys are not modified by use;
+	 * the second run signs on several threads where the scheme supports it */
+	for (size_t i = 0; i < 4; i++) {
+		size_t ctx_len = (sig->sig_with_ctx_support && i >= 2) ? 255 : 0;
+		const uint8_t *ctx_str = ctx_len > 0 ? ctx : NULL;
+
+		OQS_SIG_SECRET_KEY_set_threads(prepared_secret_key, (i % 2 == 0) ? 1 : 4);
+		rc = OQS_SIG_sign_prepared(sig, signature, &signature_len, message, message_len, ctx_str, ctx_len, prepared_secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign_prepared failed\n");
+			goto cleanup;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		rc = OQS_SIG_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx_str, ctx_len, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_with_ctx_str failed on prepared key signature\n");
+			goto cleanup;
+		}
+		rc = OQS_SIG_verify_prepared(sig, message, message_len, signature, signature_len, ctx_str, ctx_len, prepared_public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_prepared failed\n");
+			goto cleanup;
+		}
+
+		/* modify the signature to invalidate it */
+		signature[0] ^= 1;
+		rc = OQS_SIG_verify_prepared(sig, message, message_len, signature, signature_len, ctx_str, ctx_len, prepared_public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_prepared should have failed!\n");
+			goto cleanup;
+		}
+	}
+
+	printf("prepared key signatures verify as expected\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_SECRET_KEY_free(prepared_secret_key);
+	OQS_SIG_PUBLIC_KEY_free(prepared_public_key);
+	return ret;
+}
+
+#ifndef OQS_ENABLE_TEST_CONSTANT_TIME
+/* Deterministic stand-in for OQS_randombytes: SHAKE256 of a call counter, so
+ * that a signing run can be repeated by resetting the counter. */
+static uint64_t fixed_randombytes_counter;
+
+static void fixed_randombytes(uint8_t *random_array, size_t bytes_to_read) {
+	uint8_t counter[8];
+	for (size_t i = 0; i < 8; i++) {
+		counter[i] = (uint8_t)(fixed_randombytes_counter >> (8 * i));
+	}
+	fixed_randombytes_counter++;
+	OQS_SHA3_shake256(random_array, bytes_to_read, counter, sizeof counter);
+}
+
+/* Checks that signing with a prepared secret key, on one and on four threads,
+ * outputs the same bytes as OQS_SIG_sign when all draw the same randomness. */
+static OQS_STATUS sig_test_prepared_deterministic(OQS_SIG *sig, const uint8_t *secret_key, const uint8_t *message, size_t message_len) {
+	OQS_SIG_SECRET_KEY *prepared_secret_key = NULL;
+	uint8_t *expected = NULL;
+	uint8_t *signature = NULL;
+	size_t expected_len, signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	if (sig->prepare_secret_key == NULL) {
+		return OQS_SUCCESS;
+	}
+
+	prepared_secret_key = OQS_SIG_SECRET_KEY_new(sig, secret_key);
+	expected = OQS_MEM_malloc(sig->length_signature);
+	signature = OQS_MEM_malloc(sig->length_signature);
+	if (prepared_secret_key == NULL || expected == NULL || signature == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc or OQS_SIG_SECRET_KEY_new failed\n");
+		goto cleanup;
+	}
+
+	OQS_randombytes_custom_algorithm(&fixed_randombytes);
+	fixed_randombytes_counter = 0;
+	rc = OQS_SIG_sign(sig, expected, &expected_len, message, message_len, secret_key);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign failed\n");
+		goto cleanup;
+	}
+	/* on one thread, and on several threads where the scheme supports it */
+	for (unsigned int num_threads = 1; num_threads <= 4; num_threads += 3) {
+		OQS_SIG_SECRET_KEY_set_threads(prepared_secret_key, num_threads);
+		fixed_randombytes_counter = 0;
+		rc = OQS_SIG_sign_prepared(sig, signature, &signature_len, message, message_len, NULL, 0, prepared_secret_key);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign_prepared failed\n");
+			goto cleanup;
+		}
+		if (signature_len != expected_len || memcmp(signature, expected, expected_len) != 0) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign_prepared on %u thread(s) differs from OQS_SIG_sign under the same randomness\n", num_threads);
+			goto cleanup;
+		}
+	}
+
+	printf("prepared key signatures match regular signatures\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_randombytes_switch_algorithm("system");
+	OQS_SIG_SECRET_KEY_free(prepared_secret_key);
+	OQS_MEM_insecure_free(expected);
+	OQS_MEM_insecure_free(signature);
+	return ret;
+}
+#endif
+
+/* Feeds the message to OQS_SIG_STREAM objects in uneven chunks and checks the
+ * result against regular signing and verification. */
+static OQS_STATUS sig_stream_update(const OQS_SIG *sig, OQS_SIG_STREAM *stream, bool signing, const uint8_t *message, size_t message_len) {
+	static const size_t chunk_lens[] = { 1, 0, 30, 7 };
+	size_t offset = 0;
+	OQS_STATUS rc;
+
+	for (size_t i = 0; offset < message_len; i++) {
+		size_t chunk_len = chunk_lens[i % 4];
+		if (chunk_len > message_len - offset) {
+			chunk_len = message_len - offset;
+		}
+		if (signing) {
+			rc = OQS_SIG_sign_update(sig, stream, message + offset, chunk_len);
+		} else {
+			rc = OQS_SIG_verify_update(sig, stream, message + offset, chunk_len);
+		}
+		if (rc != OQS_SUCCESS) {
+			return rc;
+		}
+		offset += chunk_len;
+	}
+	return OQS_SUCCESS;
+}
+
+static OQS_STATUS sig_test_stream(OQS_SIG *sig, const uint8_t *public_key, const uint8_t *secret_key, const uint8_t *message, size_t message_len, const uint8_t *ctx, uint8_t *signature) {
+	OQS_SIG_STREAM *stream = NULL;
+	size_t ctx_len = sig->sig_with_ctx_support ? 17 : 0;
+	const uint8_t *ctx_str = ctx_len > 0 ? ctx : NULL;
+	size_t signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	/* chunked signing, one-shot verification */
+	stream = OQS_SIG_sign_init(sig, ctx_str, ctx_len, secret_key);
+	if (stream == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_init failed\n");
+		goto cleanup;
+	}
+	rc = sig_stream_update(sig, stream, true, message, message_len);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_update failed\n");
+		goto cleanup;
+	}
+	rc = OQS_SIG_sign_final(sig, stream, signature, &signature_len);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_final failed\n");
+		goto cleanup;
+	}
+	if (OQS_SIG_sign_update(sig, stream, message, message_len) != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_update should fail after OQS_SIG_sign_final\n");
+		goto cleanup;
+	}
+	OQS_SIG_STREAM_free(stream);
+	stream = NULL;
+
+	OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	rc = OQS_SIG_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx_str, ctx_len, public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_with_ctx_str failed on streamed signature\n");
+		goto cleanup;
+	}
+
+	/* one-shot signing, chunked verification */
+	rc = OQS_SIG_sign_with_ctx_str(sig, signature, &signature_len, message, message_len, ctx_str, ctx_len, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_with_ctx_str failed\n");
+		goto cleanup;
+	}
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	stream = OQS_SIG_verify_init(sig, signature, signature_len, ctx_str, ctx_len, public_key);
+	if (stream == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_init failed\n");
+		goto cleanup;
+	}
+	rc = sig_stream_update(sig, stream, false, message, message_len);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_update failed\n");
+		goto cleanup;
+	}
+	rc = OQS_SIG_verify_final(sig, stream);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_final failed\n");
+		goto cleanup;
+	}
+	OQS_SIG_STREAM_free(stream);
+	stream = NULL;
+
+	/* a truncated message must not verify */
+	stream = OQS_SIG_verify_init(sig, signature, signature_len, ctx_str, ctx_len, public_key);
+	if (stream == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_init failed\n");
+		goto cleanup;
+	}
+	rc = sig_stream_update(sig, stream, false, message, message_len - 1);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_update failed\n");
+		goto cleanup;
+	}
+	rc = OQS_SIG_verify_final(sig, stream);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_final should have failed!\n");
+		goto cleanup;
+	}
+	OQS_SIG_STREAM_free(stream);
+	stream = NULL;
+
+	/* modify the signature to invalidate it; it may already be rejected by OQS_SIG_verify_init */
+	signature[signature_len - 1] ^= 1;
+	stream = OQS_SIG_verify_init(sig, signature, signature_len, ctx_str, ctx_len, public_key);
+	if (stream != NULL) {
+		rc = sig_stream_update(sig, stream, false, message, message_len);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_update failed\n");
+			goto cleanup;
+		}
+		rc = OQS_SIG_verify_final(sig, stream);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_final should have failed!\n");
+			goto cleanup;
+		}
+	}
+
+	printf("streamed signatures verify as expected\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_SIG_STREAM_free(stream);
+	return ret;
+}
+
+/* Checks signing and verification through an externally computed message
+ * representative mu against regular signing and verification. */
+static OQS_STATUS sig_test_external_mu(OQS_SIG *sig, const uint8_t *public_key, const uint8_t *secret_key, const uint8_t *message, size_t message_len, const uint8_t *ctx, uint8_t *signature) {
+	uint8_t *mu = NULL;
+	size_t signature_len;
+	OQS_STATUS rc, ret = OQS_ERROR;
+
+	mu = OQS_MEM_malloc(sig->length_mu);
+	if (mu == NULL) {
+		fprintf(stderr, "ERROR: OQS_MEM_malloc failed\n");
+		goto cleanup;
+	}
+	rc = OQS_SIG_compute_mu(sig, mu, message, message_len, ctx, 17, public_key);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_compute_mu failed\n");
+		goto cleanup;
+	}
+
+	rc = OQS_SIG_sign_mu(sig, signature, &signature_len, mu, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_mu failed\n");
+		goto cleanup;
+	}
+	OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	rc = OQS_SIG_verify_with_ctx_str(sig, message, message_len, signature, signature_len, ctx, 17, public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_with_ctx_str failed on external mu signature\n");
+		goto cleanup;
+	}
+
+	rc = OQS_SIG_sign_with_ctx_str(sig, signature, &signature_len, message, message_len, ctx, 17, secret_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_with_ctx_str failed\n");
+		goto cleanup;
+	}
+	OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+	rc = OQS_SIG_verify_mu(sig, mu, signature, signature_len, public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_SUCCESS) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_mu failed\n");
+		goto cleanup;
+	}
+
+	/* modify mu to invalidate the signature */
+	mu[0] ^= 1;
+	rc = OQS_SIG_verify_mu(sig, mu, signature, signature_len, public_key);
+	OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+	if (rc != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_verify_mu should have failed!\n");
+		goto cleanup;
+	}
+
+	printf("external mu signatures verify as expected\n");
+	ret = OQS_SUCCESS;
+
+cleanup:
+	OQS_MEM_insecure_free(mu);
+	return ret;
+}
+
+/* Signs and verifies digests with each pre-hash function, and checks that the
+ * signatures are bound to the pre-hash function and not valid for the message. */
+static OQS_STATUS sig_test_prehash(OQS_SIG *sig, const uint8_t *public_key, const uint8_t *secret_key, const uint8_t *message, size_t message_len, const uint8_t *ctx, uint8_t *signature) {
+	uint8_t digest[64];
+	size_t signature_len;
+	OQS_STATUS rc;
+
+	for (int i = OQS_SIG_PREHASH_SHA2_256; i <= OQS_SIG_PREHASH_SHAKE256; i++) {
+		OQS_SIG_PREHASH prehash = (OQS_SIG_PREHASH) i;
+		OQS_SIG_PREHASH other = (prehash == OQS_SIG_PREHASH_SHA2_256) ? OQS_SIG_PREHASH_SHA3_256 : OQS_SIG_PREHASH_SHA2_256;
+		size_t digest_len = OQS_SIG_prehash_length(prehash);
+
+		rc = OQS_SIG_prehash(prehash, digest, message, message_len);
+		if (rc != OQS_SUCCESS || digest_len == 0) {
+			fprintf(stderr, "ERROR: OQS_SIG_prehash failed\n");
+			return OQS_ERROR;
+		}
+		rc = OQS_SIG_sign_prehash(sig, signature, &signature_len, digest, digest_len, prehash, ctx, 17, secret_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_sign_prehash failed\n");
+			return OQS_ERROR;
+		}
+
+		OQS_TEST_CT_DECLASSIFY(public_key, sig->length_public_key);
+		OQS_TEST_CT_DECLASSIFY(signature, signature_len);
+		rc = OQS_SIG_verify_prehash(sig, digest, digest_len, prehash, signature, signature_len, ctx, 17, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_SUCCESS) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_prehash failed\n");
+			return OQS_ERROR;
+		}
+		if (digest_len == OQS_SIG_prehash_length(other)) {
+			rc = OQS_SIG_verify_prehash(sig, digest, digest_len, other, signature, signature_len, ctx, 17, public_key);
+			OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+			if (rc != OQS_ERROR) {
+				fprintf(stderr, "ERROR: OQS_SIG_verify_prehash should have failed for another pre-hash function!\n");
+				return OQS_ERROR;
+			}
+		}
+		rc = OQS_SIG_verify_with_ctx_str(sig, digest, digest_len, signature, signature_len, ctx, 17, public_key);
+		OQS_TEST_CT_DECLASSIFY(&rc, sizeof rc);
+		if (rc != OQS_ERROR) {
+			fprintf(stderr, "ERROR: OQS_SIG_verify_with_ctx_str should have failed on pre-hash signature!\n");
+			return OQS_ERROR;
+		}
+	}
+
+	if (OQS_SIG_sign_prehash(sig, signature, &signature_len, digest, 31, OQS_SIG_PREHASH_SHA2_256, NULL, 0, secret_key) != OQS_ERROR) {
+		fprintf(stderr, "ERROR: OQS_SIG_sign_prehash should reject a digest of the wrong length\n");
+		return OQS_ERROR;
+	}
+
+	printf("pre-hash signatures verify as expected\n");
+	return OQS_SUCCESS;
+}
+
 static OQS_STATUS sig_test_correctness(const char *method_name) {
 
 	OQS_SIG *sig = NULL;
@@ -189,6 +586,28 @@ static OQS_STATUS sig_test_correctness(const char *method_name) {
 		goto err;
 	}
 
+	if (sig_test_prepared(sig, public_key, secret_key, message, message_len, ctx, signature) != OQS_SUCCESS) {
+		goto err;
+	}
+
+#ifndef OQS_ENABLE_TEST_CONSTANT_TIME
+	if (sig_test_prepared_deterministic(sig, secret_key, message, message_len) != OQS_SUCCESS) {
+		goto err;
+	}
+#endif
+
+	if (sig_test_stream(sig, public_key, secret_key, message, message_len, ctx, signature) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	if (sig->length_mu > 0 && sig_test_external_mu(sig, public_key, secret_key, message, message_len, ctx, signature) != OQS_SUCCESS) {
+		goto err;
+	}
+
+	if (sig->sign_prehash != NULL && sig_test_prehash(sig, public_key, secret_key, message, message_len, ctx, signature) != OQS_SUCCESS) {
+		goto err;
+	}
+
 #ifndef OQS_ENABLE_TEST_CONSTANT_TIME
 	/* check magic values */
 	int rv = memcmp(public_key + sig->length_public_key, magic.val, sizeof(magic_t));
@@ -230,6 +649,51 @@ cleanup:
 	return ret;
 }
 
+/* Checks that OQS_SIG_get agrees with OQS_SIG_new and OQS_SIG_alg_is_enabled */
+static OQS_STATUS sig_test_registry(const char *method_name) {
+	char lower_name[128];
+	const OQS_SIG *desc;
+	OQS_SIG *sig;
+	size_t i;
+	OQS_STATUS ret = OQS_ERROR;
+
+	for (i = 0; i < OQS_SIG_algs_length; i++) {
+		const char *name = OQS_SIG_alg_identifier(i);
+		if ((OQS_SIG_get(name) != NULL) != (OQS_SIG_alg_is_enabled(name) != 0)) {
+			fprintf(stderr, "ERROR: OQS_SIG_get and OQS_SIG_alg_is_enabled disagree on %s\n", name);
+			return OQS_ERROR;
+		}
+	}
+	if (OQS_SIG_get("not-an-algorithm") != NULL || OQS_SIG_get(NULL) != NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_get accepted an invalid name\n");
+		return OQS_ERROR;
+	}
+
+	for (i = 0; method_name[i] != '\0' && i < sizeof(lower_name) - 1; i++) {
+		lower_name[i] = (char)tolower((unsigned char)method_name[i]);
+	}
+	lower_name[i] = '\0';
+	desc = OQS_SIG_get(method_name);
+	if (desc == NULL || OQS_SIG_get(lower_name) != desc) {
+		fprintf(stderr, "ERROR: OQS_SIG_get did not return the shared descriptor of %s\n", method_name);
+		return OQS_ERROR;
+	}
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		fprintf(stderr, "ERROR: OQS_SIG_new failed\n");
+		return OQS_ERROR;
+	}
+	if (strcmp(desc->method_name, sig->method_name) != 0 || desc->length_public_key != sig->length_public_key ||
+	        desc->length_secret_key != sig->length_secret_key || desc->keypair != sig->keypair) {
+		fprintf(stderr, "ERROR: the descriptor of %s differs from OQS_SIG_new\n", method_name);
+	} else {
+		ret = OQS_SUCCESS;
+	}
+	OQS_SIG_free(sig);
+	return ret;
+}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 static void TEST_SIG_randombytes(uint8_t *random_array, size_t bytes_to_read) {
 	// We can't make direct calls to the system randombytes on some platforms,
@@ -287,6 +751,11 @@ int main(int argc, char **argv) {
 		return EXIT_FAILURE;
 	}
 
+	if (sig_test_registry(alg_name) != OQS_SUCCESS) {
+		OQS_destroy();
+		return EXIT_FAILURE;
+	}
+
 #ifdef OQS_ENABLE_TEST_CONSTANT_TIME
 	OQS_randombytes_custom_algorithm(&TEST_SIG_randombytes);
 #else
@@ -359,6 +359,192 @@ cleanup:
 }
 #endif
 
+static bool prehash_from_name(const char *hash_name, OQS_SIG_PREHASH *prehash) {
+	static const struct {
+		const char *name;
+		OQS_SIG_PREHASH prehash;
+	} prehashes[] = {
+		{"SHA2-256", OQS_SIG_PREHASH_SHA2_256},
+		{"SHA2-384", OQS_SIG_PREHASH_SHA2_384},
+		{"SHA2-512", OQS_SIG_PREHASH_SHA2_512},
+		{"SHA3-256", OQS_SIG_PREHASH_SHA3_256},
+		{"SHA3-384", OQS_SIG_PREHASH_SHA3_384},
+		{"SHA3-512", OQS_SIG_PREHASH_SHA3_512},
+		{"SHAKE-128", OQS_SIG_PREHASH_SHAKE128},
+		{"SHAKE-256", OQS_SIG_PREHASH_SHAKE256},
+	};
+	for (size_t i = 0; i < sizeof(prehashes) / sizeof(prehashes[0]); i++) {
+		if (!strcmp(hash_name, prehashes[i].name)) {
+			*prehash = prehashes[i].prehash;
+			return true;
+		}
+	}
+	return false;
+}
+
+/* HashML-DSA through the public pre-hash API: sign the digest of the message, then verify it */
+static int sig_gen_prehash_vector(const char *method_name,
+                                  uint8_t *prng_output_stream,
+                                  const uint8_t *sigGen_pk, const uint8_t *sigGen_sk,
+                                  const uint8_t *sigGen_msg, size_t sigGen_msgLen,
+                                  const uint8_t *sigGen_ctx, size_t sigGen_ctxLen,
+                                  OQS_SIG_PREHASH prehash, const uint8_t *sigGen_sig) {
+
+	FILE *fh = NULL;
+	uint8_t *signature = NULL;
+	uint8_t digest[64];
+	OQS_SIG *sig = NULL;
+	int ret = -1;
+	size_t sigLen;
+	size_t digestLen = OQS_SIG_prehash_length(prehash);
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		printf("[vectors_sig] %s was not enabled at compile-time.\n", method_name);
+		goto algo_not_enabled;
+	}
+
+	sigLen = sig->length_signature;
+
+	fh = stdout;
+
+	signature = OQS_MEM_malloc(sigLen);
+
+	if (signature == NULL) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_MEM_malloc failed!\n", method_name);
+		goto err;
+	}
+
+	if ((prng_output_stream == NULL) || (sigGen_pk == NULL) || (sigGen_sk == NULL) || (sigGen_msg == NULL) || (sigGen_sig == NULL)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: inputs NULL!\n", method_name);
+		goto err;
+	}
+
+	if (digestLen == 0 || digestLen > sizeof(digest) || OQS_SIG_prehash(prehash, digest, sigGen_msg, sigGen_msgLen) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_prehash failed!\n", method_name);
+		goto err;
+	}
+
+	OQS_randombytes_custom_algorithm(&MLDSA_randombytes);
+	MLDSA_randombytes_init(prng_output_stream, NULL);
+
+	if (OQS_SIG_sign_prehash(sig, signature, &sigLen, digest, digestLen, prehash, sigGen_ctx, sigGen_ctxLen, sigGen_sk) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_sign_prehash failed!\n", method_name);
+		goto err;
+	}
+	fprintBstr(fh, "signature: ", signature, sigLen);
+
+	if (sigLen != sig->length_signature || memcmp(signature, sigGen_sig, sigLen)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: signature doesn't match!\n", method_name);
+		goto err;
+	}
+
+	if (OQS_SIG_verify_prehash(sig, digest, digestLen, prehash, sigGen_sig, sig->length_signature, sigGen_ctx, sigGen_ctxLen, sigGen_pk) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_verify_prehash failed!\n", method_name);
+		goto err;
+	}
+	ret = EXIT_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = EXIT_FAILURE;
+	goto cleanup;
+
+algo_not_enabled:
+	ret = EXIT_SUCCESS;
+
+cleanup:
+	MLDSA_randombytes_free();
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+	return ret;
+}
+
+/* External-mu ML-DSA: check the message representative, sign it, then verify it */
+static int sig_gen_mu_vector(const char *method_name,
+                             uint8_t *prng_output_stream,
+                             const uint8_t *sigGen_pk, const uint8_t *sigGen_sk,
+                             const uint8_t *sigGen_msg, size_t sigGen_msgLen,
+                             const uint8_t *sigGen_ctx, size_t sigGen_ctxLen,
+                             const uint8_t *sigGen_mu, const uint8_t *sigGen_sig) {
+
+	FILE *fh = NULL;
+	uint8_t *signature = NULL;
+	uint8_t *mu = NULL;
+	OQS_SIG *sig = NULL;
+	int ret = -1;
+	size_t sigLen;
+
+	sig = OQS_SIG_new(method_name);
+	if (sig == NULL) {
+		printf("[vectors_sig] %s was not enabled at compile-time.\n", method_name);
+		goto algo_not_enabled;
+	}
+
+	sigLen = sig->length_signature;
+
+	fh = stdout;
+
+	signature = OQS_MEM_malloc(sigLen);
+	mu = OQS_MEM_malloc(sig->length_mu);
+
+	if ((signature == NULL) || (mu == NULL)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_MEM_malloc failed!\n", method_name);
+		goto err;
+	}
+
+	if ((prng_output_stream == NULL) || (sigGen_pk == NULL) || (sigGen_sk == NULL) || (sigGen_msg == NULL) || (sigGen_mu == NULL) || (sigGen_sig == NULL)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: inputs NULL!\n", method_name);
+		goto err;
+	}
+
+	if (OQS_SIG_compute_mu(sig, mu, sigGen_msg, sigGen_msgLen, sigGen_ctx, sigGen_ctxLen, sigGen_pk) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_compute_mu failed!\n", method_name);
+		goto err;
+	}
+	fprintBstr(fh, "mu: ", mu, sig->length_mu);
+
+	if (memcmp(mu, sigGen_mu, sig->length_mu)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: mu doesn't match!\n", method_name);
+		goto err;
+	}
+
+	OQS_randombytes_custom_algorithm(&MLDSA_randombytes);
+	MLDSA_randombytes_init(prng_output_stream, NULL);
+
+	if (OQS_SIG_sign_mu(sig, signature, &sigLen, sigGen_mu, sigGen_sk) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_sign_mu failed!\n", method_name);
+		goto err;
+	}
+	fprintBstr(fh, "signature: ", signature, sigLen);
+
+	if (sigLen != sig->length_signature || memcmp(signature, sigGen_sig, sigLen)) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: signature doesn't match!\n", method_name);
+		goto err;
+	}
+
+	if (OQS_SIG_verify_mu(sig, sigGen_mu, sigGen_sig, sig->length_signature, sigGen_pk) != OQS_SUCCESS) {
+		fprintf(stderr, "[vectors_sig] %s ERROR: OQS_SIG_verify_mu failed!\n", method_name);
+		goto err;
+	}
+	ret = EXIT_SUCCESS;
+	goto cleanup;
+
+err:
+	ret = EXIT_FAILURE;
+	goto cleanup;
+
+algo_not_enabled:
+	ret = EXIT_SUCCESS;
+
+cleanup:
+	MLDSA_randombytes_free();
+	OQS_MEM_insecure_free(mu);
+	OQS_MEM_insecure_free(signature);
+	OQS_SIG_free(sig);
+	return ret;
+}
+
 
 
 int main(int argc, char **argv) {
@@ -373,8 +559,12 @@ int main(int argc, char **argv) {
 	char *kg_pk;
 	char *kg_sk;
 
+	char *sigGen_pk;
 	char *sigGen_sk;
 	char *sigGen_msg;
+	char *sigGen_ctx;
+	char *sigGen_hashAlg = NULL;
+	char *sigGen_mu = NULL;
 	char *sigGen_sig;
 
 	char *sigVer_pk;
@@ -385,8 +575,10 @@ int main(int argc, char **argv) {
 	uint8_t *kg_pk_bytes = NULL;
 	uint8_t *kg_sk_bytes = NULL;
 
+	uint8_t *sigGen_pk_bytes = NULL;
 	uint8_t *sigGen_sk_bytes = NULL;
 	uint8_t *sigGen_msg_bytes = NULL;
+	uint8_t *sigGen_mu_bytes = NULL;
 	uint8_t *sigGen_sig_bytes = NULL;
 
 
@@ -502,6 +694,79 @@ int main(int argc, char **argv) {
 		goto cleanup;
 #endif
 
+	} else if (!strcmp(test_name, "sigGen_preHash") || !strcmp(test_name, "sigGen_externalMu")) {
+		int external_mu = !strcmp(test_name, "sigGen_externalMu");
+		OQS_SIG_PREHASH prehash = OQS_SIG_PREHASH_SHA2_512;
+		uint8_t sigGen_ctx_bytes[255];
+		size_t ctxLen;
+
+		if (argc != 10) {
+			valid_args = false;
+			goto err;
+		}
+		sigGen_pk = argv[3];
+		sigGen_sk = argv[4];
+		sigGen_msg = argv[5];
+		sigGen_ctx = argv[6];
+		if (external_mu) {
+			sigGen_mu = argv[7];
+		} else {
+			sigGen_hashAlg = argv[7];
+		}
+		sigGen_sig = argv[8];
+		prng_output_stream = argv[9];
+
+		if (strlen(sigGen_pk) != 2 * sig->length_public_key ||
+		        strlen(sigGen_sk) != 2 * sig->length_secret_key ||
+		        strlen(sigGen_msg) % 2 != 0 ||
+		        strlen(sigGen_ctx) % 2 != 0 || strlen(sigGen_ctx) > 2 * sizeof(sigGen_ctx_bytes) ||
+		        strlen(sigGen_sig) != 2 * sig->length_signature ||
+		        strlen(prng_output_stream) != 2 * RNDBYTES) {
+			printf("lengths bad\n");
+			goto err;
+		}
+		if (external_mu) {
+			if (strlen(sigGen_mu) != 2 * sig->length_mu) {
+				printf("lengths bad\n");
+				goto err;
+			}
+		} else if (!prehash_from_name(sigGen_hashAlg, &prehash)) {
+			printf("[vectors_sig] unsupported hash function %s\n", sigGen_hashAlg);
+			goto err;
+		}
+
+		msgLen = strlen(sigGen_msg) / 2;
+		ctxLen = strlen(sigGen_ctx) / 2;
+
+		prng_output_stream_bytes = OQS_MEM_malloc(RNDBYTES);
+		sigGen_pk_bytes = OQS_MEM_malloc(sig->length_public_key);
+		sigGen_sk_bytes = OQS_MEM_malloc(sig->length_secret_key);
+		sigGen_msg_bytes = OQS_MEM_malloc(msgLen);
+		sigGen_sig_bytes = OQS_MEM_malloc(sig->length_signature);
+		if (external_mu) {
+			sigGen_mu_bytes = OQS_MEM_malloc(sig->length_mu);
+		}
+
+		if ((prng_output_stream_bytes == NULL) || (sigGen_pk_bytes == NULL) || (sigGen_sk_bytes == NULL) ||
+		        (sigGen_msg_bytes == NULL) || (sigGen_sig_bytes == NULL) || (external_mu && sigGen_mu_bytes == NULL)) {
+			fprintf(stderr, "[vectors_sig] ERROR: OQS_MEM_malloc failed!\n");
+			goto err;
+		}
+
+		hexStringToByteArray(prng_output_stream, prng_output_stream_bytes);
+		hexStringToByteArray(sigGen_pk, sigGen_pk_bytes);
+		hexStringToByteArray(sigGen_sk, sigGen_sk_bytes);
+		hexStringToByteArray(sigGen_msg, sigGen_msg_bytes);
+		hexStringToByteArray(sigGen_ctx, sigGen_ctx_bytes);
+		hexStringToByteArray(sigGen_sig, sigGen_sig_bytes);
+
+		if (external_mu) {
+			hexStringToByteArray(sigGen_mu, sigGen_mu_bytes);
+			rc = sig_gen_mu_vector(alg_name, prng_output_stream_bytes, sigGen_pk_bytes, sigGen_sk_bytes, sigGen_msg_bytes, msgLen, sigGen_ctx_bytes, ctxLen, sigGen_mu_bytes, sigGen_sig_bytes);
+		} else {
+			rc = sig_gen_prehash_vector(alg_name, prng_output_stream_bytes, sigGen_pk_bytes, sigGen_sk_bytes, sigGen_msg_bytes, msgLen, sigGen_ctx_bytes, ctxLen, prehash, sigGen_sig_bytes);
+		}
+
 	} else if (!strcmp(test_name, "sigVer")) {
 		if (argc != 7) {
 			valid_args = false;
@@ -544,7 +809,7 @@ int main(int argc, char **argv) {
 #endif
 
 	} else {
-		printf("[vectors_sig] %s only keyGen/sigGen/sigVer supported!\n", alg_name);
+		printf("[vectors_sig] %s only keyGen/sigGen/sigGen_preHash/sigGen_externalMu/sigVer supported!\n", alg_name);
 		goto err;
 	}
 	goto cleanup;
@@ -565,8 +830,10 @@ cleanup:
 	OQS_MEM_insecure_free(sigVer_pk_bytes);
 	OQS_MEM_insecure_free(sigVer_msg_bytes);
 	OQS_MEM_insecure_free(sigVer_sig_bytes);
+	OQS_MEM_insecure_free(sigGen_pk_bytes);
 	OQS_MEM_insecure_free(sigGen_sk_bytes);
 	OQS_MEM_insecure_free(sigGen_msg_bytes);
+	OQS_MEM_insecure_free(sigGen_mu_bytes);
 	OQS_MEM_insecure_free(sigGen_sig_bytes);
 	OQS_SIG_free(sig);
 	OQS_destroy();